@@ -16,7 +16,7 @@
 // other, from this software.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-// This file was generated Fri Dec 19 03:54:31 PM MST 2025
+// This file was generated Sat Oct 17 21:55:35 UTC 2026
 
 #ifndef CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT_HPP
 #define CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT_HPP
@@ -27,7 +27,8 @@
 #define CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT 1000
 #endif
 
-namespace cljonic {
+namespace cljonic
+{
 
 using SizeType = std::size_t;
 
@@ -36,56 +37,131 @@ constexpr auto CljonicCollectionMaximumElementCount{static_cast<SizeType>(CLJONI
 } // namespace cljonic
 
 #endif // CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT_HPP
+#include <compare>
+#include <cstddef>
 
-namespace cljonic {
+namespace cljonic
+{
 
 template <typename T>
-class CollectionIterator {
-const T& m_collection;
+class CollectionIterator
+{
+const T* m_collection;
 SizeType m_index;
 
 public:
+using value_type = typename T::value_type;
+using difference_type = std::ptrdiff_t;
+using reference = value_type;
+
+constexpr CollectionIterator() noexcept : m_collection(nullptr), m_index(0)
+{
+}
+
 constexpr CollectionIterator(const T& collection, const SizeType index) noexcept
-    : m_collection(collection), m_index(index) {
+: m_collection(&collection), m_index(index)
+{
+}
+
+[[nodiscard]] constexpr reference operator*() const noexcept
+{
+return (*m_collection)[m_index];
 }
 
-[[nodiscard]] constexpr auto operator*() const noexcept -> decltype(m_collection[m_index]) {
-return m_collection[m_index];
+[[nodiscard]] constexpr reference operator[](const difference_type n) const noexcept
+{
+return (*m_collection)[static_cast<SizeType>(static_cast<difference_type>(m_index) + n)];
 }
 
-constexpr CollectionIterator& operator++() noexcept {
+constexpr CollectionIterator& operator++() noexcept
+{
 ++m_index;
 return *this;
 }
 
-[[nodiscard]] constexpr bool operator!=(const CollectionIterator& other) const noexcept {
-return m_index != other.m_index;
+constexpr CollectionIterator operator++(int) noexcept
+{
+CollectionIterator temp = *this;
+++m_index;
+return temp;
 }
 
-constexpr CollectionIterator& operator+=(int value) noexcept {
-m_index += value;
+constexpr CollectionIterator& operator--() noexcept
+{
+--m_index;
 return *this;
 }
 
-[[nodiscard]] constexpr CollectionIterator operator+(int value) const noexcept {
+constexpr CollectionIterator operator--(int) noexcept
+{
 CollectionIterator temp = *this;
-temp += value;
+--m_index;
+return temp;
+}
+
+constexpr CollectionIterator& operator+=(const difference_type n) noexcept
+{
+m_index = static_cast<SizeType>(static_cast<difference_type>(m_index) + n);
+return *this;
+}
+
+constexpr CollectionIterator& operator-=(const difference_type n) noexcept
+{
+return *this += -n;
+}
+
+[[nodiscard]] constexpr CollectionIterator operator+(const difference_type n) const noexcept
+{
+CollectionIterator temp = *this;
+temp += n;
+return temp;
+}
+
+[[nodiscard]] friend constexpr CollectionIterator operator+(const difference_type n,
+const CollectionIterator& it) noexcept
+{
+return it + n;
+}
+
+[[nodiscard]] constexpr CollectionIterator operator-(const difference_type n) const noexcept
+{
+CollectionIterator temp = *this;
+temp -= n;
 return temp;
 }
+
+[[nodiscard]] constexpr difference_type operator-(const CollectionIterator& other) const noexcept
+{
+return static_cast<difference_type>(m_index) - static_cast<difference_type>(other.m_index);
+}
+
+[[nodiscard]] constexpr bool operator==(const CollectionIterator& other) const noexcept
+{
+return m_index == other.m_index;
+}
+
+[[nodiscard]] constexpr std::strong_ordering operator<=>(const CollectionIterator& other) const noexcept
+{
+return m_index <=> other.m_index;
+}
 };
 
-} // namespace cljonic
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-enum class CljonicCollectionType {
-    Array,
-    Cycle,
-    Iterator,
-    Range,
-    Repeat,
-    Set,
-    String
+enum class CljonicCollectionType
+{
+Array,
+Cycle,
+HashMap,
+Iterator,
+Range,
+Repeat,
+Set,
+String,
+View
 };
 
 }
@@ -94,7 +170,8 @@ enum class CljonicCollectionType {
 #include <limits>
 #include <type_traits>
 
-namespace cljonic {
+namespace cljonic
+{
 
 template <typename T>
 concept IsArithmetic = std::integral<T> or std::floating_point<T>;
@@ -109,36 +186,67 @@ concept IsBinaryPredicateForAll = (IsBinaryPredicate<P, T, Ts> && ...);
 
 template <typename T>
 concept IsCljonicArray = std::same_as<typename T::cljonic_collection_type,
-                                      std::integral_constant<CljonicCollectionType, CljonicCollectionType::Array>>;
+std::integral_constant<CljonicCollectionType, CljonicCollectionType::Array>>;
 
 template <typename T>
 concept IsCljonicCollection = requires { typename T::cljonic_collection_type; };
 
+template <typename T>
+concept IsCljonicCycle = std::same_as<typename T::cljonic_collection_type,
+std::integral_constant<CljonicCollectionType, CljonicCollectionType::Cycle>>;
+
+template <typename T>
+concept IsCljonicIndexable =
+requires(const T& t, const SizeType index, const typename T::value_type& element) {
+{ t.Count() } -> std::convertible_to<SizeType>;
+{ t[index] } -> std::convertible_to<typename T::value_type>;
+{ t.ElementAtIndexIsEqualToElement(index, element) } -> std::convertible_to<bool>;
+};
+
+template <typename T>
+concept IsCljonicHashMap = std::same_as<typename T::cljonic_collection_type,
+std::integral_constant<CljonicCollectionType, CljonicCollectionType::HashMap>>;
+
 template <typename T>
 concept IsCljonicIterator =
-    std::same_as<typename T::cljonic_collection_type,
-                 std::integral_constant<CljonicCollectionType, CljonicCollectionType::Iterator>>;
+std::same_as<typename T::cljonic_collection_type,
+std::integral_constant<CljonicCollectionType, CljonicCollectionType::Iterator>>;
 
 template <typename T>
 concept IsCljonicRange = std::same_as<typename T::cljonic_collection_type,
-                                      std::integral_constant<CljonicCollectionType, CljonicCollectionType::Range>>;
+std::integral_constant<CljonicCollectionType, CljonicCollectionType::Range>>;
 
 template <typename T>
 concept IsCljonicRepeat = std::same_as<typename T::cljonic_collection_type,
-                                       std::integral_constant<CljonicCollectionType, CljonicCollectionType::Repeat>>;
+std::integral_constant<CljonicCollectionType, CljonicCollectionType::Repeat>>;
 
 template <typename T>
 concept IsCljonicSet = std::same_as<typename T::cljonic_collection_type,
-                                    std::integral_constant<CljonicCollectionType, CljonicCollectionType::Set>>;
+std::integral_constant<CljonicCollectionType, CljonicCollectionType::Set>>;
+
+template <typename T>
+concept IsCljonicSortedSet = IsCljonicSet<T> and requires { typename T::cljonic_sorted_set; };
+
+template <typename T>
+concept IsCljonicView = std::same_as<typename T::cljonic_collection_type,
+std::integral_constant<CljonicCollectionType, CljonicCollectionType::View>>;
 
 template <typename T>
-concept IsCljonicArrayRangeOrRepeat = IsCljonicArray<T> or IsCljonicRange<T> or IsCljonicRepeat<T>;
+concept IsCljonicArrayRangeRepeatOrView =
+IsCljonicArray<T> or IsCljonicRange<T> or IsCljonicRepeat<T> or IsCljonicView<T>;
 
 template <typename T>
-concept IsConvertibleToIntegral = std::convertible_to<T, char> or std::convertible_to<T, short> or std::convertible_to<T, int> or std::convertible_to<T, long> or std::convertible_to<T, long long>;
+concept IsConvertibleToIntegral = std::convertible_to<T, char>
+or std::convertible_to<T, short>
+or std::convertible_to<T, int>
+or std::convertible_to<T, long>
+or std::convertible_to<T, long long>;
 template <typename T>
 concept IsCString = std::same_as<std::decay_t<T>, char*> or std::same_as<std::decay_t<T>, const char*>;
 
+template <typename T>
+concept IsHashable = std::integral<T> or std::is_enum_v<T> or IsCString<T>;
+
 template <typename T>
 concept IsNotCljonicCollection = not IsCljonicCollection<T>;
 
@@ -153,7 +261,8 @@ concept IsUnaryPredicate = requires(P p, T t) {
 };
 
 template <typename T, typename... Ts>
-concept AllCljonicArrayRangeOrRepeat = (IsCljonicArrayRangeOrRepeat<T> and ... and IsCljonicArrayRangeOrRepeat<Ts>);
+concept AllCljonicArrayRangeRepeatOrView =
+(IsCljonicArrayRangeRepeatOrView<T> and ... and IsCljonicArrayRangeRepeatOrView<Ts>);
 
 template <typename T, typename... Ts>
 concept AllCljonicCollections = (IsCljonicCollection<T> and ... and IsCljonicCollection<Ts>);
@@ -172,7 +281,7 @@ concept AllEqualityComparableTypes = (std::equality_comparable_with<T, Ts> && ..
 
 template <typename T, typename... Ts>
 concept AllEqualityComparableValueTypes =
-    (std::equality_comparable_with<typename T::value_type, typename Ts::value_type> && ...);
+(std::equality_comparable_with<typename T::value_type, typename Ts::value_type> && ...);
 
 template <typename T, typename... Ts>
 concept AnyFloatingPointTypes = (std::floating_point<T> || ... || std::floating_point<Ts>);
@@ -182,19 +291,19 @@ concept AllNotCljonicCollections = (IsNotCljonicCollection<T> and ... and IsNotC
 
 template <typename T, typename... Ts>
 concept AllSameCljonicCollectionType =
-    (std::same_as<typename T::cljonic_collection_type, typename Ts::cljonic_collection_type> and ...);
+(std::same_as<typename T::cljonic_collection_type, typename Ts::cljonic_collection_type> and ...);
 
 template <typename T, typename... Ts>
 concept AnyFloatingPointValueTypes =
-    (std::floating_point<typename T::value_type> || ... || std::floating_point<typename Ts::value_type>);
+(std::floating_point<typename T::value_type> || ... || std::floating_point<typename Ts::value_type>);
 
 template <typename T>
 concept ValidCljonicContainerElementType =
-    std::is_nothrow_copy_constructible_v<T> and
-    std::is_nothrow_move_constructible_v<T> and
-    std::is_nothrow_copy_assignable_v<T> and
-    std::is_nothrow_move_assignable_v<T> and
-    std::is_nothrow_destructible_v<T>;
+std::is_nothrow_copy_constructible_v<T> and
+std::is_nothrow_move_constructible_v<T> and
+std::is_nothrow_copy_assignable_v<T> and
+std::is_nothrow_move_assignable_v<T> and
+std::is_nothrow_destructible_v<T>;
 
 template <typename T, typename... Ts>
 using FindCommonType = std::common_type_t<T, Ts...>;
@@ -204,124 +313,478 @@ using FindCommonValueType = std::common_type_t<typename T::value_type, typename
 
 template <typename F, IsCljonicCollection T, IsCljonicCollection... Ts>
 constexpr bool IsBinaryPredicateForAllCljonicCollections =
-    (IsBinaryPredicateForAll<F, typename T::value_type, typename Ts::value_type> and ...);
+(IsBinaryPredicateForAll<F, typename T::value_type, typename Ts::value_type> and ...);
 
-} // namespace cljonic
+}
 
 #include <concepts>
+#include <cstdint>
 #include <cstring>
 #include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace cljonic
+{
+
+constexpr auto CLJONIC_INVALID_INDEX{std::numeric_limits<SizeType>::max()};
 
-namespace cljonic {
+template <typename C>
+concept IsContiguousCollection =
+IsCljonicCollection<C> and std::is_pointer_v<decltype(std::declval<const C&>().begin())>;
+
+template <typename C>
+concept IsRandomAccessCollection =
+IsCljonicCollection<C> and requires(const C& c) { c.begin()[SizeType{0}]; };
+
+template <typename C>
+concept IsContiguousCycle =
+IsCljonicCycle<C> and IsContiguousCollection<typename C::collection_type>;
 
 template <typename T>
-class IndexInterface {
-public:
-virtual constexpr SizeType Count() const noexcept = 0;
-virtual constexpr T operator[](const SizeType index) const noexcept = 0;
-virtual constexpr bool ElementAtIndexIsEqualToElement(const SizeType index, const T& element) const noexcept = 0;
-};
+concept IsBytewiseComparable = (std::integral<T> or std::is_enum_v<T>) and std::has_unique_object_representations_v<T>;
 
-constexpr auto CLJONIC_INVALID_INDEX{std::numeric_limits<SizeType>::max()};
+template <typename T, typename U>
+concept AreBytewiseComparableCollections =
+IsContiguousCollection<T> and IsContiguousCollection<U> and
+std::same_as<typename T::value_type, typename U::value_type> and IsBytewiseComparable<typename T::value_type>;
+
+template <typename T>
+[[nodiscard]] constexpr bool ElementsAreEqual(const T* t, const T* u, const SizeType count) noexcept
+{
+if constexpr (IsBytewiseComparable<T>)
+if (not std::is_constant_evaluated())
+return 0 == std::memcmp(t, u, count * sizeof(T));
+auto result{true};
+for (SizeType i{0}; (result and (i < count)); ++i)
+result = (t[i] == u[i]);
+return result;
+}
+
+template <typename T>
+constexpr void CopyElements(T* destination, const T* source, const SizeType count) noexcept
+{
+if constexpr (std::is_trivially_copyable_v<T>)
+{
+if (not std::is_constant_evaluated())
+{
+std::memcpy(destination, source, count * sizeof(T));
+return;
+}
+}
+for (SizeType i{0}; i < count; ++i)
+destination[i] = source[i];
+}
+
+template <typename T, typename U>
+concept AreIteratedCollections = IsCljonicCollection<T> and IsCljonicCollection<U> and
+not(IsRandomAccessCollection<T> and IsRandomAccessCollection<U>);
+
+template <typename F, typename T, typename U>
+[[nodiscard]] constexpr bool ElementsAreEqualBy(F&& f, const T& t, const U& u) noexcept
+{
+auto tIt{t.begin()};
+auto uIt{u.begin()};
+const auto tEnd{t.end()};
+const auto uEnd{u.end()};
+for (; ((tIt != tEnd) and (uIt != uEnd)); ++tIt, ++uIt)
+if (not f(*tIt, *uIt))
+return false;
+return (not(tIt != tEnd)) and (not(uIt != uEnd));
+}
 
 template <typename F, typename T, typename U>
-[[nodiscard]] constexpr bool AreEqualBy(F&& f, const T& t, const U& u) noexcept {
+[[nodiscard]] constexpr bool AreEqualBy(F&& f, const T& t, const U& u) noexcept
+{
 
-if constexpr(IsCljonicSet<T> or IsCljonicSet<U>) {
+if constexpr (IsCljonicSet<T> or IsCljonicSet<U>)
+{
 auto result{t.Count() == u.Count()};
-for(SizeType i{0}; (result and (i < t.Count())); ++i)
+for (SizeType i{0}; (result and (i < t.Count())); ++i)
 result = t.ContainsBy(f, u[i]);
 return result;
-} else if constexpr(IsCljonicCollection<T> or IsCljonicCollection<U>) {
+}
+else if constexpr (AreIteratedCollections<T, U>)
+{
+return ElementsAreEqualBy(f, t, u);
+}
+else if constexpr (IsCljonicCollection<T> or IsCljonicCollection<U>)
+{
 auto result{t.Count() == u.Count()};
-for(SizeType i{0}; (result and (i < t.Count())); ++i)
+for (SizeType i{0}; (result and (i < t.Count())); ++i)
 result = f(t[i], u[i]);
 return result;
-} else {
+}
+else
+{
 return f(t, u);
 }
 }
 
 template <typename T, typename U>
-[[nodiscard]] constexpr bool AreEqual(const T& t, const U& u) noexcept {
+[[nodiscard]] constexpr bool AreEqual(const T& t, const U& u) noexcept
+{
 
-if constexpr(IsCString<T> and IsCString<U>) {
+if constexpr (IsCString<T> and IsCString<U>)
+{
 return std::strcmp(t, u) == 0;
-} else if constexpr(IsCljonicSet<T> or IsCljonicSet<U>) {
+}
+else if constexpr (IsCljonicHashMap<T> and IsCljonicHashMap<U>)
+{
+
+auto result{t.Count() == u.Count()};
+for (SizeType i{0}; (result and (i < u.Count())); ++i)
+{
+const auto entry{u[i]};
+result = t.ContainsKey(entry.first) and AreEqual(t.Get(entry.first), entry.second);
+}
+return result;
+}
+else if constexpr (IsCljonicSortedSet<T> and IsCljonicSortedSet<U>)
+{
+
+auto result{t.Count() == u.Count()};
+for (SizeType i{0}; (result and (i < t.Count())); ++i)
+result = AreEqual(t[i], u[i]);
+return result;
+}
+else if constexpr (IsCljonicSet<T> or IsCljonicSet<U>)
+{
 auto result{t.Count() == u.Count()};
-for(SizeType i{0}; (result and (i < t.Count())); ++i)
+for (SizeType i{0}; (result and (i < t.Count())); ++i)
 result = t.Contains(u[i]);
 return result;
-} else if constexpr(IsCljonicCollection<T> or IsCljonicCollection<U>) {
+}
+else if constexpr (IsCljonicRange<T> and IsCljonicRange<U>)
+{
+
+return (t.Count() == u.Count()) and (t[0] == u[0]) and (t[1] == u[1]);
+}
+else if constexpr (IsCljonicRepeat<T> and IsCljonicRepeat<U>)
+{
+
+return (t.Count() == u.Count()) and ((0 == t.Count()) or AreEqual(t.At(0), u.At(0)));
+}
+else if constexpr (AreBytewiseComparableCollections<T, U>)
+{
+return (t.Count() == u.Count()) and ElementsAreEqual(t.begin(), u.begin(), t.Count());
+}
+else if constexpr (AreIteratedCollections<T, U>)
+{
+return ElementsAreEqualBy([](const auto& a, const auto& b) { return AreEqual(a, b); }, t, u);
+}
+else if constexpr (IsCljonicCollection<T> or IsCljonicCollection<U>)
+{
 auto result{t.Count() == u.Count()};
-for(SizeType i{0}; (result and (i < t.Count())); ++i)
+for (SizeType i{0}; (result and (i < t.Count())); ++i)
 result = AreEqual(t[i], u[i]);
 return result;
-} else {
+}
+else
+{
 return t == u;
 }
 }
 
 template <typename T, typename U>
-[[nodiscard]] constexpr bool FirstLessThanSecond(const T& t, const U& u) noexcept {
-if constexpr(IsCString<T> and IsCString<U>) {
+[[nodiscard]] constexpr bool FirstLessThanSecond(const T& t, const U& u) noexcept
+{
+if constexpr (IsCString<T> and IsCString<U>)
+{
 return std::strcmp(t, u) < 0;
-} else {
+}
+else
+{
 return t < u;
 }
 }
 
+template <typename T>
+[[nodiscard]] constexpr SizeType HashValue(const T& t) noexcept
+{
+if constexpr (IsCString<T>)
+{
+auto result{static_cast<std::uint64_t>(14695981039346656037ull)};
+for (SizeType i{0}; '\0' != t[i]; ++i)
+result = (result ^ static_cast<unsigned char>(t[i])) * 1099511628211ull;
+return static_cast<SizeType>(result);
+}
+else if constexpr (std::is_enum_v<T>)
+{
+return HashValue(static_cast<std::underlying_type_t<T>>(t));
+}
+else
+{
+auto result{static_cast<std::uint64_t>(t)};
+result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ull;
+result = (result ^ (result >> 27)) * 0x94d049bb133111ebull;
+return static_cast<SizeType>(result ^ (result >> 31));
+}
+}
+
 template <typename T, typename... Ts>
-[[nodiscard]] constexpr auto MinArgument(T a, Ts... args) noexcept {
-if constexpr(sizeof...(args) == 0) {
+[[nodiscard]] constexpr auto MinArgument(T a, Ts... args) noexcept
+{
+if constexpr (sizeof...(args) == 0)
+{
 return a;
-} else {
+}
+else
+{
 return (a < MinArgument(args...)) ? a : MinArgument(args...);
 }
 }
 
 template <typename C, typename... Cs>
-[[nodiscard]] consteval auto MinimumOfCljonicCollectionMaximumCounts() {
-if constexpr(sizeof...(Cs) == 0) {
+[[nodiscard]] consteval auto MinimumOfCljonicCollectionMaximumCounts()
+{
+if constexpr (sizeof...(Cs) == 0)
+{
 return C::MaximumCount();
-} else {
+}
+else
+{
 return MinArgument(C::MaximumCount(), Cs::MaximumCount()...);
 }
 }
 
 template <typename C, typename... Cs>
-[[nodiscard]] consteval auto SumOfCljonicCollectionMaximumCounts() {
-if constexpr(sizeof...(Cs) == 0) {
+[[nodiscard]] consteval auto SumOfCljonicCollectionMaximumCounts()
+{
+if constexpr (sizeof...(Cs) == 0)
+{
 return C::MaximumCount();
-} else {
+}
+else
+{
 return (C::MaximumCount() + ... + Cs::MaximumCount());
 }
 }
 
-[[nodiscard]] consteval SizeType MaximumElements(const SizeType count) noexcept {
+[[nodiscard]] consteval SizeType HashSlotCount(const SizeType count) noexcept
+{
+
+auto result{static_cast<SizeType>(1)};
+while (result < (2 * count))
+result *= 2;
+return result;
+}
+
+template <SizeType Count>
+using HashSlotType = std::conditional_t<(Count < std::numeric_limits<std::uint16_t>::max()), std::uint16_t, SizeType>;
+
+[[nodiscard]] consteval SizeType MaximumElements(const SizeType count) noexcept
+{
 return MinArgument(count, CljonicCollectionMaximumElementCount);
 }
 
-} // namespace cljonic
+template <typename T>
+constexpr void InitializeUnusedElements(T* elements, const SizeType count, const SizeType maximumCount) noexcept
+{
+if (std::is_constant_evaluated())
+for (auto i{count}; i < maximumCount; ++i)
+elements[i] = T{};
+}
+
+template <typename C>
+[[nodiscard]] constexpr decltype(auto) ElementAt(const C& c, const SizeType index) noexcept
+{
+if constexpr (requires { c.At(index); })
+return c.At(index);
+else
+return c[index];
+}
+
+template <typename C>
+class ElementCursor
+{
+using Iterator = decltype(std::declval<const C&>().begin());
+
+const C& m_c;
+Iterator m_it;
+Iterator m_end;
+bool m_isStarted;
+
+public:
+constexpr explicit ElementCursor(const C& c) noexcept
+: m_c(c), m_it(c.begin()), m_end(c.end()), m_isStarted(false)
+{
+}
+
+[[nodiscard]] constexpr typename C::value_type Next() noexcept
+{
+if (m_isStarted and (m_it != m_end))
+++m_it;
+m_isStarted = true;
+if (m_it != m_end)
+return *m_it;
+return m_c.DefaultElement();
+}
+};
+
+template <typename C>
+requires IsRandomAccessCollection<C>
+class ElementCursor<C>
+{
+const C& m_c;
+SizeType m_index;
+
+public:
+constexpr explicit ElementCursor(const C& c) noexcept : m_c(c), m_index(0)
+{
+}
+
+[[nodiscard]] constexpr decltype(auto) Next() noexcept
+{
+return ElementAt(m_c, m_index++);
+}
+};
+
+template <typename C>
+requires IsCljonicCycle<C>
+class ElementCursor<C>
+{
+decltype(std::declval<const C&>().begin()) m_it;
+
+public:
+constexpr explicit ElementCursor(const C& c) noexcept : m_it(c.begin())
+{
+}
+
+[[nodiscard]] constexpr auto Next() noexcept
+{
+auto result{*m_it};
+++m_it;
+return result;
+}
+};
+
+template <typename T, typename U>
+concept IsBulkSearchable = (std::integral<T> and std::integral<U>) or (std::is_enum_v<T> and std::is_same_v<T, U>);
+
+template <SizeType blockSize, typename T>
+[[nodiscard]] constexpr bool BlockContains(const T* elements, const T& t) noexcept
+{
+unsigned result{0};
+for (SizeType i{0}; i < blockSize; ++i)
+result |= static_cast<unsigned>(elements[i] == t);
+return 0 != result;
+}
+
+template <typename T>
+[[nodiscard]] constexpr SizeType IndexOfElement(const T* elements, const SizeType count, const T& t) noexcept
+{
+if constexpr (sizeof(T) == 1)
+{
+if (not std::is_constant_evaluated())
+{
+const auto found{static_cast<const T*>(std::memchr(elements, static_cast<unsigned char>(t), count))};
+return (nullptr == found) ? CLJONIC_INVALID_INDEX : static_cast<SizeType>(found - elements);
+}
+}
+constexpr SizeType blockSize{16};
+SizeType i{0};
+while (((i + blockSize) <= count) and not BlockContains<blockSize>(elements + i, t))
+i += blockSize;
+for (; i < count; ++i)
+if (elements[i] == t)
+return i;
+return CLJONIC_INVALID_INDEX;
+}
+
+template <typename T>
+[[nodiscard]] constexpr SizeType LastIndexOfElement(const T* elements, const SizeType count, const T& t) noexcept
+{
+constexpr SizeType blockSize{16};
+SizeType i{count};
+while ((i >= blockSize) and not BlockContains<blockSize>(elements + (i - blockSize), t))
+i -= blockSize;
+for (; i > 0; --i)
+if (elements[i - 1] == t)
+return i - 1;
+return CLJONIC_INVALID_INDEX;
+}
+
+template <bool last, typename T, typename U>
+[[nodiscard]] constexpr SizeType BulkIndexOf(const T* elements, const SizeType count, const U& u) noexcept
+{
+const auto t{static_cast<T>(u)};
+if (not(static_cast<U>(t) == u))
+return CLJONIC_INVALID_INDEX;
+if constexpr (last)
+return LastIndexOfElement(elements, count, t);
+else
+return IndexOfElement(elements, count, t);
+}
+
+template <bool last, typename R, typename T>
+[[nodiscard]] constexpr SizeType RangeIndexOf(const R& r, const T& t) noexcept
+{
+const auto value{static_cast<int>(t)};
+if ((0 == r.Count()) or not(static_cast<T>(value) == t))
+return CLJONIC_INVALID_INDEX;
+const auto offset{static_cast<std::int64_t>(value) - r[0]};
+const auto step{(r.Count() > 1) ? (static_cast<std::int64_t>(r[1]) - r[0]) : std::int64_t{0}};
+if (0 == step)
+return (0 != offset) ? CLJONIC_INVALID_INDEX : (last ? (r.Count() - 1) : 0);
+const auto index{offset / step};
+return ((0 != (offset % step)) or (index < 0) or (index >= static_cast<std::int64_t>(r.Count())))
+? CLJONIC_INVALID_INDEX
+: static_cast<SizeType>(index);
+}
 
-namespace cljonic {
+}
+
+namespace cljonic
+{
 
 template <ValidCljonicContainerElementType T, SizeType MaxElements>
 class Array;
 
+template <typename F, typename C>
+class FilterView;
+
+template <typename K, ValidCljonicContainerElementType V, SizeType MaxElements>
+class HashMap;
+
+template <ValidCljonicContainerElementType T, SizeType MaxElements>
+class HashSet;
+
+template <typename F, typename C>
+class MapView;
+
 template <int... StartEndStep>
 class Range;
 
+template <typename F, typename C>
+class RemoveView;
+
 template <SizeType MaxElements, typename T>
 class Repeat;
 
 template <ValidCljonicContainerElementType T, SizeType MaxElements>
 class Set;
 
+template <ValidCljonicContainerElementType T, SizeType MaxElements>
+class SortedSet;
+
+template <typename C>
+class SliceView;
+
+template <typename T>
+class SpanView;
+
 template <SizeType MaxElements>
 class String;
 
-namespace core {
+namespace core
+{
+
+template <SizeType N, auto f>
+consteval auto ArrayOf() noexcept;
+
+template <typename C, typename K, typename V>
+constexpr auto Assoc(const C& c, const K& k, const V& v) noexcept;
 
 template <typename F1, typename F2>
 constexpr auto Compose(F1&& f1, F2&& f2) noexcept;
@@ -346,15 +809,27 @@ constexpr auto Dedupe(const C& c) noexcept;
 template <typename F, typename C>
 constexpr auto DedupeBy(F&& f, const C& c) noexcept;
 
+template <typename T>
+constexpr auto DedupeT() noexcept;
+
 template <typename C>
 constexpr auto DefaultElement(const C& c) noexcept;
 
+template <typename C, typename K>
+constexpr auto Dissoc(const C& c, const K& k) noexcept;
+
 template <typename C>
 constexpr auto Drop(const SizeType count, const C& c) noexcept;
 
+template <typename C>
+constexpr auto DropView(const SizeType count, C&& c) noexcept;
+
 template <typename C>
 constexpr auto DropLast(const SizeType count, const C& c) noexcept;
 
+template <typename C>
+constexpr auto DropLastView(const SizeType count, C&& c) noexcept;
+
 template <typename F, typename C>
 constexpr auto DropWhile(F&& f, const C& c) noexcept;
 
@@ -370,9 +845,15 @@ constexpr auto Every(F&& f, const C& c) noexcept;
 template <typename F, typename C>
 constexpr auto Filter(F&& f, const C& c) noexcept;
 
+template <typename F>
+constexpr auto FilterT(F&& f) noexcept;
+
 template <typename C>
 constexpr auto First(const C& coll) noexcept;
 
+template <auto pipeline>
+consteval auto Freeze() noexcept;
+
 template <typename T, typename... Ts>
 constexpr auto Identical(const T& t, const Ts&... ts) noexcept;
 
@@ -388,6 +869,12 @@ constexpr auto IndexOf(const C& c, const T& t) noexcept;
 template <typename F, typename C, typename T>
 constexpr auto IndexOfBy(F&& f, const C& c, const T& t) noexcept;
 
+template <typename C>
+constexpr SizeType IndexOfMax(const C& c) noexcept;
+
+template <typename C>
+constexpr SizeType IndexOfMin(const C& c) noexcept;
+
 constexpr auto Interleave() noexcept;
 
 template <typename C, typename... Cs>
@@ -396,6 +883,9 @@ constexpr auto Interleave(const C& c, const Cs&... cs) noexcept;
 template <typename T, typename C>
 constexpr auto Interpose(const T& t, const C& c) noexcept;
 
+template <typename A, typename XF, typename C>
+constexpr auto Into(const A& a, XF&& xf, const C& c) noexcept;
+
 template <typename T, typename... Ts>
 constexpr auto IsDistinct(const T& t, const Ts&... ts) noexcept;
 
@@ -423,6 +913,9 @@ constexpr auto LastIndexOfBy(F&& f, const C& c, const T& t) noexcept;
 template <typename F, typename C, typename... Cs>
 constexpr auto Map(F&& f, const C& c, const Cs&... cs) noexcept;
 
+template <typename F>
+constexpr auto MapT(F&& f) noexcept;
+
 template <typename T, typename... Ts>
 constexpr auto Max(const T& t, const Ts&... ts) noexcept;
 
@@ -480,123 +973,595 @@ constexpr auto Sort(F&& f, const C& c) noexcept;
 template <typename F, typename C>
 constexpr auto SortBy(F&& f, const C& c) noexcept;
 
+template <typename C>
+constexpr auto StableSort(const C& c) noexcept;
+
+template <typename F, typename C>
+constexpr auto StableSortBy(F&& f, const C& c) noexcept;
+
 template <typename C>
 constexpr auto SplitAt(const SizeType count, const C& c) noexcept;
 
+template <typename C>
+constexpr auto SplitAtView(const SizeType count, C&& c) noexcept;
+
 template <typename F, typename C>
 constexpr auto SplitWith(F&& f, const C& c) noexcept;
 
+template <typename F, typename C>
+constexpr auto SplitWithView(F&& f, C&& c) noexcept;
+
 template <typename C>
 constexpr auto Subs(const C& c, const SizeType start, const SizeType end) noexcept;
 
+template <typename C>
+constexpr auto SubsView(C&& c, const SizeType start, const SizeType end) noexcept;
+
+template <typename C>
+constexpr auto SubsView(C&& c, const SizeType start) noexcept;
+
 template <typename C>
 constexpr auto Take(const SizeType count, const C& c) noexcept;
 
+template <typename C>
+constexpr auto TakeView(const SizeType count, C&& c) noexcept;
+
 template <typename C>
 constexpr auto TakeLast(const SizeType count, const C& c) noexcept;
 
+template <typename C>
+constexpr auto TakeLastView(const SizeType count, C&& c) noexcept;
+
 template <typename C>
 constexpr auto TakeNth(const SizeType nth, const C& c) noexcept;
 
+constexpr auto TakeT(const SizeType count) noexcept;
+
 template <typename F, typename C>
 constexpr auto TakeWhile(F&& f, const C& c) noexcept;
 
-} // namespace core
-
-} // namespace cljonic
+template <typename F>
+constexpr auto TakeWhileT(F&& f) noexcept;
 
-#include <concepts>
-#include <cstring>
-#include <initializer_list>
-#include <type_traits>
+template <typename XF, typename F, typename T, typename C>
+constexpr auto Transduce(XF&& xf, F&& f, const T& t, const C& c) noexcept;
 
-namespace cljonic {
-template <ValidCljonicContainerElementType T, SizeType MaxElements>
-class Array : public IndexInterface<T> {
-static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+}
 
-static_assert(maximumElements == MaxElements,
-              "Attempt to create an Array bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+}
 
-SizeType m_elementCount;
-T m_elementDefault;
-T m_elements[maximumElements]{};
+#include <utility>
 
-template <typename U, SizeType N>
-constexpr friend void MConj(Array<U, N>& array, const U& value);
+namespace cljonic
+{
+
+constexpr SizeType IntroSortInsertionSortCutoff{16};
+
+template <typename T, typename F>
+constexpr void InsertionSortBy(T* elements, const SizeType count, F& lessThan) noexcept
+{
+for (SizeType i{1}; i < count; ++i)
+{
+auto key{std::move(elements[i])};
+auto j{i};
+while ((j > 0) and lessThan(key, elements[j - 1]))
+{
+elements[j] = std::move(elements[j - 1]);
+--j;
+}
+elements[j] = std::move(key);
+}
+}
+
+template <typename T, typename F>
+constexpr void SiftDownBy(T* elements, SizeType root, const SizeType count, F& lessThan) noexcept
+{
+for (auto child{(2 * root) + 1}; child < count; child = (2 * root) + 1)
+{
+if (((child + 1) < count) and lessThan(elements[child], elements[child + 1]))
+++child;
+if (not lessThan(elements[root], elements[child]))
+return;
+std::swap(elements[root], elements[child]);
+root = child;
+}
+}
+
+template <typename T, typename F>
+constexpr void HeapSortBy(T* elements, const SizeType count, F& lessThan) noexcept
+{
+for (auto i{count / 2}; i > 0; --i)
+SiftDownBy(elements, (i - 1), count, lessThan);
+for (auto end{count}; end > 1; --end)
+{
+std::swap(elements[0], elements[end - 1]);
+SiftDownBy(elements, 0, (end - 1), lessThan);
+}
+}
+
+template <typename T, typename F>
+constexpr SizeType PartitionBy(T* elements, const SizeType count, F& lessThan) noexcept
+{
+
+const auto middle{count / 2};
+const auto last{count - 1};
+if (lessThan(elements[middle], elements[0]))
+std::swap(elements[middle], elements[0]);
+if (lessThan(elements[last], elements[middle]))
+{
+std::swap(elements[last], elements[middle]);
+if (lessThan(elements[middle], elements[0]))
+std::swap(elements[middle], elements[0]);
+}
+std::swap(elements[0], elements[middle]);
+
+const auto& pivot{elements[0]};
+SizeType i{0};
+SizeType j{count};
+while (true)
+{
+do
+++i;
+while ((i < last) and lessThan(elements[i], pivot));
+do
+--j;
+while ((j > 0) and lessThan(pivot, elements[j]));
+if (i >= j)
+break;
+std::swap(elements[i], elements[j]);
+}
+std::swap(elements[0], elements[j]);
+return j;
+}
+
+template <typename T, typename F>
+constexpr void IntroSortBy(T* elements, SizeType count, SizeType depthLimit, F& lessThan) noexcept
+{
+while (count > IntroSortInsertionSortCutoff)
+{
+if (0 == depthLimit)
+{
+HeapSortBy(elements, count, lessThan);
+return;
+}
+--depthLimit;
+const auto p{PartitionBy(elements, count, lessThan)};
+if (p < (count - p - 1))
+{
+IntroSortBy(elements, p, depthLimit, lessThan);
+elements += (p + 1);
+count -= (p + 1);
+}
+else
+{
+IntroSortBy((elements + p + 1), (count - p - 1), depthLimit, lessThan);
+count = p;
+}
+}
+InsertionSortBy(elements, count, lessThan);
+}
 
-template <typename U, SizeType N>
-constexpr friend void MSet(Array<U, N>& array, const U& value, const SizeType index);
+template <typename T, typename F>
+constexpr void IntroSort(T* elements, const SizeType count, F& lessThan) noexcept
+{
+SizeType depthLimit{0};
+for (auto n{count}; n > 1; n /= 2)
+depthLimit += 2;
+IntroSortBy(elements, count, depthLimit, lessThan);
+}
 
-[[nodiscard]] constexpr auto ValueAtIndex(const SizeType index) const noexcept {
-return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
 }
 
-public:
-using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Array>;
-using size_type = SizeType;
+#include <utility>
+
+namespace cljonic
+{
+
+constexpr SizeType MergeSortRunLength{16};
+
+template <typename T, typename F>
+constexpr void MergeBy(T* source,
+T* destination,
+const SizeType begin,
+const SizeType middle,
+const SizeType end,
+F& lessThan) noexcept
+{
+
+auto i{begin};
+auto j{middle};
+auto k{begin};
+while ((i < middle) and (j < end))
+destination[k++] = lessThan(source[j], source[i]) ? std::move(source[j++]) : std::move(source[i++]);
+while (i < middle)
+destination[k++] = std::move(source[i++]);
+while (j < end)
+destination[k++] = std::move(source[j++]);
+}
+
+template <typename T, typename F>
+constexpr void MergeSort(T* elements, T* scratch, const SizeType count, F& lessThan) noexcept
+{
+for (SizeType begin{0}; begin < count; begin += MergeSortRunLength)
+{
+const auto runLength{((count - begin) < MergeSortRunLength) ? (count - begin) : MergeSortRunLength};
+InsertionSortBy((elements + begin), runLength, lessThan);
+}
+auto source{elements};
+auto destination{scratch};
+for (auto width{MergeSortRunLength}; width < count; width *= 2)
+{
+for (SizeType begin{0}; begin < count; begin += (2 * width))
+{
+const auto middle{((count - begin) < width) ? count : (begin + width)};
+const auto end{((count - middle) < width) ? count : (middle + width)};
+MergeBy(source, destination, begin, middle, end, lessThan);
+}
+const auto merged{destination};
+destination = source;
+source = merged;
+}
+if (source != elements)
+for (SizeType i{0}; i < count; ++i)
+elements[i] = std::move(source[i]);
+}
+
+}
+
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace cljonic
+{
+
+struct Text
+{
+const char* chars;
+SizeType count;
+};
+
+template <typename T>
+concept IsText = IsCString<T> or (IsCljonicCollection<T> and std::same_as<typename T::value_type, char> and
+std::is_pointer_v<decltype(std::declval<const T&>().begin())>);
+
+template <typename T>
+[[nodiscard]] constexpr Text AsText(const T& t) noexcept
+{
+if constexpr (IsCString<T>)
+{
+const char* chars{t};
+if (not std::is_constant_evaluated())
+return Text{chars, std::strlen(chars)};
+SizeType count{0};
+while ('\0' != chars[count])
+++count;
+return Text{chars, count};
+}
+else
+{
+return Text{t.begin(), t.Count()};
+}
+}
+template <bool backward>
+class TwoWaySearcher
+{
+const Text m_needle;
+SizeType m_split;
+SizeType m_period;
+SizeType m_memoryPeriod;
+std::uint32_t m_chars[8];
+
+[[nodiscard]] static constexpr unsigned char CharAt(const Text& text, const SizeType index) noexcept
+{
+return static_cast<unsigned char>(text.chars[backward ? (text.count - 1 - index) : index]);
+}
+
+[[nodiscard]] constexpr unsigned char NeedleAt(const SizeType index) const noexcept
+{
+return CharAt(m_needle, index);
+}
+
+[[nodiscard]] constexpr bool NeedleHasChar(const unsigned char c) const noexcept
+{
+return 0 != (m_chars[c / 32] & (std::uint32_t{1} << (c % 32)));
+}
+
+[[nodiscard]] constexpr SizeType NextStart(const Text& haystack, const SizeType start) const noexcept
+{
+const auto c{static_cast<char>(NeedleAt(0))};
+if constexpr (backward)
+{
+const auto index{LastIndexOfElement(haystack.chars, haystack.count - start, c)};
+return (CLJONIC_INVALID_INDEX == index) ? index : (haystack.count - 1 - index);
+}
+else
+{
+const auto index{IndexOfElement(haystack.chars + start, haystack.count - start, c)};
+return (CLJONIC_INVALID_INDEX == index) ? index : (start + index);
+}
+}
+
+[[nodiscard]] constexpr std::pair<SizeType, SizeType> MaximalSuffix(const bool greater) const noexcept
+{
+SizeType suffix{0};
+SizeType j{0};
+SizeType k{1};
+SizeType period{1};
+while ((j + k) < m_needle.count)
+{
+const auto a{NeedleAt(suffix + k - 1)};
+const auto b{NeedleAt(j + k)};
+if (a == b)
+{
+if (k == period)
+{
+j += period;
+k = 1;
+}
+else
+{
+++k;
+}
+}
+else if (greater ? (a > b) : (a < b))
+{
+j += k;
+k = 1;
+period = j + 1 - suffix;
+}
+else
+{
+suffix = ++j;
+k = 1;
+period = 1;
+}
+}
+return {suffix, period};
+}
+
+public:
+constexpr explicit TwoWaySearcher(const Text& needle) noexcept
+: m_needle(needle), m_split(0), m_period(1), m_memoryPeriod(0), m_chars{}
+{
+for (SizeType i{0}; i < m_needle.count; ++i)
+m_chars[NeedleAt(i) / 32] |= std::uint32_t{1} << (NeedleAt(i) % 32);
+const auto [split0, period0]{MaximalSuffix(true)};
+const auto [split1, period1]{MaximalSuffix(false)};
+m_split = (split1 > split0) ? split1 : split0;
+m_period = (split1 > split0) ? period1 : period0;
+auto periodic{(m_split + m_period) <= m_needle.count};
+for (SizeType i{0}; (periodic and (i < m_split)); ++i)
+periodic = (NeedleAt(i) == NeedleAt(i + m_period));
+if (periodic)
+m_memoryPeriod = m_needle.count - m_period;
+else
+m_period = ((m_split > (m_needle.count - m_split)) ? m_split : (m_needle.count - m_split)) + 1;
+}
+
+[[nodiscard]] constexpr SizeType Find(const Text& haystack, SizeType start) const noexcept
+{
+
+const auto count{m_needle.count};
+SizeType memory{0};
+while ((start <= haystack.count) and (count <= (haystack.count - start)))
+{
+if (0 == count)
+return start;
+if ((0 == memory) and (NeedleAt(0) != CharAt(haystack, start)))
+{
+
+start = NextStart(haystack, start);
+if ((CLJONIC_INVALID_INDEX == start) or (count > (haystack.count - start)))
+return CLJONIC_INVALID_INDEX;
+}
+if (not NeedleHasChar(CharAt(haystack, start + count - 1)))
+{
+start += count;
+memory = 0;
+continue;
+}
+auto k{(m_split > memory) ? m_split : memory};
+while ((k < count) and (NeedleAt(k) == CharAt(haystack, start + k)))
+++k;
+if (k < count)
+{
+start += k - m_split + 1;
+memory = 0;
+continue;
+}
+k = m_split;
+while ((k > memory) and (NeedleAt(k - 1) == CharAt(haystack, start + k - 1)))
+--k;
+if (k <= memory)
+return start;
+start += m_period;
+memory = m_memoryPeriod;
+}
+return CLJONIC_INVALID_INDEX;
+}
+};
+
+[[nodiscard]] constexpr SizeType IndexOfText(const Text& text, const Text& part, const SizeType start = 0) noexcept
+{
+if ((start > text.count) or (part.count > (text.count - start)))
+return CLJONIC_INVALID_INDEX;
+if (1 == part.count)
+{
+const auto index{IndexOfElement(text.chars + start, text.count - start, part.chars[0])};
+return (CLJONIC_INVALID_INDEX == index) ? index : (start + index);
+}
+return TwoWaySearcher<false>{part}.Find(text, start);
+}
+
+[[nodiscard]] constexpr SizeType LastIndexOfText(const Text& text, const Text& part) noexcept
+{
+if (part.count > text.count)
+return CLJONIC_INVALID_INDEX;
+if (1 == part.count)
+return LastIndexOfElement(text.chars, text.count, part.chars[0]);
+const auto index{TwoWaySearcher<true>{part}.Find(text, 0)};
+return (CLJONIC_INVALID_INDEX == index) ? index : (text.count - part.count - index);
+}
+
+}
+
+#include <concepts>
+#include <cstring>
+#include <initializer_list>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace cljonic
+{
+template <ValidCljonicContainerElementType T, SizeType MaxElements>
+class Array
+{
+static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+
+static_assert(maximumElements == MaxElements,
+"Attempt to create an Array bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+
+SizeType m_elementCount;
+T m_elementDefault;
+T m_elements[maximumElements];
+
+template <typename U, SizeType N>
+constexpr friend void MConj(Array<U, N>& array, const U& value);
+
+template <typename U, SizeType N>
+constexpr friend void MConj(Array<U, N>& array, U&& value);
+
+template <typename U, SizeType N>
+constexpr friend void MConjElements(Array<U, N>& array, const U* elements, const SizeType count);
+
+template <typename U, SizeType N>
+constexpr friend void MSet(Array<U, N>& array, const U& value, const SizeType index);
+
+template <typename U, SizeType N, typename F>
+constexpr friend void MSortBy(Array<U, N>& array, F&& f);
+
+template <typename U, SizeType N, typename F>
+constexpr friend void MStableSortBy(Array<U, N>& array, F&& f);
+
+public:
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Array>;
+using size_type = SizeType;
 using value_type = T;
 
-constexpr Array() noexcept : m_elementCount(0), m_elementDefault(T{}) {
+constexpr Array() noexcept : m_elementCount(0), m_elementDefault(T{})
+{
+InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
 }
 
 template <typename... Args>
-constexpr explicit Array(Args&&... args) noexcept : m_elementCount(0), m_elementDefault(T{}) {
+requires(std::convertible_to<Args, T> and ...)
+constexpr explicit Array(Args&&... args) noexcept : m_elementCount(0), m_elementDefault(T{})
+{
 static_assert(sizeof...(Args) <= MaximumCount(), "Array initialized with too many elements");
-((m_elements[m_elementCount++] = args), ...);
+((m_elements[m_elementCount++] = std::forward<Args>(args)), ...);
+InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+}
+
+constexpr Array(const Array& other) noexcept
+: m_elementCount(other.m_elementCount), m_elementDefault(other.m_elementDefault)
+{
+CopyElements(m_elements, other.m_elements, m_elementCount);
+InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
 }
 
-constexpr Array(const Array& other) noexcept = default;
-constexpr Array(Array&& other) noexcept = default;
+constexpr Array(Array&& other) noexcept
+: m_elementCount(other.m_elementCount), m_elementDefault(std::move(other.m_elementDefault))
+{
+for (SizeType i{0}; i < m_elementCount; ++i)
+m_elements[i] = std::move(other.m_elements[i]);
+InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+}
 
 private:
-using Iterator = CollectionIterator<Array>;
+using Iterator = const T*;
 
 public:
-[[nodiscard]] constexpr Iterator begin() const noexcept {
-return Iterator{*this, 0};
+[[nodiscard]] constexpr Iterator begin() const noexcept
+{
+return m_elements;
 }
 
-[[nodiscard]] constexpr Iterator end() const noexcept {
-return Iterator{*this, m_elementCount};
+[[nodiscard]] constexpr Iterator end() const noexcept
+{
+return m_elements + m_elementCount;
 }
 
-[[nodiscard]] constexpr T operator[](const SizeType index) const noexcept override {
-return ValueAtIndex(index);
+[[nodiscard]] constexpr T operator[](const SizeType index) const noexcept
+{
+return At(index);
 }
 
-[[nodiscard]] constexpr T operator()(const SizeType index) const noexcept {
+[[nodiscard]] constexpr T operator()(const SizeType index) const noexcept
+{
 return this->operator[](index);
 }
 
-constexpr Array& operator=(const Array& other) noexcept {
-if(this != &other) {
+constexpr Array& operator=(const Array& other) noexcept
+{
+if (this != &other)
+{
 m_elementCount = other.m_elementCount;
 m_elementDefault = other.m_elementDefault;
-for(SizeType i{0}; i < m_elementCount; ++i)
-m_elements[i] = other.m_elements[i];
+CopyElements(m_elements, other.m_elements, m_elementCount);
 }
 return *this;
 }
 
-constexpr Array& operator=(Array&& other) noexcept {
-return *this = other;
+constexpr Array& operator=(Array&& other) noexcept
+{
+
+if (std::is_constant_evaluated() or (this != &other))
+{
+m_elementCount = other.m_elementCount;
+m_elementDefault = std::move(other.m_elementDefault);
+for (SizeType i{0}; i < m_elementCount; ++i)
+m_elements[i] = std::move(other.m_elements[i]);
+}
+return *this;
+}
+
+[[nodiscard]] constexpr std::span<const T> AsSpan() const noexcept
+{
+return std::span<const T>{Data(), m_elementCount};
 }
 
-[[nodiscard]] constexpr SizeType Count() const noexcept override {
+[[nodiscard]] constexpr const T& At(const SizeType index) const noexcept
+{
+return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
 return m_elementCount;
 }
 
-[[nodiscard]] constexpr const T& DefaultElement() const noexcept {
+[[nodiscard]] constexpr const T* Data() const noexcept
+{
+return m_elements;
+}
+
+[[nodiscard]] constexpr const T& DefaultElement() const noexcept
+{
 return m_elementDefault;
 }
 
 [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
-                                                            const T& element) const noexcept override {
-return (index < m_elementCount) and AreEqual(ValueAtIndex(index), element);
+const T& element) const noexcept
+{
+return (index < m_elementCount) and AreEqual(m_elements[index], element);
 }
 
-[[nodiscard]] static consteval SizeType MaximumCount() noexcept {
+[[nodiscard]] static consteval SizeType MaximumCount() noexcept
+{
 return maximumElements;
 }
 };
@@ -605,2007 +1570,5585 @@ template <typename... Args>
 Array(Args...) -> Array<std::common_type_t<Args...>, sizeof...(Args)>;
 
 template <typename U, SizeType N>
-constexpr void MConj(Array<U, N>& array, const U& value) {
-if(array.m_elementCount < array.MaximumCount())
+constexpr void MConj(Array<U, N>& array, const U& value)
+{
+if (array.m_elementCount < array.MaximumCount())
 array.m_elements[array.m_elementCount++] = value;
 }
 
 template <typename U, SizeType N>
-constexpr void MSet(Array<U, N>& array, const U& value, const SizeType index) {
-if(index < array.m_elementCount)
+constexpr void MConj(Array<U, N>& array, U&& value)
+{
+if (array.m_elementCount < array.MaximumCount())
+array.m_elements[array.m_elementCount++] = std::move(value);
+}
+
+template <typename U, SizeType N>
+constexpr void MConjElements(Array<U, N>& array, const U* elements, const SizeType count)
+{
+const auto fitCount{MinArgument(count, array.MaximumCount() - array.m_elementCount)};
+CopyElements(array.m_elements + array.m_elementCount, elements, fitCount);
+array.m_elementCount += fitCount;
+}
+
+template <typename U, SizeType N>
+constexpr void MSet(Array<U, N>& array, const U& value, const SizeType index)
+{
+if (index < array.m_elementCount)
 array.m_elements[index] = value;
 }
 
-} // namespace cljonic
+template <typename U, SizeType N, typename F>
+constexpr void MSortBy(Array<U, N>& array, F&& f)
+{
+IntroSort(array.m_elements, array.m_elementCount, f);
+}
 
-#include <concepts>
+template <typename U, SizeType N, typename F>
+constexpr void MStableSortBy(Array<U, N>& array, F&& f)
+{
+U scratch[N];
+InitializeUnusedElements(scratch, 0, N);
+MergeSort(array.m_elements, scratch, array.m_elementCount, f);
+}
+
+}
+
+#include <type_traits>
 #include <utility>
 
-namespace cljonic {
-template <typename F, typename T>
-class Iterator {
-F m_f;
-T m_initialValue;
+namespace cljonic
+{
+
+template <typename F, typename C, bool KeepMatches>
+class SelectView
+{
+using Collection = std::remove_cvref_t<C>;
+
+static_assert(IsCljonicCollection<Collection>,
+"A FilterView or RemoveView collection must be a cljonic collection");
+
+static_assert(IsUnaryPredicate<const F&, typename Collection::value_type>,
+"A FilterView or RemoveView function is not a valid unary predicate for the collection value type");
+
+using ElementType = typename Collection::value_type;
+using CollectionIteratorType = decltype(std::declval<const Collection&>().begin());
 
-class Itr {
 F m_f;
-SizeType m_index;
-T m_nextValue;
+std::conditional_t<std::is_lvalue_reference_v<C>, const Collection&, Collection> m_collection;
+
+class SelectViewIterator
+{
+const F& m_f;
+CollectionIteratorType m_iterator;
+CollectionIteratorType m_end;
+ElementType m_element;
+
+constexpr void SkipUnselectedElements() noexcept
+{
+for (; m_iterator != m_end; ++m_iterator)
+{
+m_element = *m_iterator;
+if (KeepMatches == static_cast<bool>(m_f(m_element)))
+break;
+}
+}
 
 public:
-using value_type = T;
-using difference_type = std::ptrdiff_t;
-using pointer = T*;
-using reference = T&;
+constexpr SelectViewIterator(const F& f,
+const CollectionIteratorType& iterator,
+const CollectionIteratorType& end) noexcept
+: m_f(f), m_iterator(iterator), m_end(end), m_element(ElementType{})
+{
+SkipUnselectedElements();
+}
 
-Itr(const Iterator& iterator, SizeType index)
-    : m_f{iterator.m_f}, m_index{index}, m_nextValue{iterator.m_initialValue} {
+[[nodiscard]] constexpr ElementType operator*() const noexcept
+{
+return m_element;
 }
 
-[[nodiscard]] T operator*() const {
-return m_nextValue;
+constexpr SelectViewIterator& operator++() noexcept
+{
+++m_iterator;
+SkipUnselectedElements();
+return *this;
 }
 
-Itr& operator++() {
-if(m_index < Iterator::MaximumCount()) {
-m_nextValue = m_f(m_nextValue);
-++m_index;
+[[nodiscard]] constexpr bool operator!=(const SelectViewIterator& other) const noexcept
+{
+return m_iterator != other.m_iterator;
 }
+
+constexpr SelectViewIterator& operator+=(const int value) noexcept
+{
+for (auto i{0}; ((i < value) and (m_iterator != m_end)); ++i)
+++(*this);
 return *this;
 }
 
-[[nodiscard]] bool operator!=(const Itr& other) const {
-return m_index != other.m_index;
+[[nodiscard]] constexpr SelectViewIterator operator+(const int value) const noexcept
+{
+SelectViewIterator temp = *this;
+temp += value;
+return temp;
 }
 };
 
 public:
-using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Iterator>;
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::View>;
 using size_type = SizeType;
-using value_type = T;
+using value_type = ElementType;
 
-constexpr explicit Iterator(F&& f, const T& t) noexcept : m_f{std::forward<F>(f)}, m_initialValue{t} {
-static_assert(IsUnaryFunction<F, T>,
-              "Iterator constructor's first parameter is not a unary function of its second parameter");
+template <typename G, typename D>
+constexpr SelectView(G&& f, D&& collection) noexcept
+: m_f(std::forward<G>(f)), m_collection(std::forward<D>(collection))
+{
 }
 
-constexpr Iterator(const Iterator& other) = default;
-constexpr Iterator(Iterator&& other) = default;
+constexpr SelectView(const SelectView& other) noexcept = default;
+constexpr SelectView(SelectView&& other) noexcept = default;
 
-[[nodiscard]] Itr begin() {
-return Itr(*this, 0);
+[[nodiscard]] constexpr SelectViewIterator begin() const noexcept
+{
+return SelectViewIterator{m_f, m_collection.begin(), m_collection.end()};
 }
 
-[[nodiscard]] Itr end() {
-return Itr(*this, MaximumCount());
+[[nodiscard]] constexpr SelectViewIterator end() const noexcept
+{
+return SelectViewIterator{m_f, m_collection.end(), m_collection.end()};
+}
+
+[[nodiscard]] constexpr ElementType operator[](const SizeType index) const noexcept
+{
+
+SizeType i{0};
+for (const auto& element : *this)
+if (index == i++)
+return element;
+return DefaultElement();
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
+SizeType result{0};
+for (auto it{begin()}; it != end(); ++it)
+++result;
+return result;
 }
 
-[[nodiscard]] constexpr SizeType Count() const noexcept {
-return CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT;
+[[nodiscard]] constexpr const ElementType& DefaultElement() const noexcept
+{
+return m_collection.DefaultElement();
 }
 
-[[nodiscard]] static constexpr auto MaximumCount() noexcept {
-return CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT;
+[[nodiscard]] static consteval SizeType MaximumCount() noexcept
+{
+return Collection::MaximumCount();
 }
 };
+template <typename F, typename C>
+class FilterView : public SelectView<F, C, true>
+{
+public:
+using SelectView<F, C, true>::SelectView;
+};
 
-template <typename F, typename T>
-Iterator(F&&, const T&) -> Iterator<F, T>;
+template <typename F, typename C>
+FilterView(F&&, C&&) -> FilterView<std::decay_t<F>, C>;
+template <typename F, typename C>
+class RemoveView : public SelectView<F, C, false>
+{
+public:
+using SelectView<F, C, false>::SelectView;
+};
 
-} // namespace cljonic
+template <typename F, typename C>
+RemoveView(F&&, C&&) -> RemoveView<std::decay_t<F>, C>;
 
-#include <concepts>
+}
 
-namespace cljonic {
-template <int... StartEndStep>
-class Range : public IndexInterface<int> {
-private:
-static_assert(sizeof...(StartEndStep) <= 3, "Number of Range parameters must be less than or equal to three");
+#include <concepts>
+#include <type_traits>
+#include <utility>
 
-using Iterator = CollectionIterator<Range>;
+namespace cljonic
+{
+template <typename K, ValidCljonicContainerElementType V, SizeType MaxElements>
+class HashMap
+{
+static_assert(IsHashable<K>, "A HashMap key type must be an integral, enumeration, or C string type");
 
-SizeType m_elementCount;
-int m_elementDefault;
-int m_elementStart;
-int m_elementStep;
+static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
 
-static constexpr auto RangeCount(const int start, const int end, const int step) noexcept {
-return (0 == step) ? 0 : ((end - start) / step) + ((((end - start) % step) == 0) ? 0 : 1);
-}
+static_assert(maximumElements == MaxElements,
+"Attempt to create a HashMap bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
 
-static constexpr int values[] = {StartEndStep...};
+static constexpr SizeType slotCount{HashSlotCount(maximumElements)};
 
-static constexpr auto MaxElements = []() constexpr {
-if constexpr(sizeof...(StartEndStep) == 1) {
-if constexpr(values[0] < 0)
-return static_cast<SizeType>(0);
-else
-return static_cast<SizeType>(values[0]);
-} else if constexpr(sizeof...(StartEndStep) == 2) {
-if constexpr(values[1] <= values[0])
-return static_cast<SizeType>(0);
-else
-return static_cast<SizeType>(values[1] - values[0]);
-} else if constexpr(sizeof...(StartEndStep) == 3) {
+using Entry = std::pair<K, V>;
+using SlotType = HashSlotType<maximumElements>;
 
-if constexpr((0 == values[2]) and (values[0] == values[1]))
-return static_cast<SizeType>(0);
-else if constexpr(0 == values[2])
-return CljonicCollectionMaximumElementCount;
-else if constexpr(values[2] < 0) {
-if constexpr(values[0] <= values[1])
-return static_cast<SizeType>(0);
-else
-return static_cast<SizeType>(RangeCount(values[0], values[1], values[2]));
-} else {
-if constexpr(values[1] <= values[0])
-return static_cast<SizeType>(0);
-else
-return static_cast<SizeType>(RangeCount(values[0], values[1], values[2]));
-}
-} else {
-return CljonicCollectionMaximumElementCount;
-}
-}();
+SizeType m_elementCount;
+Entry m_elementDefault;
+Entry m_elements[maximumElements]{};
+SlotType m_slots[slotCount]{};
 
-static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+template <typename L, typename W, SizeType N>
+constexpr friend void MAssoc(HashMap<L, W, N>& map, const L& key, const W& value);
 
-static_assert(maximumElements == MaxElements,
-              "Attempt to create a Range bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+template <typename L, typename W, SizeType N>
+constexpr friend void MDissoc(HashMap<L, W, N>& map, const L& key);
 
-constexpr void InitializeMembers(const int count, const int start, const int step) noexcept {
-m_elementCount = MinArgument(static_cast<SizeType>(count), CljonicCollectionMaximumElementCount);
-m_elementDefault = 0;
-m_elementStart = start;
-m_elementStep = step;
+[[nodiscard]] static constexpr SizeType HomeSlotIndex(const K& key) noexcept
+{
+return HashValue(key) & (slotCount - 1);
 }
 
-constexpr void Initialize() noexcept {
-InitializeMembers(CljonicCollectionMaximumElementCount, 0, 1);
-}
+[[nodiscard]] constexpr SizeType SlotIndex(const K& key) const noexcept
+{
 
-constexpr void InitializeEnd(const int end) noexcept {
-if(end <= 0)
-InitializeMembers(0, 0, 1);
-else
-InitializeMembers(end, 0, 1);
+auto i{HomeSlotIndex(key)};
+while ((0 != m_slots[i]) and not AreEqual(key, m_elements[m_slots[i] - 1].first))
+i = (i + 1) & (slotCount - 1);
+return i;
 }
 
-constexpr void InitializeStartEnd(const int start, const int end) noexcept {
-if(end <= start)
-InitializeMembers(0, 0, 1);
-else
-InitializeMembers((end - start), start, 1);
+constexpr void Assoc(const K& key, const V& value) noexcept
+{
+const auto i{SlotIndex(key)};
+if (0 != m_slots[i])
+{
+m_elements[m_slots[i] - 1].second = value;
 }
-
-constexpr void InitializeStartEndStepWithNegativeStep(const int start, const int end, const int step) noexcept {
-if(start <= end)
-InitializeMembers(0, 0, step);
-else {
-const int count{RangeCount(start, end, step)};
-InitializeMembers(count, start, step);
+else if (m_elementCount < maximumElements)
+{
+m_elements[m_elementCount++] = Entry{key, value};
+m_slots[i] = static_cast<SlotType>(m_elementCount);
 }
 }
 
-constexpr void InitializeStartEndStepWithPositiveStep(const int start, const int end, const int step) noexcept {
-if(end <= start)
-InitializeMembers(0, 0, step);
-else {
-const int count{RangeCount(start, end, step)};
-InitializeMembers(count, start, step);
+constexpr void RemoveSlot(SizeType i) noexcept
+{
+
+for (auto j{(i + 1) & (slotCount - 1)}; 0 != m_slots[j]; j = (j + 1) & (slotCount - 1))
+{
+const auto home{HomeSlotIndex(m_elements[m_slots[j] - 1].first)};
+const auto homeIsBetweenIAndJ{(i <= j) ? ((i < home) and (home <= j)) : ((i < home) or (home <= j))};
+if (not homeIsBetweenIAndJ)
+{
+m_slots[i] = m_slots[j];
+i = j;
 }
 }
-
-constexpr void InitializeStartEndStep(const int start, const int end, const int step) noexcept {
-
-if((0 == step) and (start == end))
-InitializeMembers(0, 0, 0);
-else if(0 == step)
-InitializeMembers(CljonicCollectionMaximumElementCount, start, 0);
-else if(step < 0)
-InitializeStartEndStepWithNegativeStep(start, end, step);
-else
-InitializeStartEndStepWithPositiveStep(start, end, step);
+m_slots[i] = 0;
 }
 
-constexpr auto ValueAtIndex(const SizeType index) const noexcept {
-return ((0 == m_elementCount) or (index >= m_elementCount))
-           ? m_elementDefault
-           : (m_elementStart + (static_cast<int>(index) * m_elementStep));
+constexpr void Dissoc(const K& key) noexcept
+{
+const auto i{SlotIndex(key)};
+if (0 != m_slots[i])
+{
+const auto index{static_cast<SizeType>(m_slots[i] - 1)};
+const auto lastIndex{m_elementCount - 1};
+RemoveSlot(i);
+if (index != lastIndex)
+{
+m_elements[index] = m_elements[lastIndex];
+m_slots[SlotIndex(m_elements[index].first)] = static_cast<SlotType>(index + 1);
+}
+m_elements[lastIndex] = m_elementDefault;
+--m_elementCount;
+}
 }
 
 public:
-using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Range>;
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::HashMap>;
+using key_type = K;
+using mapped_type = V;
 using size_type = SizeType;
-using value_type = int;
-
-constexpr Range() noexcept
-    : m_elementCount{static_cast<SizeType>(0)}, m_elementDefault{0}, m_elementStart{0}, m_elementStep{0} {
+using value_type = Entry;
 
-if constexpr(sizeof...(StartEndStep) == 1) {
-InitializeEnd(values[0]);
-} else if constexpr(sizeof...(StartEndStep) == 2) {
-InitializeStartEnd(values[0], values[1]);
-} else if constexpr(sizeof...(StartEndStep) == 3) {
-InitializeStartEndStep(values[0], values[1], values[2]);
-} else {
-Initialize();
+constexpr HashMap() noexcept : m_elementCount(0), m_elementDefault(Entry{})
+{
 }
+
+template <typename... Args>
+constexpr explicit HashMap(const Args&... entries) noexcept : m_elementCount(0), m_elementDefault(Entry{})
+{
+static_assert(sizeof...(Args) <= MaximumCount(), "HashMap initialized with too many entries");
+(Assoc(entries.first, entries.second), ...);
 }
 
-constexpr Range(const Range& other) = default;
-constexpr Range(Range&& other) = default;
+constexpr HashMap(const HashMap& other) noexcept
+: m_elementCount(other.m_elementCount), m_elementDefault(other.m_elementDefault)
+{
+for (SizeType i{0}; i < m_elementCount; ++i)
+m_elements[i] = other.m_elements[i];
+for (SizeType i{0}; i < slotCount; ++i)
+m_slots[i] = other.m_slots[i];
+}
 
-[[nodiscard]] constexpr Iterator begin() const noexcept {
-return Iterator{*this, 0};
+constexpr HashMap(HashMap&& other) noexcept : HashMap(other)
+{
 }
 
-[[nodiscard]] constexpr Iterator end() const noexcept {
-return Iterator{*this, m_elementCount};
+private:
+using Iterator = const Entry*;
+
+public:
+[[nodiscard]] constexpr Iterator begin() const noexcept
+{
+return m_elements;
 }
 
-[[nodiscard]] constexpr int operator[](const SizeType index) const noexcept override {
-return ValueAtIndex(index);
+[[nodiscard]] constexpr Iterator end() const noexcept
+{
+return m_elements + m_elementCount;
+}
+
+[[nodiscard]] constexpr Entry operator[](const SizeType index) const noexcept
+{
+return At(index);
+}
+
+[[nodiscard]] constexpr V operator()(const K& key) const noexcept
+{
+return Get(key);
+}
+
+constexpr HashMap& operator=(const HashMap& other) noexcept
+{
+if (this != &other)
+{
+m_elementCount = other.m_elementCount;
+m_elementDefault = other.m_elementDefault;
+for (SizeType i{0}; i < m_elementCount; ++i)
+m_elements[i] = other.m_elements[i];
+for (SizeType i{0}; i < slotCount; ++i)
+m_slots[i] = other.m_slots[i];
+}
+return *this;
 }
 
-[[nodiscard]] constexpr SizeType Count() const noexcept override {
+constexpr HashMap& operator=(HashMap&& other) noexcept
+{
+return *this = other;
+}
+
+[[nodiscard]] constexpr const Entry& At(const SizeType index) const noexcept
+{
+return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+}
+
+[[nodiscard]] constexpr bool ContainsKey(const K& key) const noexcept
+{
+return 0 != m_slots[SlotIndex(key)];
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
 return m_elementCount;
 }
 
-[[nodiscard]] constexpr const int& DefaultElement() const noexcept {
+[[nodiscard]] constexpr const Entry& DefaultElement() const noexcept
+{
 return m_elementDefault;
 }
 
 [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
-                                                            const int& element) const noexcept override {
-return (index < m_elementCount) and AreEqual(ValueAtIndex(index), element);
+const Entry& entry) const noexcept
+{
+return (index < m_elementCount) and ContainsKey(entry.first) and AreEqual(Get(entry.first), entry.second);
+}
+
+[[nodiscard]] constexpr V Get(const K& key) const noexcept
+{
+const auto i{SlotIndex(key)};
+return (0 != m_slots[i]) ? m_elements[m_slots[i] - 1].second : m_elementDefault.second;
+}
+
+[[nodiscard]] constexpr V Get(const K& key, const V& notFound) const noexcept
+{
+const auto i{SlotIndex(key)};
+return (0 != m_slots[i]) ? m_elements[m_slots[i] - 1].second : notFound;
 }
 
-[[nodiscard]] static consteval auto MaximumCount() noexcept {
+[[nodiscard]] static consteval SizeType MaximumCount() noexcept
+{
 return maximumElements;
 }
 };
 
-Range() -> Range<>;
+template <typename K, typename V, typename... Args>
+HashMap(std::pair<K, V>, Args...) -> HashMap<K, V, 1 + sizeof...(Args)>;
 
-} // namespace cljonic
+template <typename L, typename W, SizeType N>
+constexpr void MAssoc(HashMap<L, W, N>& map, const L& key, const W& value)
+{
+map.Assoc(key, value);
+}
+
+template <typename L, typename W, SizeType N>
+constexpr void MDissoc(HashMap<L, W, N>& map, const L& key)
+{
+map.Dissoc(key);
+}
+
+}
 
 #include <concepts>
-#include <limits>
+#include <type_traits>
 
-namespace cljonic {
-template <SizeType MaxElements, typename T>
-class Repeat : public IndexInterface<T> {
-using Iterator = CollectionIterator<Repeat>;
+namespace cljonic
+{
+template <ValidCljonicContainerElementType T, SizeType MaxElements>
+class HashSet
+{
+static_assert(not std::floating_point<T>,
+"Floating point types should not be compared for equality, hence HashSets of floating point types "
+"are not allowed");
+
+static_assert(std::equality_comparable<T>, "A HashSet type must be equality comparable");
+
+static_assert(IsHashable<T>, "A HashSet type must be an integral, enumeration, or C string type");
 
 static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
 
 static_assert(maximumElements == MaxElements,
-              "Attempt to create a Repeat bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+"Attempt to create a HashSet bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
 
-const SizeType m_elementCount;
-const T m_elementDefault;
-const T m_elementValue;
+static constexpr SizeType slotCount{HashSlotCount(maximumElements)};
+
+using SlotType = HashSlotType<maximumElements>;
 
-constexpr auto ValueAtIndex(const SizeType index) const noexcept {
-return ((m_elementCount <= 0) or (index >= m_elementCount)) ? m_elementDefault : m_elementValue;
+SizeType m_elementCount;
+T m_elementDefault;
+T m_elements[maximumElements]{};
+SlotType m_slots[slotCount]{};
+
+[[nodiscard]] constexpr SizeType SlotIndex(const T& element) const noexcept
+{
+
+auto i{HashValue(element) & (slotCount - 1)};
+while ((0 != m_slots[i]) and not AreEqual(element, m_elements[m_slots[i] - 1]))
+i = (i + 1) & (slotCount - 1);
+return i;
+}
+
+constexpr void Insert(const T& element) noexcept
+{
+const auto i{SlotIndex(element)};
+if (0 == m_slots[i])
+{
+m_elements[m_elementCount++] = element;
+m_slots[i] = static_cast<SlotType>(m_elementCount);
+}
+}
+
+[[nodiscard]] constexpr bool IsUniqueElementBy(const auto& f, const T& element) const noexcept
+{
+auto result{true};
+for (SizeType i{0}; (result and (i < m_elementCount)); ++i)
+result = not AreEqualBy(f, element, m_elements[i]);
+return result;
 }
 
 public:
-using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Repeat>;
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Set>;
 using size_type = SizeType;
 using value_type = T;
 
-constexpr explicit Repeat(const T& t) noexcept
-    : m_elementCount{maximumElements}, m_elementDefault{T{}}, m_elementValue{t} {
+constexpr HashSet() noexcept : m_elementCount(0), m_elementDefault(T{})
+{
 }
 
-constexpr Repeat(const Repeat& other) = default;
-constexpr Repeat(Repeat&& other) = default;
+template <typename... Args>
+constexpr explicit HashSet(Args... elements) noexcept : m_elementCount(0), m_elementDefault(T{})
+{
+static_assert(sizeof...(Args) <= MaximumCount(), "HashSet initialized with too many elements");
+(Insert(elements), ...);
+}
 
-[[nodiscard]] constexpr Iterator begin() const noexcept {
-return Iterator{*this, 0};
+constexpr HashSet(const HashSet& other) noexcept = default;
+constexpr HashSet(HashSet&& other) noexcept = default;
+
+private:
+using Iterator = const T*;
+
+public:
+[[nodiscard]] constexpr Iterator begin() const noexcept
+{
+return m_elements;
 }
 
-[[nodiscard]] constexpr Iterator end() const noexcept {
-return Iterator{*this, m_elementCount};
+[[nodiscard]] constexpr Iterator end() const noexcept
+{
+return m_elements + m_elementCount;
 }
 
-[[nodiscard]] constexpr T operator[](const SizeType index) const noexcept override {
-return ValueAtIndex(index);
+[[nodiscard]] constexpr T operator[](const SizeType index) const noexcept
+{
+return At(index);
+}
+
+[[nodiscard]] constexpr T operator()(const T& t) const noexcept
+{
+return Contains(t) ? t : m_elementDefault;
+}
+
+constexpr HashSet& operator=(const HashSet& other) noexcept = default;
+
+constexpr HashSet& operator=(HashSet&& other) noexcept = default;
+
+[[nodiscard]] constexpr const T& At(const SizeType index) const noexcept
+{
+return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
 }
 
-[[nodiscard]] constexpr SizeType Count() const noexcept override {
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
 return m_elementCount;
 }
 
-[[nodiscard]] constexpr const T& DefaultElement() const noexcept {
+[[nodiscard]] constexpr bool ContainsBy(const auto& f, const T& element) const noexcept
+{
+return not IsUniqueElementBy(f, element);
+}
+
+[[nodiscard]] constexpr bool Contains(const T& element) const noexcept
+{
+return 0 != m_slots[SlotIndex(element)];
+}
+
+[[nodiscard]] constexpr const T& DefaultElement() const noexcept
+{
 return m_elementDefault;
 }
 
 [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
-                                                            const T& element) const noexcept override {
-return (index < m_elementCount) and AreEqual(ValueAtIndex(index), element);
+const T& element) const noexcept
+{
+return (index < m_elementCount) and Contains(element);
 }
 
-[[nodiscard]] static consteval auto MaximumCount() noexcept {
+[[nodiscard]] static consteval SizeType MaximumCount() noexcept
+{
 return maximumElements;
 }
 };
 
-template <typename T>
-Repeat(T) -> Repeat<CljonicCollectionMaximumElementCount, T>;
+template <typename... Args>
+HashSet(Args...) -> HashSet<std::common_type_t<Args...>, sizeof...(Args)>;
 
-} // namespace cljonic
+}
+
+#include <concepts>
+#include <utility>
+
+namespace cljonic
+{
+template <typename F, typename T>
+class Iterator
+{
+F m_f;
+T m_initialValue;
+T m_elementDefault;
+
+class Itr
+{
+const Iterator* m_iterator;
+SizeType m_index;
+T m_value;
+
+public:
+using value_type = T;
+using difference_type = std::ptrdiff_t;
+using pointer = T*;
+using reference = T&;
+
+constexpr Itr(const Iterator& iterator, const SizeType index) noexcept
+: m_iterator{&iterator}, m_index{index}, m_value{iterator.m_initialValue}
+{
+}
+
+[[nodiscard]] constexpr T operator*() const noexcept
+{
+return m_value;
+}
+
+constexpr Itr& operator++() noexcept
+{
+
+if (++m_index < Iterator::MaximumCount())
+m_value = m_iterator->m_f(m_value);
+else
+m_index = Iterator::MaximumCount();
+return *this;
+}
+
+[[nodiscard]] constexpr bool operator!=(const Itr& other) const noexcept
+{
+return m_index != other.m_index;
+}
+};
+
+public:
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Iterator>;
+using size_type = SizeType;
+using value_type = T;
+
+constexpr explicit Iterator(F&& f, const T& t) noexcept
+: m_f{std::forward<F>(f)}, m_initialValue{t}, m_elementDefault{T{}}
+{
+static_assert(IsUnaryFunction<F, T>,
+"Iterator constructor's first parameter is not a unary function of its second parameter");
+}
+
+constexpr Iterator(const Iterator& other) = default;
+constexpr Iterator(Iterator&& other) = default;
+
+[[nodiscard]] constexpr Itr begin() const noexcept
+{
+return Itr(*this, 0);
+}
+
+[[nodiscard]] constexpr Itr end() const noexcept
+{
+return Itr(*this, MaximumCount());
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
+return MaximumCount();
+}
+
+[[nodiscard]] constexpr const T& DefaultElement() const noexcept
+{
+return m_elementDefault;
+}
+
+[[nodiscard]] static consteval SizeType MaximumCount() noexcept
+{
+return CljonicCollectionMaximumElementCount;
+}
+};
+
+template <typename F, typename T>
+Iterator(F&&, const T&) -> Iterator<F, T>;
+
+}
 
 #include <concepts>
-#include <cstring>
-#include <initializer_list>
 #include <type_traits>
+#include <utility>
 
-namespace cljonic {
-template <ValidCljonicContainerElementType T, SizeType MaxElements>
-class Set : public IndexInterface<T> {
-static_assert(not std::floating_point<T>,
-              "Floating point types should not be compared for equality, hence Sets of floating point types are "
-              "not allowed");
+namespace cljonic
+{
+template <typename F, typename C>
+class MapView
+{
+using Collection = std::remove_cvref_t<C>;
 
-static_assert(std::equality_comparable<T>, "A Set type must be equality comparable");
+static_assert(IsCljonicCollection<Collection>, "A MapView collection must be a cljonic collection");
 
-static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+static_assert(std::invocable<const F&, typename Collection::value_type>,
+"A MapView function cannot be called with values from its cljonic collection");
 
-static_assert(maximumElements == MaxElements,
-              "Attempt to create a Set bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+using ElementType = std::decay_t<std::invoke_result_t<const F&, typename Collection::value_type>>;
+using CollectionIteratorType = decltype(std::declval<const Collection&>().begin());
+
+F m_f;
+std::conditional_t<std::is_lvalue_reference_v<C>, const Collection&, Collection> m_collection;
+ElementType m_elementDefault;
+
+class MapViewIterator
+{
+const F& m_f;
+CollectionIteratorType m_iterator;
+
+public:
+constexpr MapViewIterator(const F& f, const CollectionIteratorType& iterator) noexcept
+: m_f(f), m_iterator(iterator)
+{
+}
+
+[[nodiscard]] constexpr ElementType operator*() const noexcept
+{
+return m_f(*m_iterator);
+}
+
+[[nodiscard]] constexpr ElementType operator[](const SizeType index) const noexcept
+requires requires(const CollectionIteratorType& it, const SizeType i) { it[i]; }
+{
+return m_f(m_iterator[index]);
+}
+
+constexpr MapViewIterator& operator++() noexcept
+{
+++m_iterator;
+return *this;
+}
+
+[[nodiscard]] constexpr bool operator!=(const MapViewIterator& other) const noexcept
+{
+return m_iterator != other.m_iterator;
+}
+
+constexpr MapViewIterator& operator+=(const int value) noexcept
+{
+m_iterator += value;
+return *this;
+}
+
+[[nodiscard]] constexpr MapViewIterator operator+(const int value) const noexcept
+{
+MapViewIterator temp = *this;
+temp += value;
+return temp;
+}
+};
+
+public:
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::View>;
+using size_type = SizeType;
+using value_type = ElementType;
+
+template <typename G, typename D>
+constexpr MapView(G&& f, D&& collection) noexcept
+: m_f(std::forward<G>(f)), m_collection(std::forward<D>(collection)), m_elementDefault(ElementType{})
+{
+}
+
+constexpr MapView(const MapView& other) noexcept = default;
+constexpr MapView(MapView&& other) noexcept = default;
+
+[[nodiscard]] constexpr MapViewIterator begin() const noexcept
+{
+return MapViewIterator{m_f, m_collection.begin()};
+}
+
+[[nodiscard]] constexpr MapViewIterator end() const noexcept
+{
+return MapViewIterator{m_f, m_collection.end()};
+}
+
+[[nodiscard]] constexpr ElementType operator[](const SizeType index) const noexcept
+{
+return (index < m_collection.Count()) ? m_f(m_collection[index]) : m_elementDefault;
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
+return m_collection.Count();
+}
+
+[[nodiscard]] constexpr const ElementType& DefaultElement() const noexcept
+{
+return m_elementDefault;
+}
+
+[[nodiscard]] static consteval SizeType MaximumCount() noexcept
+{
+return Collection::MaximumCount();
+}
+};
+
+template <typename F, typename C>
+MapView(F&&, C&&) -> MapView<std::decay_t<F>, C>;
+
+}
+
+#include <concepts>
+
+namespace cljonic
+{
+template <int... StartEndStep>
+class Range
+{
+private:
+static_assert(sizeof...(StartEndStep) <= 3, "Number of Range parameters must be less than or equal to three");
+
+using Iterator = CollectionIterator<Range>;
 
 SizeType m_elementCount;
-const T m_elementDefault;
-T m_elements[maximumElements]{};
+int m_elementDefault;
+int m_elementStart;
+int m_elementStep;
+
+static constexpr auto RangeCount(const int start, const int end, const int step) noexcept
+{
+return (0 == step) ? 0 : ((end - start) / step) + ((((end - start) % step) == 0) ? 0 : 1);
+}
+
+static constexpr int values[] = {StartEndStep...};
+
+static constexpr auto MaxElements = []() constexpr
+{
+if constexpr (sizeof...(StartEndStep) == 1)
+{
+if constexpr (values[0] < 0)
+return static_cast<SizeType>(0);
+else
+return static_cast<SizeType>(values[0]);
+}
+else if constexpr (sizeof...(StartEndStep) == 2)
+{
+if constexpr (values[1] <= values[0])
+return static_cast<SizeType>(0);
+else
+return static_cast<SizeType>(values[1] - values[0]);
+}
+else if constexpr (sizeof...(StartEndStep) == 3)
+{
+
+if constexpr ((0 == values[2]) and (values[0] == values[1]))
+return static_cast<SizeType>(0);
+else if constexpr (0 == values[2])
+return CljonicCollectionMaximumElementCount;
+else if constexpr (values[2] < 0)
+{
+if constexpr (values[0] <= values[1])
+return static_cast<SizeType>(0);
+else
+return static_cast<SizeType>(RangeCount(values[0], values[1], values[2]));
+}
+else
+{
+if constexpr (values[1] <= values[0])
+return static_cast<SizeType>(0);
+else
+return static_cast<SizeType>(RangeCount(values[0], values[1], values[2]));
+}
+}
+else
+{
+return CljonicCollectionMaximumElementCount;
+}
+}();
+
+static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+
+static_assert(maximumElements == MaxElements,
+"Attempt to create a Range bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+
+constexpr void InitializeMembers(const int count, const int start, const int step) noexcept
+{
+m_elementCount = MinArgument(static_cast<SizeType>(count), CljonicCollectionMaximumElementCount);
+m_elementDefault = 0;
+m_elementStart = start;
+m_elementStep = step;
+}
+
+constexpr void Initialize() noexcept
+{
+InitializeMembers(CljonicCollectionMaximumElementCount, 0, 1);
+}
+
+constexpr void InitializeEnd(const int end) noexcept
+{
+if (end <= 0)
+InitializeMembers(0, 0, 1);
+else
+InitializeMembers(end, 0, 1);
+}
+
+constexpr void InitializeStartEnd(const int start, const int end) noexcept
+{
+if (end <= start)
+InitializeMembers(0, 0, 1);
+else
+InitializeMembers((end - start), start, 1);
+}
+
+constexpr void InitializeStartEndStepWithNegativeStep(const int start, const int end, const int step) noexcept
+{
+if (start <= end)
+InitializeMembers(0, 0, step);
+else
+{
+const int count{RangeCount(start, end, step)};
+InitializeMembers(count, start, step);
+}
+}
+
+constexpr void InitializeStartEndStepWithPositiveStep(const int start, const int end, const int step) noexcept
+{
+if (end <= start)
+InitializeMembers(0, 0, step);
+else
+{
+const int count{RangeCount(start, end, step)};
+InitializeMembers(count, start, step);
+}
+}
+
+constexpr void InitializeStartEndStep(const int start, const int end, const int step) noexcept
+{
+
+if ((0 == step) and (start == end))
+InitializeMembers(0, 0, 0);
+else if (0 == step)
+InitializeMembers(CljonicCollectionMaximumElementCount, start, 0);
+else if (step < 0)
+InitializeStartEndStepWithNegativeStep(start, end, step);
+else
+InitializeStartEndStepWithPositiveStep(start, end, step);
+}
+
+constexpr auto ValueAtIndex(const SizeType index) const noexcept
+{
+return ((0 == m_elementCount) or (index >= m_elementCount))
+? m_elementDefault
+: (m_elementStart + (static_cast<int>(index) * m_elementStep));
+}
+
+public:
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Range>;
+using size_type = SizeType;
+using value_type = int;
+
+constexpr Range() noexcept
+: m_elementCount{static_cast<SizeType>(0)}, m_elementDefault{0}, m_elementStart{0}, m_elementStep{0}
+{
+
+if constexpr (sizeof...(StartEndStep) == 1)
+{
+InitializeEnd(values[0]);
+}
+else if constexpr (sizeof...(StartEndStep) == 2)
+{
+InitializeStartEnd(values[0], values[1]);
+}
+else if constexpr (sizeof...(StartEndStep) == 3)
+{
+InitializeStartEndStep(values[0], values[1], values[2]);
+}
+else
+{
+Initialize();
+}
+}
+
+constexpr Range(const Range& other) = default;
+constexpr Range(Range&& other) = default;
+
+[[nodiscard]] constexpr Iterator begin() const noexcept
+{
+return Iterator{*this, 0};
+}
+
+[[nodiscard]] constexpr Iterator end() const noexcept
+{
+return Iterator{*this, m_elementCount};
+}
+
+[[nodiscard]] constexpr int operator[](const SizeType index) const noexcept
+{
+return ValueAtIndex(index);
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
+return m_elementCount;
+}
+
+[[nodiscard]] constexpr const int& DefaultElement() const noexcept
+{
+return m_elementDefault;
+}
+
+[[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
+const int& element) const noexcept
+{
+return (index < m_elementCount) and AreEqual(ValueAtIndex(index), element);
+}
+
+[[nodiscard]] static consteval auto MaximumCount() noexcept
+{
+return maximumElements;
+}
+};
+
+Range() -> Range<>;
+
+}
+
+#include <concepts>
+#include <limits>
+
+namespace cljonic
+{
+template <SizeType MaxElements, typename T>
+class Repeat
+{
+using Iterator = CollectionIterator<Repeat>;
+
+static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+
+static_assert(maximumElements == MaxElements,
+"Attempt to create a Repeat bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+
+const SizeType m_elementCount;
+const T m_elementDefault;
+const T m_elementValue;
+
+public:
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Repeat>;
+using size_type = SizeType;
+using value_type = T;
+
+constexpr explicit Repeat(const T& t) noexcept
+: m_elementCount{maximumElements}, m_elementDefault{T{}}, m_elementValue{t}
+{
+}
+
+constexpr Repeat(const Repeat& other) = default;
+constexpr Repeat(Repeat&& other) = default;
+
+[[nodiscard]] constexpr Iterator begin() const noexcept
+{
+return Iterator{*this, 0};
+}
+
+[[nodiscard]] constexpr Iterator end() const noexcept
+{
+return Iterator{*this, m_elementCount};
+}
+
+[[nodiscard]] constexpr T operator[](const SizeType index) const noexcept
+{
+return At(index);
+}
+
+[[nodiscard]] constexpr const T& At(const SizeType index) const noexcept
+{
+return (index < m_elementCount) ? m_elementValue : m_elementDefault;
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
+return m_elementCount;
+}
+
+[[nodiscard]] constexpr const T& DefaultElement() const noexcept
+{
+return m_elementDefault;
+}
+
+[[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
+const T& element) const noexcept
+{
+return (index < m_elementCount) and AreEqual(m_elementValue, element);
+}
+
+[[nodiscard]] static consteval auto MaximumCount() noexcept
+{
+return maximumElements;
+}
+};
+
+template <typename T>
+Repeat(T) -> Repeat<CljonicCollectionMaximumElementCount, T>;
+
+}
+
+#include <concepts>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+
+namespace cljonic
+{
+template <ValidCljonicContainerElementType T, SizeType MaxElements>
+class Set
+{
+static_assert(not std::floating_point<T>,
+"Floating point types should not be compared for equality, hence Sets of floating point types are "
+"not allowed");
+
+static_assert(std::equality_comparable<T>, "A Set type must be equality comparable");
+
+static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+
+static_assert(maximumElements == MaxElements,
+"Attempt to create a Set bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+
+SizeType m_elementCount;
+const T m_elementDefault;
+T m_elements[maximumElements];
+
+[[nodiscard]] constexpr bool IsUniqueElementBy(const auto& f, const T& element) const noexcept
+{
+auto result{true};
+for (SizeType i{0}; (result and (i < m_elementCount)); ++i)
+result = not AreEqualBy(f, element, m_elements[i]);
+return result;
+}
+
+[[nodiscard]] constexpr bool IsUniqueElement(const T& element) const noexcept
+{
+if constexpr (IsBulkSearchable<T, T>)
+{
+return CLJONIC_INVALID_INDEX == IndexOfElement(m_elements, m_elementCount, element);
+}
+else
+{
+auto result{true};
+for (SizeType i{0}; (result and (i < m_elementCount)); ++i)
+result = not AreEqual(element, m_elements[i]);
+return result;
+}
+}
+
+public:
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Set>;
+using size_type = SizeType;
+using value_type = T;
+
+constexpr Set() noexcept : m_elementCount(0), m_elementDefault(T{})
+{
+InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+}
+
+template <typename... Args>
+constexpr explicit Set(Args... elements) noexcept : m_elementCount(0), m_elementDefault(T{})
+{
+static_assert(sizeof...(Args) <= MaximumCount(), "Set initialized with too many elements");
+((IsUniqueElement(elements) ? (m_elements[m_elementCount++] = elements, void()) : void()), ...);
+InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+}
+
+constexpr Set(const Set& other) noexcept
+: m_elementCount(other.m_elementCount), m_elementDefault(other.m_elementDefault)
+{
+for (SizeType i{0}; i < m_elementCount; ++i)
+m_elements[i] = other.m_elements[i];
+InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+}
+
+constexpr Set(Set&& other) noexcept : Set(static_cast<const Set&>(other))
+{
+}
+
+private:
+using Iterator = const T*;
+
+public:
+[[nodiscard]] constexpr Iterator begin() const noexcept
+{
+return m_elements;
+}
+
+[[nodiscard]] constexpr Iterator end() const noexcept
+{
+return m_elements + m_elementCount;
+}
+
+[[nodiscard]] constexpr T operator[](const SizeType index) const noexcept
+{
+return At(index);
+}
+
+[[nodiscard]] constexpr T operator()(const T& t) const noexcept
+{
+return Contains(t) ? t : m_elementDefault;
+}
+
+constexpr Set& operator=(const Set& other) noexcept
+{
+if (this != &other)
+{
+m_elementCount = other.m_elementCount;
+m_elementDefault = other.m_elementDefault;
+for (SizeType i{0}; i < m_elementCount; ++i)
+m_elements[i] = other.m_elements[i];
+}
+return *this;
+}
+
+constexpr Set& operator=(Set&& other) noexcept
+{
+return *this = other;
+}
+
+[[nodiscard]] constexpr const T& At(const SizeType index) const noexcept
+{
+return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
+return m_elementCount;
+}
+
+[[nodiscard]] constexpr bool ContainsBy(const auto& f, const T& element) const noexcept
+{
+return not IsUniqueElementBy(f, element);
+}
+
+[[nodiscard]] constexpr bool Contains(const T& element) const noexcept
+{
+return not IsUniqueElement(element);
+}
+
+[[nodiscard]] constexpr const T& DefaultElement() const noexcept
+{
+return m_elementDefault;
+}
+
+[[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
+const T& element) const noexcept
+{
+return (index < m_elementCount) and Contains(element);
+}
+
+[[nodiscard]] static consteval SizeType MaximumCount() noexcept
+{
+return maximumElements;
+}
+};
+
+template <typename... Args>
+Set(Args...) -> Set<std::common_type_t<Args...>, sizeof...(Args)>;
+
+}
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+namespace cljonic
+{
+template <typename C>
+class SliceView
+{
+using Collection = std::remove_cvref_t<C>;
+
+static_assert(IsCljonicCollection<Collection>, "A SliceView collection must be a cljonic collection");
+
+static_assert(IsRandomAccessCollection<Collection>,
+"A SliceView collection must be a random access collection, not a FilterView");
+
+using ElementType = typename Collection::value_type;
+
+std::conditional_t<std::is_lvalue_reference_v<C>, const Collection&, Collection> m_collection;
+SizeType m_start;
+SizeType m_elementCount;
+ElementType m_elementDefault;
+
+template <typename Iterator>
+[[nodiscard]] static constexpr Iterator Advance(Iterator it, const SizeType n) noexcept
+{
+it += static_cast<int>(n);
+return it;
+}
+
+public:
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::View>;
+using size_type = SizeType;
+using value_type = ElementType;
+
+template <typename D>
+constexpr SliceView(D&& collection, const SizeType start, const SizeType end) noexcept
+: m_collection(std::forward<D>(collection)),
+m_start(MinArgument(start, m_collection.Count())),
+m_elementCount(MinArgument(end, m_collection.Count()) - MinArgument(start, end, m_collection.Count())),
+m_elementDefault(ElementType{})
+{
+}
+
+template <typename D>
+constexpr SliceView(D&& collection, const SizeType start) noexcept
+: SliceView(std::forward<D>(collection), start, CljonicCollectionMaximumElementCount)
+{
+}
+
+constexpr SliceView(const SliceView& other) noexcept = default;
+constexpr SliceView(SliceView&& other) noexcept = default;
+
+[[nodiscard]] constexpr auto begin() const noexcept
+{
+return Advance(m_collection.begin(), m_start);
+}
+
+[[nodiscard]] constexpr auto end() const noexcept
+{
+return Advance(m_collection.begin(), m_start + m_elementCount);
+}
+
+[[nodiscard]] constexpr ElementType operator[](const SizeType index) const noexcept
+{
+return (index < m_elementCount) ? m_collection[m_start + index] : m_elementDefault;
+}
+
+[[nodiscard]] constexpr const ElementType& At(const SizeType index) const noexcept
+requires requires(const Collection& c, const SizeType i) {
+{ c.At(i) } -> std::same_as<const ElementType&>;
+}
+{
+return (index < m_elementCount) ? m_collection.At(m_start + index) : m_elementDefault;
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
+return m_elementCount;
+}
+
+[[nodiscard]] constexpr const ElementType& DefaultElement() const noexcept
+{
+return m_elementDefault;
+}
+
+[[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
+const ElementType& element) const noexcept
+{
+return (index < m_elementCount) and AreEqual(ElementAt(m_collection, m_start + index), element);
+}
+
+[[nodiscard]] static consteval SizeType MaximumCount() noexcept
+{
+return Collection::MaximumCount();
+}
+};
+
+template <typename C>
+SliceView(C&&, SizeType, SizeType) -> SliceView<C>;
+
+template <typename C>
+SliceView(C&&, SizeType) -> SliceView<C>;
+
+}
+
+#include <concepts>
+#include <type_traits>
+
+namespace cljonic
+{
+template <ValidCljonicContainerElementType T, SizeType MaxElements>
+class SortedSet
+{
+static_assert(not std::floating_point<T>,
+"Floating point types should not be compared for equality, hence SortedSets of floating point types "
+"are not allowed");
+
+static_assert(std::totally_ordered<T> or IsCString<T>, "A SortedSet type must be totally ordered");
+
+static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+
+static_assert(maximumElements == MaxElements,
+"Attempt to create a SortedSet bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+
+SizeType m_elementCount;
+T m_elementDefault;
+T m_elements[maximumElements];
+
+[[nodiscard]] constexpr SizeType LowerBound(const T& element) const noexcept
+{
+
+SizeType low{0};
+SizeType high{m_elementCount};
+while (low < high)
+{
+const auto middle{low + ((high - low) / 2)};
+if (FirstLessThanSecond(m_elements[middle], element))
+low = middle + 1;
+else
+high = middle;
+}
+return low;
+}
+
+constexpr void Insert(const T& element) noexcept
+{
+const auto index{LowerBound(element)};
+if ((index == m_elementCount) or not AreEqual(element, m_elements[index]))
+{
+for (auto i{m_elementCount}; i > index; --i)
+m_elements[i] = m_elements[i - 1];
+m_elements[index] = element;
+++m_elementCount;
+}
+}
+
+[[nodiscard]] constexpr bool IsUniqueElementBy(const auto& f, const T& element) const noexcept
+{
+auto result{true};
+for (SizeType i{0}; (result and (i < m_elementCount)); ++i)
+result = not AreEqualBy(f, element, m_elements[i]);
+return result;
+}
+
+public:
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Set>;
+using cljonic_sorted_set = std::true_type;
+using size_type = SizeType;
+using value_type = T;
+
+constexpr SortedSet() noexcept : m_elementCount(0), m_elementDefault(T{})
+{
+InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+}
+
+template <typename... Args>
+constexpr explicit SortedSet(Args... elements) noexcept : m_elementCount(0), m_elementDefault(T{})
+{
+static_assert(sizeof...(Args) <= MaximumCount(), "SortedSet initialized with too many elements");
+(Insert(elements), ...);
+InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+}
+
+constexpr SortedSet(const SortedSet& other) noexcept
+: m_elementCount(other.m_elementCount), m_elementDefault(other.m_elementDefault)
+{
+for (SizeType i{0}; i < m_elementCount; ++i)
+m_elements[i] = other.m_elements[i];
+InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+}
+
+constexpr SortedSet(SortedSet&& other) noexcept : SortedSet(static_cast<const SortedSet&>(other))
+{
+}
+
+private:
+using Iterator = const T*;
+
+public:
+[[nodiscard]] constexpr Iterator begin() const noexcept
+{
+return m_elements;
+}
+
+[[nodiscard]] constexpr Iterator end() const noexcept
+{
+return m_elements + m_elementCount;
+}
+
+[[nodiscard]] constexpr T operator[](const SizeType index) const noexcept
+{
+return At(index);
+}
+
+[[nodiscard]] constexpr T operator()(const T& t) const noexcept
+{
+return Contains(t) ? t : m_elementDefault;
+}
+
+constexpr SortedSet& operator=(const SortedSet& other) noexcept
+{
+if (this != &other)
+{
+m_elementCount = other.m_elementCount;
+m_elementDefault = other.m_elementDefault;
+for (SizeType i{0}; i < m_elementCount; ++i)
+m_elements[i] = other.m_elements[i];
+}
+return *this;
+}
+
+constexpr SortedSet& operator=(SortedSet&& other) noexcept
+{
+return *this = other;
+}
+
+[[nodiscard]] constexpr const T& At(const SizeType index) const noexcept
+{
+return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
+return m_elementCount;
+}
+
+[[nodiscard]] constexpr bool ContainsBy(const auto& f, const T& element) const noexcept
+{
+
+return not IsUniqueElementBy(f, element);
+}
+
+[[nodiscard]] constexpr bool Contains(const T& element) const noexcept
+{
+const auto index{LowerBound(element)};
+return (index < m_elementCount) and AreEqual(element, m_elements[index]);
+}
+
+[[nodiscard]] constexpr const T& DefaultElement() const noexcept
+{
+return m_elementDefault;
+}
+
+[[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
+const T& element) const noexcept
+{
+return (index < m_elementCount) and Contains(element);
+}
+
+[[nodiscard]] static consteval SizeType MaximumCount() noexcept
+{
+return maximumElements;
+}
+};
+
+template <typename... Args>
+SortedSet(Args...) -> SortedSet<std::common_type_t<Args...>, sizeof...(Args)>;
+
+}
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace cljonic
+{
+template <typename T>
+class SpanView
+{
+const T* m_elements;
+SizeType m_elementCount;
+T m_elementDefault;
+
+public:
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::View>;
+using size_type = SizeType;
+using value_type = T;
+
+constexpr SpanView() noexcept : m_elements(nullptr), m_elementCount(0), m_elementDefault(T{})
+{
+}
+
+template <typename C>
+requires requires(const C& c) {
+{ c.data() } -> std::convertible_to<const T*>;
+{ c.size() } -> std::convertible_to<std::size_t>;
+}
+
+constexpr explicit SpanView(const C& contiguous) noexcept
+: m_elements(contiguous.data()),
+m_elementCount(MinArgument(static_cast<SizeType>(contiguous.size()), CljonicCollectionMaximumElementCount)),
+m_elementDefault(T{})
+{
+assert(static_cast<SizeType>(contiguous.size()) <= CljonicCollectionMaximumElementCount);
+}
+
+constexpr SpanView(const T* elements, const SizeType count) noexcept
+: m_elements(elements), m_elementCount(MinArgument(count, CljonicCollectionMaximumElementCount)),
+m_elementDefault(T{})
+{
+assert(count <= CljonicCollectionMaximumElementCount);
+}
+
+constexpr SpanView(const SpanView& other) noexcept = default;
+constexpr SpanView(SpanView&& other) noexcept = default;
+
+constexpr SpanView& operator=(const SpanView& other) noexcept = default;
+
+constexpr SpanView& operator=(SpanView&& other) noexcept = default;
+
+[[nodiscard]] constexpr const T* begin() const noexcept
+{
+return m_elements;
+}
+
+[[nodiscard]] constexpr const T* end() const noexcept
+{
+return m_elements + m_elementCount;
+}
+
+[[nodiscard]] constexpr T operator[](const SizeType index) const noexcept
+{
+return At(index);
+}
+
+[[nodiscard]] constexpr const T& At(const SizeType index) const noexcept
+{
+return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
+return m_elementCount;
+}
+
+[[nodiscard]] constexpr const T* Data() const noexcept
+{
+return m_elements;
+}
+
+[[nodiscard]] constexpr const T& DefaultElement() const noexcept
+{
+return m_elementDefault;
+}
+
+[[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
+const T& element) const noexcept
+{
+return (index < m_elementCount) and AreEqual(m_elements[index], element);
+}
+
+[[nodiscard]] static consteval SizeType MaximumCount() noexcept
+{
+return CljonicCollectionMaximumElementCount;
+}
+};
+
+template <typename C>
+SpanView(const C&) -> SpanView<std::remove_cvref_t<decltype(*std::declval<const C&>().data())>>;
+
+}
+
+#include <cstring>
+#include <initializer_list>
+#include <span>
+#include <type_traits>
+
+namespace cljonic
+{
+template <SizeType MaxElements>
+class String
+{
+using Iterator = const char*;
+
+static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+
+static_assert(maximumElements == MaxElements,
+"Attempt to create a String bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+
+SizeType m_elementCount;
+const char m_elementDefault;
+char m_elements[maximumElements + 1];
+
+template <SizeType N>
+constexpr friend void MConj(String<N>& string, const char c);
+
+public:
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::String>;
+using size_type = SizeType;
+using value_type = char;
+
+constexpr String() noexcept : m_elementCount(0), m_elementDefault('\0')
+{
+m_elements[0] = '\0';
+InitializeUnusedElements(m_elements, (m_elementCount + 1), (maximumElements + 1));
+}
+
+template <typename... Args>
+requires(std::same_as<std::remove_cvref_t<Args>, char> && ...)
+constexpr explicit String(Args&&... args) noexcept : m_elementCount(0), m_elementDefault('\0')
+{
+static_assert(sizeof...(Args) <= MaximumCount(), "String initialized with too many elements");
+((m_elements[m_elementCount++] = args), ...);
+m_elements[m_elementCount] = '\0';
+InitializeUnusedElements(m_elements, (m_elementCount + 1), (maximumElements + 1));
+}
+
+constexpr explicit String(const char* c_str) noexcept : m_elementCount(0), m_elementDefault('\0')
+{
+while ((m_elementCount < MaximumCount()) and ('\0' != c_str[m_elementCount]))
+{
+m_elements[m_elementCount] = c_str[m_elementCount];
+m_elementCount += 1;
+}
+m_elements[m_elementCount] = '\0';
+InitializeUnusedElements(m_elements, (m_elementCount + 1), (maximumElements + 1));
+}
+
+constexpr String(const String& other) noexcept
+: m_elementCount(other.m_elementCount), m_elementDefault(other.m_elementDefault)
+{
+for (SizeType i{0}; i <= m_elementCount; ++i)
+m_elements[i] = other.m_elements[i];
+InitializeUnusedElements(m_elements, (m_elementCount + 1), (maximumElements + 1));
+}
+
+constexpr String(String&& other) noexcept : String(static_cast<const String&>(other))
+{
+}
+
+[[nodiscard]] constexpr Iterator begin() const noexcept
+{
+return m_elements;
+}
+
+[[nodiscard]] constexpr Iterator end() const noexcept
+{
+return m_elements + m_elementCount;
+}
+
+[[nodiscard]] constexpr char operator[](const SizeType index) const noexcept
+{
+return At(index);
+}
+
+[[nodiscard]] constexpr char operator()(const SizeType index) const noexcept
+{
+return this->operator[](index);
+}
+
+[[nodiscard]] constexpr std::span<const char> AsSpan() const noexcept
+{
+return std::span<const char>{Data(), m_elementCount};
+}
+
+template <typename StringView>
+[[nodiscard]] constexpr StringView AsStringView() const noexcept
+{
+return StringView{Data(), m_elementCount};
+}
+
+[[nodiscard]] constexpr const char& At(const SizeType index) const noexcept
+{
+return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
+return m_elementCount;
+}
+
+[[nodiscard]] constexpr const char* Data() const noexcept
+{
+return m_elements;
+}
+
+[[nodiscard]] constexpr const char& DefaultElement() const noexcept
+{
+return m_elementDefault;
+}
+
+[[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
+const char& element) const noexcept
+{
+return (index < m_elementCount) and AreEqual(m_elements[index], element);
+}
+
+[[nodiscard]] static consteval SizeType MaximumCount() noexcept
+{
+return maximumElements;
+}
+};
+
+template <SizeType N>
+String(const char (&)[N]) -> String<N - 1>;
+
+template <typename... Args>
+String(Args...) -> String<sizeof...(Args)>;
+
+template <SizeType N>
+constexpr void MConj(String<N>& string, const char c)
+{
+if (string.m_elementCount < string.MaximumCount())
+{
+string.m_elements[string.m_elementCount++] = c;
+string.m_elements[string.m_elementCount] = '\0';
+}
+}
+
+}
+
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace cljonic
+{
+
+template <typename T>
+concept IsNumberInteger = std::integral<T> and not std::same_as<T, bool> and not std::same_as<T, char> and
+not std::same_as<T, wchar_t> and not std::same_as<T, char8_t> and
+not std::same_as<T, char16_t> and not std::same_as<T, char32_t>;
+
+template <typename T>
+concept IsNumberFloating = std::same_as<T, float> or std::same_as<T, double>;
+
+template <typename T>
+[[nodiscard]] constexpr bool ParseIntegerText(const Text& text, T& result) noexcept
+{
+using U = std::make_unsigned_t<T>;
+const auto negative{(0 < text.count) and ('-' == text.chars[0])};
+auto i{(negative or ((0 < text.count) and ('+' == text.chars[0]))) ? SizeType{1} : SizeType{0}};
+if ((i == text.count) or (negative and std::is_unsigned_v<T>))
+return false;
+const auto limit{negative ? static_cast<U>(static_cast<U>(std::numeric_limits<T>::max()) + 1u)
+: static_cast<U>(std::numeric_limits<T>::max())};
+const auto limitTens{static_cast<U>(limit / 10)};
+const auto limitUnits{static_cast<U>(limit % 10)};
+U value{0};
+for (; i < text.count; ++i)
+{
+const auto digit{static_cast<U>(static_cast<unsigned char>(text.chars[i]) - '0')};
+if ((digit > 9) or (value > limitTens) or ((value == limitTens) and (digit > limitUnits)))
+return false;
+value = static_cast<U>((value * 10u) + digit);
+}
+result = negative ? static_cast<T>(static_cast<U>(0u - value)) : static_cast<T>(value);
+return true;
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto IntegerString(const T t) noexcept
+{
+using U = std::make_unsigned_t<T>;
+constexpr SizeType maximumCount{std::numeric_limits<T>::digits10 + 2};
+char chars[maximumCount + 1]{};
+auto negative{false};
+auto value{static_cast<U>(t)};
+if constexpr (std::is_signed_v<T>)
+{
+negative = (t < 0);
+if (negative)
+value = static_cast<U>(0u - value);
+}
+auto start{maximumCount};
+do
+{
+chars[--start] = static_cast<char>('0' + (value % 10u));
+value = static_cast<U>(value / 10u);
+} while (0 != value);
+if (negative)
+chars[--start] = '-';
+return String<maximumCount>{chars + start};
+}
+
+struct DecimalNumber
+{
+std::uint64_t digits;
+int exponent;
+bool negative;
+bool truncated;
+};
+
+[[nodiscard]] constexpr bool IsNameOfText(const Text& text, const SizeType start, const char* name) noexcept
+{
+SizeType i{0};
+for (; '\0' != name[i]; ++i)
+if (((start + i) >= text.count) or ((text.chars[start + i] | 0x20) != name[i]))
+return false;
+return (start + i) == text.count;
+}
+
+[[nodiscard]] constexpr bool ParseDecimalText(const Text& text, DecimalNumber& number) noexcept
+{
+
+constexpr SizeType maximumSignificantCount{19};
+const auto IsDigitAt = [&](const SizeType index) {
+return (index < text.count) and (static_cast<unsigned char>(text.chars[index] - '0') <= 9);
+};
+const auto DigitAt = [&](const SizeType index) { return static_cast<std::uint64_t>(text.chars[index] - '0'); };
+SizeType i{0};
+const auto negative{(0 < text.count) and ('-' == text.chars[0])};
+if (negative or ((0 < text.count) and ('+' == text.chars[0])))
+++i;
+const auto mantissaStart{i};
+while ((i < text.count) and ('0' == text.chars[i]))
+++i;
+std::uint64_t digits{0};
+SizeType significantCount{0};
+auto exponent{0};
+auto truncated{false};
+for (; IsDigitAt(i); ++i)
+{
+if (significantCount < maximumSignificantCount)
+{
+digits = (digits * 10) + DigitAt(i);
+++significantCount;
+}
+else
+{
+++exponent;
+truncated = truncated or ('0' != text.chars[i]);
+}
+}
+auto pointCount{SizeType{0}};
+if ((i < text.count) and ('.' == text.chars[i]))
+{
+pointCount = 1;
+++i;
+if (0 == significantCount)
+for (; (i < text.count) and ('0' == text.chars[i]); ++i)
+--exponent;
+for (; IsDigitAt(i); ++i)
+{
+if (significantCount < maximumSignificantCount)
+{
+digits = (digits * 10) + DigitAt(i);
+++significantCount;
+--exponent;
+}
+else
+{
+truncated = truncated or ('0' != text.chars[i]);
+}
+}
+}
+if ((i - mantissaStart) == pointCount)
+return false;
+if ((i < text.count) and ('e' == (text.chars[i] | 0x20)))
+{
+++i;
+const auto negativeExponent{(i < text.count) and ('-' == text.chars[i])};
+if (negativeExponent or ((i < text.count) and ('+' == text.chars[i])))
+++i;
+if (not IsDigitAt(i))
+return false;
+auto exponentValue{0};
+for (; IsDigitAt(i); ++i)
+if (exponentValue < 100000)
+exponentValue = (exponentValue * 10) + static_cast<int>(DigitAt(i));
+exponent += negativeExponent ? -exponentValue : exponentValue;
+}
+number = DecimalNumber{digits, exponent, negative, truncated};
+return i == text.count;
+}
+
+class BigInteger
+{
+static constexpr SizeType maximumLimbs{128};
+
+std::uint32_t m_limbs[maximumLimbs];
+SizeType m_count;
+
+public:
+constexpr explicit BigInteger(const std::uint64_t value) noexcept : m_limbs{}, m_count{0}
+{
+m_limbs[0] = static_cast<std::uint32_t>(value);
+m_limbs[1] = static_cast<std::uint32_t>(value >> 32);
+m_count = (0 != m_limbs[1]) ? 2 : ((0 != m_limbs[0]) ? 1 : 0);
+}
+
+[[nodiscard]] constexpr bool IsZero() const noexcept
+{
+return 0 == m_count;
+}
+
+[[nodiscard]] constexpr SizeType BitCount() const noexcept
+{
+if (0 == m_count)
+return 0;
+return (32 * (m_count - 1)) + static_cast<SizeType>(std::bit_width(m_limbs[m_count - 1]));
+}
+
+constexpr void MultiplyBy(const std::uint32_t factor) noexcept
+{
+std::uint64_t carry{0};
+for (SizeType i{0}; i < m_count; ++i)
+{
+carry += static_cast<std::uint64_t>(m_limbs[i]) * factor;
+m_limbs[i] = static_cast<std::uint32_t>(carry);
+carry >>= 32;
+}
+if ((0 != carry) and (m_count < maximumLimbs))
+m_limbs[m_count++] = static_cast<std::uint32_t>(carry);
+}
+
+constexpr void MultiplyByPower(const std::uint32_t base, SizeType exponent, const SizeType chunk) noexcept
+{
+auto chunkPower{std::uint32_t{1}};
+for (SizeType i{0}; i < chunk; ++i)
+chunkPower *= base;
+for (; exponent >= chunk; exponent -= chunk)
+MultiplyBy(chunkPower);
+for (; exponent > 0; --exponent)
+MultiplyBy(base);
+}
+
+constexpr void ShiftLeft(const SizeType bits) noexcept
+{
+const auto limbShift{bits / 32};
+const auto bitShift{bits % 32};
+if (0 == m_count)
+return;
+m_count = MinArgument(m_count + limbShift + 1, maximumLimbs);
+for (auto i{m_count}; i-- > 0;)
+{
+const auto high{(i >= limbShift) ? m_limbs[i - limbShift] : std::uint32_t{0}};
+const auto low{((i > limbShift) and (0 != bitShift)) ? m_limbs[i - limbShift - 1] : std::uint32_t{0}};
+m_limbs[i] = (0 == bitShift) ? high : ((high << bitShift) | (low >> (32 - bitShift)));
+}
+while ((0 < m_count) and (0 == m_limbs[m_count - 1]))
+--m_count;
+}
+
+[[nodiscard]] constexpr bool IsLessThan(const BigInteger& other) const noexcept
+{
+if (m_count != other.m_count)
+return m_count < other.m_count;
+for (auto i{m_count}; i-- > 0;)
+if (m_limbs[i] != other.m_limbs[i])
+return m_limbs[i] < other.m_limbs[i];
+return false;
+}
+
+constexpr void Subtract(const BigInteger& other) noexcept
+{
+std::int64_t borrow{0};
+for (SizeType i{0}; i < m_count; ++i)
+{
+borrow += static_cast<std::int64_t>(m_limbs[i]) - ((i < other.m_count) ? other.m_limbs[i] : 0);
+m_limbs[i] = static_cast<std::uint32_t>(borrow);
+borrow = (borrow < 0) ? -1 : 0;
+}
+while ((0 < m_count) and (0 == m_limbs[m_count - 1]))
+--m_count;
+}
+
+constexpr void Add(const std::uint32_t addend) noexcept
+{
+std::uint64_t carry{addend};
+for (SizeType i{0}; (0 != carry) and (i < maximumLimbs); ++i)
+{
+carry += m_limbs[i];
+m_limbs[i] = static_cast<std::uint32_t>(carry);
+carry >>= 32;
+m_count = (i < m_count) ? m_count : (i + 1);
+}
+}
+
+constexpr std::uint32_t DivideBy(const std::uint32_t divisor) noexcept
+{
+std::uint64_t remainder{0};
+for (auto i{m_count}; i-- > 0;)
+{
+remainder = (remainder << 32) | m_limbs[i];
+m_limbs[i] = static_cast<std::uint32_t>(remainder / divisor);
+remainder %= divisor;
+}
+while ((0 < m_count) and (0 == m_limbs[m_count - 1]))
+--m_count;
+return static_cast<std::uint32_t>(remainder);
+}
+
+[[nodiscard]] constexpr std::uint64_t ShiftedRight(const SizeType bits, bool& sticky) const noexcept
+{
+const auto Bit = [&](const SizeType bit) {
+return ((bit / 32) < m_count) ? ((m_limbs[bit / 32] >> (bit % 32)) & 1u) : 0u;
+};
+std::uint64_t result{0};
+for (SizeType i{64}; i-- > 0;)
+result = (result << 1) | Bit(bits + i);
+for (SizeType bit{0}; ((not sticky) and (bit < bits)); ++bit)
+sticky = (0 != Bit(bit));
+return result;
+}
+};
+
+template <typename T>
+[[nodiscard]] constexpr T AssembleFloating(const bool negative, const std::uint64_t q, const int exponent,
+const bool sticky) noexcept
+{
+using Bits = std::conditional_t<std::same_as<T, float>, std::uint32_t, std::uint64_t>;
+constexpr int digits{std::numeric_limits<T>::digits};
+constexpr int minimumExponent{std::numeric_limits<T>::min_exponent - digits};
+constexpr int maximumExponent{std::numeric_limits<T>::max_exponent - digits};
+constexpr auto hidden{std::uint64_t{1} << (digits - 1)};
+const auto Mask = [](const int bits) {
+return (bits >= 64) ? ~std::uint64_t{0} : ((std::uint64_t{1} << bits) - 1);
+};
+auto shift{static_cast<int>(std::bit_width(q)) - digits};
+auto e{exponent + shift};
+if (e < minimumExponent)
+{
+shift += minimumExponent - e;
+e = minimumExponent;
+}
+auto m{(shift <= 0) ? (q << -shift) : ((shift < 64) ? (q >> shift) : std::uint64_t{0})};
+if (shift > 0)
+{
+const auto half{(shift <= 64) and (0 != ((q >> (shift - 1)) & 1))};
+const auto rest{sticky or (0 != (q & Mask(shift - 1)))};
+if (half and (rest or (0 != (m & 1))))
+++m;
+if (m == (hidden << 1))
+{
+m >>= 1;
+++e;
+}
+}
+const auto sign{negative ? (Bits{1} << (sizeof(Bits) * 8 - 1)) : Bits{0}};
+if ((e > maximumExponent) or ((e == maximumExponent) and (m >= (hidden << 1))))
+return negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+const auto biased{(m < hidden) ? Bits{0} : static_cast<Bits>(e - minimumExponent + 1)};
+const auto fraction{static_cast<Bits>(m & (hidden - 1))};
+return std::bit_cast<T>(static_cast<Bits>(sign | static_cast<Bits>(biased << (digits - 1)) | fraction));
+}
+
+[[nodiscard]] constexpr int DecimalDigitCount(std::uint64_t digits) noexcept
+{
+auto result{0};
+for (; 0 != digits; digits /= 10)
+++result;
+return result;
+}
+
+[[nodiscard]] constexpr SizeType ReadSignificantDigits(const Text& text, BigInteger& n, bool& sticky) noexcept
+{
+constexpr SizeType maximumSignificantCount{768};
+SizeType count{0};
+std::uint32_t chunk{0};
+SizeType chunkCount{0};
+for (SizeType i{0}; (i < text.count) and ('e' != (text.chars[i] | 0x20)); ++i)
+{
+const auto c{text.chars[i]};
+if ((c < '0') or ('9' < c) or ((0 == count) and ('0' == c)))
+continue;
+if (maximumSignificantCount == count)
+{
+sticky = sticky or ('0' != c);
+continue;
+}
+chunk = (chunk * 10) + static_cast<std::uint32_t>(c - '0');
+++count;
+if (9 == ++chunkCount)
+{
+n.MultiplyBy(1000000000u);
+n.Add(chunk);
+chunk = 0;
+chunkCount = 0;
+}
+}
+n.MultiplyByPower(10, chunkCount, 9);
+n.Add(chunk);
+return count;
+}
+
+template <typename T>
+[[nodiscard]] constexpr T DecimalToFloatingExactly(const DecimalNumber& number, const Text& text) noexcept
+{
+const auto zero{number.negative ? -T{0} : T{0}};
+if (0 == number.digits)
+return zero;
+const auto magnitude{number.exponent + DecimalDigitCount(number.digits)};
+if (magnitude > (std::numeric_limits<T>::max_exponent10 + 1))
+return number.negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+if (magnitude < (std::numeric_limits<T>::min_exponent10 - std::numeric_limits<T>::max_digits10))
+return zero;
+auto sticky{false};
+auto n{BigInteger{number.digits}};
+auto exponent{number.exponent};
+if (number.truncated)
+{
+n = BigInteger{0};
+exponent -= static_cast<int>(ReadSignificantDigits(text, n, sticky)) - 19;
+}
+if (exponent >= 0)
+{
+n.MultiplyByPower(10, static_cast<SizeType>(exponent), 9);
+const auto shift{(n.BitCount() > 64) ? (n.BitCount() - 64) : SizeType{0}};
+const auto q{n.ShiftedRight(shift, sticky)};
+return AssembleFloating<T>(number.negative, q, static_cast<int>(shift), sticky);
+}
+auto divisor{BigInteger{1}};
+divisor.MultiplyByPower(10, static_cast<SizeType>(-exponent), 9);
+
+const auto shift{static_cast<int>(divisor.BitCount() + 63) - static_cast<int>(n.BitCount())};
+if (shift > 0)
+n.ShiftLeft(static_cast<SizeType>(shift));
+else
+divisor.ShiftLeft(static_cast<SizeType>(-shift));
+std::uint64_t q{0};
+for (auto bit{64}; bit-- > 0;)
+{
+auto shiftedDivisor{divisor};
+shiftedDivisor.ShiftLeft(static_cast<SizeType>(bit));
+if (not n.IsLessThan(shiftedDivisor))
+{
+n.Subtract(shiftedDivisor);
+q |= std::uint64_t{1} << bit;
+}
+}
+sticky = sticky or not n.IsZero();
+return AssembleFloating<T>(number.negative, q, -shift, sticky);
+}
+
+inline constexpr double ExactPowersOfTen[]{1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+template <typename T>
+[[nodiscard]] bool FloatingFromChars(const Text& text, T& result) noexcept
+{
+const auto plus{(0 < text.count) and ('+' == text.chars[0])};
+const auto first{text.chars + (plus ? 1 : 0)};
+const auto last{text.chars + text.count};
+if (plus and (first < last) and ('-' == *first))
+return false;
+auto value{T{}};
+const auto [end, error]{std::from_chars(first, last, value)};
+if ((std::errc::invalid_argument == error) or (end != last) or ((value != value) and (')' == *(last - 1))))
+return false;
+if (std::errc::result_out_of_range == error)
+{
+auto number{DecimalNumber{}};
+static_cast<void>(ParseDecimalText(text, number));
+value = ((number.exponent + DecimalDigitCount(number.digits)) > 0) ? std::numeric_limits<T>::infinity() : T{0};
+value = number.negative ? -value : value;
+}
+result = value;
+return true;
+}
+
+template <typename T>
+[[nodiscard]] constexpr bool ParseFloatingText(const Text& text, T& result) noexcept
+{
+constexpr auto maximumExactDigits{std::uint64_t{1} << std::numeric_limits<T>::digits};
+constexpr int maximumExactExponent{std::same_as<T, float> ? 10 : 22};
+if (not std::is_constant_evaluated())
+return FloatingFromChars(text, result);
+auto number{DecimalNumber{}};
+if (not ParseDecimalText(text, number))
+{
+const auto signCount{((0 < text.count) and (('-' == text.chars[0]) or ('+' == text.chars[0]))) ? 1u : 0u};
+const auto negative{(1 == signCount) and ('-' == text.chars[0])};
+if (IsNameOfText(text, signCount, "inf") or IsNameOfText(text, signCount, "infinity"))
+result = negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+else if (IsNameOfText(text, signCount, "nan"))
+result = negative ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+else
+return false;
+return true;
+}
+if ((not number.truncated) and (number.digits <= maximumExactDigits) and
+(-maximumExactExponent <= number.exponent) and (number.exponent <= maximumExactExponent))
+{
+const auto digits{static_cast<T>(number.digits)};
+const auto power{static_cast<T>(ExactPowersOfTen[(number.exponent < 0) ? -number.exponent : number.exponent])};
+const auto value{(number.exponent < 0) ? (digits / power) : (digits * power)};
+result = number.negative ? -value : value;
+return true;
+}
+result = DecimalToFloatingExactly<T>(number, text);
+return true;
+}
+
+template <typename T>
+[[nodiscard]] constexpr bool ParseNumberText(const Text& text, T& result) noexcept
+{
+if constexpr (IsNumberInteger<T>)
+return ParseIntegerText(text, result);
+else
+return ParseFloatingText(text, result);
+}
+
+template <typename T>
+constexpr int ExactDecimal(const T value, char (&chars)[800], SizeType& count) noexcept
+{
+using Bits = std::conditional_t<std::same_as<T, float>, std::uint32_t, std::uint64_t>;
+constexpr int digits{std::numeric_limits<T>::digits};
+constexpr int minimumExponent{std::numeric_limits<T>::min_exponent - digits};
+constexpr auto hidden{std::uint64_t{1} << (digits - 1)};
+const auto bits{static_cast<std::uint64_t>(std::bit_cast<Bits>(value))};
+const auto biased{static_cast<int>(bits >> (digits - 1))};
+const auto m{(0 == biased) ? (bits & (hidden - 1)) : ((bits & (hidden - 1)) | hidden)};
+const auto e{((0 == biased) ? 1 : biased) - 1 + minimumExponent};
+
+auto n{BigInteger{m}};
+if (e >= 0)
+n.ShiftLeft(static_cast<SizeType>(e));
+else
+n.MultiplyByPower(5, static_cast<SizeType>(-e), 13);
+count = 0;
+while (not n.IsZero())
+{
+auto chunk{n.DivideBy(1000000000u)};
+for (auto i{0}; (i < 9) and ((0 != chunk) or not n.IsZero()); ++i, chunk /= 10)
+chars[count++] = static_cast<char>('0' + (chunk % 10));
+}
+for (SizeType i{0}; i < (count / 2); ++i)
+{
+const auto c{chars[i]};
+chars[i] = chars[count - 1 - i];
+chars[count - 1 - i] = c;
+}
+return (e >= 0) ? 0 : e;
+}
+
+template <typename T>
+[[nodiscard]] constexpr DecimalNumber ShortestDecimal(const T value) noexcept
+{
+
+char chars[800]{};
+SizeType count{0};
+const auto exponent{ExactDecimal(value, chars, count)};
+for (SizeType precision{1};; ++precision)
+{
+std::uint64_t down{0};
+for (SizeType i{0}; i < MinArgument(precision, count); ++i)
+down = (down * 10) + static_cast<std::uint64_t>(chars[i] - '0');
+if (precision >= count)
+{
+
+auto result{DecimalNumber{down, exponent, false, false}};
+for (; (0 != result.digits) and (0 == (result.digits % 10)); result.digits /= 10)
+++result.exponent;
+return result;
+}
+const auto downExponent{exponent + static_cast<int>(count - precision)};
+auto firstRest{chars[precision]};
+auto restIsZero{true};
+for (auto i{precision + 1}; (restIsZero and (i < count)); ++i)
+restIsZero = ('0' == chars[i]);
+const auto roundUp{(firstRest > '5') or (('5' == firstRest) and ((not restIsZero) or (0 != (down % 2))))};
+const auto nearest{roundUp ? (down + 1) : down};
+const auto other{roundUp ? down : (down + 1)};
+for (const auto candidate : {nearest, other})
+{
+if ((0 != candidate) and
+(value == DecimalToFloatingExactly<T>(DecimalNumber{candidate, downExponent, false, false}, Text{})))
+{
+auto result{DecimalNumber{candidate, downExponent, false, false}};
+for (; 0 == (result.digits % 10); result.digits /= 10)
+++result.exponent;
+return result;
+}
+}
+}
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto FloatingString(const T t) noexcept
+{
+
+constexpr SizeType maximumCount{std::numeric_limits<T>::max_digits10 + 7};
+char chars[maximumCount + 1]{};
+if (not std::is_constant_evaluated())
+{
+static_cast<void>(std::to_chars(chars, chars + maximumCount, t));
+return String<maximumCount>{chars};
+}
+using Bits = std::conditional_t<std::same_as<T, float>, std::uint32_t, std::uint64_t>;
+SizeType count{0};
+if (0 != (std::bit_cast<Bits>(t) >> (sizeof(Bits) * 8 - 1)))
+chars[count++] = '-';
+const auto Append = [&](const char* text) {
+for (SizeType i{0}; '\0' != text[i]; ++i)
+chars[count++] = text[i];
+};
+if (t != t)
+{
+Append("nan");
+}
+else if ((t == std::numeric_limits<T>::infinity()) or (t == -std::numeric_limits<T>::infinity()))
+{
+Append("inf");
+}
+else if (T{0} == t)
+{
+Append("0");
+}
+else
+{
+const auto number{ShortestDecimal((t < 0) ? -t : t)};
+const auto digits{IntegerString(number.digits)};
+const auto digitCount{static_cast<int>(digits.Count())};
+const auto scientificExponent{number.exponent + digitCount - 1};
+const auto absoluteExponent{(scientificExponent < 0) ? -scientificExponent : scientificExponent};
+const auto scientificCount{digitCount + ((digitCount > 1) ? 1 : 0) + 2 + ((absoluteExponent >= 100) ? 3 : 2)};
+const auto fixedCount{(scientificExponent < 0)
+? (digitCount + 1 - scientificExponent)
+: ((scientificExponent >= digitCount) ? (scientificExponent + 1) : (digitCount + 1))};
+if (fixedCount <= scientificCount)
+{
+if (scientificExponent < 0)
+{
+
+Append("0.");
+for (auto i{1}; i < -scientificExponent; ++i)
+chars[count++] = '0';
+Append(digits.Data());
+}
+else if (scientificExponent >= (digitCount - 1))
+{
+
+char exactChars[800]{};
+SizeType exactCount{0};
+static_cast<void>(ExactDecimal((t < 0) ? -t : t, exactChars, exactCount));
+for (auto i{0}; i <= scientificExponent; ++i)
+chars[count++] = exactChars[i];
+}
+else
+{
+for (auto i{0}; i < digitCount; ++i)
+{
+if (i == (scientificExponent + 1))
+chars[count++] = '.';
+chars[count++] = digits[static_cast<SizeType>(i)];
+}
+}
+}
+else
+{
+chars[count++] = digits[0];
+if (digitCount > 1)
+chars[count++] = '.';
+for (auto i{1}; i < digitCount; ++i)
+chars[count++] = digits[static_cast<SizeType>(i)];
+chars[count++] = 'e';
+chars[count++] = (scientificExponent < 0) ? '-' : '+';
+if (absoluteExponent >= 100)
+chars[count++] = static_cast<char>('0' + (absoluteExponent / 100));
+chars[count++] = static_cast<char>('0' + ((absoluteExponent / 10) % 10));
+chars[count++] = static_cast<char>('0' + (absoluteExponent % 10));
+}
+}
+return String<maximumCount>{chars};
+}
+
+}
+
+namespace cljonic
+{
+
+namespace core
+{
+}
+
+namespace string
+{
+}
+
+}
+
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+namespace cljonic
+{
+
+namespace core
+{
+struct PlusReducer
+{
+template <typename T, typename U>
+[[nodiscard]] constexpr auto operator()(const T& t, const U& u) const noexcept
+{
+return t + u;
+}
+};
+
+struct MultipliesReducer
+{
+template <typename T, typename U>
+[[nodiscard]] constexpr auto operator()(const T& t, const U& u) const noexcept
+{
+return t * u;
+}
+};
+
+struct BitAndReducer
+{
+template <typename T, typename U>
+[[nodiscard]] constexpr auto operator()(const T& t, const U& u) const noexcept
+{
+return t & u;
+}
+};
+
+struct BitOrReducer
+{
+template <typename T, typename U>
+[[nodiscard]] constexpr auto operator()(const T& t, const U& u) const noexcept
+{
+return t | u;
+}
+};
+
+struct MinimumReducer
+{
+template <typename T>
+[[nodiscard]] constexpr T operator()(const T& t, const T& u) const noexcept
+{
+return (u < t) ? u : t;
+}
+};
+
+struct MaximumReducer
+{
+template <typename T>
+[[nodiscard]] constexpr T operator()(const T& t, const T& u) const noexcept
+{
+return (t < u) ? u : t;
+}
+};
+
+inline constexpr PlusReducer Plus{};
+inline constexpr MultipliesReducer Multiplies{};
+inline constexpr BitAndReducer BitAnd{};
+inline constexpr BitOrReducer BitOr{};
+inline constexpr MinimumReducer Minimum{};
+inline constexpr MaximumReducer Maximum{};
+
+}
+
+template <typename F, typename T>
+concept IsLaneReducer =
+std::is_arithmetic_v<T> and not std::is_same_v<T, bool> and
+(std::is_same_v<F, core::PlusReducer> or std::is_same_v<F, core::MultipliesReducer> or
+(std::is_integral_v<T> and (std::is_same_v<F, core::MinimumReducer> or std::is_same_v<F, core::MaximumReducer> or
+std::is_same_v<F, core::BitAndReducer> or std::is_same_v<F, core::BitOrReducer>)));
+
+template <typename F>
+concept IsRangeReducer = std::is_same_v<F, core::PlusReducer> or std::is_same_v<F, core::MultipliesReducer> or
+std::is_same_v<F, core::MinimumReducer> or std::is_same_v<F, core::MaximumReducer>;
+
+template <typename F, typename R>
+[[nodiscard]] constexpr int ReduceRange(const F& f, const R& r) noexcept
+{
+const auto first{r[0]};
+const auto last{r[r.Count() - 1]};
+if constexpr (std::is_same_v<F, core::PlusReducer>)
+{
+return static_cast<int>(((static_cast<std::int64_t>(first) + last) * static_cast<std::int64_t>(r.Count())) / 2);
+}
+else if constexpr (std::is_same_v<F, core::MultipliesReducer>)
+{
+if (CLJONIC_INVALID_INDEX != RangeIndexOf<false>(r, 0))
+return 0;
+auto result{first};
+for (SizeType i{1}; i < r.Count(); ++i)
+result = f(result, r[i]);
+return result;
+}
+else
+{
+return f(first, last);
+}
+}
+
+template <typename F, typename T>
+[[nodiscard]] constexpr T ReduceRepeated(const F& f, const T& t, const SizeType count) noexcept
+{
+if constexpr (std::is_same_v<F, core::PlusReducer> and std::is_integral_v<T>)
+{
+return static_cast<T>(static_cast<std::uint64_t>(t) * static_cast<std::uint64_t>(count));
+}
+else if constexpr (std::is_same_v<F, core::PlusReducer> or std::is_same_v<F, core::MultipliesReducer>)
+{
+auto result{t};
+auto power{t};
+for (auto remaining{count - 1}; remaining > 0; remaining /= 2)
+{
+if (0 != (remaining % 2))
+result = static_cast<T>(f(result, power));
+if (remaining > 1)
+power = static_cast<T>(f(power, power));
+}
+return result;
+}
+else
+{
+return t;
+}
+}
+
+template <typename F, typename T>
+[[nodiscard]] constexpr T ReduceInLanes(const F& f, const T* elements, const SizeType count) noexcept
+{
+constexpr SizeType laneCount{8};
+if (count < (2 * laneCount))
+{
+auto result{elements[0]};
+for (SizeType i{1}; i < count; ++i)
+result = static_cast<T>(f(result, elements[i]));
+return result;
+}
+T lanes[laneCount];
+for (SizeType j{0}; j < laneCount; ++j)
+lanes[j] = elements[j];
+SizeType i{laneCount};
+for (; (i + laneCount) <= count; i += laneCount)
+#pragma GCC unroll 8
+for (SizeType j{0}; j < laneCount; ++j)
+lanes[j] = static_cast<T>(f(lanes[j], elements[i + j]));
+for (SizeType width{laneCount / 2}; width > 0; width /= 2)
+for (SizeType j{0}; j < width; ++j)
+lanes[j] = static_cast<T>(f(lanes[j], lanes[j + width]));
+auto result{lanes[0]};
+for (; i < count; ++i)
+result = static_cast<T>(f(result, elements[i]));
+return result;
+}
+
+template <SizeType laneCount, typename F, typename T>
+[[nodiscard]] constexpr T BestOfBlock(F& better, const T* elements) noexcept
+{
+T lanes[laneCount];
+for (SizeType j{0}; j < laneCount; ++j)
+lanes[j] = elements[j];
+for (SizeType i{laneCount}; i < (laneCount * laneCount); i += laneCount)
+#pragma GCC unroll 8
+for (SizeType j{0}; j < laneCount; ++j)
+lanes[j] = better(lanes[j], elements[i + j]) ? elements[i + j] : lanes[j];
+for (SizeType width{laneCount / 2}; width > 0; width /= 2)
+for (SizeType j{0}; j < width; ++j)
+lanes[j] = better(lanes[j], lanes[j + width]) ? lanes[j + width] : lanes[j];
+return lanes[0];
+}
+
+template <typename F, typename T>
+[[nodiscard]] constexpr SizeType IndexOfBestInLanes(F&& better, const T* elements, const SizeType count) noexcept
+{
+constexpr SizeType laneCount{8};
+constexpr SizeType blockSize{laneCount * laneCount};
+SizeType result{0};
+SizeType i{1};
+if (count >= (2 * blockSize))
+{
+auto best{BestOfBlock<laneCount>(better, elements)};
+for (i = blockSize; (i + blockSize) <= count; i += blockSize)
+{
+const auto blockBest{BestOfBlock<laneCount>(better, elements + i)};
+if (better(best, blockBest))
+{
+best = blockBest;
+result = i;
+}
+}
+const auto blockEnd{result + blockSize};
+for (auto j{result + 1}; j < blockEnd; ++j)
+if (better(elements[result], elements[j]))
+result = j;
+}
+for (; i < count; ++i)
+if (better(elements[result], elements[i]))
+result = i;
+return result;
+}
+
+template <typename F, typename C>
+[[nodiscard]] constexpr SizeType IndexOfBest(F&& better, const C& c) noexcept
+{
+if (0 == c.Count())
+return CLJONIC_INVALID_INDEX;
+if constexpr (std::is_integral_v<typename C::value_type> and std::is_pointer_v<decltype(c.begin())>)
+{
+return IndexOfBestInLanes(better, c.begin(), c.Count());
+}
+else
+{
+SizeType result{0};
+for (SizeType i{1}; i < c.Count(); ++i)
+if (better(ElementAt(c, result), ElementAt(c, i)))
+result = i;
+return result;
+}
+}
+
+}
+
+#include <concepts>
+
+namespace cljonic
+{
+
+namespace core
+{
+struct IsEvenPredicate
+{
+template <typename T>
+[[nodiscard]] constexpr bool operator()(const T& t) const noexcept
+{
+static_assert(std::integral<T>, "IsEven's parameter must be an integer");
+
+return 0 == (t % 2);
+}
+};
+
+inline constexpr IsEvenPredicate IsEven{};
+
+}
+
+}
+
+#include <concepts>
+
+namespace cljonic
+{
+
+namespace core
+{
+struct IsOddPredicate
+{
+template <typename T>
+[[nodiscard]] constexpr bool operator()(const T& t) const noexcept
+{
+static_assert(std::integral<T>, "IsOdd's parameter must be an integer");
+
+return 0 != (t % 2);
+}
+};
+
+inline constexpr IsOddPredicate IsOdd{};
+
+}
+
+}
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename C, typename K, typename V>
+[[nodiscard]] constexpr auto Assoc(const C& c, const K& k, const V& v) noexcept
+{
+static_assert(IsCljonicHashMap<C>, "Assoc's first parameter must be a cljonic HashMap");
+
+static_assert(std::convertible_to<K, typename C::key_type>,
+"Assoc's second parameter must be convertible to the HashMap key type");
+
+static_assert(std::convertible_to<V, typename C::mapped_type>,
+"Assoc's third parameter must be convertible to the HashMap value type");
+
+auto result{c};
+MAssoc(result, static_cast<typename C::key_type>(k), static_cast<typename C::mapped_type>(v));
+return result;
+}
+
+}
+
+}
+
+#include <utility>
+
+namespace cljonic
+{
+
+namespace core
+{
+
+template <typename F1, typename F2, typename... Args>
+concept ComposeIsCallableWith = requires(F1 f1, F2 f2, Args&&... args) {
+{ f1(f2(std::forward<Args>(args)...)) };
+};
+
+template <typename F1, typename F2>
+[[nodiscard]] constexpr auto Compose(F1&& f1, F2&& f2) noexcept
+{
+return [f1 = std::forward<F1>(f1), f2 = std::forward<F2>(f2)]<typename... T>(T&&... args)
+{
+static_assert(ComposeIsCallableWith<F1, F2, T...>,
+"Each Compose argument must be callable with one argument of the return type of the argument to "
+"its right. Was the Compose result function called with the correct number of arguments?");
+
+return f1(f2(std::forward<T>(args)...));
+};
+}
+template <typename F1, typename F2, typename... Fs>
+[[nodiscard]] constexpr auto Compose(F1&& f1, F2&& f2, Fs&&... fs) noexcept
+{
+return Compose(std::forward<F1>(f1), Compose(std::forward<F2>(f2), std::forward<Fs>(fs)...));
+}
+
+}
+
+}
+
+#include <concepts>
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename C, typename... Cs>
+[[nodiscard]] constexpr auto Concat(const C& c, const Cs&... cs) noexcept
+{
+
+static_assert(AllCljonicCollections<C, Cs...>, "All Concat parameters must be cljonic collections");
+
+static_assert(AllConvertibleValueTypes<C, Cs...>,
+"All Concat cljonic collection value types must be interconvertible");
+
+using ResultType = FindCommonValueType<C, Cs...>;
+
+constexpr auto count{SumOfCljonicCollectionMaximumCounts<C, Cs...>()};
+auto result{Array<ResultType, count>{}};
+const auto MConjCollectionOntoResult = [&]<typename D>(const D& c)
+{
+if constexpr (IsContiguousCollection<D> and std::same_as<typename D::value_type, ResultType>)
+MConjElements(result, c.begin(), c.Count());
+else
+for (const auto& element : c)
+MConj(result, static_cast<const ResultType&>(element));
+};
+(MConjCollectionOntoResult(c), ..., MConjCollectionOntoResult(cs));
+return result;
+}
+
+[[nodiscard]] constexpr auto Concat() noexcept
+{
+return Array<int, 0>{};
+}
+
+}
+
+}
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename C, typename... Es>
+[[nodiscard]] constexpr auto Conj(const C& c, const Es&... es) noexcept
+{
+
+static_assert(IsCljonicCollection<C>, "First Conj parameter must be a cljonic collection");
+
+static_assert(AllConvertibleTypes<typename C::value_type, Es...>,
+"Second through last Conj parameters must be convertible to cljonic collection value type");
+
+using ResultType = typename C::value_type;
+
+constexpr auto count{C::MaximumCount() + sizeof...(Es)};
+auto result{Array<ResultType, count>{}};
+const auto MConjElementOntoResult = [&](const auto& e) { MConj(result, e); };
+if constexpr (IsContiguousCollection<C>)
+MConjElements(result, c.begin(), c.Count());
+else
+for (const auto& element : c)
+MConjElementOntoResult(element);
+(MConjElementOntoResult(es), ...);
+return result;
+}
+
+}
+
+}
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto Count(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Count's parameter must be a cljonic collection");
+
+return c.Count();
+}
+
+}
+
+}
+
+#include <utility>
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename C>
+class CycleCollection
+{
+using ElementType = typename C::value_type;
+
+C m_collection;
+
+[[nodiscard]] constexpr SizeType IndexToElementIndex(const SizeType index) const noexcept
+{
+return (0 == m_collection.Count()) ? 0 : (index % m_collection.Count());
+}
+
+class CycleIterator
+{
+const CycleCollection& m_cycle;
+SizeType m_index;
+SizeType m_elementIndex;
+
+public:
+constexpr CycleIterator(const CycleCollection& cycle, const SizeType index) noexcept
+: m_cycle(cycle), m_index(index), m_elementIndex(cycle.IndexToElementIndex(index))
+{
+}
+
+[[nodiscard]] constexpr auto operator*() const noexcept -> decltype(m_cycle[m_index])
+{
+return m_cycle.m_collection[m_elementIndex];
+}
+
+constexpr CycleIterator& operator++() noexcept
+{
+++m_index;
+if (++m_elementIndex == m_cycle.m_collection.Count())
+m_elementIndex = 0;
+return *this;
+}
+
+[[nodiscard]] constexpr bool operator!=(const CycleIterator& other) const noexcept
+{
+return m_index != other.m_index;
+}
+
+constexpr CycleIterator& operator+=(const int value) noexcept
+{
+m_index += value;
+m_elementIndex = m_cycle.IndexToElementIndex(m_index);
+return *this;
+}
+
+[[nodiscard]] constexpr CycleIterator operator+(const int value) const noexcept
+{
+CycleIterator temp = *this;
+temp += value;
+return temp;
+}
+};
+
+public:
+using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Cycle>;
+using collection_type = C;
+using size_type = SizeType;
+using value_type = ElementType;
+
+constexpr explicit CycleCollection(const C& collection) : m_collection(collection)
+{
+}
+
+constexpr explicit CycleCollection(C&& collection) : m_collection(std::move(collection))
+{
+}
+
+constexpr CycleCollection(const CycleCollection& other) = default;
+constexpr CycleCollection(CycleCollection&& other) = default;
+
+[[nodiscard]] constexpr CycleIterator begin() const noexcept
+{
+return CycleIterator(*this, 0);
+}
+
+[[nodiscard]] constexpr CycleIterator end() const noexcept
+{
+return CycleIterator(*this, Count());
+}
+
+[[nodiscard]] constexpr ElementType operator[](const SizeType index) const noexcept
+{
+return m_collection[IndexToElementIndex(index)];
+}
+
+[[nodiscard]] constexpr SizeType Count() const noexcept
+{
+return (0 == m_collection.Count()) ? 0 : CljonicCollectionMaximumElementCount;
+}
+
+[[nodiscard]] constexpr const C& Collection() const noexcept
+{
+return m_collection;
+}
+
+[[nodiscard]] constexpr const ElementType& DefaultElement() const noexcept
+{
+return m_collection.DefaultElement();
+}
+
+[[nodiscard]] static consteval SizeType MaximumCount() noexcept
+{
+return (0 == C::MaximumCount()) ? 0 : CljonicCollectionMaximumElementCount;
+}
+};
+template <typename C>
+[[nodiscard]] constexpr auto Cycle(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Cycle's parameter must be a cljonic collection");
+
+return CycleCollection{c};
+}
+
+}
+
+}
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto Dedupe(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Dedupe's parameter must be a cljonic collection");
+
+static_assert((not std::floating_point<typename C::value_type>),
+"Dedupe should not compare cljonic floating point collection value types for equality. Consider "
+"using DedupeBy to override this default.");
+
+if constexpr (IsCljonicRepeat<C>)
+{
+auto result{Array<typename C::value_type, C::MaximumCount()>{}};
+if (c.Count() > 0)
+MConj(result, c.At(0));
+return result;
+}
+else
+{
+return DedupeBy([](const auto& a, const auto& b) { return AreEqual(a, b); }, c);
+}
+}
+
+}
+
+}
+
+#include <type_traits>
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename F, typename C>
+[[nodiscard]] constexpr auto DedupeBy(F&& f, const C& c) noexcept
+{
+
+static_assert(IsCljonicCollection<C>, "DedupeBy's second parameter must be a cljonic collection");
+
+static_assert(IsBinaryPredicate<std::decay_t<F>, typename C::value_type, typename C::value_type>,
+"DedupeBy's function is not a valid binary predicate for the collection value type");
+
+using ValueType = typename C::value_type;
+
+constexpr auto IndexOfNextElementNotEqualToCurrentElement =
+[](const F& fn, const C& collection, const SizeType currentIndex)
+{
+auto currentElement{collection[currentIndex]};
+auto i{currentIndex + 1};
+while ((i < collection.Count()) and fn(collection[i], currentElement))
+++i;
+return i;
+};
+
+auto result{Array<ValueType, c.MaximumCount()>{}};
+for (SizeType i{0}; i < c.Count();)
+{
+MConj(result, ElementAt(c, i));
+i = IndexOfNextElementNotEqualToCurrentElement(f, c, i);
+}
+return result;
+}
+
+}
+
+}
+
+#include <concepts>
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename T>
+[[nodiscard]] constexpr auto DedupeT() noexcept
+{
+static_assert(not std::floating_point<T>, "DedupeT should not compare floating point values for equality");
+
+return [](auto step)
+{
+return [step, previous = T{}, hasPrevious = false](auto& accumulator, const T& element) mutable
+{
+if (hasPrevious and AreEqual(previous, element))
+return true;
+previous = element;
+hasPrevious = true;
+return step(accumulator, element);
+};
+};
+}
+
+}
+
+}
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto DefaultElement(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "DefaultElement's parameter must be a cljonic collection");
+
+return c.DefaultElement();
+}
+
+}
+
+}
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename C, typename K>
+[[nodiscard]] constexpr auto Dissoc(const C& c, const K& k) noexcept
+{
+static_assert(IsCljonicHashMap<C>, "Dissoc's first parameter must be a cljonic HashMap");
+
+static_assert(std::convertible_to<K, typename C::key_type>,
+"Dissoc's second parameter must be convertible to the HashMap key type");
+
+auto result{c};
+MDissoc(result, static_cast<typename C::key_type>(k));
+return result;
+}
+
+}
+
+}
+
+#include <type_traits>
+#include <utility>
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto Drop(const SizeType count, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Drop's second parameter must be a cljonic collection");
+
+auto result{Array<typename C::value_type, c.MaximumCount()>{}};
+if constexpr (IsContiguousCollection<C>)
+{
+if (count < c.Count())
+MConjElements(result, c.begin() + count, c.Count() - count);
+}
+else
+{
+for (SizeType i{count}; (i < c.Count()); ++i)
+MConj(result, ElementAt(c, i));
+}
+return result;
+}
+template <typename C>
+[[nodiscard]] constexpr auto DropView(const SizeType count, C&& c) noexcept
+{
+static_assert(IsCljonicCollection<std::remove_cvref_t<C>>,
+"DropView's second parameter must be a cljonic collection");
+
+return SliceView<C>{std::forward<C>(c), count};
+}
+
+}
+
+}
+
+#include <type_traits>
+#include <utility>
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto DropLast(const SizeType count, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "DropLast's second parameter must be a cljonic collection");
+
+auto result{Array<typename C::value_type, c.MaximumCount()>{}};
+auto endIndex{(count > c.Count()) ? 0 : (c.Count() - count)};
+for (SizeType i{0}; (i < endIndex); ++i)
+MConj(result, ElementAt(c, i));
+return result;
+}
+template <typename C>
+[[nodiscard]] constexpr auto DropLastView(const SizeType count, C&& c) noexcept
+{
+static_assert(IsCljonicCollection<std::remove_cvref_t<C>>,
+"DropLastView's second parameter must be a cljonic collection");
+
+const auto end{(c.Count() > count) ? (c.Count() - count) : 0};
+return SliceView<C>{std::forward<C>(c), 0, end};
+}
+
+}
+
+}
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename F, typename C>
+[[nodiscard]] constexpr auto DropWhile(F&& f, const C& c) noexcept
+{
+
+static_assert(IsCljonicCollection<C>, "DropWhile's second parameter must be a cljonic collection");
+
+static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
+"DropWhile's function is not a valid unary predicate for the collection value type");
+
+auto result{Array<typename C::value_type, c.MaximumCount()>{}};
+auto conjElement(false);
+for (const auto& element : c)
+if (conjElement |= (not f(element)))
+MConj(result, element);
+return result;
+}
+
+}
+
+}
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename T, typename... Ts>
+[[nodiscard]] constexpr auto Equal(const T& t, const Ts&... ts) noexcept
+{
+
+if constexpr (sizeof...(Ts) == 0)
+{
+if constexpr (IsCljonicCollection<T>)
+static_assert((not std::floating_point<typename T::value_type>),
+"Equal should not compare cljonic floating point collection value types for equality. "
+"Consider using EqualBy to override this default.");
+else
+static_assert((not std::floating_point<T>),
+"Equal should not compare floating point types for equality. Consider using EqualBy to "
+"override this default.");
+return true;
+}
+else if constexpr (AllCljonicCollections<T, Ts...>)
+{
+static_assert(not AnyFloatingPointValueTypes<T, Ts...>,
+"Equal should not compare cljonic floating point collection value types for equality. Consider "
+"using EqualBy to override this default.");
+
+static_assert(AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeRepeatOrView<T, Ts...>,
+"Equal cljonic collection types are not all the same, or all Array, Range, Repeat or view types");
+
+return (AreEqual(t, ts) and ...);
+}
+else
+{
+static_assert(not AnyFloatingPointTypes<T, Ts...>,
+"Equal should not compare floating point types for equality. Consider using EqualBy to override "
+"this default.");
+
+static_assert(AllEqualityComparableTypes<T, Ts...>, "Not all Equal types are equality comparable");
+
+return (AreEqual(t, ts) and ...);
+}
+}
+
+}
+
+}
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename F, typename T, typename... Ts>
+[[nodiscard]] constexpr auto EqualBy(F&& f, const T& t, const Ts&... ts) noexcept
+{
+
+if constexpr (sizeof...(Ts) <= 0)
+{
+return true;
+}
+else if constexpr (AllCljonicCollections<T, Ts...>)
+{
+static_assert(AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeRepeatOrView<T, Ts...>,
+"EqualBy cljonic collection types are not all the same, or all Array, Range, Repeat or view "
+"types");
+
+static_assert(IsBinaryPredicateForAllCljonicCollections<std::decay_t<F>, T, Ts...>,
+"EqualBy function is not a valid binary predicate for all cljonic collection value types");
+
+return (AreEqualBy(f, t, ts) and ...);
+}
+else
+{
+static_assert(AllEqualityComparableTypes<T, Ts...>, "Not all EqualBy types are equality comparable");
+
+static_assert(IsBinaryPredicateForAll<F, T, Ts...>,
+"EqualBy function is not a valid binary predicate for all parameters");
+
+return (AreEqualBy(f, t, ts) and ...);
+}
+}
+
+}
+
+}
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename F, typename C>
+[[nodiscard]] constexpr auto Every(F&& f, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Every's second parameter must be a cljonic collection");
+
+static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
+"Every's function is not a valid unary predicate for the collection value type");
+
+for (const auto& element : c)
+if (not f(element))
+return false;
+return true;
+}
+
+}
+
+}
+
+#include <type_traits>
+
+namespace cljonic
+{
+
+template <typename R, bool even>
+[[nodiscard]] constexpr auto RangeOfParity() noexcept
+{
+constexpr R r{};
+constexpr auto count{r.Count()};
+constexpr auto step{(count > 1) ? (r[1] - r[0]) : 0};
+constexpr SizeType start{((0 == (r[0] % 2)) == even) ? 0 : 1};
+if constexpr (start >= count)
+{
+return Range<0>{};
+}
+else if constexpr (0 == (step % 2))
+{
+if constexpr (0 == start)
+return R{};
+else
+return Range<0>{};
+}
+else
+{
+constexpr auto first{r[start]};
+constexpr auto last{r[start + (2 * ((count - start - 1) / 2))]};
+return Range<first, ((step < 0) ? (last - 1) : (last + 1)), (2 * step)>{};
+}
+}
+
+namespace core
+{
+template <typename F, typename C>
+[[nodiscard]] constexpr auto Filter(F&& f, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Filter's second parameter must be a cljonic collection");
+
+static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
+"Filter's function is not a valid unary predicate for the collection value type");
+
+using Predicate = std::decay_t<F>;
+if constexpr (IsCljonicRange<C> and (std::is_same_v<Predicate, IsEvenPredicate> or
+std::is_same_v<Predicate, IsOddPredicate>))
+{
+return RangeOfParity<C, std::is_same_v<Predicate, IsEvenPredicate>>();
+}
+else
+{
+auto result{Array<typename C::value_type, c.MaximumCount()>{}};
+for (const auto& element : c)
+if (f(element))
+MConj(result, element);
+return result;
+}
+}
+
+}
+
+}
+
+#include <utility>
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename F>
+[[nodiscard]] constexpr auto FilterT(F&& f) noexcept
+{
+return [f = std::forward<F>(f)](auto step)
+{
+return [f, step](auto& accumulator, const auto& element) mutable
+{ return f(element) ? step(accumulator, element) : true; };
+};
+}
+
+}
+
+}
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto First(const C& coll) noexcept
+{
+static_assert(IsCljonicCollection<C>, "First's parameter must be a cljonic collection");
+
+if constexpr (IsCljonicIterator<C>)
+return *coll.begin();
+else
+return coll[0];
+}
+
+}
+
+}
+
+#include <concepts>
+#include <type_traits>
+
+namespace cljonic
+{
+
+template <typename T, SizeType N>
+struct FrozenElements
+{
+T elements[(0 == N) ? 1 : N];
+};
+
+template <auto pipeline>
+class FrozenCollection
+{
+using T = typename std::remove_cvref_t<decltype(pipeline())>::value_type;
 
-[[nodiscard]] constexpr bool IsUniqueElementBy(const auto& f, const T& element) const noexcept {
-auto result{true};
-for(SizeType i{0}; (result and (i < m_elementCount)); ++i)
-result = not AreEqualBy(f, element, m_elements[i]);
-return result;
-}
+static constexpr SizeType count{pipeline().Count()};
 
-[[nodiscard]] constexpr bool IsUniqueElement(const T& element) const noexcept {
-auto result{true};
-for(SizeType i{0}; (result and (i < m_elementCount)); ++i)
-result = not AreEqual(element, m_elements[i]);
+[[nodiscard]] static consteval FrozenElements<T, count> Elements() noexcept
+{
+auto result{FrozenElements<T, count>{}};
+SizeType i{0};
+for (const auto& element : pipeline())
+result.elements[i++] = element;
 return result;
 }
 
 public:
-using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Set>;
-using size_type = SizeType;
-using value_type = T;
+static constexpr FrozenElements<T, count> frozen{Elements()};
 
-constexpr Set() noexcept : m_elementCount(0), m_elementDefault(T{}) {
+[[nodiscard]] static consteval SizeType Count() noexcept
+{
+return count;
 }
+};
 
-template <typename... Args>
-constexpr explicit Set(Args... elements) noexcept : m_elementCount(0), m_elementDefault(T{}) {
-static_assert(sizeof...(Args) <= MaximumCount(), "Set initialized with too many elements");
-((IsUniqueElement(elements) ? (m_elements[m_elementCount++] = elements, void()) : void()), ...);
+template <SizeType N, auto f>
+class FrozenTable
+{
+using T = std::remove_cvref_t<decltype(f(SizeType{0}))>;
+
+[[nodiscard]] static consteval FrozenElements<T, N> Elements() noexcept
+{
+auto result{FrozenElements<T, N>{}};
+for (SizeType i{0}; i < N; ++i)
+result.elements[i] = f(i);
+return result;
 }
 
-constexpr Set(const Set& other) noexcept = default;
-constexpr Set(Set&& other) noexcept = default;
+public:
+static constexpr FrozenElements<T, N> frozen{Elements()};
+};
 
-private:
-using Iterator = CollectionIterator<Set>;
+namespace core
+{
+template <auto pipeline>
+[[nodiscard]] consteval auto Freeze() noexcept
+{
+static_assert(IsCljonicCollection<std::remove_cvref_t<decltype(pipeline())>>,
+"Freeze's template parameter must be a function of no parameters that returns a cljonic collection");
 
-public:
-[[nodiscard]] constexpr Iterator begin() const noexcept {
-return Iterator{*this, 0};
+using Frozen = FrozenCollection<pipeline>;
+using T = std::remove_cvref_t<decltype(Frozen::frozen.elements[0])>;
+return SpanView<T>{Frozen::frozen.elements, Frozen::Count()};
 }
+template <SizeType N, auto f>
+[[nodiscard]] consteval auto ArrayOf() noexcept
+{
+static_assert(N <= CljonicCollectionMaximumElementCount,
+"ArrayOf's first template parameter must not be greater than "
+"CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
 
-[[nodiscard]] constexpr Iterator end() const noexcept {
-return Iterator{*this, m_elementCount};
+static_assert(std::invocable<decltype(f), SizeType>,
+"ArrayOf's second template parameter must be a function of an index");
+
+using Frozen = FrozenTable<N, f>;
+using T = std::remove_cvref_t<decltype(Frozen::frozen.elements[0])>;
+return SpanView<T>{Frozen::frozen.elements, N};
 }
 
-[[nodiscard]] constexpr T operator[](const SizeType index) const noexcept override {
-return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
 }
 
-[[nodiscard]] constexpr T operator()(const T& t) const noexcept {
-return Contains(t) ? t : m_elementDefault;
 }
 
-constexpr Set& operator=(const Set& other) noexcept {
-if(this != &other) {
-m_elementCount = other.m_elementCount;
-m_elementDefault = other.m_elementDefault;
-for(SizeType i{0}; i < m_elementCount; ++i)
-m_elements[i] = other.m_elements[i];
+namespace cljonic
+{
+
+namespace core
+{
+template <typename T, typename... Ts>
+[[nodiscard]] constexpr auto Identical(const T& t, const Ts&... ts) noexcept
+{
+if constexpr (sizeof...(Ts) <= 0)
+{
+return true;
 }
-return *this;
+else
+{
+auto SameIdentity = [&](const auto& t1, const auto& t2) { return Identity(t1) == Identity(t2); };
+return (SameIdentity(t, ts) and ...);
 }
-
-constexpr Set& operator=(Set&& other) noexcept {
-return *this = other;
 }
 
-[[nodiscard]] constexpr SizeType Count() const noexcept override {
-return m_elementCount;
 }
 
-[[nodiscard]] constexpr bool ContainsBy(const auto& f, const T& element) const noexcept {
-return not IsUniqueElementBy(f, element);
 }
 
-[[nodiscard]] constexpr bool Contains(const T& element) const noexcept {
-return not IsUniqueElement(element);
-}
+namespace cljonic
+{
 
-[[nodiscard]] constexpr const T& DefaultElement() const noexcept {
-return m_elementDefault;
+namespace core
+{
+template <typename T>
+[[nodiscard]] constexpr void* Identity(const T& t) noexcept
+{
+return (void*)&t;
 }
 
-[[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
-                                                            const T& element) const noexcept override {
-return (index < m_elementCount) and Contains(element);
 }
 
-[[nodiscard]] static consteval SizeType MaximumCount() noexcept {
-return maximumElements;
 }
-};
 
-template <typename... Args>
-Set(Args...) -> Set<std::common_type_t<Args...>, sizeof...(Args)>;
+#include <limits>
 
-} // namespace cljonic
+namespace cljonic
+{
 
-#include <cstring>
-#include <initializer_list>
-#include <type_traits>
+namespace core
+{
+template <typename T>
+[[nodiscard]] constexpr auto Inc(const T t) noexcept
+{
+static_assert(IsArithmetic<T>, "Inc's parameter must be an arithmetic type");
 
-namespace cljonic {
-template <SizeType MaxElements>
-class String : public IndexInterface<char> {
-using Iterator = CollectionIterator<String>;
+return (std::numeric_limits<T>::max() == t) ? t : (t + 1);
+}
 
-static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+}
 
-static_assert(maximumElements == MaxElements,
-              "Attempt to create a String bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+}
 
-SizeType m_elementCount;
-const char m_elementDefault;
-char m_elements[maximumElements + 1]{};
+#include <type_traits>
 
-[[nodiscard]] constexpr auto ValueAtIndex(const SizeType index) const noexcept {
-return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
-}
+namespace cljonic
+{
 
-public:
-using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::String>;
-using size_type = SizeType;
-using value_type = char;
+namespace core
+{
+template <typename C, typename T>
+[[nodiscard]] constexpr auto IndexOf(const C& c, const T& t) noexcept
+{
 
-constexpr String() noexcept : m_elementCount(0), m_elementDefault('\0') {
-m_elements[0] = '\0';
-}
+static_assert(IsCljonicCollection<C>, "IndexOf's first parameter must be a cljonic collection");
 
-template <typename... Args>
-requires(std::same_as<std::remove_cvref_t<Args>, char> && ...)
-constexpr explicit String(Args&&... args) noexcept : m_elementCount(0), m_elementDefault('\0') {
-static_assert(sizeof...(Args) <= MaximumCount(), "String initialized with too many elements");
-((m_elements[m_elementCount++] = args), ...);
-m_elements[m_elementCount] = '\0';
-}
+static_assert((not std::floating_point<typename C::value_type>) and (not std::floating_point<T>),
+"IndexOf should not compare floating point types for equality. Consider using IndexOfBy to override "
+"this default.");
 
-constexpr explicit String(const char* c_str) noexcept : m_elementCount(0), m_elementDefault('\0') {
-while((m_elementCount < MaximumCount()) and ('\0' != c_str[m_elementCount])) {
-m_elements[m_elementCount] = c_str[m_elementCount];
-m_elementCount += 1;
+static_assert(std::convertible_to<T, typename C::value_type>,
+"IndexOf's second parameter must be convertible to the collection value type");
+
+if constexpr (IsCljonicRange<C> and std::integral<T>)
+{
+return RangeIndexOf<false>(c, t);
 }
-m_elements[m_elementCount] = '\0';
+else if constexpr (IsCljonicRepeat<C>)
+{
+return ((c.Count() > 0) and AreEqual(c.At(0), t)) ? 0 : CLJONIC_INVALID_INDEX;
 }
-
-constexpr String(const String& other) noexcept = default;
-constexpr String(String&& other) noexcept = default;
-
-[[nodiscard]] constexpr Iterator begin() const noexcept {
-return Iterator{*this, 0};
+else if constexpr (IsBulkSearchable<typename C::value_type, T> and std::is_pointer_v<decltype(c.begin())>)
+{
+return BulkIndexOf<false>(c.begin(), c.Count(), t);
 }
+else
+{
 
-[[nodiscard]] constexpr Iterator end() const noexcept {
-return Iterator{*this, m_elementCount};
+SizeType index{0};
+for (const auto& element : c)
+{
+if (AreEqual(element, t))
+return index;
+++index;
 }
-
-[[nodiscard]] constexpr char operator[](const SizeType index) const noexcept override {
-return ValueAtIndex(index);
+return CLJONIC_INVALID_INDEX;
 }
-
-[[nodiscard]] constexpr char operator()(const SizeType index) const noexcept {
-return this->operator[](index);
 }
 
-[[nodiscard]] constexpr SizeType Count() const noexcept override {
-return m_elementCount;
 }
 
-[[nodiscard]] constexpr const char& DefaultElement() const noexcept {
-return m_elementDefault;
 }
 
-[[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
-                                                            const char& element) const noexcept override {
-return (index < m_elementCount) and AreEqual(ValueAtIndex(index), element);
-}
+namespace cljonic
+{
 
-[[nodiscard]] static consteval SizeType MaximumCount() noexcept {
-return maximumElements;
-}
-};
+namespace core
+{
+template <typename F, typename C, typename T>
+[[nodiscard]] constexpr auto IndexOfBy(F&& f, const C& c, const T& t) noexcept
+{
 
-template <SizeType N>
-String(const char (&)[N]) -> String<N - 1>;
+static_assert(IsCljonicCollection<C>, "IndexOfBy's second parameter must be a cljonic collection");
 
-template <typename... Args>
-String(Args...) -> String<sizeof...(Args)>;
+static_assert(IsBinaryPredicate<std::decay_t<F>, typename C::value_type, typename C::value_type>,
+"IndexOfBy's function is not a valid binary predicate for the collection value type");
 
-} // namespace cljonic
+static_assert(std::convertible_to<T, typename C::value_type>,
+"IndexOfBy's third parameter must be convertible to the collection value type");
 
-namespace cljonic {
+auto result{CLJONIC_INVALID_INDEX};
+for (SizeType i{0}; ((CLJONIC_INVALID_INDEX == result) and (i < c.Count())); ++i)
+if (f(ElementAt(c, i), t))
+result = i;
+return result;
+}
 
-namespace core {
 }
 
 }
 
-#include <utility>
+namespace cljonic
+{
 
-namespace cljonic {
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr SizeType IndexOfMax(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "IndexOfMax's parameter must be a cljonic collection");
+
+if constexpr (IsCljonicRange<C>)
+return (0 == c.Count()) ? CLJONIC_INVALID_INDEX : ((c[0] < c[c.Count() - 1]) ? (c.Count() - 1) : 0);
+else if constexpr (IsCljonicRepeat<C>)
+return (0 == c.Count()) ? CLJONIC_INVALID_INDEX : 0;
+else
+return IndexOfBest([](const auto& best, const auto& element) { return best < element; }, c);
+}
 
-namespace core {
+}
 
-template <typename F1, typename F2, typename... Args>
-concept ComposeIsCallableWith = requires(F1 f1, F2 f2, Args&&... args) {
-{ f1(f2(std::forward<Args>(args)...)) };
-};
+}
 
-template <typename F1, typename F2>
-[[nodiscard]] constexpr auto Compose(F1&& f1, F2&& f2) noexcept {
-return [f1 = std::forward<F1>(f1), f2 = std::forward<F2>(f2)]<typename... T>(T&&... args) {
-static_assert(ComposeIsCallableWith<F1, F2, T...>,
-              "Each Compose argument must be callable with one argument of the return type of the argument to "
-              "its right. Was the Compose result function called with the correct number of arguments?");
+namespace cljonic
+{
 
-return f1(f2(std::forward<T>(args)...));
-};
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr SizeType IndexOfMin(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "IndexOfMin's parameter must be a cljonic collection");
+
+if constexpr (IsCljonicRange<C>)
+return (0 == c.Count()) ? CLJONIC_INVALID_INDEX : ((c[c.Count() - 1] < c[0]) ? (c.Count() - 1) : 0);
+else if constexpr (IsCljonicRepeat<C>)
+return (0 == c.Count()) ? CLJONIC_INVALID_INDEX : 0;
+else
+return IndexOfBest([](const auto& best, const auto& element) { return element < best; }, c);
 }
-template <typename F1, typename F2, typename... Fs>
-[[nodiscard]] constexpr auto Compose(F1&& f1, F2&& f2, Fs&&... fs) noexcept {
-return Compose(std::forward<F1>(f1), Compose(std::forward<F2>(f2), std::forward<Fs>(fs)...));
+
 }
 
 }
 
-} // namespace cljonic::core
+#include <concepts>
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
+namespace core
+{
 template <typename C, typename... Cs>
-[[nodiscard]] constexpr auto Concat(const C& c, const Cs&... cs) noexcept {
+[[nodiscard]] constexpr auto Interleave(const C& c, const Cs&... cs) noexcept
+{
 
-static_assert(AllCljonicCollections<C, Cs...>, "All Concat parameters must be cljonic collections");
+static_assert(AllCljonicCollections<C, Cs...>, "Interleave's parameters must all be cljonic collections");
 
 static_assert(AllConvertibleValueTypes<C, Cs...>,
-              "All Concat cljonic collection value types must be interconvertible");
+"All Interleave cljonic collection value types must be interconvertible");
 
-using ResultType = FindCommonValueType<C, Cs...>;
-
-constexpr auto count{SumOfCljonicCollectionMaximumCounts<C, Cs...>()};
-auto result{Array<ResultType, count>{}};
-const auto MConjCollectionOntoResult = [&](const auto& c) {
-for(SizeType i{0}; i < c.Count(); ++i)
-MConj(result, static_cast<ResultType>(c[i]));
-};
-(MConjCollectionOntoResult(c), ..., MConjCollectionOntoResult(cs));
+constexpr auto minimumCollectionCount{MinimumOfCljonicCollectionMaximumCounts<C, Cs...>()};
+constexpr auto collectionsCount{sizeof...(Cs) + 1};
+constexpr auto resultCount{minimumCollectionCount * collectionsCount};
+auto result{Array<FindCommonValueType<C, Cs...>, resultCount>{}};
+for (SizeType i{0}; i < minimumCollectionCount; ++i)
+{
+MConj(result, ElementAt(c, i));
+(MConj(result, cs[i]), ...);
+}
 return result;
 }
 
-[[nodiscard]] constexpr auto Concat() noexcept {
+[[nodiscard]] constexpr auto Interleave() noexcept
+{
 return Array<int, 0>{};
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename C, typename... Es>
-[[nodiscard]] constexpr auto Conj(const C& c, const Es&... es) noexcept {
+namespace core
+{
+template <typename T, typename C>
+[[nodiscard]] constexpr auto Interpose(const T& t, const C& c) noexcept
+{
 
-static_assert(IsCljonicCollection<C>, "First Conj parameter must be a cljonic collection");
+static_assert(IsCljonicCollection<C>, "Interpose's second parameter must be a cljonic collection");
 
-static_assert(AllConvertibleTypes<typename C::value_type, Es...>,
-              "Second through last Conj parameters must be convertible to cljonic collection value type");
+static_assert(std::convertible_to<T, typename C::value_type>,
+"Interpose's first parameter must be convertible to cljonic collection value type");
 
 using ResultType = typename C::value_type;
-
-constexpr auto count{C::MaximumCount() + sizeof...(Es)};
-auto result{Array<ResultType, count>{}};
-const auto MConjElementOntoResult = [&](const auto& e) { MConj(result, e); };
-for(SizeType i{0}; i < c.Count(); ++i)
-MConjElementOntoResult(c[i]);
-(MConjElementOntoResult(es), ...);
+constexpr auto collectionMaximumCount{c.MaximumCount()};
+constexpr auto resultMaximumCount{(2 * collectionMaximumCount) - 1};
+auto interposeValue{static_cast<ResultType>(t)};
+auto result{Array<ResultType, resultMaximumCount>{}};
+for (SizeType i{0}; i < collectionMaximumCount; ++i)
+{
+MConj(result, ElementAt(c, i));
+MConj(result, interposeValue);
+}
 return result;
 }
 
+[[nodiscard]] constexpr auto Interpose() noexcept
+{
+return Array<int, 0>{};
 }
 
-} // namespace cljonic::core
-
-namespace cljonic {
-
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto Count(const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Count's parameter must be a cljonic collection");
-
-return c.Count();
 }
 
 }
 
-} // namespace cljonic::core
+namespace cljonic
+{
 
-#include <utility>
+namespace core
+{
+template <typename A, typename XF, typename C>
+[[nodiscard]] constexpr auto Into(const A& a, XF&& xf, const C& c) noexcept
+{
+static_assert(IsCljonicArray<A>, "Into's first parameter must be a cljonic Array");
 
-namespace cljonic {
+static_assert(IsCljonicCollection<C>, "Into's third parameter must be a cljonic collection");
 
-namespace core {
+using ValueType = typename A::value_type;
 
-template <typename C>
-class CycleCollection {
-using ElementType = typename C::value_type;
+auto result{a};
+auto step{xf(
+[](A& accumulator, const auto& element)
+{
+MConj(accumulator, static_cast<ValueType>(element));
+return accumulator.Count() < accumulator.MaximumCount();
+})};
+if (result.Count() < result.MaximumCount())
+for (const auto& element : c)
+if (not step(result, element))
+break;
+return result;
+}
 
-C m_collection;
+}
 
-[[nodiscard]] constexpr SizeType IndexToElementIndex(const SizeType index) const noexcept {
-return (0 == m_collection.Count()) ? 0 : (index % m_collection.Count());
 }
 
-class CycleIterator {
-const CycleCollection& m_cycle;
-SizeType m_index;
+namespace cljonic
+{
 
-public:
-constexpr CycleIterator(const CycleCollection& cycle, const SizeType index) noexcept
-    : m_cycle(cycle), m_index(index) {
-}
+namespace core
+{
+template <typename T, typename... Ts>
+[[nodiscard]] constexpr auto IsDistinct(const T& t, const Ts&... ts) noexcept
+{
 
-[[nodiscard]] constexpr auto operator*() const noexcept -> decltype(m_cycle[m_index]) {
-return m_cycle[m_cycle.IndexToElementIndex(m_index)];
+if constexpr (sizeof...(Ts) == 0)
+{
+return true;
 }
+else
+{
+if constexpr (AllCljonicCollections<T, Ts...>)
+{
+static_assert(not AnyFloatingPointValueTypes<T, Ts...>,
+"IsDistinct should not compare cljonic floating point collection value types for "
+"equality. Consider using IsDistinctBy to override this default.");
 
-constexpr CycleIterator& operator++() noexcept {
-++m_index;
-return *this;
-}
+static_assert(
+AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeRepeatOrView<T, Ts...>,
+"IsDistinct cljonic collection types are not all the same, or all Array, Range, Repeat or view types");
 
-[[nodiscard]] constexpr bool operator!=(const CycleIterator& other) const noexcept {
-return m_index != other.m_index;
+constexpr auto CollectionsEqual = [](const auto& t, const auto& u) noexcept
+{
+if (static_cast<const void*>(&t) == static_cast<const void*>(&u))
+return true;
+if constexpr ((IsCljonicRange<std::remove_cvref_t<decltype(t)>> and
+IsCljonicRange<std::remove_cvref_t<decltype(u)>>) or
+(IsCljonicRepeat<std::remove_cvref_t<decltype(t)>> and
+IsCljonicRepeat<std::remove_cvref_t<decltype(u)>>))
+return AreEqual(t, u);
+if (t.Count() != u.Count())
+return false;
+for (SizeType i{0}; i < t.Count(); ++i)
+if (not t.ElementAtIndexIsEqualToElement(i, u[i]))
+return false;
+return true;
+};
+return (not CollectionsEqual(t, ts) and ...) and IsDistinct(ts...);
 }
+else
+{
+static_assert(not AnyFloatingPointTypes<T, Ts...>,
+"IsDistinct should not compare floating point types for equality. Consider using "
+"IsDistinctBy to override this default.");
 
-constexpr CycleIterator& operator+=(const int value) noexcept {
-m_index += value;
-return *this;
-}
+static_assert(AllEqualityComparableTypes<T, Ts...>, "Not all IsDistinct types are equality comparable");
 
-[[nodiscard]] constexpr CycleIterator operator+(const int value) const noexcept {
-CycleIterator temp = *this;
-temp += value;
-return temp;
+return (not AreEqual(t, ts) and ...);
+}
+}
 }
-};
-
-public:
-using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Cycle>;
-using size_type = SizeType;
-using value_type = ElementType;
 
-constexpr explicit CycleCollection(const C& collection) : m_collection(collection) {
 }
 
-constexpr explicit CycleCollection(C&& collection) : m_collection(std::move(collection)) {
 }
 
-constexpr CycleCollection(const CycleCollection& other) = default;
-constexpr CycleCollection(CycleCollection&& other) = default;
+#include <utility>
 
-[[nodiscard]] constexpr CycleIterator begin() const noexcept {
-return CycleIterator(*this, 0);
-}
+namespace cljonic
+{
 
-[[nodiscard]] constexpr CycleIterator end() const noexcept {
-return CycleIterator(*this, MaximumCount());
-}
+namespace core
+{
+template <typename F, typename T, typename... Ts>
+[[nodiscard]] constexpr auto IsDistinctBy(F&& f, const T& t, const Ts&... ts) noexcept
+{
 
-[[nodiscard]] constexpr ElementType operator[](const SizeType index) const noexcept {
-return m_collection[IndexToElementIndex(index)];
+if constexpr (sizeof...(Ts) == 0)
+{
+return true;
 }
+else
+{
+if constexpr (AllCljonicCollections<T, Ts...>)
+{
+static_assert(
+AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeRepeatOrView<T, Ts...>,
+"IsDistinctBy cljonic collection types are not all the same, or all Array, Range, Repeat or view "
+"types");
 
-[[nodiscard]] constexpr SizeType Count() const noexcept {
-return MaximumCount();
-}
+static_assert(
+IsBinaryPredicateForAllCljonicCollections<std::decay_t<F>, T, Ts...>,
+"IsDistinctBy function is not a valid binary predicate for all cljonic collection value types");
 
-[[nodiscard]] constexpr const ElementType& DefaultElement() const noexcept {
-return m_collection.DefaultElement();
+constexpr auto CollectionsEqualBy = [](auto&& f, const auto& t, const auto& u) noexcept
+{
+if (static_cast<const void*>(&t) == static_cast<const void*>(&u))
+return true;
+if (t.Count() != u.Count())
+return false;
+if constexpr (IsCljonicSet<T>)
+{
+constexpr auto ContainsBy = [](auto&& f, const auto& setIndex, const auto& element) noexcept
+{
+auto result{false};
+for (SizeType i{0}; ((not result) and (i < setIndex.Count())); ++i)
+result = f(setIndex[i], element);
+return result;
+};
+for (SizeType i{0}; i < t.Count(); ++i)
+if (not ContainsBy(f, t, u[i]))
+return false;
+return true;
 }
-
-[[nodiscard]] constexpr SizeType MaximumCount() const noexcept {
-return (0 == m_collection.Count()) ? 0 : CljonicCollectionMaximumElementCount;
+else
+{
+for (SizeType i{0}; i < t.Count(); ++i)
+if (not f(t[i], u[i]))
+return false;
+return true;
 }
 };
-template <typename C>
-[[nodiscard]] constexpr auto Cycle(const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Cycle's parameter must be a cljonic collection");
+return (not CollectionsEqualBy(f, t, ts) and ...) and IsDistinctBy(std::forward<F>(f), ts...);
+}
+else
+{
+static_assert(IsBinaryPredicateForAll<std::decay_t<F>, T, Ts...>,
+"IsDistinctBy function is not a valid binary predicate for all parameters");
 
-return CycleCollection{c};
+return ((f(t, ts) == false) and ...) and IsDistinctBy(std::forward<F>(f), ts...);
+}
+}
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
+namespace core
+{
 template <typename C>
-[[nodiscard]] constexpr auto Dedupe(const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Dedupe's parameter must be a cljonic collection");
+[[nodiscard]] constexpr auto IsEmpty(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "IsEmpty's parameter must be a cljonic collection");
 
-static_assert((not std::floating_point<typename C::value_type>),
-              "Dedupe should not compare cljonic floating point collection value types for equality. Consider "
-              "using DedupeBy to override this default.");
+return 0 == c.Count();
+}
 
-return DedupeBy([](const auto& a, const auto& b) { return AreEqual(a, b); }, c);
 }
 
 }
 
-} // namespace cljonic::core
+namespace cljonic
+{
 
-namespace cljonic {
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto IsFull(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "IsFull's parameter must be a cljonic collection");
 
-namespace core {
-template <typename F, typename C>
-[[nodiscard]] constexpr auto DedupeBy(F&& f, const C& c) noexcept {
+return c.Count() == c.MaximumCount();
+}
 
-static_assert(IsCljonicCollection<C>, "DedupeBy's second parameter must be a cljonic collection");
+}
 
-static_assert(IsBinaryPredicate<std::decay_t<F>, typename C::value_type, typename C::value_type>,
-              "DedupeBy's function is not a valid binary predicate for the collection value type");
+}
 
-using ValueType = typename C::value_type;
+namespace cljonic
+{
 
-constexpr auto IndexOfNextElementNotEqualToCurrentElement =
-    [](const F& fn, const C& collection, const SizeType currentIndex) {
-    auto currentElement{collection[currentIndex]};
-    auto i{currentIndex + 1};
-    while((i < collection.Count()) and fn(collection[i], currentElement))
-    ++i;
-    return i;
-    };
+namespace core
+{
+template <typename F, typename T>
+[[nodiscard]] constexpr auto Iterate(F&& f, const T& t) noexcept
+{
+static_assert(IsUnaryFunction<F, T>, "Iterate's first parameter is not a unary function of its second parameter");
 
-auto result{Array<ValueType, c.MaximumCount()>{}};
-for(SizeType i{0}; i < c.Count();) {
-MConj(result, c[i]);
-i = IndexOfNextElementNotEqualToCurrentElement(f, c, i);
-}
-return result;
+return Iterator{std::forward<F>(f), t};
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
+namespace core
+{
 template <typename C>
-[[nodiscard]] constexpr auto DefaultElement(const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "DefaultElement's parameter must be a cljonic collection");
+[[nodiscard]] constexpr auto Last(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Last's parameter must be a cljonic collection");
 
-return c.DefaultElement();
+return c[(c.Count() > 0) ? (c.Count() - 1) : 0];
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+#include <type_traits>
 
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto Drop(const SizeType count, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Drop's second parameter must be a cljonic collection");
+namespace cljonic
+{
 
-auto result{Array<typename C::value_type, c.MaximumCount()>{}};
-for(SizeType i{count}; (i < c.Count()); ++i)
-MConj(result, c[i]);
-return result;
-}
+namespace core
+{
+template <typename C, typename T>
+[[nodiscard]] constexpr auto LastIndexOf(const C& c, const T& t) noexcept
+{
 
-}
+static_assert(IsCljonicCollection<C>, "LastIndexOf's first parameter must be a cljonic collection");
 
-} // namespace cljonic::core
+static_assert(std::equality_comparable_with<typename C::value_type, T>,
+"LastIndexOf's second parameter is not equality comparable with the cljonic collection values");
 
-namespace cljonic {
+static_assert(not std::floating_point<typename C::value_type>,
+"LastIndexOf should not compare floating point types for equality. Consider using LastIndexOfBy to "
+"override this default.");
 
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto DropLast(const SizeType count, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "DropLast's second parameter must be a cljonic collection");
+static_assert(not std::floating_point<T>,
+"LastIndexOf should not compare floating point types for equality. Consider using LastIndexOfBy to "
+"override this default.");
 
-auto result{Array<typename C::value_type, c.MaximumCount()>{}};
-auto endIndex{(count > c.Count()) ? 0 : (c.Count() - count)};
-for(SizeType i{0}; (i < endIndex); ++i)
-MConj(result, c[i]);
+if constexpr (IsCljonicRange<C> and std::integral<T>)
+{
+return RangeIndexOf<true>(c, t);
+}
+else if constexpr (IsCljonicRepeat<C>)
+{
+return ((c.Count() > 0) and AreEqual(c.At(0), t)) ? (c.Count() - 1) : CLJONIC_INVALID_INDEX;
+}
+else if constexpr (IsBulkSearchable<typename C::value_type, T> and std::is_pointer_v<decltype(c.begin())>)
+{
+return BulkIndexOf<true>(c.begin(), c.Count(), t);
+}
+else
+{
+auto result{CLJONIC_INVALID_INDEX};
+for (SizeType nextIndex{c.Count()}; ((CLJONIC_INVALID_INDEX == result) and (nextIndex > 0)); --nextIndex)
+if (AreEqual(c[nextIndex - 1], t))
+result = nextIndex - 1;
 return result;
 }
+}
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename F, typename C>
-[[nodiscard]] constexpr auto DropWhile(F&& f, const C& c) noexcept {
+namespace core
+{
+template <typename F, typename C, typename T>
+[[nodiscard]] constexpr auto LastIndexOfBy(F&& f, const C& c, const T& t) noexcept
+{
 
-static_assert(IsCljonicCollection<C>, "DropWhile's second parameter must be a cljonic collection");
+static_assert(IsCljonicCollection<C>, "LastIndexOfBy's second parameter must be a cljonic collection");
 
-static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
-              "DropWhile's function is not a valid unary predicate for the collection value type");
+static_assert(std::equality_comparable_with<typename C::value_type, T>,
+"LastIndexOfBy's third parameter is not equality comparable with the cljonic collection values");
 
-auto result{Array<typename C::value_type, c.MaximumCount()>{}};
-auto conjElement(false);
-for(const auto& element : c)
-if(conjElement |= (not f(element)))
-MConj(result, element);
+static_assert(IsBinaryPredicate<F, typename C::value_type, T>,
+"LastIndexOfBy's first parameter is not a valid binary predicate for the collection value type");
+
+auto result{CLJONIC_INVALID_INDEX};
+for (SizeType nextIndex{c.Count()}; ((CLJONIC_INVALID_INDEX == result) and (nextIndex > 0)); --nextIndex)
+if (f(c[nextIndex - 1], t))
+result = nextIndex - 1;
 return result;
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+#include <concepts>
 
-namespace core {
-template <typename T, typename... Ts>
-[[nodiscard]] constexpr auto Equal(const T& t, const Ts&... ts) noexcept {
+namespace cljonic
+{
 
-if constexpr(sizeof...(Ts) == 0) {
-if constexpr(IsCljonicCollection<T>)
-static_assert((not std::floating_point<typename T::value_type>),
-              "Equal should not compare cljonic floating point collection value types for equality. "
-              "Consider using EqualBy to override this default.");
-else
-static_assert((not std::floating_point<T>),
-              "Equal should not compare floating point types for equality. Consider using EqualBy to "
-              "override this default.");
-return true;
-} else if constexpr(AllCljonicCollections<T, Ts...>) {
-static_assert(not AnyFloatingPointValueTypes<T, Ts...>,
-              "Equal should not compare cljonic floating point collection value types for equality. Consider "
-              "using EqualBy to override this default.");
+namespace core
+{
+template <typename F, typename C, typename... Cs>
+[[nodiscard]] constexpr auto Map(F&& f, const C& c, const Cs&... cs) noexcept
+{
 
-static_assert(AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeOrRepeat<T, Ts...>,
-              "Equal cljonic collection types are not all the same, or all Array, Range or Repeat types");
+static_assert(AllCljonicCollections<C, Cs...>, "Map's second through last parameters must be cljonic collections");
 
-return (AreEqual(t, ts) and ...);
-} else {
-static_assert(not AnyFloatingPointTypes<T, Ts...>,
-              "Equal should not compare floating point types for equality. Consider using EqualBy to override "
-              "this default.");
+static_assert(std::invocable<F, typename C::value_type, typename Cs::value_type...>,
+"Map's function cannot be called with values from the specified cljonic collections");
 
-static_assert(AllEqualityComparableTypes<T, Ts...>, "Not all Equal types are equality comparable");
+using ResultType = decltype(f(std::declval<typename C::value_type>(), std::declval<typename Cs::value_type>()...));
 
-return (AreEqual(t, ts) and ...);
+constexpr auto count{MinimumOfCljonicCollectionMaximumCounts<C, Cs...>()};
+auto result{Array<ResultType, count>{}};
+if constexpr (IsRandomAccessCollection<C>)
+{
+
+[&](auto... cursors)
+{
+const auto n{MinArgument(c.Count(), count)};
+for (SizeType i{0}; i < n; ++i)
+MConj(result, f(cursors.Next()...));
+}(ElementCursor{c}, ElementCursor{cs}...);
 }
+else
+{
+
+[&](auto... cursors)
+{
+if constexpr (count > 0)
+{
+SizeType i{0};
+for (const auto& element : c)
+{
+MConj(result, f(element, cursors.Next()...));
+if (count == ++i)
+break;
 }
-
+}
+}(ElementCursor{cs}...);
+}
+return result;
 }
 
-} // namespace cljonic::core
-
-namespace cljonic {
-
-namespace core {
-template <typename F, typename T, typename... Ts>
-[[nodiscard]] constexpr auto EqualBy(F&& f, const T& t, const Ts&... ts) noexcept {
-
-if constexpr(sizeof...(Ts) <= 0) {
-return true;
-} else if constexpr(AllCljonicCollections<T, Ts...>) {
-static_assert(AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeOrRepeat<T, Ts...>,
-              "EqualBy cljonic collection types are not all the same, or all Array, Range or Repeat types");
-
-static_assert(IsBinaryPredicateForAllCljonicCollections<std::decay_t<F>, T, Ts...>,
-              "EqualBy function is not a valid binary predicate for all cljonic collection value types");
+}
 
-return (AreEqualBy(f, t, ts) and ...);
-} else {
-static_assert(AllEqualityComparableTypes<T, Ts...>, "Not all EqualBy types are equality comparable");
+}
 
-static_assert(IsBinaryPredicateForAll<F, T, Ts...>,
-              "EqualBy function is not a valid binary predicate for all parameters");
+#include <utility>
 
-return (AreEqualBy(f, t, ts) and ...);
+namespace cljonic
+{
+
+namespace core
+{
+template <typename F>
+[[nodiscard]] constexpr auto MapT(F&& f) noexcept
+{
+return [f = std::forward<F>(f)](auto step)
+{
+return [f, step](auto& accumulator, const auto& element) mutable { return step(accumulator, f(element)); };
+};
 }
+
 }
 
 }
 
-} // namespace cljonic::core
+#include <type_traits>
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename F, typename C>
-[[nodiscard]] constexpr auto Every(F&& f, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Every's second parameter must be a cljonic collection");
+namespace core
+{
+template <typename T, typename... Ts>
+[[nodiscard]] constexpr auto Max(const T& t, const Ts&... ts) noexcept
+{
 
-static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
-              "Every's function is not a valid unary predicate for the collection value type");
+if constexpr (sizeof...(Ts) == 0)
+{
+static_assert(IsCljonicCollection<T>, "Max's parameter must be a cljonic collection");
 
-auto result{true};
-for(SizeType i{0}; (result and (i < c.Count())); ++i)
-result = f(c[i]);
+if constexpr (IsCljonicRange<T>)
+{
+
+return (0 == t.Count()) ? t.DefaultElement() : Max(t[0], t[t.Count() - 1]);
+}
+else if constexpr (IsCljonicRepeat<T>)
+{
+return t[0];
+}
+else if constexpr (IsLaneReducer<MaximumReducer, typename T::value_type> and
+std::is_pointer_v<decltype(t.begin())>)
+{
+return (0 == t.Count()) ? t.DefaultElement() : ReduceInLanes(Maximum, t.begin(), t.Count());
+}
+else
+{
+auto result{t.DefaultElement()};
+if (t.Count() > 0)
+{
+result = t[0];
+for (SizeType i{1}; i < t.Count(); ++i)
+if (result < t[i])
+result = t[i];
+}
 return result;
 }
-
 }
+else
+{
+static_assert(AllNotCljonicCollections<T, Ts...>, "None of Max's parameters can be cljonic collections");
 
-} // namespace cljonic::core
-
-namespace cljonic {
-
-namespace core {
-template <typename F, typename C>
-[[nodiscard]] constexpr auto Filter(F&& f, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Filter's second parameter must be a cljonic collection");
-
-static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
-              "Filter's function is not a valid unary predicate for the collection value type");
-
-auto result{Array<typename C::value_type, c.MaximumCount()>{}};
-for(const auto& element : c)
-if(f(element))
-MConj(result, element);
+auto result{t};
+(..., (void)((result < ts) ? result = ts : result));
 return result;
 }
+}
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto First(const C& coll) noexcept {
-static_assert(IsCljonicCollection<C>, "First's parameter must be a cljonic collection");
+namespace core
+{
+template <typename F, typename T, typename... Ts>
+[[nodiscard]] constexpr auto MaxBy(F&& f, const T& t, const Ts&... ts) noexcept
+{
 
-return coll[0];
-}
+if constexpr (sizeof...(Ts) == 0)
+{
+static_assert(IsCljonicCollection<T>, "MaxBy's second parameter must be a cljonic collection");
 
-}
+static_assert(IsBinaryPredicate<F, typename T::value_type, typename T::value_type>,
+"MaxBy function is not a valid binary predicate for the collection value type");
 
-} // namespace cljonic::core
+const auto index{IndexOfBest(f, t)};
+return (CLJONIC_INVALID_INDEX == index) ? t.DefaultElement() : t[index];
+}
+else
+{
+static_assert(AllNotCljonicCollections<T, Ts...>,
+"None of MaxBy's second through last parameters can be cljonic collections");
 
-namespace cljonic {
+static_assert(IsBinaryPredicate<F, T, T>,
+"MaxBy function is not a valid binary predicate for the collection value type");
 
-namespace core {
-template <typename T, typename... Ts>
-[[nodiscard]] constexpr auto Identical(const T& t, const Ts&... ts) noexcept {
-if constexpr(sizeof...(Ts) <= 0) {
-return true;
-} else {
-auto SameIdentity = [&](const auto& t1, const auto& t2) { return Identity(t1) == Identity(t2); };
-return (SameIdentity(t, ts) and ...);
+auto result{t};
+(..., (void)(f(result, ts) ? result = ts : result));
+return result;
 }
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+#include <type_traits>
 
-namespace core {
-template <typename T>
-[[nodiscard]] constexpr void* Identity(const T& t) noexcept {
-return (void*)&t;
-}
+namespace cljonic
+{
 
-}
+namespace core
+{
+template <typename T, typename... Ts>
+[[nodiscard]] constexpr auto Min(const T& t, const Ts&... ts) noexcept
+{
 
-} // namespace cljonic::core
+if constexpr (sizeof...(Ts) == 0)
+{
+static_assert(IsCljonicCollection<T>, "Min's parameter must be a cljonic collection");
 
-#include <limits>
+if constexpr (IsCljonicRange<T>)
+{
 
-namespace cljonic {
+return (0 == t.Count()) ? t.DefaultElement() : Min(t[0], t[t.Count() - 1]);
+}
+else if constexpr (IsCljonicRepeat<T>)
+{
+return t[0];
+}
+else if constexpr (IsLaneReducer<MinimumReducer, typename T::value_type> and
+std::is_pointer_v<decltype(t.begin())>)
+{
+return (0 == t.Count()) ? t.DefaultElement() : ReduceInLanes(Minimum, t.begin(), t.Count());
+}
+else
+{
+auto result{t.DefaultElement()};
+if (t.Count() > 0)
+{
+result = t[0];
+for (SizeType i{1}; i < t.Count(); ++i)
+if (t[i] < result)
+result = t[i];
+}
+return result;
+}
+}
+else
+{
+static_assert(AllNotCljonicCollections<T, Ts...>, "None of Min's parameters can be cljonic collections");
 
-namespace core {
-template <typename T>
-[[nodiscard]] constexpr auto Inc(const T t) noexcept {
-static_assert(IsArithmetic<T>, "Inc's parameter must be an arithmetic type");
+auto result{t};
+(..., (void)((ts < result) ? result = ts : result));
+return result;
+}
+}
 
-return (std::numeric_limits<T>::max() == t) ? t : (t + 1);
 }
 
 }
 
-} // namespace cljonic::core
+namespace cljonic
+{
 
-namespace cljonic {
+namespace core
+{
+template <typename F, typename T, typename... Ts>
+[[nodiscard]] constexpr auto MinBy(F&& f, const T& t, const Ts&... ts) noexcept
+{
 
-namespace core {
-template <typename C, typename T>
-[[nodiscard]] constexpr auto IndexOf(const C& c, const T& t) noexcept {
+if constexpr (sizeof...(Ts) == 0)
+{
+static_assert(IsCljonicCollection<T>, "MinBy's second parameter must be a cljonic collection");
 
-static_assert(IsCljonicCollection<C>, "IndexOf's first parameter must be a cljonic collection");
+static_assert(IsBinaryPredicate<F, typename T::value_type, typename T::value_type>,
+"MinBy function is not a valid binary predicate for the collection value type");
 
-static_assert((not std::floating_point<typename C::value_type>) and (not std::floating_point<T>),
-              "IndexOf should not compare floating point types for equality. Consider using IndexOfBy to override "
-              "this default.");
+const auto index{IndexOfBest([&f](const auto& best, const auto& element) { return not f(best, element); }, t)};
+return (CLJONIC_INVALID_INDEX == index) ? t.DefaultElement() : t[index];
+}
+else
+{
+static_assert(AllNotCljonicCollections<T, Ts...>,
+"None of MinBy's second through last parameters can be cljonic collections");
 
-static_assert(std::convertible_to<T, typename C::value_type>,
-              "IndexOf's second parameter must be convertible to the collection value type");
+static_assert(IsBinaryPredicate<F, T, T>,
+"MinBy function is not a valid binary predicate for the collection value type");
 
-auto result{CLJONIC_INVALID_INDEX};
-for(SizeType i{0}; ((CLJONIC_INVALID_INDEX == result) and (i < c.Count())); ++i)
-if(AreEqual(c[i], t))
-result = i;
+auto result{t};
+(..., (void)((not f(result, ts)) ? result = ts : result));
 return result;
 }
-
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+}
 
-namespace core {
-template <typename F, typename C, typename T>
-[[nodiscard]] constexpr auto IndexOfBy(F&& f, const C& c, const T& t) noexcept {
+namespace cljonic
+{
 
-static_assert(IsCljonicCollection<C>, "IndexOfBy's second parameter must be a cljonic collection");
+namespace core
+{
+template <typename F, typename C>
+[[nodiscard]] constexpr auto NotAny(F&& f, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "NotAny's second parameter must be a cljonic collection");
 
-static_assert(IsBinaryPredicate<std::decay_t<F>, typename C::value_type, typename C::value_type>,
-              "IndexOfBy's function is not a valid binary predicate for the collection value type");
+static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
+"NotAny's function is not a valid unary predicate for the collection value type");
 
-static_assert(std::convertible_to<T, typename C::value_type>,
-              "IndexOfBy's third parameter must be convertible to the collection value type");
+return (c.Count() == 0) or (not Some(std::forward<F>(f), c));
+}
 
-auto result{CLJONIC_INVALID_INDEX};
-for(SizeType i{0}; ((CLJONIC_INVALID_INDEX == result) and (i < c.Count())); ++i)
-if(f(c[i], t))
-result = i;
-return result;
 }
 
 }
 
-} // namespace cljonic::core
+namespace cljonic
+{
 
-#include <concepts>
+namespace core
+{
+template <typename F, typename C>
+[[nodiscard]] constexpr auto NotEvery(F&& f, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "NotEvery's second parameter must be a cljonic collection");
 
-namespace cljonic {
+static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
+"NotEvery's function is not a valid unary predicate for the collection value type");
 
-namespace core {
-template <typename C, typename... Cs>
-[[nodiscard]] constexpr auto Interleave(const C& c, const Cs&... cs) noexcept {
+return (c.Count() != 0) and (not Every(std::forward<F>(f), c));
+}
 
-static_assert(AllCljonicCollections<C, Cs...>, "Interleave's parameters must all be cljonic collections");
+}
 
-static_assert(AllConvertibleValueTypes<C, Cs...>,
-              "All Interleave cljonic collection value types must be interconvertible");
+}
 
-constexpr auto minimumCollectionCount{MinimumOfCljonicCollectionMaximumCounts<C, Cs...>()};
-constexpr auto collectionsCount{sizeof...(Cs) + 1};
-constexpr auto resultCount{minimumCollectionCount * collectionsCount};
-auto result{Array<FindCommonValueType<C, Cs...>, resultCount>{}};
-for(SizeType i{0}; i < minimumCollectionCount; ++i) {
-MConj(result, c[i]);
-(MConj(result, cs[i]), ...);
+namespace cljonic
+{
+
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto Nth(const C& c, const SizeType index) noexcept
+{
+static_assert(IsCljonicCollection<C> and (not IsCljonicSet<C>),
+"Nth's first parameter must be a cljonic collection other than a Set");
+
+if constexpr (IsCljonicIterator<C>)
+{
+
+if (index >= c.Count())
+return c.DefaultElement();
+auto it{c.begin()};
+for (SizeType i{0}; i < index; ++i)
+++it;
+return *it;
 }
-return result;
+else
+{
+return c[index];
 }
-
-[[nodiscard]] constexpr auto Interleave() noexcept {
-return Array<int, 0>{};
 }
 
+template <typename C, typename T>
+[[nodiscard]] constexpr auto Nth(const C& c, const SizeType index, const T& t) noexcept
+{
+static_assert(IsCljonicCollection<C> and (not IsCljonicSet<C>),
+"Nth's first parameter must be a cljonic collection other than a Set");
+
+static_assert(std::same_as<typename C::value_type, T>,
+"Nth's third parameter must have the same type as the values in the first parameter");
+
+return (index < c.Count()) ? Nth(c, index) : t;
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+}
 
-namespace core {
-template <typename T, typename C>
-[[nodiscard]] constexpr auto Interpose(const T& t, const C& c) noexcept {
+#include <utility>
 
-static_assert(IsCljonicCollection<C>, "Interpose's second parameter must be a cljonic collection");
+namespace cljonic
+{
 
-static_assert(std::convertible_to<T, typename C::value_type>,
-              "Interpose's first parameter must be convertible to cljonic collection value type");
+namespace core
+{
+template <typename F, typename... Args>
+[[nodiscard]] constexpr auto Partial(F&& f, Args&&... args) noexcept
+{
+return [f = std::forward<F>(f), ... args = std::forward<Args>(args)](auto&&... rest)
+{
+static_assert(std::regular_invocable<F, Args..., decltype(rest)...>,
+"Partial's function cannot be called with the specified arguments");
 
-using ResultType = typename C::value_type;
-constexpr auto collectionMaximumCount{c.MaximumCount()};
-constexpr auto resultMaximumCount{(2 * collectionMaximumCount) - 1};
-auto interposeValue{static_cast<ResultType>(t)};
-auto result{Array<ResultType, resultMaximumCount>{}};
-for(SizeType i{0}; i < collectionMaximumCount; ++i) {
-MConj(result, c[i]);
-MConj(result, interposeValue);
-}
-return result;
+return f(args..., std::forward<decltype(rest)>(rest)...);
+};
 }
 
-[[nodiscard]] constexpr auto Interpose() noexcept {
-return Array<int, 0>{};
 }
 
 }
 
-} // namespace cljonic::core
+#include <tuple>
+#include <numeric>
+#include <type_traits>
 
-#include <array>
+namespace cljonic
+{
 
-namespace cljonic {
+namespace core
+{
+template <typename F, typename C>
+[[nodiscard]] constexpr auto Reduce(F&& f, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Reduce's second parameter must be a cljonic collection");
 
-namespace core {
-template <typename T, typename... Ts>
-[[nodiscard]] constexpr auto IsDistinct(const T& t, const Ts&... ts) noexcept {
+static_assert(std::regular_invocable<F, typename C::value_type, typename C::value_type>,
+"Reduce's function cannot be called with two parameters of the collection value type");
 
-if constexpr(sizeof...(Ts) == 0) {
-return true;
-} else {
-if constexpr(AllCljonicCollections<T, Ts...>) {
-static_assert(not AnyFloatingPointValueTypes<T, Ts...>,
-              "IsDistinct should not compare cljonic floating point collection value types for "
-              "equality. Consider using IsDistinctBy to override this default.");
+using ResultType = std::invoke_result_t<F, typename C::value_type, typename C::value_type>;
+static_assert(
+std::regular_invocable<F, ResultType, typename C::value_type>,
+"Reduce's function cannot be called with parameters of function result type, and collection value type");
+
+if constexpr (IsCljonicRange<C> and IsRangeReducer<std::decay_t<F>>)
+return (0 == c.Count()) ? c.DefaultElement() : ReduceRange(f, c);
+else if constexpr (IsCljonicRepeat<C> and IsLaneReducer<std::decay_t<F>, typename C::value_type>)
+return (0 == c.Count()) ? c.DefaultElement() : ReduceRepeated(f, c.At(0), c.Count());
+else if constexpr (IsLaneReducer<std::decay_t<F>, typename C::value_type> and
+std::is_pointer_v<decltype(c.begin())>)
+return (0 == c.Count()) ? c.DefaultElement() : ReduceInLanes(f, c.begin(), c.Count());
+else
+return (0 == c.Count()) ? c.DefaultElement()
+: std::accumulate((c.begin() + 1), c.end(), *c.begin(), std::forward<F>(f));
+}
+
+template <typename F, typename T, typename C>
+[[nodiscard]] constexpr auto Reduce(F&& f, const T& t, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Reduce's third parameter must be a cljonic collection");
 
 static_assert(
-    AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeOrRepeat<T, Ts...>,
-    "IsDistinct cljonic collection types are not all the same, or all Array, Range or Repeat types");
+std::regular_invocable<F, T, typename C::value_type>,
+"Reduce's function cannot be called with parameters of initial value type, and collection value type");
 
-constexpr auto IndexInterfacesEqual = [](const auto& t, const auto& u) noexcept {
-if(&t == &u)
-return true;
-if(t.Count() != u.Count())
-return false;
-for(SizeType i{0}; i < t.Count(); ++i)
-if(not t.ElementAtIndexIsEqualToElement(i, u[i]))
-return false;
-return true;
-};
-using I = const IndexInterface<typename T::value_type>*;
-constexpr auto n{sizeof...(Ts) + 1};
-const auto i{std::array<I, n>{static_cast<I>(&t), static_cast<I>(&ts)...}};
-for(SizeType j{0}; j < n; ++j)
-for(SizeType k{j + 1}; k < n; ++k)
-if(IndexInterfacesEqual(*i[j], *i[k]))
-return false;
-return true;
-} else {
-static_assert(not AnyFloatingPointTypes<T, Ts...>,
-              "IsDistinct should not compare floating point types for equality. Consider using "
-              "IsDistinctBy to override this default.");
+using ResultType = std::invoke_result_t<F, T, typename C::value_type>;
+static_assert(
+std::regular_invocable<F, ResultType, typename C::value_type>,
+"Reduce's function cannot be called with parameters of function result type, and collection value type");
+
+if constexpr (IsCljonicRange<C> and IsRangeReducer<std::decay_t<F>> and std::is_same_v<T, int>)
+return (0 == c.Count()) ? t : static_cast<T>(f(t, ReduceRange(f, c)));
+else if constexpr (IsCljonicRepeat<C> and IsLaneReducer<std::decay_t<F>, typename C::value_type> and
+std::is_same_v<T, typename C::value_type>)
+return (0 == c.Count()) ? t : static_cast<T>(f(t, ReduceRepeated(f, c.At(0), c.Count())));
+else if constexpr (IsLaneReducer<std::decay_t<F>, typename C::value_type> and
+std::is_same_v<T, typename C::value_type> and std::is_pointer_v<decltype(c.begin())>)
+return (0 == c.Count()) ? t : static_cast<T>(f(t, ReduceInLanes(f, c.begin(), c.Count())));
+else
+return (0 == c.Count()) ? t : std::accumulate(c.begin(), c.end(), t, std::forward<F>(f));
+}
 
-static_assert(AllEqualityComparableTypes<T, Ts...>, "Not all IsDistinct types are equality comparable");
+}
 
-return (not AreEqual(t, ts) and ...);
 }
+
+namespace cljonic
+{
+
+namespace core
+{
+template <typename F, typename C>
+[[nodiscard]] constexpr auto Remove(F&& f, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Remove's second parameter must be a cljonic collection");
+
+static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
+"Remove's function is not a valid unary predicate for the collection value type");
+
+auto result{Array<typename C::value_type, c.MaximumCount()>{}};
+for (const auto& element : c)
+if (not f(element))
+MConj(result, element);
+return result;
 }
+
 }
 
 }
 
-} // namespace cljonic::core
+#include <concepts>
+
+namespace cljonic
+{
 
-#include <array>
+namespace core
+{
+template <typename C1, typename C2>
+[[nodiscard]] constexpr auto Replace(const C1& c1, const C2& c2) noexcept
+{
 
-namespace cljonic {
+static_assert(IsCljonicCollection<C1>, "Replace's first parameter must be a cljonic collection");
 
-namespace core {
-template <typename F, typename T, typename... Ts>
-[[nodiscard]] constexpr auto IsDistinctBy(F&& f, const T& t, const Ts&... ts) noexcept {
+static_assert(IsCljonicCollection<C2>, "Replace's second parameter must be a cljonic collection");
 
-if constexpr(sizeof...(Ts) == 0) {
-return true;
-} else {
-if constexpr(AllCljonicCollections<T, Ts...>) {
-static_assert(
-    AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeOrRepeat<T, Ts...>,
-    "IsDistinctBy cljonic collection types are not all the same, or all Array, Range or Repeat types");
+static_assert(IsConvertibleToIntegral<typename C2::value_type>,
+"Replace's second parameter value type must be convertible to an integral");
 
-static_assert(
-    IsBinaryPredicateForAllCljonicCollections<std::decay_t<F>, T, Ts...>,
-    "IsDistinctBy function is not a valid binary predicate for all cljonic collection value types");
+static_assert(std::convertible_to<typename C2::value_type, typename C1::value_type>,
+"Replace's second parameter value type must be convertible to the first parameter value type");
 
-constexpr auto IndexInterfacesEqualBy = [](auto&& f, const auto& t, const auto& u) noexcept {
-if(&t == &u)
-return true;
-if(t.Count() != u.Count())
-return false;
-if constexpr(IsCljonicSet<T>) {
-constexpr auto ContainsBy = [](auto&& f, const auto& setIndex, const auto& element) noexcept {
-auto result{false};
-for(SizeType i{0}; ((not result) and (i < setIndex.Count())); ++i)
-result = f(setIndex[i], element);
+auto result{Array<typename C1::value_type, c2.MaximumCount()>{}};
+for (SizeType i{0}; i < c2.Count(); ++i)
+MConj(result, ((c2[i] >= 0) and (static_cast<SizeType>(c2[i]) < c1.Count())) ? c1[c2[i]] : c2[i]);
 return result;
-};
-for(SizeType i{0}; i < t.Count(); ++i)
-if(not ContainsBy(f, t, u[i]))
-return false;
-return true;
-} else {
-for(SizeType i{0}; i < t.Count(); ++i)
-if(not f(t[i], u[i]))
-return false;
-return true;
 }
-};
-using I = const IndexInterface<typename T::value_type>*;
-constexpr auto n{sizeof...(Ts) + 1};
-const auto i{std::array<I, n>{static_cast<I>(&t), static_cast<I>(&ts)...}};
-for(SizeType j{0}; j < n; ++j)
-for(SizeType k{j + 1}; k < n; ++k)
-if(IndexInterfacesEqualBy(std::forward<F>(f), *i[j], *i[k]))
-return false;
-return true;
-} else {
-static_assert(IsBinaryPredicateForAll<std::decay_t<F>, T, Ts...>,
-              "IsDistinctBy function is not a valid binary predicate for all parameters");
 
-return ((f(t, ts) == false) and ...) and IsDistinctBy(std::forward<F>(f), ts...);
-}
-}
 }
 
 }
 
-} // namespace cljonic::core
+namespace cljonic
+{
 
-namespace cljonic {
-
-namespace core {
+namespace core
+{
 template <typename C>
-[[nodiscard]] constexpr auto IsEmpty(const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "IsEmpty's parameter must be a cljonic collection");
+[[nodiscard]] constexpr auto Reverse(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Reverse's parameter must be a cljonic collection");
 
-return 0 == c.Count();
+auto result{Array<typename C::value_type, C::MaximumCount()>{}};
+for (SizeType i{c.Count()}; i != 0; --i)
+MConj(result, c[i - 1]);
+return result;
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
+namespace core
+{
 template <typename C>
-[[nodiscard]] constexpr auto IsFull(const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "IsFull's parameter must be a cljonic collection");
+[[nodiscard]] constexpr auto Second(const C& coll) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Second's parameter must be a cljonic collection");
 
-return c.Count() == c.MaximumCount();
+return coll[1];
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename F, typename T>
-[[nodiscard]] constexpr auto Iterate(F&& f, const T& t) noexcept {
-static_assert(IsUnaryFunction<F, T>, "Iterate's first parameter is not a unary function of its second parameter");
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto Seq(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Seq's parameter must be a cljonic collection");
 
-return Iterator{std::forward<F>(f), t};
+return Take(c.MaximumCount(), c);
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
+namespace core
+{
 template <typename C>
-[[nodiscard]] constexpr auto Last(const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Last's parameter must be a cljonic collection");
+[[nodiscard]] constexpr auto Size(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Size's parameter must be a cljonic collection");
 
-return c[(c.Count() > 0) ? (c.Count() - 1) : 0];
+return c.MaximumCount();
 }
 
 }
 
-} // namespace cljonic::core
-
-namespace cljonic {
-
-namespace core {
-template <typename C, typename T>
-[[nodiscard]] constexpr auto LastIndexOf(const C& c, const T& t) noexcept {
+}
 
-static_assert(IsCljonicCollection<C>, "LastIndexOf's first parameter must be a cljonic collection");
+namespace cljonic
+{
 
-static_assert(std::equality_comparable_with<typename C::value_type, T>,
-              "LastIndexOf's second parameter is not equality comparable with the cljonic collection values");
+namespace core
+{
+template <typename F, typename C>
+[[nodiscard]] constexpr auto Some(F&& f, const C& c) noexcept
+{
 
-static_assert(not std::floating_point<typename C::value_type>,
-              "LastIndexOf should not compare floating point types for equality. Consider using LastIndexOfBy to "
-              "override this default.");
+static_assert(IsCljonicCollection<C>, "Some's second parameter must be a cljonic collection");
 
-static_assert(not std::floating_point<T>,
-              "LastIndexOf should not compare floating point types for equality. Consider using LastIndexOfBy to "
-              "override this default.");
+static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
+"Some's function is not a valid unary predicate for the collection value type");
 
-auto result{CLJONIC_INVALID_INDEX};
-for(SizeType nextIndex{c.Count()}; ((CLJONIC_INVALID_INDEX == result) and (nextIndex > 0)); --nextIndex)
-if(AreEqual(c[nextIndex - 1], t))
-result = nextIndex - 1;
-return result;
+for (const auto& i : c)
+if (f(i))
+return true;
+return false;
 }
 
 }
 
-} // namespace cljonic::core
-
-namespace cljonic {
-
-namespace core {
-template <typename F, typename C, typename T>
-[[nodiscard]] constexpr auto LastIndexOfBy(F&& f, const C& c, const T& t) noexcept {
-
-static_assert(IsCljonicCollection<C>, "LastIndexOfBy's second parameter must be a cljonic collection");
+}
 
-static_assert(std::equality_comparable_with<typename C::value_type, T>,
-              "LastIndexOfBy's third parameter is not equality comparable with the cljonic collection values");
+namespace cljonic
+{
 
-static_assert(IsBinaryPredicate<F, typename C::value_type, T>,
-              "LastIndexOfBy's first parameter is not a valid binary predicate for the collection value type");
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto Sort(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Sort's parameter must be a cljonic collection");
 
-auto result{CLJONIC_INVALID_INDEX};
-for(SizeType nextIndex{c.Count()}; ((CLJONIC_INVALID_INDEX == result) and (nextIndex > 0)); --nextIndex)
-if(f(c[nextIndex - 1], t))
-result = nextIndex - 1;
+if constexpr (IsCljonicRange<C>)
+{
+return (c[0] <= c[c.Count() - 1]) ? Seq(c) : Reverse(c);
+}
+else
+{
+auto result{Seq(c)};
+if constexpr (not(IsCljonicSortedSet<C> or IsCljonicRepeat<C>))
+MSortBy(result, [](const auto& a, const auto& b) { return FirstLessThanSecond(a, b); });
 return result;
 }
-
 }
 
-} // namespace cljonic::core
-
-#include <concepts>
+}
 
-namespace cljonic {
+}
 
-namespace core {
-template <typename F, typename C, typename... Cs>
-[[nodiscard]] constexpr auto Map(F&& f, const C& c, const Cs&... cs) noexcept {
+#include <utility>
 
-static_assert(AllCljonicCollections<C, Cs...>, "Map's second through last parameters must be cljonic collections");
+namespace cljonic
+{
 
-static_assert(std::invocable<F, typename C::value_type, typename Cs::value_type...>,
-              "Map's function cannot be called with values from the specified cljonic collections");
+namespace core
+{
+template <typename F, typename C>
+[[nodiscard]] constexpr auto SortBy(F&& f, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "SortBy's second parameter must be a cljonic collection");
 
-using ResultType = decltype(f(std::declval<typename C::value_type>(), std::declval<typename Cs::value_type>()...));
+static_assert(IsBinaryPredicate<std::decay_t<F>, typename C::value_type, typename C::value_type>,
+"SortBy's function is not a valid binary predicate for the collection value type");
 
-constexpr auto count{MinimumOfCljonicCollectionMaximumCounts<C, Cs...>()};
-auto result{Array<ResultType, count>{}};
-for(SizeType i{0}; i < c.Count(); ++i)
-MConj(result, f(c[i], cs[i]...));
+auto result{Seq(c)};
+MSortBy(result, std::forward<F>(f));
 return result;
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
-namespace core {
-template <typename T, typename... Ts>
-[[nodiscard]] constexpr auto Max(const T& t, const Ts&... ts) noexcept {
+namespace cljonic
+{
 
-if constexpr(sizeof...(Ts) == 0) {
-static_assert(IsCljonicCollection<T>, "Max's parameter must be a cljonic collection");
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto SplitAt(const SizeType count, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "SplitAt's second parameter must be a cljonic collection");
 
-auto result{t.DefaultElement()};
-if(t.Count() > 0) {
-result = t[0];
-for(SizeType i{1}; i < t.Count(); ++i)
-if(result < t[i])
-result = t[i];
+return Array{Take(count, c), Drop(count, c)};
 }
-return result;
-} else {
-static_assert(AllNotCljonicCollections<T, Ts...>, "None of Max's parameters can be cljonic collections");
+template <typename C>
+[[nodiscard]] constexpr auto SplitAtView(const SizeType count, C&& c) noexcept
+{
+using Collection = std::remove_cvref_t<C>;
 
-auto result{t};
-(..., (void)((result < ts) ? result = ts : result));
-return result;
-}
+static_assert(IsCljonicCollection<Collection>, "SplitAtView's second parameter must be a cljonic collection");
+
+static_assert(std::is_lvalue_reference_v<C> or
+std::is_same_v<Collection, SpanView<typename Collection::value_type>>,
+"SplitAtView's second parameter must be an lvalue, or a SpanView, which both SliceViews refer to");
+
+return std::pair{SliceView<C>{c, 0, count}, SliceView<C>{c, count}};
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+#include <type_traits>
+#include <utility>
 
-namespace core {
-template <typename F, typename T, typename... Ts>
-[[nodiscard]] constexpr auto MaxBy(F&& f, const T& t, const Ts&... ts) noexcept {
+namespace cljonic
+{
 
-if constexpr(sizeof...(Ts) == 0) {
-static_assert(IsCljonicCollection<T>, "MaxBy's second parameter must be a cljonic collection");
+namespace core
+{
+template <typename F, typename C>
+[[nodiscard]] constexpr auto SplitWith(F&& f, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "SplitWith's second parameter must be a cljonic collection");
 
-static_assert(IsBinaryPredicate<F, typename T::value_type, typename T::value_type>,
-              "MaxBy function is not a valid binary predicate for the collection value type");
+static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
+"SplitWith's function is not a valid unary predicate for the collection value type");
 
-auto result{t.DefaultElement()};
-if(t.Count() > 0) {
-result = t[0];
-for(SizeType i{1}; i < t.Count(); ++i)
-if(f(result, t[i]))
-result = t[i];
+auto firstArray{TakeWhile(f, c)};
+auto secondArray{Drop(firstArray.Count(), c)};
+return Array{std::move(firstArray), std::move(secondArray)};
 }
-return result;
-} else {
-static_assert(AllNotCljonicCollections<T, Ts...>,
-              "None of MaxBy's second through last parameters can be cljonic collections");
+template <typename F, typename C>
+[[nodiscard]] constexpr auto SplitWithView(F&& f, C&& c) noexcept
+{
+using Collection = std::remove_cvref_t<C>;
 
-static_assert(IsBinaryPredicate<F, T, T>,
-              "MaxBy function is not a valid binary predicate for the collection value type");
+static_assert(IsCljonicCollection<Collection>, "SplitWithView's second parameter must be a cljonic collection");
 
-auto result{t};
-(..., (void)(f(result, ts) ? result = ts : result));
-return result;
+static_assert(std::is_lvalue_reference_v<C> or
+std::is_same_v<Collection, SpanView<typename Collection::value_type>>,
+"SplitWithView's second parameter must be an lvalue, or a SpanView, which both SliceViews refer to");
+
+static_assert(IsUnaryPredicate<std::decay_t<F>, typename Collection::value_type>,
+"SplitWithView's function is not a valid unary predicate for the collection value type");
+
+auto count{SizeType{0}};
+for (const auto& element : c)
+{
+if (not f(element))
+break;
+++count;
 }
+return std::pair{SliceView<C>{c, 0, count}, SliceView<C>{c, count}};
 }
 
 }
 
-} // namespace cljonic::core
-
-namespace cljonic {
-
-namespace core {
-template <typename T, typename... Ts>
-[[nodiscard]] constexpr auto Min(const T& t, const Ts&... ts) noexcept {
+}
 
-if constexpr(sizeof...(Ts) == 0) {
-static_assert(IsCljonicCollection<T>, "Min's parameter must be a cljonic collection");
+namespace cljonic
+{
 
-auto result{t.DefaultElement()};
-if(t.Count() > 0) {
-result = t[0];
-for(SizeType i{1}; i < t.Count(); ++i)
-if(t[i] < result)
-result = t[i];
-}
-return result;
-} else {
-static_assert(AllNotCljonicCollections<T, Ts...>, "None of Min's parameters can be cljonic collections");
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto StableSort(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "StableSort's parameter must be a cljonic collection");
 
-auto result{t};
-(..., (void)((ts < result) ? result = ts : result));
+auto result{Seq(c)};
+if constexpr (not IsCljonicSortedSet<C>)
+MStableSortBy(result, [](const auto& a, const auto& b) { return FirstLessThanSecond(a, b); });
 return result;
 }
-}
 
 }
 
-} // namespace cljonic::core
-
-namespace cljonic {
-
-namespace core {
-template <typename F, typename T, typename... Ts>
-[[nodiscard]] constexpr auto MinBy(F&& f, const T& t, const Ts&... ts) noexcept {
+}
 
-if constexpr(sizeof...(Ts) == 0) {
-static_assert(IsCljonicCollection<T>, "MinBy's second parameter must be a cljonic collection");
+#include <utility>
 
-static_assert(IsBinaryPredicate<F, typename T::value_type, typename T::value_type>,
-              "MinBy function is not a valid binary predicate for the collection value type");
+namespace cljonic
+{
 
-auto result{t.DefaultElement()};
-if(t.Count() > 0) {
-result = t[0];
-for(SizeType i{1}; i < t.Count(); ++i)
-if(not f(result, t[i]))
-result = t[i];
-}
-return result;
-} else {
-static_assert(AllNotCljonicCollections<T, Ts...>,
-              "None of MinBy's second through last parameters can be cljonic collections");
+namespace core
+{
+template <typename F, typename C>
+[[nodiscard]] constexpr auto StableSortBy(F&& f, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "StableSortBy's second parameter must be a cljonic collection");
 
-static_assert(IsBinaryPredicate<F, T, T>,
-              "MinBy function is not a valid binary predicate for the collection value type");
+static_assert(IsBinaryPredicate<std::decay_t<F>, typename C::value_type, typename C::value_type>,
+"StableSortBy's function is not a valid binary predicate for the collection value type");
 
-auto result{t};
-(..., (void)((not f(result, ts)) ? result = ts : result));
+auto result{Seq(c)};
+MStableSortBy(result, std::forward<F>(f));
 return result;
 }
+
 }
 
 }
 
-} // namespace cljonic::core
+#include <type_traits>
+#include <utility>
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename F, typename C>
-[[nodiscard]] constexpr auto NotAny(F&& f, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "NotAny's second parameter must be a cljonic collection");
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto Subs(const C& c, const SizeType start, const SizeType end) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Subs's first parameter must be a cljonic collection");
+
+auto result{Array<typename C::value_type, c.MaximumCount()>{}};
+if constexpr (IsRandomAccessCollection<C>)
+{
+for (const auto& element : SliceView{c, start, end})
+MConj(result, element);
+}
+else
+{
+
+auto index{SizeType{0}};
+for (const auto& element : c)
+{
+if (index == end)
+break;
+if (index++ >= start)
+MConj(result, element);
+}
+}
+return result;
+}
 
-static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
-              "NotAny's function is not a valid unary predicate for the collection value type");
+template <typename C>
+[[nodiscard]] constexpr auto Subs(const C& c, const SizeType start) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Subs's first parameter must be a cljonic collection");
 
-return (c.Count() == 0) or (not Some(std::forward<F>(f), c));
+return Subs(c, start, c.Count());
 }
+template <typename C>
+[[nodiscard]] constexpr auto SubsView(C&& c, const SizeType start, const SizeType end) noexcept
+{
+static_assert(IsCljonicCollection<std::remove_cvref_t<C>>,
+"SubsView's first parameter must be a cljonic collection");
 
+return SliceView<C>{std::forward<C>(c), start, end};
 }
 
-} // namespace cljonic::core
-
-namespace cljonic {
-
-namespace core {
-template <typename F, typename C>
-[[nodiscard]] constexpr auto NotEvery(F&& f, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "NotEvery's second parameter must be a cljonic collection");
+template <typename C>
+[[nodiscard]] constexpr auto SubsView(C&& c, const SizeType start) noexcept
+{
+static_assert(IsCljonicCollection<std::remove_cvref_t<C>>,
+"SubsView's first parameter must be a cljonic collection");
 
-static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
-              "NotEvery's function is not a valid unary predicate for the collection value type");
+return SliceView<C>{std::forward<C>(c), start};
+}
 
-return (c.Count() != 0) and (not Every(std::forward<F>(f), c));
 }
 
 }
 
-} // namespace cljonic::core
+#include <type_traits>
+#include <utility>
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
+namespace core
+{
 template <typename C>
-[[nodiscard]] constexpr auto Nth(const C& c, const SizeType index) noexcept {
-static_assert(IsCljonicCollection<C> and (not IsCljonicSet<C>),
-              "Nth's first parameter must be a cljonic collection other than a Set");
+[[nodiscard]] constexpr auto Take(const SizeType count, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Take's second parameter must be a cljonic collection");
 
-return c[index];
+auto result{Array<typename C::value_type, c.MaximumCount()>{}};
+if constexpr (IsContiguousCollection<C>)
+{
+MConjElements(result, c.begin(), MinArgument(count, c.Count()));
 }
+else if constexpr (IsContiguousCycle<C>)
+{
 
-template <typename C, typename T>
-[[nodiscard]] constexpr auto Nth(const C& c, const SizeType index, const T& t) noexcept {
-static_assert(IsCljonicCollection<C> and (not IsCljonicSet<C>),
-              "Nth's first parameter must be a cljonic collection other than a Set");
+const auto takeCount{MinArgument(count, c.Count())};
+MConjElements(result, c.Collection().begin(), MinArgument(takeCount, c.Collection().Count()));
+while (result.Count() < takeCount)
+MConjElements(result, result.begin(), MinArgument(result.Count(), takeCount - result.Count()));
+}
+else
+{
 
-static_assert(std::same_as<typename C::value_type, T>,
-              "Nth's third parameter must have the same type as the values in the first parameter");
+auto it{c.begin()};
+const auto end{c.end()};
+for (SizeType i{0}; ((i < count) and (it != end)); ++i)
+{
+MConj(result, *it);
+if ((i + 1) < count)
+++it;
+}
+}
+return result;
+}
+template <typename C>
+[[nodiscard]] constexpr auto TakeView(const SizeType count, C&& c) noexcept
+{
+static_assert(IsCljonicCollection<std::remove_cvref_t<C>>,
+"TakeView's second parameter must be a cljonic collection");
 
-return (index < c.Count()) ? c[index] : t;
+return SliceView<C>{std::forward<C>(c), 0, count};
 }
 
 }
 
-} // namespace cljonic::core
+}
 
+#include <type_traits>
 #include <utility>
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename F, typename... Args>
-[[nodiscard]] constexpr auto Partial(F&& f, Args&&... args) noexcept {
-return [f = std::forward<F>(f), ... args = std::forward<Args>(args)](auto&&... rest) {
-static_assert(std::regular_invocable<F, Args..., decltype(rest)...>,
-              "Partial's function cannot be called with the specified arguments");
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto TakeLast(const SizeType count, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "TakeLast's second parameter must be a cljonic collection");
 
-return f(args..., std::forward<decltype(rest)>(rest)...);
-};
+auto result{Array<typename C::value_type, c.MaximumCount()>{}};
+auto startIndex{(c.Count() > count) ? (c.Count() - count) : 0};
+for (SizeType i{startIndex}; (i < c.Count()); ++i)
+MConj(result, ElementAt(c, i));
+return result;
 }
+template <typename C>
+[[nodiscard]] constexpr auto TakeLastView(const SizeType count, C&& c) noexcept
+{
+static_assert(IsCljonicCollection<std::remove_cvref_t<C>>,
+"TakeLastView's second parameter must be a cljonic collection");
 
+const auto start{(c.Count() > count) ? (c.Count() - count) : 0};
+return SliceView<C>{std::forward<C>(c), start};
 }
 
-} // namespace cljonic::core
+}
 
-#include <numeric>
-#include <tuple>
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename F, typename C>
-[[nodiscard]] constexpr auto Reduce(F&& f, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Reduce's second parameter must be a cljonic collection");
+namespace core
+{
+template <typename C>
+[[nodiscard]] constexpr auto TakeNth(const SizeType nth, const C& c) noexcept
+{
 
-static_assert(std::regular_invocable<F, typename C::value_type, typename C::value_type>,
-              "Reduce's function cannot be called with two parameters of the collection value type");
+static_assert(IsCljonicCollection<C>, "TakeNth's second parameter must be a cljonic collection");
 
-using ResultType = std::invoke_result_t<F, typename C::value_type, typename C::value_type>;
-static_assert(
-    std::regular_invocable<F, ResultType, typename C::value_type>,
-    "Reduce's function cannot be called with parameters of function result type, and collection value type");
+using ResultType = Array<typename C::value_type, c.MaximumCount()>;
+using ValueType = typename C::value_type;
 
-return (0 == c.Count()) ? c.DefaultElement()
-                        : std::accumulate((c.begin() + 1), c.end(), *c.begin(), std::forward<F>(f));
+constexpr auto FillArray = [](ResultType& r, const ValueType& v) noexcept
+{
+for (SizeType i{0}; i < r.MaximumCount(); ++i)
+MConj(r, v);
+};
+constexpr auto FillArrayNth = [](ResultType& r, const C& vArray, const SizeType nth) noexcept
+{
+auto i{SizeType{0}};
+while (i < vArray.Count())
+{
+MConj(r, vArray[i]);
+i += nth;
+}
+};
+auto result{ResultType{}};
+if ((c.Count() > 0) and (0 == nth))
+FillArray(result, c[0]);
+else if (c.Count() > 0)
+FillArrayNth(result, c, nth);
+return result;
 }
 
-template <typename F, typename T, typename C>
-[[nodiscard]] constexpr auto Reduce(F&& f, const T& t, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Reduce's third parameter must be a cljonic collection");
+}
 
-static_assert(
-    std::regular_invocable<F, T, typename C::value_type>,
-    "Reduce's function cannot be called with parameters of initial value type, and collection value type");
+}
 
-using ResultType = std::invoke_result_t<F, T, typename C::value_type>;
-static_assert(
-    std::regular_invocable<F, ResultType, typename C::value_type>,
-    "Reduce's function cannot be called with parameters of function result type, and collection value type");
+namespace cljonic
+{
 
-return (0 == c.Count()) ? t : std::accumulate(c.begin(), c.end(), t, std::forward<F>(f));
+namespace core
+{
+[[nodiscard]] constexpr auto TakeT(const SizeType count) noexcept
+{
+return [count](auto step)
+{
+return [count, step, taken = SizeType{0}](auto& accumulator, const auto& element) mutable
+{
+if (taken == count)
+return false;
+++taken;
+return step(accumulator, element) and (taken < count);
+};
+};
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
+namespace core
+{
 template <typename F, typename C>
-[[nodiscard]] constexpr auto Remove(F&& f, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Remove's second parameter must be a cljonic collection");
+[[nodiscard]] constexpr auto TakeWhile(F&& f, const C& c) noexcept
+{
+
+static_assert(IsCljonicCollection<C>, "TakeWhile's second parameter must be a cljonic collection");
 
 static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
-              "Remove's function is not a valid unary predicate for the collection value type");
+"TakeWhile's function is not a valid unary predicate for the collection value type");
 
 auto result{Array<typename C::value_type, c.MaximumCount()>{}};
-for(const auto& element : c)
-if(not f(element))
+for (const auto& element : c)
+if (f(element))
 MConj(result, element);
+else
+break;
 return result;
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-#include <concepts>
+#include <utility>
 
-namespace cljonic {
+namespace cljonic
+{
+
+namespace core
+{
+template <typename F>
+[[nodiscard]] constexpr auto TakeWhileT(F&& f) noexcept
+{
+return [f = std::forward<F>(f)](auto step)
+{
+return [f, step](auto& accumulator, const auto& element) mutable
+{ return f(element) and step(accumulator, element); };
+};
+}
 
-namespace core {
-template <typename C1, typename C2>
-[[nodiscard]] constexpr auto Replace(const C1& c1, const C2& c2) noexcept {
+}
 
-static_assert(IsCljonicCollection<C1>, "Replace's first parameter must be a cljonic collection");
+}
 
-static_assert(IsCljonicCollection<C2>, "Replace's second parameter must be a cljonic collection");
+#include <utility>
 
-static_assert(IsConvertibleToIntegral<typename C2::value_type>,
-              "Replace's second parameter value type must be convertible to an integral");
+namespace cljonic
+{
 
-static_assert(std::convertible_to<typename C2::value_type, typename C1::value_type>,
-              "Replace's second parameter value type must be convertible to the first parameter value type");
+namespace core
+{
+template <typename XF, typename F, typename T, typename C>
+[[nodiscard]] constexpr auto Transduce(XF&& xf, F&& f, const T& t, const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Transduce's fourth parameter must be a cljonic collection");
 
-auto result{Array<typename C1::value_type, c2.MaximumCount()>{}};
-for(SizeType i{0}; i < c2.Count(); ++i)
-MConj(result, ((c2[i] >= 0) and (static_cast<SizeType>(c2[i]) < c1.Count())) ? c1[c2[i]] : c2[i]);
+auto result{t};
+auto step{xf(
+[&f](T& accumulator, const auto& element)
+{
+accumulator = f(accumulator, element);
+return true;
+})};
+for (const auto& element : c)
+if (not step(result, element))
+break;
 return result;
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto Reverse(const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Reverse's parameter must be a cljonic collection");
+namespace string
+{
+template <typename T, typename U>
+[[nodiscard]] constexpr bool EndsWith(const T& t, const U& u) noexcept
+{
+static_assert(IsText<T>, "EndsWith's first parameter must be a C string or a collection of contiguous chars");
 
-auto result{Array<typename C::value_type, C::MaximumCount()>{}};
-for(SizeType i{c.Count()}; i != 0; --i)
-MConj(result, c[i - 1]);
-return result;
+static_assert(IsText<U>, "EndsWith's second parameter must be a C string or a collection of contiguous chars");
+
+const auto text{AsText(t)};
+const auto suffix{AsText(u)};
+if (suffix.count > text.count)
+return false;
+const auto start{text.count - suffix.count};
+for (SizeType i{0}; i < suffix.count; ++i)
+if (text.chars[start + i] != suffix.chars[i])
+return false;
+return true;
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto Second(const C& coll) noexcept {
-static_assert(IsCljonicCollection<C>, "Second's parameter must be a cljonic collection");
+namespace string
+{
+template <typename T, typename U>
+[[nodiscard]] constexpr bool Includes(const T& t, const U& u) noexcept
+{
+static_assert(IsText<T>, "Includes's first parameter must be a C string or a collection of contiguous chars");
 
-return coll[1];
+static_assert(IsText<U>, "Includes's second parameter must be a C string or a collection of contiguous chars");
+
+return CLJONIC_INVALID_INDEX != IndexOfText(AsText(t), AsText(u));
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto Seq(const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Seq's parameter must be a cljonic collection");
+namespace string
+{
+template <typename T, typename U>
+[[nodiscard]] constexpr SizeType IndexOfSubstring(const T& t, const U& u) noexcept
+{
+static_assert(IsText<T>,
+"IndexOfSubstring's first parameter must be a C string or a collection of contiguous chars");
 
-return Take(c.MaximumCount(), c);
+static_assert(IsText<U>,
+"IndexOfSubstring's second parameter must be a C string or a collection of contiguous chars");
+
+return IndexOfText(AsText(t), AsText(u));
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+#include <concepts>
 
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto Size(const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Size's parameter must be a cljonic collection");
+namespace cljonic
+{
 
-return c.MaximumCount();
+template <typename T>
+[[nodiscard]] consteval SizeType MaximumTextCount() noexcept
+{
+if constexpr (std::same_as<T, char>)
+return 1;
+else if constexpr (IsCString<T>)
+return CljonicCollectionMaximumElementCount;
+else
+return T::MaximumCount();
+}
+
+template <SizeType N, typename C>
+[[nodiscard]] constexpr auto JoinTexts(const Text& separator, const C& c) noexcept
+{
+auto result{String<N>{}};
+auto first{true};
+for (const auto& element : c)
+{
+if (not first)
+for (SizeType i{0}; i < separator.count; ++i)
+MConj(result, separator.chars[i]);
+first = false;
+const auto text{AsText(element)};
+for (SizeType i{0}; i < text.count; ++i)
+MConj(result, text.chars[i]);
 }
-
+return result;
 }
 
-} // namespace cljonic::core
-
-namespace cljonic {
+namespace string
+{
+template <typename T, typename C>
+[[nodiscard]] constexpr auto Join(const T& separator, const C& c) noexcept
+{
+static_assert(std::same_as<T, char> or IsText<T>,
+"Join's first parameter must be a char, a C string, or a collection of contiguous chars");
+
+static_assert(IsCljonicCollection<C>, "Join's second parameter must be a cljonic collection");
+
+static_assert(IsText<typename C::value_type>,
+"Join's elements must be C strings or collections of contiguous chars");
+
+constexpr auto separatorCount{(0 == C::MaximumCount()) ? 0 : (C::MaximumCount() - 1)};
+constexpr auto maximumCount{MinArgument((C::MaximumCount() * MaximumTextCount<typename C::value_type>()) +
+(separatorCount * MaximumTextCount<T>()),
+CljonicCollectionMaximumElementCount)};
+if constexpr (std::same_as<T, char>)
+return JoinTexts<maximumCount>(Text{&separator, 1}, c);
+else
+return JoinTexts<maximumCount>(AsText(separator), c);
+}
 
-namespace core {
-template <typename F, typename C>
-[[nodiscard]] constexpr auto Some(F&& f, const C& c) noexcept {
+template <typename C>
+[[nodiscard]] constexpr auto Join(const C& c) noexcept
+{
+static_assert(IsCljonicCollection<C>, "Join's parameter must be a cljonic collection");
 
-static_assert(IsCljonicCollection<C>, "Some's second parameter must be a cljonic collection");
+static_assert(IsText<typename C::value_type>,
+"Join's elements must be C strings or collections of contiguous chars");
 
-static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
-              "Some's function is not a valid unary predicate for the collection value type");
+constexpr auto elementCount{MaximumTextCount<typename C::value_type>()};
+constexpr auto maximumCount{MinArgument(C::MaximumCount() * elementCount, CljonicCollectionMaximumElementCount)};
+return JoinTexts<maximumCount>(Text{nullptr, 0}, c);
+}
 
-for(const auto& i : c)
-if(f(i))
-return true;
-return false;
 }
 
 }
 
-} // namespace cljonic::core
+namespace cljonic
+{
 
-namespace cljonic {
+namespace string
+{
+template <typename T, typename U>
+[[nodiscard]] constexpr SizeType LastIndexOfSubstring(const T& t, const U& u) noexcept
+{
+static_assert(IsText<T>,
+"LastIndexOfSubstring's first parameter must be a C string or a collection of contiguous chars");
 
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto Sort(const C& c) noexcept {
+static_assert(IsText<U>,
+"LastIndexOfSubstring's second parameter must be a C string or a collection of contiguous chars");
 
-static_assert(IsCljonicCollection<C>, "Sort's parameter must be a cljonic collection");
+return LastIndexOfText(AsText(t), AsText(u));
+}
 
-auto result{Seq(c)};
-for(SizeType i{1}; i < result.Count(); ++i) {
-auto key = result[i];
-SizeType j = i;
-while((j > 0) and FirstLessThanSecond(key, result[j - 1])) {
-MSet(result, result[j - 1], j);
---j;
 }
-MSet(result, key, j);
+
 }
+
+#include <concepts>
+#include <type_traits>
+
+namespace cljonic
+{
+
+namespace string
+{
+template <typename T, typename C, typename D>
+[[nodiscard]] constexpr auto ParseAll(const C& c, const D& delimiter, const T notANumber) noexcept
+{
+static_assert(IsNumberInteger<T> or IsNumberFloating<T>,
+"ParseAll's type must be an integer type, other than bool or a char type, or float or double");
+
+static_assert(IsText<C> and not IsCString<C>,
+"ParseAll's first parameter must be a collection of contiguous chars");
+
+static_assert(std::same_as<D, char>, "ParseAll's second parameter must be a char");
+
+constexpr auto maximumCount{MinArgument(C::MaximumCount() + 1, CljonicCollectionMaximumElementCount)};
+auto result{Array<T, maximumCount>{}};
+const auto text{AsText(c)};
+const auto Field = [&](const SizeType start, const SizeType end) {
+auto number{notANumber};
+static_cast<void>(ParseNumberText(Text{text.chars + start, end - start}, number));
+MConj(result, number);
+};
+SizeType start{0};
+for (SizeType i{0}; i < text.count; ++i)
+if (delimiter == text.chars[i])
+{
+Field(start, i);
+start = i + 1;
+}
+Field(start, text.count);
 return result;
 }
 
+template <typename T, typename C, typename D>
+[[nodiscard]] constexpr auto ParseAll(const C& c, const D& delimiter) noexcept
+{
+return ParseAll(c, delimiter, T{0});
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+}
 
-namespace core {
-template <typename F, typename C>
-[[nodiscard]] constexpr auto SortBy(F&& f, const C& c) noexcept {
+namespace cljonic
+{
 
-static_assert(IsCljonicCollection<C>, "SortBy's second parameter must be a cljonic collection");
+namespace string
+{
+template <typename T = double, typename C>
+[[nodiscard]] constexpr T ParseFloat(const C& c, const T notANumber) noexcept
+{
+static_assert(IsNumberFloating<T>, "ParseFloat's type must be float or double");
 
-static_assert(IsBinaryPredicate<std::decay_t<F>, typename C::value_type, typename C::value_type>,
-              "SortBy's function is not a valid binary predicate for the collection value type");
+static_assert(IsText<C>, "ParseFloat's first parameter must be a C string, or a collection of contiguous chars");
 
-auto result{Seq(c)};
-for(SizeType i{1}; i < result.Count(); ++i) {
-auto key = result[i];
-SizeType j = i;
-while((j > 0) and f(key, result[j - 1])) {
-MSet(result, result[j - 1], j);
---j;
-}
-MSet(result, key, j);
-}
+auto result{notANumber};
+static_cast<void>(ParseFloatingText(AsText(c), result));
 return result;
 }
 
+template <typename T = double, typename C>
+[[nodiscard]] constexpr T ParseFloat(const C& c) noexcept
+{
+return ParseFloat<T>(c, T{0});
 }
 
-} // namespace cljonic::core
-
-#include <tuple>
-
-namespace cljonic {
-
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto SplitAt(const SizeType count, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "SplitAt's second parameter must be a cljonic collection");
-
-return Array{Take(count, c), Drop(count, c)};
 }
 
 }
 
-} // namespace cljonic::core
-
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename F, typename C>
-[[nodiscard]] constexpr auto SplitWith(F&& f, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "SplitWith's second parameter must be a cljonic collection");
+namespace string
+{
+template <typename T = int, typename C>
+[[nodiscard]] constexpr T ParseInt(const C& c, const T notANumber) noexcept
+{
+static_assert(IsNumberInteger<T>, "ParseInt's type must be an integer type, other than bool or a char type");
 
-static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
-              "SplitWith's function is not a valid unary predicate for the collection value type");
+static_assert(IsText<C>, "ParseInt's first parameter must be a C string, or a collection of contiguous chars");
 
-const auto firstArray{TakeWhile(f, c)};
-const auto secondArray{Drop(firstArray.Count(), c)};
-return Array{firstArray, secondArray};
+auto result{notANumber};
+static_cast<void>(ParseIntegerText(AsText(c), result));
+return result;
 }
 
+template <typename T = int, typename C>
+[[nodiscard]] constexpr T ParseInt(const C& c) noexcept
+{
+return ParseInt<T>(c, T{0});
 }
 
-} // namespace cljonic::core
-
-namespace cljonic {
-
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto Subs(const C& c, const SizeType start, const SizeType end) noexcept {
-static_assert(IsCljonicCollection<C>, "Subs's first parameter must be a cljonic collection");
+}
 
-return ((c.Count() == 0) or (start >= c.Count()) or (end <= start))
-           ? Array<typename C::value_type, c.MaximumCount()>{}
-           : Take((end - start), Drop(start, c));
 }
 
-template <typename C>
-[[nodiscard]] constexpr auto Subs(const C& c, const SizeType start) noexcept {
-static_assert(IsCljonicCollection<C>, "Subs's first parameter must be a cljonic collection");
+namespace cljonic
+{
 
-return Subs(c, start, c.Count());
-}
+namespace string
+{
+template <typename C, typename T, typename U>
+[[nodiscard]] constexpr auto Replace(const C& c, const T& match, const U& replacement) noexcept
+{
+static_assert(IsText<C> and not IsCString<C>, "Replace's first parameter must be a collection of contiguous chars");
 
-}
+static_assert(IsText<T>, "Replace's second parameter must be a C string or a collection of contiguous chars");
 
-} // namespace cljonic::core
+static_assert(IsText<U>, "Replace's third parameter must be a C string or a collection of contiguous chars");
 
-namespace cljonic {
+auto result{String<C::MaximumCount()>{}};
+const auto Append = [&](const char* chars, const SizeType n) {
+for (SizeType i{0}; i < n; ++i)
+MConj(result, chars[i]);
+};
 
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto Take(const SizeType count, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "Take's second parameter must be a cljonic collection");
+const auto text{AsText(c)};
+const auto from{AsText(match)};
+const auto to{AsText(replacement)};
+if (0 == from.count)
+{
+for (SizeType i{0}; i < text.count; ++i)
+{
+Append(to.chars, to.count);
+Append(text.chars + i, 1);
+}
+Append(to.chars, to.count);
+}
+else
+{
 
-auto result{Array<typename C::value_type, c.MaximumCount()>{}};
-auto maxIndex{MinArgument(count, c.Count())};
-for(SizeType i{0}; (i < maxIndex); ++i)
-MConj(result, c[i]);
+SizeType start{0};
+for (auto index{IndexOfText(text, from)}; CLJONIC_INVALID_INDEX != index;
+index = IndexOfText(text, from, start))
+{
+Append(text.chars + start, index - start);
+Append(to.chars, to.count);
+start = index + from.count;
+}
+Append(text.chars + start, text.count - start);
+}
 return result;
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+#include <concepts>
+#include <type_traits>
 
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto TakeLast(const SizeType count, const C& c) noexcept {
-static_assert(IsCljonicCollection<C>, "TakeLast's second parameter must be a cljonic collection");
+namespace cljonic
+{
 
-auto result{Array<typename C::value_type, c.MaximumCount()>{}};
-auto startIndex{(c.Count() > count) ? (c.Count() - count) : 0};
-for(SizeType i{startIndex}; (i < c.Count()); ++i)
-MConj(result, c[i]);
-return result;
-}
+namespace string
+{
+template <typename C, typename T>
+[[nodiscard]] constexpr auto Split(C&& c, const T& delimiter) noexcept
+{
+using Collection = std::remove_cvref_t<C>;
 
-}
+static_assert(std::is_lvalue_reference_v<C> or std::is_same_v<Collection, SpanView<char>>,
+"Split's first parameter must be an lvalue, or a SpanView, whose chars the fields refer to");
 
-} // namespace cljonic::core
+static_assert(IsText<Collection> and not IsCString<Collection>,
+"Split's first parameter must be a collection of contiguous chars");
 
-namespace cljonic {
+static_assert(std::same_as<T, char> or IsText<T>,
+"Split's second parameter must be a char, a C string, or a collection of contiguous chars");
 
-namespace core {
-template <typename C>
-[[nodiscard]] constexpr auto TakeNth(const SizeType nth, const C& c) noexcept {
+constexpr auto maximumCount{MinArgument(Collection::MaximumCount() + 1, CljonicCollectionMaximumElementCount)};
+auto result{Array<SpanView<char>, maximumCount>{}};
+const auto text{AsText(c)};
+const auto Field = [&](const SizeType start, const SizeType end) {
+MConj(result, SpanView<char>{text.chars + start, end - start});
+};
 
-static_assert(IsCljonicCollection<C>, "TakeNth's second parameter must be a cljonic collection");
+const auto separator{[&]() {
+if constexpr (std::same_as<T, char>)
+return Text{&delimiter, 1};
+else
+return AsText(delimiter);
+}()};
+if (0 == separator.count)
+{
 
-using ResultType = Array<typename C::value_type, c.MaximumCount()>;
-using ValueType = typename C::value_type;
+for (SizeType i{0}; i < text.count; ++i)
+Field(i, i + 1);
+if (0 == text.count)
+Field(0, 0);
+}
+else if (1 == separator.count)
+{
 
-constexpr auto FillArray = [](ResultType& r, const ValueType& v) noexcept {
-for(SizeType i{0}; i < r.MaximumCount(); ++i)
-MConj(r, v);
-};
-constexpr auto FillArrayNth = [](ResultType& r, const C& vArray, const SizeType nth) noexcept {
-auto i{SizeType{0}};
-while(i < vArray.Count()) {
-MConj(r, vArray[i]);
-i += nth;
+SizeType start{0};
+for (SizeType i{0}; i < text.count; ++i)
+if (separator.chars[0] == text.chars[i])
+{
+Field(start, i);
+start = i + 1;
+}
+Field(start, text.count);
+}
+else
+{
+SizeType start{0};
+for (auto index{IndexOfText(text, separator)}; CLJONIC_INVALID_INDEX != index;
+index = IndexOfText(text, separator, start))
+{
+Field(start, index);
+start = index + ((0 == separator.count) ? 1 : separator.count);
+}
+Field(start, text.count);
 }
-};
-auto result{ResultType{}};
-if((c.Count() > 0) and (0 == nth))
-FillArray(result, c[0]);
-else if(c.Count() > 0)
-FillArrayNth(result, c, nth);
 return result;
 }
 
 }
 
-} // namespace cljonic::core
+}
 
-namespace cljonic {
+namespace cljonic
+{
 
-namespace core {
-template <typename F, typename C>
-[[nodiscard]] constexpr auto TakeWhile(F&& f, const C& c) noexcept {
+namespace string
+{
+template <typename T, typename U>
+[[nodiscard]] constexpr bool StartsWith(const T& t, const U& u) noexcept
+{
+static_assert(IsText<T>, "StartsWith's first parameter must be a C string or a collection of contiguous chars");
 
-static_assert(IsCljonicCollection<C>, "TakeWhile's second parameter must be a cljonic collection");
+static_assert(IsText<U>, "StartsWith's second parameter must be a C string or a collection of contiguous chars");
 
-static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
-              "TakeWhile's function is not a valid unary predicate for the collection value type");
+const auto text{AsText(t)};
+const auto prefix{AsText(u)};
+if (prefix.count > text.count)
+return false;
+for (SizeType i{0}; i < prefix.count; ++i)
+if (text.chars[i] != prefix.chars[i])
+return false;
+return true;
+}
 
-auto result{Array<typename C::value_type, c.MaximumCount()>{}};
-for(const auto& element : c)
-if(f(element))
-MConj(result, element);
+}
+
+}
+
+#include <concepts>
+
+namespace cljonic
+{
+
+namespace string
+{
+template <typename T>
+[[nodiscard]] constexpr auto Str(const T t) noexcept
+{
+static_assert(IsNumberInteger<T> or IsNumberFloating<T> or std::same_as<T, bool> or std::same_as<T, char>,
+"Str's parameter must be a number, a bool, or a char");
+
+if constexpr (std::same_as<T, bool>)
+return t ? String<5>{"true"} : String<5>{"false"};
+else if constexpr (std::same_as<T, char>)
+return String<1>{t};
+else if constexpr (IsNumberInteger<T>)
+return IntegerString(t);
 else
-break;
-return result;
+return FloatingString(t);
 }
 
 }
 
-} // namespace cljonic::core
+}
 
 #endif // CLJONIC_H_
@@ -0,0 +1,66 @@
+#include <cstdint>
+#include <string>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-core-concat.hpp"
+#include "cljonic-core-conj.hpp"
+#include "cljonic-core-drop.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-seq.hpp"
+#include "cljonic-core-take.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+namespace
+{
+
+template <typename T>
+void BenchmarkBulkCopy(const std::string& typeName)
+{
+    auto a{Array<T, 1000>{}};
+    for (SizeType i{0}; i < 1000; ++i)
+        MConj(a, static_cast<T>((i * 37) % 101));
+    const auto b{a};
+    auto most{Array<T, 998>{}}; // so Conj can add two elements without exceeding the maximum element count
+    for (SizeType i{0}; i < 998; ++i)
+        MConj(most, a[i]);
+    auto half{Array<T, 500>{}};
+    for (SizeType i{0}; i < 500; ++i)
+        MConj(half, a[i]);
+    const auto suffix{"Array<" + typeName + ", 1000>)"};
+
+    BENCHMARK("Equal(" + suffix)
+    {
+        return Equal(a, b);
+    };
+    BENCHMARK("Seq(" + suffix)
+    {
+        return Seq(a);
+    };
+    BENCHMARK("Take(900, " + suffix)
+    {
+        return Take(900, a);
+    };
+    BENCHMARK("Drop(100, " + suffix)
+    {
+        return Drop(100, a);
+    };
+    BENCHMARK("Conj(Array<" + typeName + ", 998>, 1, 2)")
+    {
+        return Conj(most, T{1}, T{2});
+    };
+    BENCHMARK("Concat(Array<" + typeName + ", 500> x 2)")
+    {
+        return Concat(half, half);
+    };
+}
+
+} // namespace
+
+TEST_CASE("Equal, Seq, Take, Drop, Conj, and Concat of 1000 elements", "[benchmark][CljonicBulkCopy]")
+{
+    BenchmarkBulkCopy<char>("char");
+    BenchmarkBulkCopy<int>("int");
+    BenchmarkBulkCopy<std::uint64_t>("uint64_t");
+}
@@ -0,0 +1,46 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-core-cycle.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-take.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+TEST_CASE("Take, Map, and iteration of 1000 elements of a Cycle", "[benchmark][CljonicCoreCycle]")
+{
+    volatile int seven{7};
+    const auto pattern{Array{3, 1, 4, 1, 5, 9, int{seven}}};
+    const auto set{Set{3, 1, 4, 5, 9, 2, int{seven}}};
+    const auto Add = [](const int x, const int y) { return x + y; };
+
+    BENCHMARK("Indexed Cycle(Array<int, 7>)")
+    {
+        const auto cycle{Cycle(pattern)};
+        auto result{Array<int, 1000>{}};
+        for (SizeType i{0}; i < cycle.Count(); ++i)
+            MConj(result, cycle[i]);
+        return result;
+    };
+    BENCHMARK("Take(1000, Cycle(Array<int, 7>))")
+    {
+        return Take(1000, Cycle(pattern));
+    };
+    BENCHMARK("Take(1000, Cycle(Set<int, 7>))")
+    {
+        return Take(1000, Cycle(set));
+    };
+    BENCHMARK("Map(Add, Range<1000>, Cycle(Array))")
+    {
+        return Map(Add, Range<1000>{}, Cycle(pattern));
+    };
+    BENCHMARK("for (e : Cycle(Array<int, 7>))")
+    {
+        auto sum{0};
+        for (const auto e : Cycle(pattern))
+            sum += e;
+        return sum;
+    };
+}
@@ -0,0 +1,59 @@
+#include <cstdint>
+#include "catch.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-core-freeze.hpp"
+#include "cljonic-core-map.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+namespace
+{
+
+constexpr auto Crc32OfByte = [](const int byte)
+{
+    auto c{static_cast<std::uint32_t>(byte)};
+    for (auto k{0}; k < 8; ++k)
+        c = (0 != (c & 1)) ? (0xedb88320u ^ (c >> 1)) : (c >> 1);
+    return c;
+};
+
+// the CRC-32 of count bytes, with the lookup table in a constexpr Array local variable, which is built on the stack
+// each time the function is called
+[[nodiscard]] std::uint32_t Crc32WithLocalArray(const unsigned char* bytes, const SizeType count) noexcept
+{
+    constexpr auto table{Map(Crc32OfByte, Range<256>{})};
+    auto crc{0xffffffffu};
+    for (SizeType i{0}; i < count; ++i)
+        crc = table[(crc ^ bytes[i]) & 0xffu] ^ (crc >> 8);
+    return ~crc;
+}
+
+// the CRC-32 of count bytes, with the lookup table frozen in read-only memory
+[[nodiscard]] std::uint32_t Crc32WithFrozenTable(const unsigned char* bytes, const SizeType count) noexcept
+{
+    constexpr auto table{Freeze<[] { return Map(Crc32OfByte, Range<256>{}); }>()};
+    auto crc{0xffffffffu};
+    for (SizeType i{0}; i < count; ++i)
+        crc = table[(crc ^ bytes[i]) & 0xffu] ^ (crc >> 8);
+    return ~crc;
+}
+
+} // namespace
+
+TEST_CASE("CRC-32 of 16 bytes with a local constexpr Array or a Freeze table", "[benchmark][CljonicCoreFreeze]")
+{
+    volatile unsigned char seed{7};
+    unsigned char bytes[16];
+    for (SizeType i{0}; i < 16; ++i)
+        bytes[i] = static_cast<unsigned char>(seed + (i * 13));
+
+    BENCHMARK("CRC-32 with a local constexpr Array")
+    {
+        return Crc32WithLocalArray(bytes, 16);
+    };
+    BENCHMARK("CRC-32 with a Freeze table")
+    {
+        return Crc32WithFrozenTable(bytes, 16);
+    };
+}
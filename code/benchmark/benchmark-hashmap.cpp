@@ -0,0 +1,45 @@
+#include <utility>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-hashmap.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-core-indexofby.hpp"
+#include "cljonic-core-map.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+template <typename C, SizeType... Is>
+auto MakeEntries(std::index_sequence<Is...>) noexcept
+{
+    return C{std::pair{static_cast<int>(Is * 7), static_cast<int>(Is)}...};
+}
+
+TEST_CASE("HashMap versus Array and IndexOfBy", "[benchmark][CljonicHashMap]")
+{
+    constexpr auto count{500};
+    const auto map{MakeEntries<HashMap<int, int, count>>(std::make_index_sequence<count>{})};
+    const auto array{MakeEntries<Array<std::pair<int, int>, count>>(std::make_index_sequence<count>{})};
+    const auto keys{Map([](const int i) { return i * 3; }, Range<count>{})};
+    const auto KeysEqual = [](const std::pair<int, int>& e0, const std::pair<int, int>& e1)
+    { return e0.first == e1.first; };
+
+    BENCHMARK("Array IndexOfBy lookup, 500 keys in 500 entries")
+    {
+        auto result{0};
+        for (const auto& key : keys)
+        {
+            const auto i{IndexOfBy(KeysEqual, array, std::pair{key, 0})};
+            result += (i == CLJONIC_INVALID_INDEX) ? 0 : array[i].second;
+        }
+        return result;
+    };
+
+    BENCHMARK("HashMap Get, 500 keys in 500 entries")
+    {
+        auto result{0};
+        for (const auto& key : keys)
+            result += map.Get(key);
+        return result;
+    };
+}
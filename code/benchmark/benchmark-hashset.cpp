@@ -0,0 +1,50 @@
+#include "catch.hpp"
+#include "cljonic-hashset.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-reduce.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+template <typename S, SizeType... Is>
+auto MakeSet(std::index_sequence<Is...>) noexcept
+{
+    return S{static_cast<int>(Is * 7)...};
+}
+
+TEST_CASE("HashSet versus Set", "[benchmark][CljonicHashSet]")
+{
+    constexpr auto count{500};
+    const auto hashSet{MakeSet<HashSet<int, count>>(std::make_index_sequence<count>{})};
+    const auto set{MakeSet<Set<int, count>>(std::make_index_sequence<count>{})};
+    const auto probes{Map([](const int i) { return i * 3; }, Range<count>{})};
+    const auto Hits = [&](const auto& s)
+    {
+        auto result{0};
+        for (const auto& probe : probes)
+            result += s.Contains(probe) ? 1 : 0;
+        return result;
+    };
+
+    BENCHMARK("Set construction, 500 elements")
+    {
+        return MakeSet<Set<int, count>>(std::make_index_sequence<count>{});
+    };
+
+    BENCHMARK("HashSet construction, 500 elements")
+    {
+        return MakeSet<HashSet<int, count>>(std::make_index_sequence<count>{});
+    };
+
+    BENCHMARK("Set Contains, 500 probes of 500 elements")
+    {
+        return Hits(set);
+    };
+
+    BENCHMARK("HashSet Contains, 500 probes of 500 elements")
+    {
+        return Hits(hashSet);
+    };
+}
@@ -0,0 +1,42 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-isdistinct.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-seq.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+TEST_CASE("IsDistinct and Equal", "[benchmark][CljonicIsDistinct]")
+{
+    const auto a0{Seq(Range<1000>{})};
+    const auto a1{Seq(Range<1000>{})};
+    const auto a2{Map([](const int i) { return (i < 999) ? i : 0; }, Range<1000>{})};
+    const auto a3{Map([](const int i) { return (i < 998) ? i : 0; }, Range<1000>{})};
+    const auto s0{String<1000>{"abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz"}};
+    const auto s1{String<1000>{"abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz"}};
+
+    BENCHMARK("IsDistinct of four Arrays")
+    {
+        return IsDistinct(a2, a3, a0, a1);
+    };
+    BENCHMARK("IsDistinct of Arrays and a Range")
+    {
+        return IsDistinct(a2, a3, Range<1000>{}, a1);
+    };
+    BENCHMARK("Equal of two Arrays")
+    {
+        return Equal(a0, a1);
+    };
+    BENCHMARK("Equal of an Array and a Range")
+    {
+        return Equal(a0, Range<1000>{});
+    };
+    BENCHMARK("Equal of two Strings")
+    {
+        return Equal(s0, s1);
+    };
+}
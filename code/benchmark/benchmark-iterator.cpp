@@ -0,0 +1,39 @@
+#include "catch.hpp"
+#include "cljonic-iterator.hpp"
+#include "cljonic-core-nth.hpp"
+#include "cljonic-core-some.hpp"
+#include "cljonic-core-take.hpp"
+#include "cljonic-core-takewhile.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+TEST_CASE("Take, TakeWhile, Some, Nth, and iteration of an Iterator", "[benchmark][CljonicIterator]")
+{
+    volatile unsigned one{1};
+    const auto Next = [](const unsigned i) { return (i * 7) + 3; }; // unsigned, so it wraps
+
+    BENCHMARK("for (e : Iterator)")
+    {
+        auto sum{0u};
+        for (const auto e : Iterator{Next, unsigned{one}})
+            sum += e;
+        return sum;
+    };
+    BENCHMARK("Take(5, Iterator)")
+    {
+        return Take(5, Iterator{Next, unsigned{one}});
+    };
+    BENCHMARK("TakeWhile(< 5000, Iterator)")
+    {
+        return TakeWhile([](const unsigned i) { return i < 5000; }, Iterator{Next, unsigned{one}});
+    };
+    BENCHMARK("Some(== 73, Iterator)")
+    {
+        return Some([](const unsigned i) { return 73 == i; }, Iterator{Next, unsigned{one}});
+    };
+    BENCHMARK("Nth(Iterator, 5)")
+    {
+        return Nth(Iterator{Next, unsigned{one}}, 5);
+    };
+}
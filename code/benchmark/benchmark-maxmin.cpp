@@ -0,0 +1,71 @@
+#include <string>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-core-indexofmax.hpp"
+#include "cljonic-core-indexofmin.hpp"
+#include "cljonic-core-max.hpp"
+#include "cljonic-core-maxby.hpp"
+#include "cljonic-core-min.hpp"
+#include "cljonic-core-minby.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+namespace
+{
+
+template <typename T, SizeType N>
+void BenchmarkMaxMin(const std::string& typeName)
+{
+    auto a{Array<T, N>{}};
+    for (SizeType i{0}; i < N; ++i)
+        MConj(a, static_cast<T>(((i * 37) + 11) % 61));
+    const auto IsALessThanB = [](const T x, const T y) { return x < y; };
+    const auto suffix{"Array<" + typeName + ", " + std::to_string(N) + ">)"};
+
+    BENCHMARK("Max(" + suffix)
+    {
+        return Max(a);
+    };
+    BENCHMARK("Min(" + suffix)
+    {
+        return Min(a);
+    };
+    BENCHMARK("MaxBy(IsALessThanB, " + suffix)
+    {
+        return MaxBy(IsALessThanB, a);
+    };
+    BENCHMARK("MinBy(IsALessThanB, " + suffix)
+    {
+        return MinBy(IsALessThanB, a);
+    };
+    BENCHMARK("IndexOfMax(" + suffix)
+    {
+        return IndexOfMax(a);
+    };
+    BENCHMARK("IndexOfMin(" + suffix)
+    {
+        return IndexOfMin(a);
+    };
+}
+
+} // namespace
+
+TEST_CASE("Max, Min, and their indexes", "[benchmark][CljonicMaxMin]")
+{
+    BenchmarkMaxMin<int, 16>("int");
+    BenchmarkMaxMin<int, 1000>("int");
+    BenchmarkMaxMin<float, 1000>("float");
+    BenchmarkMaxMin<double, 1000>("double");
+
+    const auto r{Range<1000>{}};
+    BENCHMARK("Max(Range<1000>)")
+    {
+        return Max(r);
+    };
+    BENCHMARK("IndexOfMin(Range<1000>)")
+    {
+        return IndexOfMin(r);
+    };
+}
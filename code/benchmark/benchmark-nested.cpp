@@ -0,0 +1,62 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-core-concat.hpp"
+#include "cljonic-core-conj.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-sortby.hpp"
+#include "cljonic-core-splitwith.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+TEST_CASE("Arrays of Arrays", "[benchmark][CljonicNested]")
+{
+    using Row = Array<int, 100>;
+    auto nested{Array<Row, 100>{}};
+    for (auto i{0}; i < 100; ++i)
+    {
+        auto row{Row{}};
+        for (auto j{0}; j < 100; ++j)
+            MConj(row, (((i * 7919) + j) % 100));
+        MConj(nested, row);
+    }
+    const auto& rows{nested};
+    const auto FirstIsEven = [](const Row& row) { return (0 == (row[0] % 2)); };
+    const auto FirstIsNotNinetyNine = [](const Row& row) { return (99 != row[0]); };
+    const auto FirstLessThan = [](const Row& a, const Row& b) { return a[0] < b[0]; };
+
+    BENCHMARK("Filter(FirstIsEven, rows)")
+    {
+        return Filter(FirstIsEven, rows);
+    };
+    BENCHMARK("Concat(rows, rows)")
+    {
+        return Concat(rows, rows);
+    };
+    BENCHMARK("Conj(rows, rows[0])")
+    {
+        return Conj(rows, rows[0]);
+    };
+    BENCHMARK("SortBy(FirstLessThan, rows)")
+    {
+        return SortBy(FirstLessThan, rows);
+    };
+    BENCHMARK("SplitWith(FirstIsNotNinetyNine, rows)")
+    {
+        return SplitWith(FirstIsNotNinetyNine, rows);
+    };
+    BENCHMARK("Sum rows[i][j] through operator[]")
+    {
+        auto sum{0};
+        for (SizeType i{0}; i < rows.Count(); ++i)
+            sum += rows[i][i];
+        return sum;
+    };
+    BENCHMARK("Sum rows.At(i).At(j) through At")
+    {
+        auto sum{0};
+        for (SizeType i{0}; i < rows.Count(); ++i)
+            sum += rows.At(i).At(i);
+        return sum;
+    };
+}
@@ -0,0 +1,135 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "catch.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-string-parseall.hpp"
+#include "cljonic-string-parsefloat.hpp"
+#include "cljonic-string-parseint.hpp"
+#include "cljonic-string-str.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+namespace
+{
+
+constexpr auto fieldCount{40};
+
+// Returns a record of 40 comma separated numbers, each the sample of its index formatted by format, in a String<1000>
+template <typename T>
+String<1000> Record(const char* format, T (&sample)(int))
+{
+    std::string text;
+    char chars[32]{};
+    for (auto i{0}; i < fieldCount; ++i)
+    {
+        std::snprintf(chars, sizeof(chars), format, sample(i));
+        text += std::string{(0 == i) ? "" : ","} + chars;
+    }
+    return String<1000>{text.c_str()};
+}
+
+int IntSample(const int i)
+{
+    return ((i * 7919) % 100003) - 50000;
+}
+
+double DoubleSample(const int i)
+{
+    return ((i * 7919) % 10007) * ((0 == (i % 3)) ? -0.013 : 1.7);
+}
+
+} // namespace
+
+TEST_CASE("Parsing and formatting numbers", "[benchmark][CljonicNumbers]")
+{
+    const auto ints{Record("%d", IntSample)};
+    const auto shortDoubles{Record("%.6g", DoubleSample)};
+    const auto doubles{Record("%.17g", DoubleSample)};
+    std::printf("bytes in records: %zu ints, %zu short doubles, %zu doubles\n", ints.Count(), shortDoubles.Count(),
+                doubles.Count());
+
+    const auto StrtolTotal = [](const auto& record) {
+        long total{0};
+        for (const char* p{record.Data()}; '\0' != *p; p += (',' == *p) ? 1 : 0)
+        {
+            char* end{};
+            total += std::strtol(p, &end, 10);
+            p = end;
+        }
+        return total;
+    };
+    const auto StrtodTotal = [](const auto& record) {
+        double total{0};
+        for (const char* p{record.Data()}; '\0' != *p; p += (',' == *p) ? 1 : 0)
+        {
+            char* end{};
+            total += std::strtod(p, &end);
+            p = end;
+        }
+        return total;
+    };
+    const auto ParseAllTotal = []<typename T>(const auto& record, const T) {
+        T total{0};
+        for (const auto n : ParseAll<T>(record, ','))
+            total += n;
+        return total;
+    };
+
+    BENCHMARK("strtol of 40 ints")
+    {
+        return StrtolTotal(ints);
+    };
+    BENCHMARK("ParseAll<long> of 40 ints")
+    {
+        return ParseAllTotal(ints, 0L);
+    };
+    BENCHMARK("strtod of 40 %.6g doubles")
+    {
+        return StrtodTotal(shortDoubles);
+    };
+    BENCHMARK("ParseAll<double> of 40 %.6g doubles")
+    {
+        return ParseAllTotal(shortDoubles, 0.0);
+    };
+    BENCHMARK("strtod of 40 %.17g doubles")
+    {
+        return StrtodTotal(doubles);
+    };
+    BENCHMARK("ParseAll<double> of 40 %.17g doubles")
+    {
+        return ParseAllTotal(doubles, 0.0);
+    };
+
+    BENCHMARK("snprintf %d of 40 ints")
+    {
+        SizeType total{0};
+        char chars[32]{};
+        for (auto i{0}; i < fieldCount; ++i)
+            total += static_cast<SizeType>(std::snprintf(chars, sizeof(chars), "%d", IntSample(i)));
+        return total;
+    };
+    BENCHMARK("Str of 40 ints")
+    {
+        SizeType total{0};
+        for (auto i{0}; i < fieldCount; ++i)
+            total += Str(IntSample(i)).Count();
+        return total;
+    };
+    BENCHMARK("snprintf %.17g of 40 doubles")
+    {
+        SizeType total{0};
+        char chars[32]{};
+        for (auto i{0}; i < fieldCount; ++i)
+            total += static_cast<SizeType>(std::snprintf(chars, sizeof(chars), "%.17g", DoubleSample(i)));
+        return total;
+    };
+    BENCHMARK("Str of 40 doubles")
+    {
+        SizeType total{0};
+        for (auto i{0}; i < fieldCount; ++i)
+            total += Str(DoubleSample(i)).Count();
+        return total;
+    };
+}
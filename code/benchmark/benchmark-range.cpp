@@ -0,0 +1,69 @@
+#include "catch.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-indexof.hpp"
+#include "cljonic-core-lastindexof.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-reducers.hpp"
+#include "cljonic-core-sort.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+TEST_CASE("Reduce, IndexOf, Sort, Filter, and Equal of a Range", "[benchmark][CljonicRange]")
+{
+    const auto up{Range<-500, 500>{}};
+    const auto down{Range<1998, -1, -2>{}};
+    const auto Add = [](const int x, const int y) { return x + y; };
+    const auto Even = [](const int i) { return 0 == (i % 2); };
+
+    BENCHMARK("Reduce(Add, Range<-500, 500>)")
+    {
+        return Reduce(Add, up);
+    };
+    BENCHMARK("Reduce(Plus, Range<-500, 500>)")
+    {
+        return Reduce(Plus, up);
+    };
+    BENCHMARK("Reduce(Plus, 7, Range<1998,-1,-2>)")
+    {
+        return Reduce(Plus, 7, down);
+    };
+    BENCHMARK("Reduce(Multiplies, Range<-500,500>)")
+    {
+        return Reduce(Multiplies, up);
+    };
+    BENCHMARK("Reduce(Minimum, Range<1998,-1,-2>)")
+    {
+        return Reduce(Minimum, down);
+    };
+    BENCHMARK("IndexOf(Range<1998, -1, -2>, 2)")
+    {
+        return IndexOf(down, 2);
+    };
+    BENCHMARK("LastIndexOf(Range<-500, 500>, -499)")
+    {
+        return LastIndexOf(up, -499);
+    };
+    BENCHMARK("Sort(Range<-500, 500>)")
+    {
+        return Sort(up);
+    };
+    BENCHMARK("Sort(Range<1998, -1, -2>)")
+    {
+        return Sort(down);
+    };
+    BENCHMARK("Filter(Even, Range<-500, 500>)")
+    {
+        return Filter(Even, up);
+    };
+    BENCHMARK("Filter(IsEven, Range<-500, 500>)")
+    {
+        return Filter(IsEven, up);
+    };
+    BENCHMARK("Equal(Range<-500, 500> x 2)")
+    {
+        return Equal(up, Range<-500, 500>{});
+    };
+}
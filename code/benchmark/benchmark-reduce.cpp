@@ -0,0 +1,54 @@
+#include <string>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-reducers.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+namespace
+{
+
+template <typename T, SizeType N>
+void BenchmarkReduce(const std::string& typeName)
+{
+    auto a{Array<T, N>{}};
+    for (SizeType i{0}; i < N; ++i)
+        MConj(a, static_cast<T>(i % 7));
+    const auto Add = [](const T x, const T y) { return static_cast<T>(x + y); };
+    const auto Larger = [](const T x, const T y) { return (x < y) ? y : x; };
+    const auto suffix{"Array<" + typeName + ", " + std::to_string(N) + ">)"};
+
+    BENCHMARK("Reduce(Add, " + suffix)
+    {
+        return Reduce(Add, a);
+    };
+    BENCHMARK("Reduce(Plus, " + suffix)
+    {
+        return Reduce(Plus, a);
+    };
+    BENCHMARK("Reduce(Larger, " + suffix)
+    {
+        return Reduce(Larger, a);
+    };
+    BENCHMARK("Reduce(Maximum, " + suffix)
+    {
+        return Reduce(Maximum, a);
+    };
+}
+
+} // namespace
+
+TEST_CASE("Reduce with a lambda versus a reducer", "[benchmark][CljonicReduce]")
+{
+    BenchmarkReduce<int, 16>("int");
+    BenchmarkReduce<int, 256>("int");
+    BenchmarkReduce<int, 1000>("int");
+    BenchmarkReduce<float, 16>("float");
+    BenchmarkReduce<float, 256>("float");
+    BenchmarkReduce<float, 1000>("float");
+    BenchmarkReduce<double, 16>("double");
+    BenchmarkReduce<double, 256>("double");
+    BenchmarkReduce<double, 1000>("double");
+}
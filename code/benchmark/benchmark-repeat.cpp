@@ -0,0 +1,73 @@
+#include <cstdint>
+#include "catch.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-core-dedupe.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-indexof.hpp"
+#include "cljonic-core-isdistinct.hpp"
+#include "cljonic-core-lastindexof.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-reducers.hpp"
+#include "cljonic-core-sort.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+TEST_CASE("Reduce, Dedupe, Sort, Equal, and IndexOf of a Repeat", "[benchmark][CljonicRepeat]")
+{
+    // the values are read at run time, so the compiler cannot fold the loops over them into constants
+    volatile int three{3};
+    volatile double quarter{0.25};
+    const auto Ints = [&] { return Repeat<1000, int>{int{three}}; };
+    const auto Words = [&] { return Repeat<1000, std::uint64_t>{static_cast<std::uint64_t>(three)}; };
+    const auto Add = [](const int x, const int y) { return x + y; };
+
+    BENCHMARK("Reduce(Add, Repeat<1000, int>)")
+    {
+        return Reduce(Add, Ints());
+    };
+    BENCHMARK("Reduce(Plus, Repeat<1000, int>)")
+    {
+        return Reduce(Plus, Ints());
+    };
+    BENCHMARK("Reduce(Plus, 7, Repeat<1000, int>)")
+    {
+        return Reduce(Plus, 7, Ints());
+    };
+    BENCHMARK("Reduce(Plus, Repeat<1000, double>)")
+    {
+        return Reduce(Plus, Repeat<1000, double>{double{quarter}});
+    };
+    BENCHMARK("Reduce(Multiplies,Repeat<1000,u64>)")
+    {
+        return Reduce(Multiplies, Words());
+    };
+    BENCHMARK("Reduce(BitOr, Repeat<1000, u64>)")
+    {
+        return Reduce(BitOr, Words());
+    };
+    BENCHMARK("Dedupe(Repeat<1000, int>)")
+    {
+        return Dedupe(Ints());
+    };
+    BENCHMARK("Sort(Repeat<1000, int>)")
+    {
+        return Sort(Ints());
+    };
+    BENCHMARK("Equal(Repeat<1000, int> x 2)")
+    {
+        return Equal(Ints(), Repeat<1000, int>{int{three}});
+    };
+    BENCHMARK("IsDistinct(Repeat<1000, int> x 2)")
+    {
+        return IsDistinct(Ints(), Repeat<1000, int>{int{three}});
+    };
+    BENCHMARK("IndexOf(Repeat<1000, int>, 4)")
+    {
+        return IndexOf(Ints(), 4);
+    };
+    BENCHMARK("LastIndexOf(Repeat<1000, int>, 3)")
+    {
+        return LastIndexOf(Ints(), 3);
+    };
+}
@@ -0,0 +1,95 @@
+#include <cstdint>
+#include <string>
+#include <utility>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-indexof.hpp"
+#include "cljonic-core-lastindexof.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+namespace
+{
+
+template <typename T, SizeType N>
+void BenchmarkSearch(const std::string& typeName)
+{
+    // every element is 1 except the one at index 10, which is 2, and the one at index N - 10, which is 3
+    auto a{Array<T, N>{}};
+    for (SizeType i{0}; i < N; ++i)
+        MConj(a, static_cast<T>((10 == i) ? 2 : ((N - 10) == i) ? 3 : 1));
+    const auto suffix{"Array<" + typeName + ", " + std::to_string(N) + ">, "};
+
+    BENCHMARK("IndexOf(" + suffix + "hit early)")
+    {
+        return IndexOf(a, static_cast<T>(2));
+    };
+    BENCHMARK("IndexOf(" + suffix + "hit late)")
+    {
+        return IndexOf(a, static_cast<T>(3));
+    };
+    BENCHMARK("IndexOf(" + suffix + "miss)")
+    {
+        return IndexOf(a, static_cast<T>(4));
+    };
+    BENCHMARK("LastIndexOf(" + suffix + "hit early)")
+    {
+        return LastIndexOf(a, static_cast<T>(3));
+    };
+    BENCHMARK("LastIndexOf(" + suffix + "hit late)")
+    {
+        return LastIndexOf(a, static_cast<T>(2));
+    };
+    BENCHMARK("LastIndexOf(" + suffix + "miss)")
+    {
+        return LastIndexOf(a, static_cast<T>(4));
+    };
+}
+
+template <SizeType... Is>
+auto MultiplesOf3(std::index_sequence<Is...>)
+{
+    return Set<int, sizeof...(Is)>{static_cast<int>(Is * 3)...};
+}
+
+} // namespace
+
+TEST_CASE("IndexOf, LastIndexOf, and Contains of integers", "[benchmark][CljonicSearch]")
+{
+    BenchmarkSearch<char, 1000>("char");
+    BenchmarkSearch<std::uint8_t, 1000>("uint8_t");
+    BenchmarkSearch<short, 1000>("short");
+    BenchmarkSearch<int, 1000>("int");
+
+    const auto s{String{"the quick brown fox jumps over the lazy dog, the quick brown fox jumps over the lazy dog, "
+                        "the quick brown fox jumps over the lazy dog, the quick brown fox jumps over the lazy cat"}};
+    BENCHMARK("IndexOf(String, hit early)")
+    {
+        return IndexOf(s, 'q');
+    };
+    BENCHMARK("IndexOf(String, hit late)")
+    {
+        return IndexOf(s, 'c');
+    };
+    BENCHMARK("IndexOf(String, miss)")
+    {
+        return IndexOf(s, '!');
+    };
+
+    const auto set{MultiplesOf3(std::make_index_sequence<256>{})};
+    BENCHMARK("Set<int, 256>.Contains(hit early)")
+    {
+        return set.Contains(30);
+    };
+    BENCHMARK("Set<int, 256>.Contains(hit late)")
+    {
+        return set.Contains(747);
+    };
+    BENCHMARK("Set<int, 256>.Contains(miss)")
+    {
+        return set.Contains(1);
+    };
+}
@@ -0,0 +1,49 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-core-drop.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-splitwith.hpp"
+#include "cljonic-core-subs.hpp"
+#include "cljonic-core-take.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+TEST_CASE("Slices versus copies", "[benchmark][CljonicSliceView]")
+{
+    auto a{Array<int, 1000>{}};
+    for (auto i{0}; i < 1000; ++i)
+        MConj(a, i);
+    const auto Add = [](const int i, const int j) { return i + j; };
+    const auto IsLessThan500 = [](const int i) { return i < 500; };
+
+    BENCHMARK("Take(500, Drop(250, a)), the former Subs")
+    {
+        return Take(500, Drop(250, a));
+    };
+    BENCHMARK("Subs(a, 250, 750)")
+    {
+        return Subs(a, 250, 750);
+    };
+    BENCHMARK("SubsView(a, 250, 750)")
+    {
+        return SubsView(a, 250, 750);
+    };
+    BENCHMARK("Reduce(Add, Subs(a, 250, 750))")
+    {
+        return Reduce(Add, Subs(a, 250, 750));
+    };
+    BENCHMARK("Reduce(Add, SubsView(a, 250, 750))")
+    {
+        return Reduce(Add, SubsView(a, 250, 750));
+    };
+    BENCHMARK("SplitWith(IsLessThan500, a)")
+    {
+        return SplitWith(IsLessThan500, a);
+    };
+    BENCHMARK("SplitWithView(IsLessThan500, a)")
+    {
+        return SplitWithView(IsLessThan500, a);
+    };
+}
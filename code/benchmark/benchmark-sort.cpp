@@ -0,0 +1,90 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-sort.hpp"
+#include "cljonic-core-stablesort.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+namespace
+{
+
+// The insertion sort that Sort used before it used introsort
+template <typename C>
+auto InsertionSort(const C& c) noexcept
+{
+    auto result{c};
+    for (SizeType i{1}; i < result.Count(); ++i)
+    {
+        const auto key{result[i]};
+        auto j{i};
+        while ((j > 0) and (key < result[j - 1]))
+        {
+            MSet(result, result[j - 1], j);
+            --j;
+        }
+        MSet(result, key, j);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Sort versus insertion sort", "[benchmark][CljonicSort]")
+{
+    const auto random{Map([](const int i) { return (i * 7919) % 1000; }, Range<1000>{})};
+    const auto sorted{Map([](const int i) { return i; }, Range<1000>{})};
+    const auto reversed{Map([](const int i) { return 999 - i; }, Range<1000>{})};
+    const auto duplicates{Map([](const int i) { return i % 10; }, Range<1000>{})};
+
+    BENCHMARK("insertion sort random")
+    {
+        return InsertionSort(random);
+    };
+    BENCHMARK("Sort random")
+    {
+        return Sort(random);
+    };
+    BENCHMARK("StableSort random")
+    {
+        return StableSort(random);
+    };
+    BENCHMARK("insertion sort sorted")
+    {
+        return InsertionSort(sorted);
+    };
+    BENCHMARK("Sort sorted")
+    {
+        return Sort(sorted);
+    };
+    BENCHMARK("StableSort sorted")
+    {
+        return StableSort(sorted);
+    };
+    BENCHMARK("insertion sort reversed")
+    {
+        return InsertionSort(reversed);
+    };
+    BENCHMARK("Sort reversed")
+    {
+        return Sort(reversed);
+    };
+    BENCHMARK("StableSort reversed")
+    {
+        return StableSort(reversed);
+    };
+    BENCHMARK("insertion sort duplicates")
+    {
+        return InsertionSort(duplicates);
+    };
+    BENCHMARK("Sort duplicates")
+    {
+        return Sort(duplicates);
+    };
+    BENCHMARK("StableSort duplicates")
+    {
+        return StableSort(duplicates);
+    };
+}
@@ -0,0 +1,52 @@
+#include "catch.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-sortedset.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-map.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+template <typename S, SizeType... Is>
+auto MakeReversedSet(std::index_sequence<Is...>) noexcept
+{
+    return S{static_cast<int>((sizeof...(Is) - Is) * 7)...};
+}
+
+TEST_CASE("SortedSet versus Set", "[benchmark][CljonicSortedSet]")
+{
+    constexpr auto count{500};
+    const auto sortedSet{MakeReversedSet<SortedSet<int, count>>(std::make_index_sequence<count>{})};
+    const auto otherSortedSet{MakeReversedSet<SortedSet<int, count>>(std::make_index_sequence<count>{})};
+    const auto set{MakeReversedSet<Set<int, count>>(std::make_index_sequence<count>{})};
+    const auto otherSet{MakeReversedSet<Set<int, count>>(std::make_index_sequence<count>{})};
+    const auto probes{Map([](const int i) { return i * 3; }, Range<count>{})};
+    const auto Hits = [&](const auto& s)
+    {
+        auto result{0};
+        for (const auto& probe : probes)
+            result += s.Contains(probe) ? 1 : 0;
+        return result;
+    };
+
+    BENCHMARK("Set Contains, 500 probes of 500 elements")
+    {
+        return Hits(set);
+    };
+
+    BENCHMARK("SortedSet Contains, 500 probes of 500 elements")
+    {
+        return Hits(sortedSet);
+    };
+
+    BENCHMARK("Set Equal, 500 elements")
+    {
+        return Equal(set, otherSet);
+    };
+
+    BENCHMARK("SortedSet Equal, 500 elements")
+    {
+        return Equal(sortedSet, otherSortedSet);
+    };
+}
@@ -0,0 +1,28 @@
+#include <span>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-spanview.hpp"
+#include "cljonic-core-reduce.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+TEST_CASE("SpanView versus copying into an Array", "[benchmark][CljonicSpanView]")
+{
+    int buffer[1000];
+    for (auto i{0}; i < 1000; ++i)
+        buffer[i] = i;
+    const auto Add = [](const int i, const int j) { return i + j; };
+
+    BENCHMARK("Reduce(Add, Array copied from a buffer)")
+    {
+        auto a{Array<int, 1000>{}};
+        for (const auto i : buffer)
+            MConj(a, i);
+        return Reduce(Add, a);
+    };
+    BENCHMARK("Reduce(Add, SpanView{std::span{buffer}})")
+    {
+        return Reduce(Add, SpanView{std::span{buffer}});
+    };
+}
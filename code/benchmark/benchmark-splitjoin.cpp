@@ -0,0 +1,66 @@
+#include <string>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-drop.hpp"
+#include "cljonic-core-dropwhile.hpp"
+#include "cljonic-core-takewhile.hpp"
+#include "cljonic-string-join.hpp"
+#include "cljonic-string-split.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+using namespace cljonic::string;
+
+namespace
+{
+
+// Returns a record of 100 comma separated fields, like "17,-3.25,OK,...", in a String<512>
+String<512> Record()
+{
+    const char* samples[]{"17", "-3.25", "OK", "1024", "", "ab12", "0.5", "NACK"};
+    std::string text;
+    for (SizeType i{0}; i < 100; ++i)
+        text += std::string{(0 == i) ? "" : ","} + samples[(i * 5) % 8];
+    return String<512>{text.c_str()};
+}
+
+} // namespace
+
+TEST_CASE("Split and Join of 100-field records", "[benchmark][CljonicSplitJoin]")
+{
+    constexpr auto IsNotComma = [](const char c) { return ',' != c; };
+    const auto record{Record()};
+
+    BENCHMARK("TakeWhile and DropWhile loop, copying each field")
+    {
+        SizeType total{0};
+        auto rest{Drop(0, record)};
+        for (SizeType i{0}; i < 100; ++i)
+        {
+            total += TakeWhile(IsNotComma, rest).Count();
+            rest = Drop(1, DropWhile(IsNotComma, rest));
+        }
+        return total;
+    };
+    BENCHMARK("Split(String<512>, ',')")
+    {
+        SizeType total{0};
+        for (const auto& field : Split(record, ','))
+            total += field.Count();
+        return total;
+    };
+
+    const auto fields{Split(record, ',')};
+    BENCHMARK("std::string appends of 100 fields")
+    {
+        std::string result;
+        for (SizeType i{0}; i < fields.Count(); ++i)
+            result.append((0 == i) ? "" : ";").append(fields[i].Data(), fields[i].Count());
+        return result.size();
+    };
+    BENCHMARK("Join(';', 100 fields)")
+    {
+        return Join(';', fields).Count();
+    };
+}
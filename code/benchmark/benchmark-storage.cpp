@@ -0,0 +1,60 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-take.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+// Hides a value from the optimizer, so the collection built from it cannot be hoisted out of the benchmark loop
+static int Opaque(int i)
+{
+    asm volatile("" : "+r"(i));
+    return i;
+}
+
+// Makes every store to the collection observable, so the optimizer cannot drop the initialization being measured
+template <typename C>
+SizeType Materialize(const C& c)
+{
+    asm volatile("" : : "r"(&c) : "memory");
+    return c.Count();
+}
+
+TEST_CASE("Sparse collections with a large capacity", "[benchmark][CljonicStorage]")
+{
+    const auto a{Map([](const int x) { return Opaque(x); }, Range<1000>{})};
+    const auto sparse{Array<int, 1000>{Opaque(1), 2, 3, 4, 5}};
+    const auto Even = [](const int i) { return (0 == (i % 2)); };
+
+    BENCHMARK("Array<int, 1000>{1, 2, 3}")
+    {
+        return Materialize(Array<int, 1000>{Opaque(1), 2, 3});
+    };
+    BENCHMARK("Set<int, 1000>{1, 2, 3}")
+    {
+        return Materialize(Set<int, 1000>{Opaque(1), 2, 3});
+    };
+    BENCHMARK("String<1000>{\"Hello\"}")
+    {
+        return Materialize(String<1000>{static_cast<char>(Opaque('H')), 'e', 'l', 'l', 'o'});
+    };
+    BENCHMARK("Copy an Array<int, 1000> of 5 elements")
+    {
+        auto copy{sparse};
+        asm volatile("" : "+m"(copy));
+        return Materialize(copy);
+    };
+    BENCHMARK("Take(5, Array<int, 1000>)")
+    {
+        return Materialize(Take(Opaque(5), a));
+    };
+    BENCHMARK("Filter(Even, Take(5, Array<int, 1000>))")
+    {
+        return Materialize(Filter(Even, Take(Opaque(5), a)));
+    };
+}
@@ -0,0 +1,66 @@
+#include <string_view>
+#include "catch.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-string-indexofsubstring.hpp"
+#include "cljonic-string-lastindexofsubstring.hpp"
+#include "cljonic-string-replace.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+namespace
+{
+
+// Returns 1000 chars of text, which repeats a sentence, or repeats one char, and ends with the given chars
+String<1000> Haystack(const char* sentence, const char* ending)
+{
+    const auto sentenceCount{std::string_view{sentence}.size()};
+    const auto endingCount{std::string_view{ending}.size()};
+    char text[1001]{};
+    for (SizeType i{0}; i < (1000 - endingCount); ++i)
+        text[i] = sentence[i % sentenceCount];
+    for (SizeType i{0}; i < endingCount; ++i)
+        text[1000 - endingCount + i] = ending[i];
+    return String<1000>{text};
+}
+
+void BenchmarkFind(const std::string& name, const String<1000>& haystack, const char* needle)
+{
+    const auto view{haystack.AsStringView<std::string_view>()};
+    BENCHMARK("IndexOfSubstring(" + name + ")")
+    {
+        return IndexOfSubstring(haystack, needle);
+    };
+    BENCHMARK("std::string_view::find(" + name + ")")
+    {
+        return view.find(needle);
+    };
+    BENCHMARK("LastIndexOfSubstring(" + name + ")")
+    {
+        return LastIndexOfSubstring(haystack, needle);
+    };
+    BENCHMARK("std::string_view::rfind(" + name + ")")
+    {
+        return view.rfind(needle);
+    };
+}
+
+} // namespace
+
+TEST_CASE("IndexOfSubstring and LastIndexOfSubstring vs std::string_view", "[benchmark][CljonicSubstring]")
+{
+    const auto prose{Haystack("the quick brown fox jumps over the lazy dog, ", "the lazy cat")};
+    BenchmarkFind("prose, 8 char hit", prose, "lazy cat");
+    BenchmarkFind("prose, 8 char miss", prose, "lazy cow");
+    BenchmarkFind("prose, 1 char miss", prose, "!");
+
+    // every window matches all but the last char of the needle, which defeats a naive search
+    const auto as{Haystack("a", "")};
+    BenchmarkFind("1000 a, 50 char miss", as, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab");
+    BenchmarkFind("1000 a, 50 char reversed miss", as, "baaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+
+    BENCHMARK("Replace(prose, \"fox\", \"wolf\")")
+    {
+        return Replace(prose, "fox", "wolf");
+    };
+}
@@ -0,0 +1,38 @@
+#include "catch.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-core-compose.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-filtert.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-mapt.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-seq.hpp"
+#include "cljonic-core-transduce.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+TEST_CASE("Transduce versus eager Map, Filter and Reduce", "[benchmark][CljonicTransduce]")
+{
+    const auto c{Seq(Range<1000>{})};
+    const auto Add = [](const int a, const int b) { return a + b; };
+    const auto Square = [](const int i) { return i * i; };
+    const auto Even = [](const int i) { return (0 == (i % 2)); };
+
+    BENCHMARK("Reduce(Add, 0, Map(Square, Filter(Even, c)))")
+    {
+        return Reduce(Add, 0, Map(Square, Filter(Even, c)));
+    };
+    BENCHMARK("Transduce(Compose(FilterT(Even), MapT(Square)), Add, 0, c)")
+    {
+        return Transduce(Compose(FilterT(Even), MapT(Square)), Add, 0, c);
+    };
+    BENCHMARK("hand-written loop")
+    {
+        auto result{0};
+        for (const auto& i : c)
+            if (Even(i))
+                result = Add(result, Square(i));
+        return result;
+    };
+}
@@ -0,0 +1,35 @@
+#include "catch.hpp"
+#include "cljonic-filterview.hpp"
+#include "cljonic-mapview.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-seq.hpp"
+#include "cljonic-core-take.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+TEST_CASE("Views versus eager Map and Filter", "[benchmark][CljonicViews]")
+{
+    const auto c{Seq(Range<1000>{})};
+    const auto Square = [](const int i) { return i * i; };
+    const auto Even = [](const int i) { return (0 == (i % 2)); };
+
+    BENCHMARK("Take(10, Filter(Even, Map(Square, c)))")
+    {
+        return Take(10, Filter(Even, Map(Square, c)));
+    };
+    BENCHMARK("Take(10, FilterView{Even, MapView{Square, c}})")
+    {
+        return Take(10, FilterView{Even, MapView{Square, c}});
+    };
+    BENCHMARK("Filter(Even, Map(Square, c))")
+    {
+        return Filter(Even, Map(Square, c));
+    };
+    BENCHMARK("Seq(FilterView{Even, MapView{Square, c}})")
+    {
+        return Seq(FilterView{Even, MapView{Square, c}});
+    };
+}
@@ -4,10 +4,13 @@
 #include <concepts>
 #include <cstring>
 #include <initializer_list>
+#include <span>
 #include <type_traits>
-#include "cljonic-collection-iterator.hpp"
+#include <utility>
 #include "cljonic-collection-type.hpp"
 #include "cljonic-concepts.hpp"
+#include "cljonic-introsort.hpp"
+#include "cljonic-mergesort.hpp"
 #include "cljonic-shared.hpp"
 
 namespace cljonic
@@ -18,6 +21,10 @@ namespace cljonic
  * specified type (i.e., It is homogenous).  <b>Note that one could create an Array of a \b UNION to get something like
  * heterogeneity.</b> An \b Array is a function of its indexable elements. An \b Array called with an out-of-bounds
  * index will return its \b default \b element. Many \ref Namespace_Core "Core" functions accept Array arguments.
+ * Because its elements are contiguous, \b Data returns a pointer to them, and \b AsSpan returns a \b std::span of them,
+ * so they can be passed to C APIs and I/O functions without being copied.  The indexing operator returns a copy of an
+ * element, while \b At returns a \b const reference to it, which avoids copying elements that are large, such as
+ * \b Arrays.
  *
  * The \b Array constructor returns an instance of Array initialized with its arguments.
  ~~~~~{.cpp}
@@ -29,6 +36,9 @@ namespace cljonic
      constexpr auto a1{Array<int, 10>{1, 2, 3, 4}}; // immutable and sparse
      constexpr auto a2{Array<int, 4>{1, 2, 3, 4}};  // immutable and full
      constexpr auto a4{Array{1, 2, 3, 4}};          // immutable and full of four int values
+     const auto p{a4.Data()};                       // const int* to the 1
+     const auto s{a4.AsSpan()};                     // std::span<const int> of the four elements
+     const auto& r{a4.At(3)};                       // const int& to the 4
 
      // Compiler Error: Array initialized with too many elements
      // constexpr auto a{Array<int, 4>{0, 2, 4, 5, 6, 7, 8, 9}};
@@ -41,7 +51,7 @@ namespace cljonic
  ~~~~~
  */
 template <ValidCljonicContainerElementType T, SizeType MaxElements>
-class Array : public IndexInterface<T>
+class Array
 {
     static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
 
@@ -50,18 +60,25 @@ class Array : public IndexInterface<T>
 
     SizeType m_elementCount;
     T m_elementDefault;
-    T m_elements[maximumElements]{};
+    T m_elements[maximumElements]; // only the first m_elementCount are initialized, see InitializeUnusedElements
 
     template <typename U, SizeType N>
     constexpr friend void MConj(Array<U, N>& array, const U& value);
 
+    template <typename U, SizeType N>
+    constexpr friend void MConj(Array<U, N>& array, U&& value);
+
+    template <typename U, SizeType N>
+    constexpr friend void MConjElements(Array<U, N>& array, const U* elements, const SizeType count);
+
     template <typename U, SizeType N>
     constexpr friend void MSet(Array<U, N>& array, const U& value, const SizeType index);
 
-    [[nodiscard]] constexpr auto ValueAtIndex(const SizeType index) const noexcept
-    {
-        return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
-    }
+    template <typename U, SizeType N, typename F>
+    constexpr friend void MSortBy(Array<U, N>& array, F&& f);
+
+    template <typename U, SizeType N, typename F>
+    constexpr friend void MStableSortBy(Array<U, N>& array, F&& f);
 
   public:
     using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Array>;
@@ -70,35 +87,52 @@ class Array : public IndexInterface<T>
 
     constexpr Array() noexcept : m_elementCount(0), m_elementDefault(T{})
     {
+        InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
     }
 
     template <typename... Args>
+        requires(std::convertible_to<Args, T> and ...) // so copying a non-const Array uses the copy constructor
     constexpr explicit Array(Args&&... args) noexcept : m_elementCount(0), m_elementDefault(T{})
     {
         static_assert(sizeof...(Args) <= MaximumCount(), "Array initialized with too many elements");
-        ((m_elements[m_elementCount++] = args), ...);
+        ((m_elements[m_elementCount++] = std::forward<Args>(args)), ...);
+        InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+    }
+
+    // Copy constructor; copies only the elements in use, rather than the whole capacity
+    constexpr Array(const Array& other) noexcept
+        : m_elementCount(other.m_elementCount), m_elementDefault(other.m_elementDefault)
+    {
+        CopyElements(m_elements, other.m_elements, m_elementCount);
+        InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
     }
 
-    constexpr Array(const Array& other) noexcept = default; // Copy constructor
-    constexpr Array(Array&& other) noexcept = default;      // Move constructor
+    // Move constructor; moves only the elements in use
+    constexpr Array(Array&& other) noexcept
+        : m_elementCount(other.m_elementCount), m_elementDefault(std::move(other.m_elementDefault))
+    {
+        for (SizeType i{0}; i < m_elementCount; ++i)
+            m_elements[i] = std::move(other.m_elements[i]);
+        InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+    }
 
   private:
-    using Iterator = CollectionIterator<Array>;
+    using Iterator = const T*; // the elements are contiguous, so a pointer is a contiguous iterator
 
   public:
     [[nodiscard]] constexpr Iterator begin() const noexcept
     {
-        return Iterator{*this, 0};
+        return m_elements;
     }
 
     [[nodiscard]] constexpr Iterator end() const noexcept
     {
-        return Iterator{*this, m_elementCount};
+        return m_elements + m_elementCount;
     }
 
-    [[nodiscard]] constexpr T operator[](const SizeType index) const noexcept override
+    [[nodiscard]] constexpr T operator[](const SizeType index) const noexcept
     {
-        return ValueAtIndex(index);
+        return At(index);
     }
 
     [[nodiscard]] constexpr T operator()(const SizeType index) const noexcept
@@ -112,31 +146,54 @@ class Array : public IndexInterface<T>
         {
             m_elementCount = other.m_elementCount;
             m_elementDefault = other.m_elementDefault;
-            for (SizeType i{0}; i < m_elementCount; ++i)
-                m_elements[i] = other.m_elements[i];
+            CopyElements(m_elements, other.m_elements, m_elementCount);
         }
         return *this;
     }
 
     constexpr Array& operator=(Array&& other) noexcept
     {
-        return *this = other; // Delegate to copy assignment
+        // GCC cannot compare the address of a temporary with this one in a constant expression, so the self move
+        // assignment check is made only at run time
+        if (std::is_constant_evaluated() or (this != &other))
+        {
+            m_elementCount = other.m_elementCount;
+            m_elementDefault = std::move(other.m_elementDefault);
+            for (SizeType i{0}; i < m_elementCount; ++i)
+                m_elements[i] = std::move(other.m_elements[i]);
+        }
+        return *this;
+    }
+
+    [[nodiscard]] constexpr std::span<const T> AsSpan() const noexcept
+    {
+        return std::span<const T>{Data(), m_elementCount};
     }
 
-    [[nodiscard]] constexpr SizeType Count() const noexcept override
+    [[nodiscard]] constexpr const T& At(const SizeType index) const noexcept
+    {
+        return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr SizeType Count() const noexcept
     {
         return m_elementCount;
     }
 
+    [[nodiscard]] constexpr const T* Data() const noexcept
+    {
+        return m_elements;
+    }
+
     [[nodiscard]] constexpr const T& DefaultElement() const noexcept
     {
         return m_elementDefault;
     }
 
     [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
-                                                                const T& element) const noexcept override
+                                                                const T& element) const noexcept
     {
-        return (index < m_elementCount) and AreEqual(ValueAtIndex(index), element);
+        return (index < m_elementCount) and AreEqual(m_elements[index], element);
     }
 
     [[nodiscard]] static consteval SizeType MaximumCount() noexcept
@@ -156,6 +213,22 @@ constexpr void MConj(Array<U, N>& array, const U& value)
         array.m_elements[array.m_elementCount++] = value;
 }
 
+template <typename U, SizeType N>
+constexpr void MConj(Array<U, N>& array, U&& value)
+{
+    if (array.m_elementCount < array.MaximumCount())
+        array.m_elements[array.m_elementCount++] = std::move(value);
+}
+
+// Appends as many of count contiguous elements as fit, in bulk, rather than one bounds checked MConj at a time
+template <typename U, SizeType N>
+constexpr void MConjElements(Array<U, N>& array, const U* elements, const SizeType count)
+{
+    const auto fitCount{MinArgument(count, array.MaximumCount() - array.m_elementCount)};
+    CopyElements(array.m_elements + array.m_elementCount, elements, fitCount);
+    array.m_elementCount += fitCount;
+}
+
 template <typename U, SizeType N>
 constexpr void MSet(Array<U, N>& array, const U& value, const SizeType index)
 {
@@ -163,6 +236,20 @@ constexpr void MSet(Array<U, N>& array, const U& value, const SizeType index)
         array.m_elements[index] = value;
 }
 
+template <typename U, SizeType N, typename F>
+constexpr void MSortBy(Array<U, N>& array, F&& f)
+{
+    IntroSort(array.m_elements, array.m_elementCount, f);
+}
+
+template <typename U, SizeType N, typename F>
+constexpr void MStableSortBy(Array<U, N>& array, F&& f)
+{
+    U scratch[N]; // the merge sort's scratch space, the same size as the array, on the stack
+    InitializeUnusedElements(scratch, 0, N);
+    MergeSort(array.m_elements, scratch, array.m_elementCount, f);
+}
+
 } // namespace cljonic
 
 #endif // CLJONIC_ARRAY_HPP
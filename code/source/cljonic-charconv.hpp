@@ -0,0 +1,709 @@
+#ifndef CLJONIC_CHARCONV_HPP
+#define CLJONIC_CHARCONV_HPP
+
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "cljonic-collection-maximum-element-count.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+namespace cljonic
+{
+
+// The integer types that are numbers, rather than truth values or chars
+template <typename T>
+concept IsNumberInteger = std::integral<T> and not std::same_as<T, bool> and not std::same_as<T, char> and
+                          not std::same_as<T, wchar_t> and not std::same_as<T, char8_t> and
+                          not std::same_as<T, char16_t> and not std::same_as<T, char32_t>;
+
+// The floating point types whose IEEE 754 bits the constant evaluation of the number functions assembles
+template <typename T>
+concept IsNumberFloating = std::same_as<T, float> or std::same_as<T, double>;
+
+// Parses all of text, an optional sign followed by decimal digits, into result, and returns false, leaving result
+// unchanged, if text is not an integer that T can hold; like std::from_chars, whose integer overload is not constexpr
+// until C++23, each digit is checked against the last digit of the limit, rather than by a division
+template <typename T>
+[[nodiscard]] constexpr bool ParseIntegerText(const Text& text, T& result) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+    const auto negative{(0 < text.count) and ('-' == text.chars[0])};
+    auto i{(negative or ((0 < text.count) and ('+' == text.chars[0]))) ? SizeType{1} : SizeType{0}};
+    if ((i == text.count) or (negative and std::is_unsigned_v<T>))
+        return false;
+    const auto limit{negative ? static_cast<U>(static_cast<U>(std::numeric_limits<T>::max()) + 1u)
+                              : static_cast<U>(std::numeric_limits<T>::max())};
+    const auto limitTens{static_cast<U>(limit / 10)};
+    const auto limitUnits{static_cast<U>(limit % 10)};
+    U value{0};
+    for (; i < text.count; ++i)
+    {
+        const auto digit{static_cast<U>(static_cast<unsigned char>(text.chars[i]) - '0')};
+        if ((digit > 9) or (value > limitTens) or ((value == limitTens) and (digit > limitUnits)))
+            return false;
+        value = static_cast<U>((value * 10u) + digit);
+    }
+    result = negative ? static_cast<T>(static_cast<U>(0u - value)) : static_cast<T>(value);
+    return true;
+}
+
+// Returns the decimal digits of t, after a '-' if it is negative, written backward from the least significant digit
+template <typename T>
+[[nodiscard]] constexpr auto IntegerString(const T t) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+    constexpr SizeType maximumCount{std::numeric_limits<T>::digits10 + 2}; // digits10 + 1 digits, and a sign
+    char chars[maximumCount + 1]{};
+    auto negative{false};
+    auto value{static_cast<U>(t)};
+    if constexpr (std::is_signed_v<T>)
+    {
+        negative = (t < 0);
+        if (negative)
+            value = static_cast<U>(0u - value);
+    }
+    auto start{maximumCount};
+    do
+    {
+        chars[--start] = static_cast<char>('0' + (value % 10u));
+        value = static_cast<U>(value / 10u);
+    } while (0 != value);
+    if (negative)
+        chars[--start] = '-';
+    return String<maximumCount>{chars + start};
+}
+
+// A decimal number, digits times ten to the power of exponent, that keeps the first 19 significant digits, which are
+// more than any float or double needs, and whether any of the digits after them are not zero
+struct DecimalNumber
+{
+    std::uint64_t digits;
+    int exponent;
+    bool negative;
+    bool truncated;
+};
+
+// Returns true if text, from index start, is name, ignoring case
+[[nodiscard]] constexpr bool IsNameOfText(const Text& text, const SizeType start, const char* name) noexcept
+{
+    SizeType i{0};
+    for (; '\0' != name[i]; ++i)
+        if (((start + i) >= text.count) or ((text.chars[start + i] | 0x20) != name[i]))
+            return false;
+    return (start + i) == text.count;
+}
+
+// Parses all of text, an optional sign, decimal digits with an optional decimal point, and an optional exponent, into
+// number, and returns false if text is not such a number; the digits are accumulated in locals, rather than in number,
+// so they stay in registers
+[[nodiscard]] constexpr bool ParseDecimalText(const Text& text, DecimalNumber& number) noexcept
+{
+    // #lizard forgives -- The length and complexity of this function is acceptable
+
+    constexpr SizeType maximumSignificantCount{19};
+    const auto IsDigitAt = [&](const SizeType index) {
+        return (index < text.count) and (static_cast<unsigned char>(text.chars[index] - '0') <= 9);
+    };
+    const auto DigitAt = [&](const SizeType index) { return static_cast<std::uint64_t>(text.chars[index] - '0'); };
+    SizeType i{0};
+    const auto negative{(0 < text.count) and ('-' == text.chars[0])};
+    if (negative or ((0 < text.count) and ('+' == text.chars[0])))
+        ++i;
+    const auto mantissaStart{i};
+    while ((i < text.count) and ('0' == text.chars[i]))
+        ++i;
+    std::uint64_t digits{0};
+    SizeType significantCount{0};
+    auto exponent{0};
+    auto truncated{false};
+    for (; IsDigitAt(i); ++i)
+    {
+        if (significantCount < maximumSignificantCount)
+        {
+            digits = (digits * 10) + DigitAt(i);
+            ++significantCount;
+        }
+        else
+        {
+            ++exponent;
+            truncated = truncated or ('0' != text.chars[i]);
+        }
+    }
+    auto pointCount{SizeType{0}};
+    if ((i < text.count) and ('.' == text.chars[i]))
+    {
+        pointCount = 1;
+        ++i;
+        if (0 == significantCount)
+            for (; (i < text.count) and ('0' == text.chars[i]); ++i)
+                --exponent;
+        for (; IsDigitAt(i); ++i)
+        {
+            if (significantCount < maximumSignificantCount)
+            {
+                digits = (digits * 10) + DigitAt(i);
+                ++significantCount;
+                --exponent;
+            }
+            else
+            {
+                truncated = truncated or ('0' != text.chars[i]);
+            }
+        }
+    }
+    if ((i - mantissaStart) == pointCount)
+        return false;
+    if ((i < text.count) and ('e' == (text.chars[i] | 0x20)))
+    {
+        ++i;
+        const auto negativeExponent{(i < text.count) and ('-' == text.chars[i])};
+        if (negativeExponent or ((i < text.count) and ('+' == text.chars[i])))
+            ++i;
+        if (not IsDigitAt(i))
+            return false;
+        auto exponentValue{0};
+        for (; IsDigitAt(i); ++i)
+            if (exponentValue < 100000)
+                exponentValue = (exponentValue * 10) + static_cast<int>(DigitAt(i));
+        exponent += negativeExponent ? -exponentValue : exponentValue;
+    }
+    number = DecimalNumber{digits, exponent, negative, truncated};
+    return i == text.count;
+}
+
+// An unsigned integer of up to 128 * 32 bits, enough to hold the exact value of any double, or any 768 digit decimal
+// number in the range of a double, with room to divide one by the other; it is only used during constant evaluation,
+// where std::from_chars and std::to_chars cannot be called, so its size is never taken from the stack at run time
+class BigInteger
+{
+    static constexpr SizeType maximumLimbs{128};
+
+    std::uint32_t m_limbs[maximumLimbs];
+    SizeType m_count; // the limbs from m_count on are zero
+
+  public:
+    constexpr explicit BigInteger(const std::uint64_t value) noexcept : m_limbs{}, m_count{0}
+    {
+        m_limbs[0] = static_cast<std::uint32_t>(value);
+        m_limbs[1] = static_cast<std::uint32_t>(value >> 32);
+        m_count = (0 != m_limbs[1]) ? 2 : ((0 != m_limbs[0]) ? 1 : 0);
+    }
+
+    [[nodiscard]] constexpr bool IsZero() const noexcept
+    {
+        return 0 == m_count;
+    }
+
+    [[nodiscard]] constexpr SizeType BitCount() const noexcept
+    {
+        if (0 == m_count)
+            return 0;
+        return (32 * (m_count - 1)) + static_cast<SizeType>(std::bit_width(m_limbs[m_count - 1]));
+    }
+
+    constexpr void MultiplyBy(const std::uint32_t factor) noexcept
+    {
+        std::uint64_t carry{0};
+        for (SizeType i{0}; i < m_count; ++i)
+        {
+            carry += static_cast<std::uint64_t>(m_limbs[i]) * factor;
+            m_limbs[i] = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+        }
+        if ((0 != carry) and (m_count < maximumLimbs))
+            m_limbs[m_count++] = static_cast<std::uint32_t>(carry);
+    }
+
+    // Multiplies by base to the power of exponent, where base to the power of chunk fits in 32 bits
+    constexpr void MultiplyByPower(const std::uint32_t base, SizeType exponent, const SizeType chunk) noexcept
+    {
+        auto chunkPower{std::uint32_t{1}};
+        for (SizeType i{0}; i < chunk; ++i)
+            chunkPower *= base;
+        for (; exponent >= chunk; exponent -= chunk)
+            MultiplyBy(chunkPower);
+        for (; exponent > 0; --exponent)
+            MultiplyBy(base);
+    }
+
+    constexpr void ShiftLeft(const SizeType bits) noexcept
+    {
+        const auto limbShift{bits / 32};
+        const auto bitShift{bits % 32};
+        if (0 == m_count)
+            return;
+        m_count = MinArgument(m_count + limbShift + 1, maximumLimbs);
+        for (auto i{m_count}; i-- > 0;)
+        {
+            const auto high{(i >= limbShift) ? m_limbs[i - limbShift] : std::uint32_t{0}};
+            const auto low{((i > limbShift) and (0 != bitShift)) ? m_limbs[i - limbShift - 1] : std::uint32_t{0}};
+            m_limbs[i] = (0 == bitShift) ? high : ((high << bitShift) | (low >> (32 - bitShift)));
+        }
+        while ((0 < m_count) and (0 == m_limbs[m_count - 1]))
+            --m_count;
+    }
+
+    [[nodiscard]] constexpr bool IsLessThan(const BigInteger& other) const noexcept
+    {
+        if (m_count != other.m_count)
+            return m_count < other.m_count;
+        for (auto i{m_count}; i-- > 0;)
+            if (m_limbs[i] != other.m_limbs[i])
+                return m_limbs[i] < other.m_limbs[i];
+        return false;
+    }
+
+    // Subtracts other, which must not be greater
+    constexpr void Subtract(const BigInteger& other) noexcept
+    {
+        std::int64_t borrow{0};
+        for (SizeType i{0}; i < m_count; ++i)
+        {
+            borrow += static_cast<std::int64_t>(m_limbs[i]) - ((i < other.m_count) ? other.m_limbs[i] : 0);
+            m_limbs[i] = static_cast<std::uint32_t>(borrow);
+            borrow = (borrow < 0) ? -1 : 0;
+        }
+        while ((0 < m_count) and (0 == m_limbs[m_count - 1]))
+            --m_count;
+    }
+
+    constexpr void Add(const std::uint32_t addend) noexcept
+    {
+        std::uint64_t carry{addend};
+        for (SizeType i{0}; (0 != carry) and (i < maximumLimbs); ++i)
+        {
+            carry += m_limbs[i];
+            m_limbs[i] = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+            m_count = (i < m_count) ? m_count : (i + 1);
+        }
+    }
+
+    // Divides by divisor, and returns the remainder
+    constexpr std::uint32_t DivideBy(const std::uint32_t divisor) noexcept
+    {
+        std::uint64_t remainder{0};
+        for (auto i{m_count}; i-- > 0;)
+        {
+            remainder = (remainder << 32) | m_limbs[i];
+            m_limbs[i] = static_cast<std::uint32_t>(remainder / divisor);
+            remainder %= divisor;
+        }
+        while ((0 < m_count) and (0 == m_limbs[m_count - 1]))
+            --m_count;
+        return static_cast<std::uint32_t>(remainder);
+    }
+
+    // Returns the value shifted right by bits, which must fit in 64 bits, and sets sticky if a bit shifted out is one
+    [[nodiscard]] constexpr std::uint64_t ShiftedRight(const SizeType bits, bool& sticky) const noexcept
+    {
+        const auto Bit = [&](const SizeType bit) {
+            return ((bit / 32) < m_count) ? ((m_limbs[bit / 32] >> (bit % 32)) & 1u) : 0u;
+        };
+        std::uint64_t result{0};
+        for (SizeType i{64}; i-- > 0;)
+            result = (result << 1) | Bit(bits + i);
+        for (SizeType bit{0}; ((not sticky) and (bit < bits)); ++bit)
+            sticky = (0 != Bit(bit));
+        return result;
+    }
+}; // class BigInteger
+
+// Returns the T nearest to q * 2^exponent, or to a little more than that if sticky, rounding ties to even, by
+// assembling its IEEE 754 bits, so it is exact for subnormal results too
+template <typename T>
+[[nodiscard]] constexpr T AssembleFloating(const bool negative, const std::uint64_t q, const int exponent,
+                                           const bool sticky) noexcept
+{
+    using Bits = std::conditional_t<std::same_as<T, float>, std::uint32_t, std::uint64_t>;
+    constexpr int digits{std::numeric_limits<T>::digits};
+    constexpr int minimumExponent{std::numeric_limits<T>::min_exponent - digits};
+    constexpr int maximumExponent{std::numeric_limits<T>::max_exponent - digits};
+    constexpr auto hidden{std::uint64_t{1} << (digits - 1)};
+    const auto Mask = [](const int bits) {
+        return (bits >= 64) ? ~std::uint64_t{0} : ((std::uint64_t{1} << bits) - 1);
+    };
+    auto shift{static_cast<int>(std::bit_width(q)) - digits};
+    auto e{exponent + shift};
+    if (e < minimumExponent)
+    {
+        shift += minimumExponent - e;
+        e = minimumExponent;
+    }
+    auto m{(shift <= 0) ? (q << -shift) : ((shift < 64) ? (q >> shift) : std::uint64_t{0})};
+    if (shift > 0)
+    {
+        const auto half{(shift <= 64) and (0 != ((q >> (shift - 1)) & 1))};
+        const auto rest{sticky or (0 != (q & Mask(shift - 1)))};
+        if (half and (rest or (0 != (m & 1))))
+            ++m;
+        if (m == (hidden << 1))
+        {
+            m >>= 1;
+            ++e;
+        }
+    }
+    const auto sign{negative ? (Bits{1} << (sizeof(Bits) * 8 - 1)) : Bits{0}};
+    if ((e > maximumExponent) or ((e == maximumExponent) and (m >= (hidden << 1))))
+        return negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+    const auto biased{(m < hidden) ? Bits{0} : static_cast<Bits>(e - minimumExponent + 1)};
+    const auto fraction{static_cast<Bits>(m & (hidden - 1))};
+    return std::bit_cast<T>(static_cast<Bits>(sign | static_cast<Bits>(biased << (digits - 1)) | fraction));
+}
+
+// Returns the number of decimal digits of digits
+[[nodiscard]] constexpr int DecimalDigitCount(std::uint64_t digits) noexcept
+{
+    auto result{0};
+    for (; 0 != digits; digits /= 10)
+        ++result;
+    return result;
+}
+
+// Reads the first 768 significant digits of text, a number that ParseDecimalText accepts, into n, which is zero, sets
+// sticky if any digit after them is not zero, and returns how many it read; as in fast_float, 768 digits are enough to
+// decide which way any number rounds to a double
+[[nodiscard]] constexpr SizeType ReadSignificantDigits(const Text& text, BigInteger& n, bool& sticky) noexcept
+{
+    constexpr SizeType maximumSignificantCount{768};
+    SizeType count{0};
+    std::uint32_t chunk{0};
+    SizeType chunkCount{0};
+    for (SizeType i{0}; (i < text.count) and ('e' != (text.chars[i] | 0x20)); ++i)
+    {
+        const auto c{text.chars[i]};
+        if ((c < '0') or ('9' < c) or ((0 == count) and ('0' == c)))
+            continue;
+        if (maximumSignificantCount == count)
+        {
+            sticky = sticky or ('0' != c);
+            continue;
+        }
+        chunk = (chunk * 10) + static_cast<std::uint32_t>(c - '0');
+        ++count;
+        if (9 == ++chunkCount)
+        {
+            n.MultiplyBy(1000000000u);
+            n.Add(chunk);
+            chunk = 0;
+            chunkCount = 0;
+        }
+    }
+    n.MultiplyByPower(10, chunkCount, 9);
+    n.Add(chunk);
+    return count;
+}
+
+// Returns the T nearest to number, by exact big integer arithmetic, reading the digits of text again when number is
+// truncated
+template <typename T>
+[[nodiscard]] constexpr T DecimalToFloatingExactly(const DecimalNumber& number, const Text& text) noexcept
+{
+    const auto zero{number.negative ? -T{0} : T{0}};
+    if (0 == number.digits)
+        return zero;
+    const auto magnitude{number.exponent + DecimalDigitCount(number.digits)}; // number < 10^magnitude
+    if (magnitude > (std::numeric_limits<T>::max_exponent10 + 1))
+        return number.negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+    if (magnitude < (std::numeric_limits<T>::min_exponent10 - std::numeric_limits<T>::max_digits10))
+        return zero;
+    auto sticky{false};
+    auto n{BigInteger{number.digits}};
+    auto exponent{number.exponent};
+    if (number.truncated)
+    {
+        n = BigInteger{0};
+        exponent -= static_cast<int>(ReadSignificantDigits(text, n, sticky)) - 19;
+    }
+    if (exponent >= 0)
+    {
+        n.MultiplyByPower(10, static_cast<SizeType>(exponent), 9);
+        const auto shift{(n.BitCount() > 64) ? (n.BitCount() - 64) : SizeType{0}};
+        const auto q{n.ShiftedRight(shift, sticky)};
+        return AssembleFloating<T>(number.negative, q, static_cast<int>(shift), sticky);
+    }
+    auto divisor{BigInteger{1}};
+    divisor.MultiplyByPower(10, static_cast<SizeType>(-exponent), 9);
+    // shift one of them so the quotient has 63 or 64 bits
+    const auto shift{static_cast<int>(divisor.BitCount() + 63) - static_cast<int>(n.BitCount())};
+    if (shift > 0)
+        n.ShiftLeft(static_cast<SizeType>(shift));
+    else
+        divisor.ShiftLeft(static_cast<SizeType>(-shift));
+    std::uint64_t q{0};
+    for (auto bit{64}; bit-- > 0;)
+    {
+        auto shiftedDivisor{divisor};
+        shiftedDivisor.ShiftLeft(static_cast<SizeType>(bit));
+        if (not n.IsLessThan(shiftedDivisor))
+        {
+            n.Subtract(shiftedDivisor);
+            q |= std::uint64_t{1} << bit;
+        }
+    }
+    sticky = sticky or not n.IsZero();
+    return AssembleFloating<T>(number.negative, q, -shift, sticky);
+}
+
+// The powers of ten that a double holds exactly
+inline constexpr double ExactPowersOfTen[]{1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                           1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// Parses all of text as ParseFloatingText does, with std::from_chars, whose Eisel-Lemire algorithm needs no heap, and
+// whose grammar is the same, except that it rejects a leading '+', and accepts chars in parentheses after a nan, and
+// leaves its value unchanged, rather than making it infinity or zero, when the number is out of range
+template <typename T>
+[[nodiscard]] bool FloatingFromChars(const Text& text, T& result) noexcept
+{
+    const auto plus{(0 < text.count) and ('+' == text.chars[0])};
+    const auto first{text.chars + (plus ? 1 : 0)};
+    const auto last{text.chars + text.count};
+    if (plus and (first < last) and ('-' == *first))
+        return false;
+    auto value{T{}};
+    const auto [end, error]{std::from_chars(first, last, value)};
+    if ((std::errc::invalid_argument == error) or (end != last) or ((value != value) and (')' == *(last - 1))))
+        return false;
+    if (std::errc::result_out_of_range == error)
+    {
+        auto number{DecimalNumber{}};
+        static_cast<void>(ParseDecimalText(text, number));
+        value = ((number.exponent + DecimalDigitCount(number.digits)) > 0) ? std::numeric_limits<T>::infinity() : T{0};
+        value = number.negative ? -value : value;
+    }
+    result = value;
+    return true;
+}
+
+// Parses all of text as a decimal number, or as inf, infinity, or nan, ignoring case, into result, and returns false,
+// leaving result unchanged, if it is not one.  At run time std::from_chars parses it, and during constant evaluation,
+// where std::from_chars is not constexpr, a number whose digits and power of ten are both exact in T is converted by
+// one correctly rounded multiplication or division, as Clinger showed, and any other number by exact big integer
+// arithmetic, so both round to the nearest T
+template <typename T>
+[[nodiscard]] constexpr bool ParseFloatingText(const Text& text, T& result) noexcept
+{
+    constexpr auto maximumExactDigits{std::uint64_t{1} << std::numeric_limits<T>::digits};
+    constexpr int maximumExactExponent{std::same_as<T, float> ? 10 : 22};
+    if (not std::is_constant_evaluated())
+        return FloatingFromChars(text, result);
+    auto number{DecimalNumber{}};
+    if (not ParseDecimalText(text, number))
+    {
+        const auto signCount{((0 < text.count) and (('-' == text.chars[0]) or ('+' == text.chars[0]))) ? 1u : 0u};
+        const auto negative{(1 == signCount) and ('-' == text.chars[0])};
+        if (IsNameOfText(text, signCount, "inf") or IsNameOfText(text, signCount, "infinity"))
+            result = negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+        else if (IsNameOfText(text, signCount, "nan"))
+            result = negative ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+        else
+            return false;
+        return true;
+    }
+    if ((not number.truncated) and (number.digits <= maximumExactDigits) and
+        (-maximumExactExponent <= number.exponent) and (number.exponent <= maximumExactExponent))
+    {
+        const auto digits{static_cast<T>(number.digits)};
+        const auto power{static_cast<T>(ExactPowersOfTen[(number.exponent < 0) ? -number.exponent : number.exponent])};
+        const auto value{(number.exponent < 0) ? (digits / power) : (digits * power)};
+        result = number.negative ? -value : value;
+        return true;
+    }
+    result = DecimalToFloatingExactly<T>(number, text);
+    return true;
+}
+
+// Parses all of text as a T, an integer or a floating point number, into result, and returns false, leaving result
+// unchanged, if text is not a T
+template <typename T>
+[[nodiscard]] constexpr bool ParseNumberText(const Text& text, T& result) noexcept
+{
+    if constexpr (IsNumberInteger<T>)
+        return ParseIntegerText(text, result);
+    else
+        return ParseFloatingText(text, result);
+}
+
+// Writes the exact decimal digits of value, a finite T greater than zero, most significant first, to chars, sets
+// count to how many there are, and returns the power of ten that they are multiplied by
+template <typename T>
+constexpr int ExactDecimal(const T value, char (&chars)[800], SizeType& count) noexcept
+{
+    using Bits = std::conditional_t<std::same_as<T, float>, std::uint32_t, std::uint64_t>;
+    constexpr int digits{std::numeric_limits<T>::digits};
+    constexpr int minimumExponent{std::numeric_limits<T>::min_exponent - digits};
+    constexpr auto hidden{std::uint64_t{1} << (digits - 1)};
+    const auto bits{static_cast<std::uint64_t>(std::bit_cast<Bits>(value))};
+    const auto biased{static_cast<int>(bits >> (digits - 1))};
+    const auto m{(0 == biased) ? (bits & (hidden - 1)) : ((bits & (hidden - 1)) | hidden)};
+    const auto e{((0 == biased) ? 1 : biased) - 1 + minimumExponent};
+
+    // m * 2^e is m * 2^e * 10^0, or m * 5^-e * 10^e
+    auto n{BigInteger{m}};
+    if (e >= 0)
+        n.ShiftLeft(static_cast<SizeType>(e));
+    else
+        n.MultiplyByPower(5, static_cast<SizeType>(-e), 13);
+    count = 0;
+    while (not n.IsZero())
+    {
+        auto chunk{n.DivideBy(1000000000u)};
+        for (auto i{0}; (i < 9) and ((0 != chunk) or not n.IsZero()); ++i, chunk /= 10)
+            chars[count++] = static_cast<char>('0' + (chunk % 10));
+    }
+    for (SizeType i{0}; i < (count / 2); ++i)
+    {
+        const auto c{chars[i]};
+        chars[i] = chars[count - 1 - i];
+        chars[count - 1 - i] = c;
+    }
+    return (e >= 0) ? 0 : e;
+}
+
+// Returns the shortest decimal number that parses back to value, a finite T greater than zero, and the nearest to
+// value of those, rounding an exact tie to even digits, which are the digits that Ryu, and so std::to_chars, return
+template <typename T>
+[[nodiscard]] constexpr DecimalNumber ShortestDecimal(const T value) noexcept
+{
+    // #lizard forgives -- The length and complexity of this function is acceptable
+
+    char chars[800]{};
+    SizeType count{0};
+    const auto exponent{ExactDecimal(value, chars, count)};
+    for (SizeType precision{1};; ++precision)
+    {
+        std::uint64_t down{0};
+        for (SizeType i{0}; i < MinArgument(precision, count); ++i)
+            down = (down * 10) + static_cast<std::uint64_t>(chars[i] - '0');
+        if (precision >= count)
+        {
+            // every digit is needed, so value is exact
+            auto result{DecimalNumber{down, exponent, false, false}};
+            for (; (0 != result.digits) and (0 == (result.digits % 10)); result.digits /= 10)
+                ++result.exponent;
+            return result;
+        }
+        const auto downExponent{exponent + static_cast<int>(count - precision)};
+        auto firstRest{chars[precision]};
+        auto restIsZero{true};
+        for (auto i{precision + 1}; (restIsZero and (i < count)); ++i)
+            restIsZero = ('0' == chars[i]);
+        const auto roundUp{(firstRest > '5') or (('5' == firstRest) and ((not restIsZero) or (0 != (down % 2))))};
+        const auto nearest{roundUp ? (down + 1) : down};
+        const auto other{roundUp ? down : (down + 1)};
+        for (const auto candidate : {nearest, other})
+        {
+            if ((0 != candidate) and
+                (value == DecimalToFloatingExactly<T>(DecimalNumber{candidate, downExponent, false, false}, Text{})))
+            {
+                auto result{DecimalNumber{candidate, downExponent, false, false}};
+                for (; 0 == (result.digits % 10); result.digits /= 10)
+                    ++result.exponent;
+                return result;
+            }
+        }
+    }
+}
+
+// Returns the shortest chars that parse back to t, in the fixed or scientific notation that has fewer chars, fixed on
+// a tie, or inf, or nan, after a '-' if t is negative, as std::to_chars does; it is called at run time, and during
+// constant evaluation, where std::to_chars is not constexpr, it converts the exact value of t to decimal digits and
+// tries each count of digits until one parses back to t
+template <typename T>
+[[nodiscard]] constexpr auto FloatingString(const T t) noexcept
+{
+    // #lizard forgives -- The length and complexity of this function is acceptable
+
+    constexpr SizeType maximumCount{std::numeric_limits<T>::max_digits10 + 7}; // sign, point, e, sign, 3 digits
+    char chars[maximumCount + 1]{};
+    if (not std::is_constant_evaluated())
+    {
+        static_cast<void>(std::to_chars(chars, chars + maximumCount, t));
+        return String<maximumCount>{chars};
+    }
+    using Bits = std::conditional_t<std::same_as<T, float>, std::uint32_t, std::uint64_t>;
+    SizeType count{0};
+    if (0 != (std::bit_cast<Bits>(t) >> (sizeof(Bits) * 8 - 1)))
+        chars[count++] = '-';
+    const auto Append = [&](const char* text) {
+        for (SizeType i{0}; '\0' != text[i]; ++i)
+            chars[count++] = text[i];
+    };
+    if (t != t)
+    {
+        Append("nan");
+    }
+    else if ((t == std::numeric_limits<T>::infinity()) or (t == -std::numeric_limits<T>::infinity()))
+    {
+        Append("inf");
+    }
+    else if (T{0} == t)
+    {
+        Append("0");
+    }
+    else
+    {
+        const auto number{ShortestDecimal((t < 0) ? -t : t)};
+        const auto digits{IntegerString(number.digits)};
+        const auto digitCount{static_cast<int>(digits.Count())};
+        const auto scientificExponent{number.exponent + digitCount - 1};
+        const auto absoluteExponent{(scientificExponent < 0) ? -scientificExponent : scientificExponent};
+        const auto scientificCount{digitCount + ((digitCount > 1) ? 1 : 0) + 2 + ((absoluteExponent >= 100) ? 3 : 2)};
+        const auto fixedCount{(scientificExponent < 0)
+                                  ? (digitCount + 1 - scientificExponent)
+                                  : ((scientificExponent >= digitCount) ? (scientificExponent + 1) : (digitCount + 1))};
+        if (fixedCount <= scientificCount)
+        {
+            if (scientificExponent < 0)
+            {
+                // 0.0...0 and the digits
+                Append("0.");
+                for (auto i{1}; i < -scientificExponent; ++i)
+                    chars[count++] = '0';
+                Append(digits.Data());
+            }
+            else if (scientificExponent >= (digitCount - 1))
+            {
+                // an integer, whose exact digits std::to_chars writes, like printf, rather than the shortest digits
+                // and zeros
+                char exactChars[800]{};
+                SizeType exactCount{0};
+                static_cast<void>(ExactDecimal((t < 0) ? -t : t, exactChars, exactCount));
+                for (auto i{0}; i <= scientificExponent; ++i)
+                    chars[count++] = exactChars[i];
+            }
+            else
+            {
+                for (auto i{0}; i < digitCount; ++i)
+                {
+                    if (i == (scientificExponent + 1))
+                        chars[count++] = '.';
+                    chars[count++] = digits[static_cast<SizeType>(i)];
+                }
+            }
+        }
+        else
+        {
+            chars[count++] = digits[0];
+            if (digitCount > 1)
+                chars[count++] = '.';
+            for (auto i{1}; i < digitCount; ++i)
+                chars[count++] = digits[static_cast<SizeType>(i)];
+            chars[count++] = 'e';
+            chars[count++] = (scientificExponent < 0) ? '-' : '+';
+            if (absoluteExponent >= 100)
+                chars[count++] = static_cast<char>('0' + (absoluteExponent / 100));
+            chars[count++] = static_cast<char>('0' + ((absoluteExponent / 10) % 10));
+            chars[count++] = static_cast<char>('0' + (absoluteExponent % 10));
+        }
+    }
+    return String<maximumCount>{chars};
+}
+
+} // namespace cljonic
+
+#endif // CLJONIC_CHARCONV_HPP
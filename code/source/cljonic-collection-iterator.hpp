@@ -1,26 +1,46 @@
 #ifndef CLJONIC_COLLECTION_ITERATOR_HPP
 #define CLJONIC_COLLECTION_ITERATOR_HPP
 
+#include <compare>
+#include <cstddef>
 #include "cljonic-collection-maximum-element-count.hpp"
 
 namespace cljonic
 {
 
+// A random access iterator over a collection that computes its elements, like Range and Repeat, rather than storing
+// them; collections that store their elements in a C array iterate with plain pointers instead.  The collection is
+// held by pointer, rather than by reference, so the iterator is default constructible and assignable, as the
+// std::random_access_iterator concept requires.  It declares no iterator tag, because <iterator> uses the heap, so
+// the standard library deduces that it is a random access iterator from its operations.
 template <typename T>
 class CollectionIterator
 {
-    const T& m_collection;
+    const T* m_collection;
     SizeType m_index;
 
   public:
+    using value_type = typename T::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type;
+
+    constexpr CollectionIterator() noexcept : m_collection(nullptr), m_index(0)
+    {
+    }
+
     constexpr CollectionIterator(const T& collection, const SizeType index) noexcept
-        : m_collection(collection), m_index(index)
+        : m_collection(&collection), m_index(index)
+    {
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept
     {
+        return (*m_collection)[m_index];
     }
 
-    [[nodiscard]] constexpr auto operator*() const noexcept -> decltype(m_collection[m_index])
+    [[nodiscard]] constexpr reference operator[](const difference_type n) const noexcept
     {
-        return m_collection[m_index];
+        return (*m_collection)[static_cast<SizeType>(static_cast<difference_type>(m_index) + n)];
     }
 
     constexpr CollectionIterator& operator++() noexcept
@@ -29,23 +49,71 @@ class CollectionIterator
         return *this;
     }
 
-    [[nodiscard]] constexpr bool operator!=(const CollectionIterator& other) const noexcept
+    constexpr CollectionIterator operator++(int) noexcept
     {
-        return m_index != other.m_index;
+        CollectionIterator temp = *this;
+        ++m_index;
+        return temp;
     }
 
-    constexpr CollectionIterator& operator+=(int value) noexcept
+    constexpr CollectionIterator& operator--() noexcept
     {
-        m_index += value;
+        --m_index;
         return *this;
     }
 
-    [[nodiscard]] constexpr CollectionIterator operator+(int value) const noexcept
+    constexpr CollectionIterator operator--(int) noexcept
     {
         CollectionIterator temp = *this;
-        temp += value;
+        --m_index;
         return temp;
     }
+
+    constexpr CollectionIterator& operator+=(const difference_type n) noexcept
+    {
+        m_index = static_cast<SizeType>(static_cast<difference_type>(m_index) + n);
+        return *this;
+    }
+
+    constexpr CollectionIterator& operator-=(const difference_type n) noexcept
+    {
+        return *this += -n;
+    }
+
+    [[nodiscard]] constexpr CollectionIterator operator+(const difference_type n) const noexcept
+    {
+        CollectionIterator temp = *this;
+        temp += n;
+        return temp;
+    }
+
+    [[nodiscard]] friend constexpr CollectionIterator operator+(const difference_type n,
+                                                                const CollectionIterator& it) noexcept
+    {
+        return it + n;
+    }
+
+    [[nodiscard]] constexpr CollectionIterator operator-(const difference_type n) const noexcept
+    {
+        CollectionIterator temp = *this;
+        temp -= n;
+        return temp;
+    }
+
+    [[nodiscard]] constexpr difference_type operator-(const CollectionIterator& other) const noexcept
+    {
+        return static_cast<difference_type>(m_index) - static_cast<difference_type>(other.m_index);
+    }
+
+    [[nodiscard]] constexpr bool operator==(const CollectionIterator& other) const noexcept
+    {
+        return m_index == other.m_index;
+    }
+
+    [[nodiscard]] constexpr std::strong_ordering operator<=>(const CollectionIterator& other) const noexcept
+    {
+        return m_index <=> other.m_index;
+    }
 }; // CollectionIterator
 
 } // namespace cljonic
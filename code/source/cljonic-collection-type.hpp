@@ -8,11 +8,13 @@ enum class CljonicCollectionType
 {
     Array,
     Cycle,
+    HashMap,
     Iterator,
     Range,
     Repeat,
     Set,
-    String
+    String,
+    View
 };
 
 } // namespace cljonic
@@ -4,6 +4,7 @@
 #include <concepts>
 #include <limits>
 #include <type_traits>
+#include "cljonic-collection-maximum-element-count.hpp"
 #include "cljonic-collection-type.hpp"
 
 namespace cljonic
@@ -27,6 +28,23 @@ concept IsCljonicArray = std::same_as<typename T::cljonic_collection_type,
 template <typename T>
 concept IsCljonicCollection = requires { typename T::cljonic_collection_type; };
 
+template <typename T>
+concept IsCljonicCycle = std::same_as<typename T::cljonic_collection_type,
+                                      std::integral_constant<CljonicCollectionType, CljonicCollectionType::Cycle>>;
+
+// The element access shared by the cljonic collection types, which the Core functions resolve at compile time
+template <typename T>
+concept IsCljonicIndexable =
+    requires(const T& t, const SizeType index, const typename T::value_type& element) {
+        { t.Count() } -> std::convertible_to<SizeType>;
+        { t[index] } -> std::convertible_to<typename T::value_type>;
+        { t.ElementAtIndexIsEqualToElement(index, element) } -> std::convertible_to<bool>;
+    };
+
+template <typename T>
+concept IsCljonicHashMap = std::same_as<typename T::cljonic_collection_type,
+                                        std::integral_constant<CljonicCollectionType, CljonicCollectionType::HashMap>>;
+
 template <typename T>
 concept IsCljonicIterator =
     std::same_as<typename T::cljonic_collection_type,
@@ -45,7 +63,17 @@ concept IsCljonicSet = std::same_as<typename T::cljonic_collection_type,
                                     std::integral_constant<CljonicCollectionType, CljonicCollectionType::Set>>;
 
 template <typename T>
-concept IsCljonicArrayRangeOrRepeat = IsCljonicArray<T> or IsCljonicRange<T> or IsCljonicRepeat<T>;
+concept IsCljonicSortedSet = IsCljonicSet<T> and requires { typename T::cljonic_sorted_set; };
+
+// A FilterView, MapView, SliceView, or SpanView, which refers to, or computes, the elements of another collection
+template <typename T>
+concept IsCljonicView = std::same_as<typename T::cljonic_collection_type,
+                                     std::integral_constant<CljonicCollectionType, CljonicCollectionType::View>>;
+
+// The collections whose elements are compared in order, so any two of them are equal when their elements are
+template <typename T>
+concept IsCljonicArrayRangeRepeatOrView =
+    IsCljonicArray<T> or IsCljonicRange<T> or IsCljonicRepeat<T> or IsCljonicView<T>;
 
 template <typename T>
 concept IsConvertibleToIntegral = std::convertible_to<T, char>     //
@@ -56,6 +84,9 @@ concept IsConvertibleToIntegral = std::convertible_to<T, char>     //
 template <typename T>
 concept IsCString = std::same_as<std::decay_t<T>, char*> or std::same_as<std::decay_t<T>, const char*>;
 
+template <typename T>
+concept IsHashable = std::integral<T> or std::is_enum_v<T> or IsCString<T>;
+
 template <typename T>
 concept IsNotCljonicCollection = not IsCljonicCollection<T>;
 
@@ -70,7 +101,8 @@ concept IsUnaryPredicate = requires(P p, T t) {
 };
 
 template <typename T, typename... Ts>
-concept AllCljonicArrayRangeOrRepeat = (IsCljonicArrayRangeOrRepeat<T> and ... and IsCljonicArrayRangeOrRepeat<Ts>);
+concept AllCljonicArrayRangeRepeatOrView =
+    (IsCljonicArrayRangeRepeatOrView<T> and ... and IsCljonicArrayRangeRepeatOrView<Ts>);
 
 template <typename T, typename... Ts>
 concept AllCljonicCollections = (IsCljonicCollection<T> and ... and IsCljonicCollection<Ts>);
@@ -0,0 +1,64 @@
+#ifndef CLJONIC_CORE_ASSOC_HPP
+#define CLJONIC_CORE_ASSOC_HPP
+
+#include "cljonic-concepts.hpp"
+#include "cljonic-hashmap.hpp"
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_Assoc
+* The \b Assoc function returns a copy of its first parameter, which must be a \b cljonic \b HashMap, in which its
+* second parameter, the key, maps to its third parameter, the value.  If the key is already in the \b HashMap its value
+* is replaced, otherwise the key and value are added as a new entry, unless the \b HashMap is full, in which case the
+* result is an unchanged copy of the first parameter.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto m{HashMap<int, int, 3>{std::pair{1, 11}, std::pair{2, 22}}};
+    constexpr auto m0{Assoc(m, 3, 33)};  // immutable, full HashMap, with 1 -> 11, 2 -> 22, and 3 -> 33
+    constexpr auto m1{Assoc(m, 1, 99)};  // immutable, sparse HashMap, with 1 -> 99, and 2 -> 22
+    constexpr auto m2{Assoc(m0, 4, 44)}; // immutable, full HashMap, with 1 -> 11, 2 -> 22, and 3 -> 33
+
+    // Compiler Error: Assoc's first parameter must be a cljonic HashMap
+    // constexpr auto m{Assoc(Array{1, 2, 3}, 1, 2)};
+
+    // Compiler Error: Assoc's second parameter must be convertible to the HashMap key type
+    // constexpr auto m{Assoc(HashMap<int, int, 3>{}, "one", 1)};
+
+    // Compiler Error: Assoc's third parameter must be convertible to the HashMap value type
+    // constexpr auto m{Assoc(HashMap<int, int, 3>{}, 1, "one")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C, typename K, typename V>
+[[nodiscard]] constexpr auto Assoc(const C& c, const K& k, const V& v) noexcept
+{
+    static_assert(IsCljonicHashMap<C>, "Assoc's first parameter must be a cljonic HashMap");
+
+    static_assert(std::convertible_to<K, typename C::key_type>,
+                  "Assoc's second parameter must be convertible to the HashMap key type");
+
+    static_assert(std::convertible_to<V, typename C::mapped_type>,
+                  "Assoc's third parameter must be convertible to the HashMap value type");
+
+    auto result{c};
+    MAssoc(result, static_cast<typename C::key_type>(k), static_cast<typename C::mapped_type>(v));
+    return result;
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_ASSOC_HPP
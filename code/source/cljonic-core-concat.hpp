@@ -1,6 +1,7 @@
 #ifndef CLJONIC_CORE_CONCAT_HPP
 #define CLJONIC_CORE_CONCAT_HPP
 
+#include <concepts>
 #include "cljonic-array.hpp"
 #include "cljonic-concepts.hpp"
 #include "cljonic-shared.hpp"
@@ -53,10 +54,13 @@ template <typename C, typename... Cs>
 
     constexpr auto count{SumOfCljonicCollectionMaximumCounts<C, Cs...>()};
     auto result{Array<ResultType, count>{}};
-    const auto MConjCollectionOntoResult = [&](const auto& c)
+    const auto MConjCollectionOntoResult = [&]<typename D>(const D& c)
     {
-        for (SizeType i{0}; i < c.Count(); ++i)
-            MConj(result, static_cast<ResultType>(c[i]));
+        if constexpr (IsContiguousCollection<D> and std::same_as<typename D::value_type, ResultType>)
+            MConjElements(result, c.begin(), c.Count());
+        else // by reference, so an element that is already a ResultType is not copied twice
+            for (const auto& element : c)
+                MConj(result, static_cast<const ResultType&>(element));
     };
     (MConjCollectionOntoResult(c), ..., MConjCollectionOntoResult(cs));
     return result;
@@ -62,8 +62,11 @@ template <typename C, typename... Es>
     constexpr auto count{C::MaximumCount() + sizeof...(Es)};
     auto result{Array<ResultType, count>{}};
     const auto MConjElementOntoResult = [&](const auto& e) { MConj(result, e); };
-    for (SizeType i{0}; i < c.Count(); ++i)
-        MConjElementOntoResult(c[i]);
+    if constexpr (IsContiguousCollection<C>)
+        MConjElements(result, c.begin(), c.Count());
+    else
+        for (const auto& element : c)
+            MConjElementOntoResult(element);
     (MConjElementOntoResult(es), ...);
     return result;
 }
@@ -15,7 +15,10 @@ namespace core
  * The \b CycleCollection type implements as a \b lazy \b sequence composed of the values returned from a function of
  * one parameter that is an index into an ordered collection of a specified length.  The \b CycleCollection type cycles
  * through the ordered collection over and over again repeatedly providing the elements of the ordered collection. Many
- * \ref Namespace_Core "Core" functions accept CycleCollection arguments.
+ * \ref Namespace_Core "Core" functions accept CycleCollection arguments.  Indexing a CycleCollection divides the
+ * index by the count of the ordered collection, but its iterator keeps the index into the ordered collection too, and
+ * wraps it around to the first element with a comparison, so the functions that traverse a CycleCollection in order
+ * do not divide for each element.
  */
 template <typename C>
 class CycleCollection
@@ -33,21 +36,24 @@ class CycleCollection
     {
         const CycleCollection& m_cycle;
         SizeType m_index;
+        SizeType m_elementIndex; // m_index modulo the count of the cycled collection
 
       public:
         constexpr CycleIterator(const CycleCollection& cycle, const SizeType index) noexcept
-            : m_cycle(cycle), m_index(index)
+            : m_cycle(cycle), m_index(index), m_elementIndex(cycle.IndexToElementIndex(index))
         {
         }
 
         [[nodiscard]] constexpr auto operator*() const noexcept -> decltype(m_cycle[m_index])
         {
-            return m_cycle[m_cycle.IndexToElementIndex(m_index)];
+            return m_cycle.m_collection[m_elementIndex];
         }
 
         constexpr CycleIterator& operator++() noexcept
         {
             ++m_index;
+            if (++m_elementIndex == m_cycle.m_collection.Count())
+                m_elementIndex = 0;
             return *this;
         }
 
@@ -59,6 +65,7 @@ class CycleCollection
         constexpr CycleIterator& operator+=(const int value) noexcept
         {
             m_index += value;
+            m_elementIndex = m_cycle.IndexToElementIndex(m_index);
             return *this;
         }
 
@@ -72,6 +79,7 @@ class CycleCollection
 
   public:
     using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Cycle>;
+    using collection_type = C;
     using size_type = SizeType;
     using value_type = ElementType;
 
@@ -93,7 +101,7 @@ class CycleCollection
 
     [[nodiscard]] constexpr CycleIterator end() const noexcept
     {
-        return CycleIterator(*this, MaximumCount());
+        return CycleIterator(*this, Count());
     }
 
     [[nodiscard]] constexpr ElementType operator[](const SizeType index) const noexcept
@@ -103,7 +111,12 @@ class CycleCollection
 
     [[nodiscard]] constexpr SizeType Count() const noexcept
     {
-        return MaximumCount();
+        return (0 == m_collection.Count()) ? 0 : CljonicCollectionMaximumElementCount;
+    }
+
+    [[nodiscard]] constexpr const C& Collection() const noexcept
+    {
+        return m_collection;
     }
 
     [[nodiscard]] constexpr const ElementType& DefaultElement() const noexcept
@@ -111,9 +124,9 @@ class CycleCollection
         return m_collection.DefaultElement();
     }
 
-    [[nodiscard]] constexpr SizeType MaximumCount() const noexcept
+    [[nodiscard]] static consteval SizeType MaximumCount() noexcept
     {
-        return (0 == m_collection.Count()) ? 0 : CljonicCollectionMaximumElementCount;
+        return (0 == C::MaximumCount()) ? 0 : CljonicCollectionMaximumElementCount;
     }
 }; // class CycleCollection
 
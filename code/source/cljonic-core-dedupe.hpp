@@ -11,7 +11,8 @@ namespace core
 
 /** \anchor Core_Dedupe
 * The \b Dedupe function returns a \b cljonic \b Array of elements from a \b cljonic \b collection such that consecutive
-* duplicates are removed.
+* duplicates are removed.  The elements of a \ref Repeat "Repeat" are all duplicates, so its first element is returned
+* without comparing any elements.
 ~~~~~{.cpp}
 #include "cljonic.hpp"
 
@@ -61,7 +62,17 @@ template <typename C>
                   "Dedupe should not compare cljonic floating point collection value types for equality. Consider "
                   "using DedupeBy to override this default.");
 
-    return DedupeBy([](const auto& a, const auto& b) { return AreEqual(a, b); }, c);
+    if constexpr (IsCljonicRepeat<C>)
+    {
+        auto result{Array<typename C::value_type, C::MaximumCount()>{}};
+        if (c.Count() > 0)
+            MConj(result, c.At(0));
+        return result;
+    }
+    else
+    {
+        return DedupeBy([](const auto& a, const auto& b) { return AreEqual(a, b); }, c);
+    }
 }
 
 } // namespace core
@@ -1,6 +1,11 @@
 #ifndef CLJONIC_CORE_DEDUPEBY_HPP
 #define CLJONIC_CORE_DEDUPEBY_HPP
 
+#include <type_traits>
+#include "cljonic-array.hpp"
+#include "cljonic-concepts.hpp"
+#include "cljonic-shared.hpp"
+
 namespace cljonic
 {
 
@@ -76,7 +81,7 @@ template <typename F, typename C>
     auto result{Array<ValueType, c.MaximumCount()>{}};
     for (SizeType i{0}; i < c.Count();)
     {
-        MConj(result, c[i]);
+        MConj(result, ElementAt(c, i));
         i = IndexOfNextElementNotEqualToCurrentElement(f, c, i);
     }
     return result;
@@ -0,0 +1,62 @@
+#ifndef CLJONIC_CORE_DEDUPET_HPP
+#define CLJONIC_CORE_DEDUPET_HPP
+
+#include <concepts>
+#include "cljonic-shared.hpp"
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_DedupeT
+* The \b DedupeT function returns a \b transducer, for use with \ref Core_Transduce "Transduce" and
+* \ref Core_Into "Into", that passes on each element that is not equal to the element before it, so consecutive
+* duplicates are removed.  The transducer remembers the previous element, so the type of the elements it receives must
+* be given as the template parameter of \b DedupeT.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto Add = [](const int a, const int b) { return a + b; };
+
+    constexpr auto t0{Transduce(DedupeT<int>(), Add, 0, Array{1, 1, 2, 2, 1})};       // 4
+    constexpr auto t1{Into(Array<char, 10>{}, DedupeT<char>(), String{"Hello"})};     // immutable, 'H', 'e', 'l', 'o'
+    constexpr auto t2{Into(Array<const char*, 10>{}, DedupeT<const char*>(), Array{"a", "a", "b"})}; // "a" and "b"
+
+    // Compiler Error:
+    //     DedupeT should not compare floating point values for equality
+    // constexpr auto t{DedupeT<double>()};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename T>
+[[nodiscard]] constexpr auto DedupeT() noexcept
+{
+    static_assert(not std::floating_point<T>, "DedupeT should not compare floating point values for equality");
+
+    return [](auto step)
+    {
+        return [step, previous = T{}, hasPrevious = false](auto& accumulator, const T& element) mutable
+        {
+            if (hasPrevious and AreEqual(previous, element))
+                return true;
+            previous = element;
+            hasPrevious = true;
+            return step(accumulator, element);
+        };
+    };
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_DEDUPET_HPP
@@ -0,0 +1,56 @@
+#ifndef CLJONIC_CORE_DISSOC_HPP
+#define CLJONIC_CORE_DISSOC_HPP
+
+#include "cljonic-concepts.hpp"
+#include "cljonic-hashmap.hpp"
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_Dissoc
+* The \b Dissoc function returns a copy of its first parameter, which must be a \b cljonic \b HashMap, without the
+* entry whose key is its second parameter.  If the key is not in the \b HashMap the result is an unchanged copy of the
+* first parameter.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto m{HashMap{std::pair{1, 11}, std::pair{2, 22}}};
+    constexpr auto m0{Dissoc(m, 1)}; // immutable, sparse HashMap, with 2 -> 22
+    constexpr auto m1{Dissoc(m, 3)}; // immutable, full HashMap, with 1 -> 11, and 2 -> 22
+
+    // Compiler Error: Dissoc's first parameter must be a cljonic HashMap
+    // constexpr auto m{Dissoc(Array{1, 2, 3}, 1)};
+
+    // Compiler Error: Dissoc's second parameter must be convertible to the HashMap key type
+    // constexpr auto m{Dissoc(HashMap<int, int, 3>{}, "one")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C, typename K>
+[[nodiscard]] constexpr auto Dissoc(const C& c, const K& k) noexcept
+{
+    static_assert(IsCljonicHashMap<C>, "Dissoc's first parameter must be a cljonic HashMap");
+
+    static_assert(std::convertible_to<K, typename C::key_type>,
+                  "Dissoc's second parameter must be convertible to the HashMap key type");
+
+    auto result{c};
+    MDissoc(result, static_cast<typename C::key_type>(k));
+    return result;
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_DISSOC_HPP
@@ -1,7 +1,10 @@
 #ifndef CLJONIC_CORE_DROP_HPP
 #define CLJONIC_CORE_DROP_HPP
 
+#include <type_traits>
+#include <utility>
 #include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
 
 namespace cljonic
 {
@@ -45,11 +48,55 @@ template <typename C>
     static_assert(IsCljonicCollection<C>, "Drop's second parameter must be a cljonic collection");
 
     auto result{Array<typename C::value_type, c.MaximumCount()>{}};
-    for (SizeType i{count}; (i < c.Count()); ++i)
-        MConj(result, c[i]);
+    if constexpr (IsContiguousCollection<C>)
+    {
+        if (count < c.Count())
+            MConjElements(result, c.begin() + count, c.Count() - count);
+    }
+    else
+    {
+        for (SizeType i{count}; (i < c.Count()); ++i)
+            MConj(result, ElementAt(c, i));
+    }
     return result;
 }
 
+/** \anchor Core_DropView
+* The \b DropView function returns a \ref SliceView "SliceView" of the elements of its second parameter, which must be a
+* \b random \b access \b cljonic \b collection, such as an \b Array, a \b Range, or a \ref MapView "MapView" of one,
+* after the number of elements given by its first parameter, so it has the same elements as the \b Array returned by
+* \ref Core_Drop "Drop", but creating it takes constant time and memory, because <b>it does not copy them</b>.  The
+* \b SliceView refers to an \b lvalue second parameter, which must outlive it, and holds a copy of an \b rvalue second
+* parameter.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    const auto a{Array{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    const auto d5{DropView(5, a)};                   // SliceView of 5 to 9, referring to a
+    constexpr auto d7{DropView(7, Range<10>{})};     // SliceView of 7, 8, and 9
+    constexpr auto dStr{DropView(50, String{"Hi"})}; // empty SliceView
+
+    // Compiler Error: DropView's second parameter must be a cljonic collection
+    // constexpr auto d{DropView(10, "Hello")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C>
+[[nodiscard]] constexpr auto DropView(const SizeType count, C&& c) noexcept
+{
+    static_assert(IsCljonicCollection<std::remove_cvref_t<C>>,
+                  "DropView's second parameter must be a cljonic collection");
+
+    return SliceView<C>{std::forward<C>(c), count};
+}
+
 } // namespace core
 
 } // namespace cljonic
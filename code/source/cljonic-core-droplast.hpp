@@ -1,7 +1,10 @@
 #ifndef CLJONIC_CORE_DROPLAST_HPP
 #define CLJONIC_CORE_DROPLAST_HPP
 
+#include <type_traits>
+#include <utility>
 #include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
 
 namespace cljonic
 {
@@ -47,10 +50,46 @@ template <typename C>
     auto result{Array<typename C::value_type, c.MaximumCount()>{}};
     auto endIndex{(count > c.Count()) ? 0 : (c.Count() - count)};
     for (SizeType i{0}; (i < endIndex); ++i)
-        MConj(result, c[i]);
+        MConj(result, ElementAt(c, i));
     return result;
 }
 
+/** \anchor Core_DropLastView
+* The \b DropLastView function returns a \ref SliceView "SliceView" of the elements of its second parameter, which must
+* be a \b random \b access \b cljonic \b collection, such as an \b Array, a \b Range, or a \ref MapView "MapView" of
+* one, before its last elements, the number of which is given by its first parameter, so it has the same elements as the
+* \b Array returned by \ref Core_DropLast "DropLast", but creating it takes constant time and memory, because <b>it does
+* not copy them</b>.  The \b SliceView refers to an \b lvalue second parameter, which must outlive it, and holds a copy
+* of an \b rvalue second parameter.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    const auto a{Array{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    const auto d8{DropLastView(8, a)};               // SliceView of 0 and 1, referring to a
+    constexpr auto d7{DropLastView(7, Range<10>{})}; // SliceView of 0, 1, and 2
+
+    // Compiler Error: DropLastView's second parameter must be a cljonic collection
+    // constexpr auto d{DropLastView(10, "Hello")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C>
+[[nodiscard]] constexpr auto DropLastView(const SizeType count, C&& c) noexcept
+{
+    static_assert(IsCljonicCollection<std::remove_cvref_t<C>>,
+                  "DropLastView's second parameter must be a cljonic collection");
+
+    const auto end{(c.Count() > count) ? (c.Count() - count) : 0};
+    return SliceView<C>{std::forward<C>(c), 0, end};
+}
+
 } // namespace core
 
 } // namespace cljonic
@@ -79,8 +79,8 @@ template <typename T, typename... Ts>
                       "Equal should not compare cljonic floating point collection value types for equality. Consider "
                       "using EqualBy to override this default.");
 
-        static_assert(AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeOrRepeat<T, Ts...>,
-                      "Equal cljonic collection types are not all the same, or all Array, Range or Repeat types");
+        static_assert(AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeRepeatOrView<T, Ts...>,
+                      "Equal cljonic collection types are not all the same, or all Array, Range, Repeat or view types");
 
         return (AreEqual(t, ts) and ...);
     }
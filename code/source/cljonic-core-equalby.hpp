@@ -62,8 +62,9 @@ template <typename F, typename T, typename... Ts>
     }
     else if constexpr (AllCljonicCollections<T, Ts...>)
     {
-        static_assert(AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeOrRepeat<T, Ts...>,
-                      "EqualBy cljonic collection types are not all the same, or all Array, Range or Repeat types");
+        static_assert(AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeRepeatOrView<T, Ts...>,
+                      "EqualBy cljonic collection types are not all the same, or all Array, Range, Repeat or view "
+                      "types");
 
         static_assert(IsBinaryPredicateForAllCljonicCollections<std::decay_t<F>, T, Ts...>,
                       "EqualBy function is not a valid binary predicate for all cljonic collection value types");
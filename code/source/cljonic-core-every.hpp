@@ -57,10 +57,12 @@ template <typename F, typename C>
     static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
                   "Every's function is not a valid unary predicate for the collection value type");
 
-    auto result{true};
-    for (SizeType i{0}; (result and (i < c.Count())); ++i)
-        result = f(c[i]);
-    return result;
+    // the elements are iterated, rather than indexed, so an Iterator computes each one once, and no more of them are
+    // computed after the first one for which f is false
+    for (const auto& element : c)
+        if (not f(element))
+            return false;
+    return true;
 }
 
 } // namespace core
@@ -1,12 +1,45 @@
 #ifndef CLJONIC_CORE_FILTER_HPP
 #define CLJONIC_CORE_FILTER_HPP
 
+#include <type_traits>
 #include "cljonic-array.hpp"
 #include "cljonic-concepts.hpp"
+#include "cljonic-core-iseven.hpp"
+#include "cljonic-core-isodd.hpp"
+#include "cljonic-range.hpp"
 
 namespace cljonic
 {
 
+// Returns the Range of the even, or odd, elements of a Range, which its type determines; when the step of the Range
+// is even all its elements have the parity of the first, and when it is odd every other element has the same parity,
+// starting with the first or second element, so they are a Range from that element with twice the step
+template <typename R, bool even>
+[[nodiscard]] constexpr auto RangeOfParity() noexcept
+{
+    constexpr R r{};
+    constexpr auto count{r.Count()};
+    constexpr auto step{(count > 1) ? (r[1] - r[0]) : 0};
+    constexpr SizeType start{((0 == (r[0] % 2)) == even) ? 0 : 1}; // an empty Range reads its default, 0
+    if constexpr (start >= count)
+    {
+        return Range<0>{};
+    }
+    else if constexpr (0 == (step % 2))
+    {
+        if constexpr (0 == start)
+            return R{};
+        else
+            return Range<0>{};
+    }
+    else
+    {
+        constexpr auto first{r[start]};
+        constexpr auto last{r[start + (2 * ((count - start - 1) / 2))]};
+        return Range<first, ((step < 0) ? (last - 1) : (last + 1)), (2 * step)>{};
+    }
+}
+
 namespace core
 {
 
@@ -14,7 +47,9 @@ namespace core
 * The \b Filter function calls its first parameter, which must be a \b unary \b predicate, with each element of its
 * second parameter, which must be a \b cljonic \b collection, and if the result is true a copy of the element is
 * concatenated to the end of \b Filter's result, which is a \b cljonic \b Array with the same \b MaximumCount as the
-* second parameter.
+* second parameter.  The exception is the \ref Core_IsEven "IsEven" or \ref Core_IsOdd "IsOdd" elements of a
+* \ref Range "Range", which are themselves a \b Range, with twice the step, and so \b Filter returns that \b Range,
+* computed at compile time, without testing each element.
 ~~~~~{.cpp}
 #include "cljonic.hpp"
 
@@ -30,6 +65,7 @@ int main()
 
     constexpr auto rng{Range<10>{}};
     constexpr auto fRng{Filter(Even, rng)}; // immutable, sparse Array, with 0, 2, 4, 6, and 8
+    constexpr auto fOdd{Filter(IsOdd, rng)}; // Range with 1, 3, 5, 7, and 9
 
     constexpr auto rpt{Repeat<10, int>{1}};
     constexpr auto fRpt{Filter(Even, rpt)}; // immutable, empty Array
@@ -58,11 +94,20 @@ template <typename F, typename C>
     static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
                   "Filter's function is not a valid unary predicate for the collection value type");
 
-    auto result{Array<typename C::value_type, c.MaximumCount()>{}};
-    for (const auto& element : c)
-        if (f(element))
-            MConj(result, element);
-    return result;
+    using Predicate = std::decay_t<F>;
+    if constexpr (IsCljonicRange<C> and (std::is_same_v<Predicate, IsEvenPredicate> or
+                                         std::is_same_v<Predicate, IsOddPredicate>))
+    {
+        return RangeOfParity<C, std::is_same_v<Predicate, IsEvenPredicate>>();
+    }
+    else
+    {
+        auto result{Array<typename C::value_type, c.MaximumCount()>{}};
+        for (const auto& element : c)
+            if (f(element))
+                MConj(result, element);
+        return result;
+    }
 }
 
 } // namespace core
@@ -0,0 +1,48 @@
+#ifndef CLJONIC_CORE_FILTERT_HPP
+#define CLJONIC_CORE_FILTERT_HPP
+
+#include <utility>
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_FilterT
+* The \b FilterT function returns a \b transducer, for use with \ref Core_Transduce "Transduce" and
+* \ref Core_Into "Into", that passes on only the elements for which its parameter, which must be a \b unary
+* \b predicate, returns \b true.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto Add = [](const int a, const int b) { return a + b; };
+    constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+
+    constexpr auto t0{Transduce(FilterT(Even), Add, 0, Range<10>{})};       // 20
+    constexpr auto t1{Into(Array<int, 10>{}, FilterT(Even), Range<10>{})}; // immutable, sparse, 0, 2, 4, 6, and 8
+
+    return 0;
+}
+~~~~~
+*/
+template <typename F>
+[[nodiscard]] constexpr auto FilterT(F&& f) noexcept
+{
+    return [f = std::forward<F>(f)](auto step)
+    {
+        return [f, step](auto& accumulator, const auto& element) mutable
+        { return f(element) ? step(accumulator, element) : true; };
+    };
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_FILTERT_HPP
@@ -47,7 +47,11 @@ template <typename C>
 {
     static_assert(IsCljonicCollection<C>, "First's parameter must be a cljonic collection");
 
-    return coll[0];
+    // an Iterator has no index operator, but its first element is its initial value
+    if constexpr (IsCljonicIterator<C>)
+        return *coll.begin();
+    else
+        return coll[0];
 }
 
 } // namespace core
@@ -0,0 +1,165 @@
+#ifndef CLJONIC_CORE_FREEZE_HPP
+#define CLJONIC_CORE_FREEZE_HPP
+
+#include <concepts>
+#include <type_traits>
+#include "cljonic-collection-maximum-element-count.hpp"
+#include "cljonic-concepts.hpp"
+#include "cljonic-spanview.hpp"
+
+namespace cljonic
+{
+
+// The elements of a frozen collection, with no count or default element; a C array cannot be empty, so an empty
+// collection has one unused value initialized element
+template <typename T, SizeType N>
+struct FrozenElements
+{
+    T elements[(0 == N) ? 1 : N];
+};
+
+// The static constexpr elements of the collection returned by pipeline, which the compiler places in read-only memory,
+// like a const C array, rather than on the stack or in RAM initialized at startup
+template <auto pipeline>
+class FrozenCollection
+{
+    using T = typename std::remove_cvref_t<decltype(pipeline())>::value_type;
+
+    // the collection is created only during constant evaluation, rather than kept in a static member, which the
+    // compiler would place in memory, too, without optimization
+    static constexpr SizeType count{pipeline().Count()};
+
+    [[nodiscard]] static consteval FrozenElements<T, count> Elements() noexcept
+    {
+        auto result{FrozenElements<T, count>{}};
+        SizeType i{0};
+        for (const auto& element : pipeline())
+            result.elements[i++] = element;
+        return result;
+    }
+
+  public:
+    static constexpr FrozenElements<T, count> frozen{Elements()};
+
+    [[nodiscard]] static consteval SizeType Count() noexcept
+    {
+        return count;
+    }
+};
+
+// The static constexpr elements f(0), f(1), ..., f(N - 1), which the compiler places in read-only memory
+template <SizeType N, auto f>
+class FrozenTable
+{
+    using T = std::remove_cvref_t<decltype(f(SizeType{0}))>;
+
+    [[nodiscard]] static consteval FrozenElements<T, N> Elements() noexcept
+    {
+        auto result{FrozenElements<T, N>{}};
+        for (SizeType i{0}; i < N; ++i)
+            result.elements[i] = f(i);
+        return result;
+    }
+
+  public:
+    static constexpr FrozenElements<T, N> frozen{Elements()};
+};
+
+namespace core
+{
+
+/** \anchor Core_Freeze
+* The \b Freeze function evaluates its template parameter, which must be a function of no parameters, usually a
+* lambda, that returns a \b cljonic \b collection, at compile time, and returns a \ref SpanView "SpanView" of a
+* \b static \b constexpr copy of the elements of that collection.  The copy has exactly as many elements as the
+* collection, and no count or default element, and the compiler places it in read-only memory, like a \b const C
+* array, so a lookup table computed with the \ref Namespace_Core "Core" functions takes no RAM, and needs no
+* initialization at startup, where a \b constexpr \b Array local variable is copied to the stack each time its function
+* is called.  \ref Core_Equal "Equal" compares the \b SpanView, element by element, with an \b Array, and every
+* \b Freeze of the same function refers to the same copy.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+constexpr auto Square = [](const int i) { return i * i; };
+constexpr auto Even = [](const int i) { return 0 == (i % 2); };
+
+int main()
+{
+    constexpr auto squares{Freeze<[] { return Map(Square, Range<256>{}); }>()}; // 256 ints in read-only memory
+    constexpr auto evens{Freeze<[] { return Filter(Even, Range<10>{}); }>()};   // 0, 2, 4, 6, and 8
+    constexpr auto hello{Freeze<[] { return String{"Hello"}; }>()};             // 'H', 'e', 'l', 'l', and 'o'
+    constexpr auto sum{Reduce(Plus, evens)};                                    // 20
+    const auto i{IndexOf(squares, 144)};                                        // 12
+
+    // Compiler Error: Freeze's template parameter must be a function of no parameters that returns a cljonic
+    //                 collection
+    // constexpr auto f{Freeze<[] { return 1; }>()};
+
+    return 0;
+}
+~~~~~
+*/
+template <auto pipeline>
+[[nodiscard]] consteval auto Freeze() noexcept
+{
+    static_assert(IsCljonicCollection<std::remove_cvref_t<decltype(pipeline())>>,
+                  "Freeze's template parameter must be a function of no parameters that returns a cljonic collection");
+
+    using Frozen = FrozenCollection<pipeline>;
+    using T = std::remove_cvref_t<decltype(Frozen::frozen.elements[0])>;
+    return SpanView<T>{Frozen::frozen.elements, Frozen::Count()};
+}
+
+/** \anchor Core_ArrayOf
+* The \b ArrayOf function returns a \ref SpanView "SpanView" of the elements <b>f(0)</b>, <b>f(1)</b>, ...,
+* <b>f(N - 1)</b>, where \b N is its first template parameter, which must not be greater than
+* \b CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT, and \b f is its second template parameter, which must be a function,
+* usually a lambda, of an index.  The elements are computed at compile time, into a \b static \b constexpr table in
+* read-only memory, like the elements of a \ref Core_Freeze "Freeze".
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto crc{ArrayOf<256, [](const SizeType i)
+                               {
+                                   auto c{static_cast<std::uint32_t>(i)};
+                                   for (auto k{0}; k < 8; ++k)
+                                       c = (0 != (c & 1)) ? (0xedb88320u ^ (c >> 1)) : (c >> 1);
+                                   return c;
+                               }>()};                                             // the CRC-32 table
+    constexpr auto squares{ArrayOf<16, [](const SizeType i) { return i * i; }>()}; // 0, 1, 4, ..., 225
+
+    // Compiler Error: ArrayOf's second template parameter must be a function of an index
+    // constexpr auto a{ArrayOf<16, [](const char* s) { return s[0]; }>()};
+
+    return 0;
+}
+~~~~~
+*/
+template <SizeType N, auto f>
+[[nodiscard]] consteval auto ArrayOf() noexcept
+{
+    static_assert(N <= CljonicCollectionMaximumElementCount,
+                  "ArrayOf's first template parameter must not be greater than "
+                  "CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+
+    static_assert(std::invocable<decltype(f), SizeType>,
+                  "ArrayOf's second template parameter must be a function of an index");
+
+    using Frozen = FrozenTable<N, f>;
+    using T = std::remove_cvref_t<decltype(Frozen::frozen.elements[0])>;
+    return SpanView<T>{Frozen::frozen.elements, N};
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_FREEZE_HPP
@@ -1,6 +1,7 @@
-#ifndef CLJONIC_CORE_FILTER_HPP
-#define CLJONIC_CORE_FILTER_HPP
+#ifndef CLJONIC_CORE_INDEXOF_HPP
+#define CLJONIC_CORE_INDEXOF_HPP
 
+#include <type_traits>
 #include "cljonic-concepts.hpp"
 #include "cljonic-shared.hpp"
 
@@ -13,7 +14,11 @@ namespace core
 /** \anchor Core_IndexOf
 * The \b IndexOf function compares each element of its first parameter, which must be a \b cljonic \b collection, with
 * its second parameter, and if they are equal the index of the first parameter element is immediately returned. If none
-* of the first parameter elements are equal to the second parameter then \b CLJONIC_INVALID_INDEX is returned.
+* of the first parameter elements are equal to the second parameter then \b CLJONIC_INVALID_INDEX is returned.  When the
+* collection stores integer or enumeration elements contiguously, like an \b Array or a \b String, they are compared a
+* block at a time, which the compiler vectorizes, and \b char elements are found with \b memchr.  An integer is found
+* in a \ref Range "Range" in constant time, because its elements are an arithmetic progression, and so is any value in a
+* \ref Repeat "Repeat", because its elements are the same.
 ~~~~~{.cpp}
 #include "cljonic.hpp"
 
@@ -68,15 +73,35 @@ template <typename C, typename T>
     static_assert(std::convertible_to<T, typename C::value_type>,
                   "IndexOf's second parameter must be convertible to the collection value type");
 
-    auto result{CLJONIC_INVALID_INDEX};
-    for (SizeType i{0}; ((CLJONIC_INVALID_INDEX == result) and (i < c.Count())); ++i)
-        if (AreEqual(c[i], t))
-            result = i;
-    return result;
+    if constexpr (IsCljonicRange<C> and std::integral<T>)
+    {
+        return RangeIndexOf<false>(c, t);
+    }
+    else if constexpr (IsCljonicRepeat<C>)
+    {
+        return ((c.Count() > 0) and AreEqual(c.At(0), t)) ? 0 : CLJONIC_INVALID_INDEX;
+    }
+    else if constexpr (IsBulkSearchable<typename C::value_type, T> and std::is_pointer_v<decltype(c.begin())>)
+    {
+        return BulkIndexOf<false>(c.begin(), c.Count(), t);
+    }
+    else
+    {
+        // the elements are iterated, rather than indexed, so an Iterator computes each one once, and no more of them
+        // are computed after the first one that equals t
+        SizeType index{0};
+        for (const auto& element : c)
+        {
+            if (AreEqual(element, t))
+                return index;
+            ++index;
+        }
+        return CLJONIC_INVALID_INDEX;
+    }
 }
 
 } // namespace core
 
 } // namespace cljonic
 
-#endif // CLJONIC_CORE_FILTER_HPP
+#endif // CLJONIC_CORE_INDEXOF_HPP
@@ -1,5 +1,5 @@
-#ifndef CLJONIC_CORE_FILTER_HPP
-#define CLJONIC_CORE_FILTER_HPP
+#ifndef CLJONIC_CORE_INDEXOFBY_HPP
+#define CLJONIC_CORE_INDEXOFBY_HPP
 
 #include "cljonic-concepts.hpp"
 
@@ -66,7 +66,7 @@ template <typename F, typename C, typename T>
 
     auto result{CLJONIC_INVALID_INDEX};
     for (SizeType i{0}; ((CLJONIC_INVALID_INDEX == result) and (i < c.Count())); ++i)
-        if (f(c[i], t))
+        if (f(ElementAt(c, i), t))
             result = i;
     return result;
 }
@@ -75,4 +75,4 @@ template <typename F, typename C, typename T>
 
 } // namespace cljonic
 
-#endif // CLJONIC_CORE_FILTER_HPP
+#endif // CLJONIC_CORE_INDEXOFBY_HPP
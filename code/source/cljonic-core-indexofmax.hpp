@@ -0,0 +1,62 @@
+#ifndef CLJONIC_CORE_INDEXOFMAX_HPP
+#define CLJONIC_CORE_INDEXOFMAX_HPP
+
+#include "cljonic-concepts.hpp"
+#include "cljonic-shared.hpp"
+#include "cljonic-core-reducers.hpp"
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_IndexOfMax
+* The \b IndexOfMax function returns the index of the first maximum value in its only parameter, which must be a
+* \b cljonic \b collection, so it is the "argmax" of the collection, and \b Max(c) equals \b c[IndexOfMax(c)].  If
+* its parameter is empty then \b IndexOfMax returns the value \b CLJONIC_INVALID_INDEX.  The index is found in the same
+* pass that finds the maximum value: when the collection stores integer elements contiguously, like an \b Array, the
+* elements are scanned in vectorizable lanes, and a \b Range, whose maximum is its first or last element, or a
+* \b Repeat, whose elements are all the same, is not scanned at all.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto a{Array{11, 14, 13, 14}};
+    constexpr auto i0{IndexOfMax(a)};                           // 1
+    constexpr auto i1{IndexOfMax(Array<int, 10>{})};            // CLJONIC_INVALID_INDEX
+    constexpr auto i2{IndexOfMax(Range<100, 0, -10>{})};        // 0
+    constexpr auto i3{IndexOfMax(Range<10>{})};                 // 9
+    constexpr auto i4{IndexOfMax(Repeat<4, int>{11})};          // 0
+    constexpr auto i5{IndexOfMax(String{"adcb"})};              // 1
+    constexpr auto i6{IndexOfMax(Array{2.5, -1.0, 7.5, 7.5})};  // 2
+
+    // Compiler Error: IndexOfMax's parameter must be a cljonic collection
+    // constexpr auto i{IndexOfMax("Hello")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C>
+[[nodiscard]] constexpr SizeType IndexOfMax(const C& c) noexcept
+{
+    static_assert(IsCljonicCollection<C>, "IndexOfMax's parameter must be a cljonic collection");
+
+    if constexpr (IsCljonicRange<C>)
+        return (0 == c.Count()) ? CLJONIC_INVALID_INDEX : ((c[0] < c[c.Count() - 1]) ? (c.Count() - 1) : 0);
+    else if constexpr (IsCljonicRepeat<C>)
+        return (0 == c.Count()) ? CLJONIC_INVALID_INDEX : 0;
+    else
+        return IndexOfBest([](const auto& best, const auto& element) { return best < element; }, c);
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_INDEXOFMAX_HPP
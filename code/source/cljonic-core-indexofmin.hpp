@@ -0,0 +1,62 @@
+#ifndef CLJONIC_CORE_INDEXOFMIN_HPP
+#define CLJONIC_CORE_INDEXOFMIN_HPP
+
+#include "cljonic-concepts.hpp"
+#include "cljonic-shared.hpp"
+#include "cljonic-core-reducers.hpp"
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_IndexOfMin
+* The \b IndexOfMin function returns the index of the first minimum value in its only parameter, which must be a
+* \b cljonic \b collection, so it is the "argmin" of the collection, and \b Min(c) equals \b c[IndexOfMin(c)].  If
+* its parameter is empty then \b IndexOfMin returns the value \b CLJONIC_INVALID_INDEX.  The index is found in the same
+* pass that finds the minimum value: when the collection stores integer elements contiguously, like an \b Array, the
+* elements are scanned in vectorizable lanes, and a \b Range, whose minimum is its first or last element, or a
+* \b Repeat, whose elements are all the same, is not scanned at all.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto a{Array{14, 11, 13, 11}};
+    constexpr auto i0{IndexOfMin(a)};                           // 1
+    constexpr auto i1{IndexOfMin(Array<int, 10>{})};            // CLJONIC_INVALID_INDEX
+    constexpr auto i2{IndexOfMin(Range<100, 0, -10>{})};        // 9
+    constexpr auto i3{IndexOfMin(Range<10>{})};                 // 0
+    constexpr auto i4{IndexOfMin(Repeat<4, int>{11})};          // 0
+    constexpr auto i5{IndexOfMin(String{"dacb"})};              // 1
+    constexpr auto i6{IndexOfMin(Array{2.5, -1.0, 7.5, -1.0})}; // 1
+
+    // Compiler Error: IndexOfMin's parameter must be a cljonic collection
+    // constexpr auto i{IndexOfMin("Hello")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C>
+[[nodiscard]] constexpr SizeType IndexOfMin(const C& c) noexcept
+{
+    static_assert(IsCljonicCollection<C>, "IndexOfMin's parameter must be a cljonic collection");
+
+    if constexpr (IsCljonicRange<C>)
+        return (0 == c.Count()) ? CLJONIC_INVALID_INDEX : ((c[c.Count() - 1] < c[0]) ? (c.Count() - 1) : 0);
+    else if constexpr (IsCljonicRepeat<C>)
+        return (0 == c.Count()) ? CLJONIC_INVALID_INDEX : 0;
+    else
+        return IndexOfBest([](const auto& best, const auto& element) { return element < best; }, c);
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_INDEXOFMIN_HPP
@@ -63,7 +63,7 @@ template <typename C, typename... Cs>
     auto result{Array<FindCommonValueType<C, Cs...>, resultCount>{}};
     for (SizeType i{0}; i < minimumCollectionCount; ++i)
     {
-        MConj(result, c[i]);
+        MConj(result, ElementAt(c, i));
         (MConj(result, cs[i]), ...);
     }
     return result;
@@ -55,7 +55,7 @@ template <typename T, typename C>
     auto result{Array<ResultType, resultMaximumCount>{}};
     for (SizeType i{0}; i < collectionMaximumCount; ++i)
     {
-        MConj(result, c[i]);
+        MConj(result, ElementAt(c, i));
         MConj(result, interposeValue); // MConj will do nothing if the collection is full
     }
     return result;
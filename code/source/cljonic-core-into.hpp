@@ -0,0 +1,71 @@
+#ifndef CLJONIC_CORE_INTO_HPP
+#define CLJONIC_CORE_INTO_HPP
+
+#include "cljonic-array.hpp"
+#include "cljonic-concepts.hpp"
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_Into
+* The \b Into function returns a copy of its first parameter, which must be a \b cljonic \b Array, with the elements
+* of its third parameter, which must be a \b cljonic \b collection, transformed by its second parameter, which must be
+* a \b transducer (see \ref Core_Transduce "Transduce"), appended to it, in a single pass and without storing any
+* intermediate results.  Appending stops when the \b Array is full.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto Square = [](const int i) { return i * i; };
+    constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+
+    constexpr auto i0{Into(Array<int, 10>{}, Compose(FilterT(Even), MapT(Square)), Range<10>{})}; // 0, 4, 16, 36, 64
+    constexpr auto i1{Into(Array<int, 10>{1, 2}, MapT(Square), Array{3, 4})};    // immutable, sparse, 1, 2, 9, and 16
+    constexpr auto i2{Into(Array<int, 3>{}, MapT(Square), Range<1000>{})};        // immutable, full, 0, 1, and 4
+
+    // Compiler Error: Into's first parameter must be a cljonic Array
+    // constexpr auto i{Into(Set<int, 10>{}, MapT(Square), Range<10>{})};
+    // constexpr auto i{Into(SliceView{Array<int, 10>{}, 0, 5}, MapT(Square), Range<10>{})};
+
+    // Compiler Error: Into's third parameter must be a cljonic collection
+    // constexpr auto i{Into(Array<int, 10>{}, MapT(Square), 10)};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename A, typename XF, typename C>
+[[nodiscard]] constexpr auto Into(const A& a, XF&& xf, const C& c) noexcept
+{
+    static_assert(IsCljonicArray<A>, "Into's first parameter must be a cljonic Array");
+
+    static_assert(IsCljonicCollection<C>, "Into's third parameter must be a cljonic collection");
+
+    using ValueType = typename A::value_type;
+
+    auto result{a};
+    auto step{xf(
+        [](A& accumulator, const auto& element)
+        {
+            MConj(accumulator, static_cast<ValueType>(element));
+            return accumulator.Count() < accumulator.MaximumCount();
+        })};
+    if (result.Count() < result.MaximumCount())
+        for (const auto& element : c)
+            if (not step(result, element))
+                break;
+    return result;
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_INTO_HPP
@@ -1,7 +1,6 @@
 #ifndef CLJONIC_CORE_ISDISTINCT_HPP
 #define CLJONIC_CORE_ISDISTINCT_HPP
 
-#include <array>
 #include "cljonic-shared.hpp"
 
 namespace cljonic
@@ -51,7 +50,8 @@ int main()
     //                 Consider using IsDistinctBy to override this default.
     // constexpr auto b{IsDistinct(Array{1.1, 1.2}, a)};
 
-    // Compiler Error: IsDistinct cljonic collection types are not all the same, or all Array, Range or Repeat types
+    // Compiler Error: IsDistinct cljonic collection types are not all the same, or all Array, Range, Repeat or view
+    //                 types
     // constexpr auto b{IsDistinct(a, Set{2, 3, 4})};
 
     // Compiler Error: IsDistinct should not compare floating point types for equality. Consider using IsDistinctBy to
@@ -83,13 +83,20 @@ template <typename T, typename... Ts>
                           "equality. Consider using IsDistinctBy to override this default.");
 
             static_assert(
-                AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeOrRepeat<T, Ts...>,
-                "IsDistinct cljonic collection types are not all the same, or all Array, Range or Repeat types");
+                AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeRepeatOrView<T, Ts...>,
+                "IsDistinct cljonic collection types are not all the same, or all Array, Range, Repeat or view types");
 
-            constexpr auto IndexInterfacesEqual = [](const auto& t, const auto& u) noexcept
+            // each pair of collections is compared through their own types, so element access is resolved at compile
+            // time, and there is no need for a common base class
+            constexpr auto CollectionsEqual = [](const auto& t, const auto& u) noexcept
             {
-                if (&t == &u) // if t and u point to the same IndexInterface
+                if (static_cast<const void*>(&t) == static_cast<const void*>(&u)) // if t and u are the same object
                     return true;
+                if constexpr ((IsCljonicRange<std::remove_cvref_t<decltype(t)>> and
+                               IsCljonicRange<std::remove_cvref_t<decltype(u)>>) or
+                              (IsCljonicRepeat<std::remove_cvref_t<decltype(t)>> and
+                               IsCljonicRepeat<std::remove_cvref_t<decltype(u)>>))
+                    return AreEqual(t, u); // without visiting their elements
                 if (t.Count() != u.Count())
                     return false;
                 for (SizeType i{0}; i < t.Count(); ++i)
@@ -97,14 +104,7 @@ template <typename T, typename... Ts>
                         return false;
                 return true;
             };
-            using I = const IndexInterface<typename T::value_type>*;
-            constexpr auto n{sizeof...(Ts) + 1};
-            const auto i{std::array<I, n>{static_cast<I>(&t), static_cast<I>(&ts)...}};
-            for (SizeType j{0}; j < n; ++j)
-                for (SizeType k{j + 1}; k < n; ++k)
-                    if (IndexInterfacesEqual(*i[j], *i[k]))
-                        return false;
-            return true;
+            return (not CollectionsEqual(t, ts) and ...) and IsDistinct(ts...);
         }
         else
         {
@@ -1,7 +1,7 @@
 #ifndef CLJONIC_CORE_ISDISTINCTBY_HPP
 #define CLJONIC_CORE_ISDISTINCTBY_HPP
 
-#include <array>
+#include <utility>
 
 namespace cljonic
 {
@@ -52,7 +52,8 @@ int main()
     // Compiler Error: no matching function for call
     // constexpr auto b{IsDistinctBy(EBF)}; // Compiler Error: Must specify at least two parameters
 
-    // Compiler Error: IsDistinctBy cljonic collection types are not all the same, or all Array, Range or Repeat types
+    // Compiler Error: IsDistinctBy cljonic collection types are not all the same, or all Array, Range, Repeat or view
+    //                 types
     // constexpr auto b{IsDistinctBy(EBF, a, Set{2, 3, 4})};
 
     // Compiler Error: IsDistinctBy function is not a valid binary predicate for all cljonic collection value types
@@ -79,16 +80,17 @@ template <typename F, typename T, typename... Ts>
         if constexpr (AllCljonicCollections<T, Ts...>)
         {
             static_assert(
-                AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeOrRepeat<T, Ts...>,
-                "IsDistinctBy cljonic collection types are not all the same, or all Array, Range or Repeat types");
+                AllSameCljonicCollectionType<T, Ts...> or AllCljonicArrayRangeRepeatOrView<T, Ts...>,
+                "IsDistinctBy cljonic collection types are not all the same, or all Array, Range, Repeat or view "
+                "types");
 
             static_assert(
                 IsBinaryPredicateForAllCljonicCollections<std::decay_t<F>, T, Ts...>,
                 "IsDistinctBy function is not a valid binary predicate for all cljonic collection value types");
 
-            constexpr auto IndexInterfacesEqualBy = [](auto&& f, const auto& t, const auto& u) noexcept
+            constexpr auto CollectionsEqualBy = [](auto&& f, const auto& t, const auto& u) noexcept
             {
-                if (&t == &u)
+                if (static_cast<const void*>(&t) == static_cast<const void*>(&u))
                     return true;
                 if (t.Count() != u.Count())
                     return false;
@@ -114,14 +116,7 @@ template <typename F, typename T, typename... Ts>
                     return true;
                 }
             };
-            using I = const IndexInterface<typename T::value_type>*;
-            constexpr auto n{sizeof...(Ts) + 1};
-            const auto i{std::array<I, n>{static_cast<I>(&t), static_cast<I>(&ts)...}};
-            for (SizeType j{0}; j < n; ++j)
-                for (SizeType k{j + 1}; k < n; ++k)
-                    if (IndexInterfacesEqualBy(std::forward<F>(f), *i[j], *i[k]))
-                        return false;
-            return true;
+            return (not CollectionsEqualBy(f, t, ts) and ...) and IsDistinctBy(std::forward<F>(f), ts...);
         }
         else
         {
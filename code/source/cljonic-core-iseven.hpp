@@ -0,0 +1,53 @@
+#ifndef CLJONIC_CORE_ISEVEN_HPP
+#define CLJONIC_CORE_ISEVEN_HPP
+
+#include <concepts>
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_IsEven
+* The \b IsEven predicate is a unary function object that returns true if its parameter, which must be an integer, is
+* even.  It can be passed to any function that takes a unary predicate, but \ref Core_Filter "Filter" recognizes it:
+* the even elements of a \ref Range "Range" are another \b Range, which \b Filter returns without testing each element.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto e0{IsEven(4)};                       // true
+    constexpr auto e1{IsEven(-3)};                      // false
+    constexpr auto e2{Filter(IsEven, Range<10>{})};     // Range with 0, 2, 4, 6, and 8
+    constexpr auto e3{Filter(IsEven, Array{1, 2, 3})}; // Array with 2
+
+    // Compiler Error: IsEven's parameter must be an integer
+    // constexpr auto e{IsEven(4.0)};
+
+    return 0;
+}
+~~~~~
+*/
+struct IsEvenPredicate
+{
+    template <typename T>
+    [[nodiscard]] constexpr bool operator()(const T& t) const noexcept
+    {
+        static_assert(std::integral<T>, "IsEven's parameter must be an integer");
+
+        return 0 == (t % 2);
+    }
+};
+
+inline constexpr IsEvenPredicate IsEven{};
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_ISEVEN_HPP
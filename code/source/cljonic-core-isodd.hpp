@@ -0,0 +1,53 @@
+#ifndef CLJONIC_CORE_ISODD_HPP
+#define CLJONIC_CORE_ISODD_HPP
+
+#include <concepts>
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_IsOdd
+* The \b IsOdd predicate is a unary function object that returns true if its parameter, which must be an integer, is
+* odd.  It can be passed to any function that takes a unary predicate, but \ref Core_Filter "Filter" recognizes it:
+* the odd elements of a \ref Range "Range" are another \b Range, which \b Filter returns without testing each element.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto o0{IsOdd(4)};                      // false
+    constexpr auto o1{IsOdd(-3)};                     // true
+    constexpr auto o2{Filter(IsOdd, Range<10>{})};    // Range with 1, 3, 5, 7, and 9
+    constexpr auto o3{Filter(IsOdd, Array{1, 2, 3})}; // Array with 1 and 3
+
+    // Compiler Error: IsOdd's parameter must be an integer
+    // constexpr auto o{IsOdd(4.0)};
+
+    return 0;
+}
+~~~~~
+*/
+struct IsOddPredicate
+{
+    template <typename T>
+    [[nodiscard]] constexpr bool operator()(const T& t) const noexcept
+    {
+        static_assert(std::integral<T>, "IsOdd's parameter must be an integer");
+
+        return 0 != (t % 2);
+    }
+};
+
+inline constexpr IsOddPredicate IsOdd{};
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_ISODD_HPP
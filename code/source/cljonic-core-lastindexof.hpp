@@ -1,6 +1,7 @@
 #ifndef CLJONIC_CORE_LASTINDEXOF_HPP
 #define CLJONIC_CORE_LASTINDEXOF_HPP
 
+#include <type_traits>
 #include "cljonic-concepts.hpp"
 #include "cljonic-shared.hpp"
 
@@ -13,7 +14,10 @@ namespace core
 /** \anchor Core_LastIndexOf
 * The \b LastIndexOf function returns the index of the last value in its first parameter, which must be a \b cljonic
 * \b collection, that equals the value of its second parameter. If the first parameter has no value equal to the second
-* parameter then \b LastIndexOf returns the value \b CLJONIC_INVALID_INDEX.
+* parameter then \b LastIndexOf returns the value \b CLJONIC_INVALID_INDEX.  When the collection stores integer or
+* enumeration elements contiguously, like an \b Array or a \b String, they are compared a block at a time, from the
+* end, which the compiler vectorizes.  An integer is found in a \ref Range "Range", and any value in a
+* \ref Repeat "Repeat", in constant time.
 ~~~~~{.cpp}
 #include "cljonic.hpp"
 
@@ -67,11 +71,26 @@ template <typename C, typename T>
                   "LastIndexOf should not compare floating point types for equality. Consider using LastIndexOfBy to "
                   "override this default.");
 
-    auto result{CLJONIC_INVALID_INDEX};
-    for (SizeType nextIndex{c.Count()}; ((CLJONIC_INVALID_INDEX == result) and (nextIndex > 0)); --nextIndex)
-        if (AreEqual(c[nextIndex - 1], t))
-            result = nextIndex - 1;
-    return result;
+    if constexpr (IsCljonicRange<C> and std::integral<T>)
+    {
+        return RangeIndexOf<true>(c, t);
+    }
+    else if constexpr (IsCljonicRepeat<C>)
+    {
+        return ((c.Count() > 0) and AreEqual(c.At(0), t)) ? (c.Count() - 1) : CLJONIC_INVALID_INDEX;
+    }
+    else if constexpr (IsBulkSearchable<typename C::value_type, T> and std::is_pointer_v<decltype(c.begin())>)
+    {
+        return BulkIndexOf<true>(c.begin(), c.Count(), t);
+    }
+    else
+    {
+        auto result{CLJONIC_INVALID_INDEX};
+        for (SizeType nextIndex{c.Count()}; ((CLJONIC_INVALID_INDEX == result) and (nextIndex > 0)); --nextIndex)
+            if (AreEqual(c[nextIndex - 1], t))
+                result = nextIndex - 1;
+        return result;
+    }
 }
 
 } // namespace core
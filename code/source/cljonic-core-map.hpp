@@ -34,6 +34,7 @@ int main()
     constexpr auto m3{Map(Add2, Array<int, 10>{1, 2, 3, 4}, Range{})};   // immutable, sparse, 1, 3, 5, and 7
     constexpr auto m4{Map(Add2, Array<int, 10>{1, 2, 3, 4}, Repeat{1})}; // immutable, sparse, 2, 3, 4, and 5
     constexpr auto m5{Map(Add3, Set{1, 2, 3, 4}, Range{}, Repeat{3})};   // immutable, full, 4, 6, 8, and 10
+    constexpr auto m6{Map(Add2, Range<5>{}, Cycle(Array{10, 20}))};      // immutable, full, 10, 21, 12, 23, and 14
 
     // Compiler Error: Map's second through last parameters must be cljonic collections
     // constexpr auto m{Map(TwoTimes, 4)};
@@ -62,8 +63,34 @@ template <typename F, typename C, typename... Cs>
 
     constexpr auto count{MinimumOfCljonicCollectionMaximumCounts<C, Cs...>()};
     auto result{Array<ResultType, count>{}};
-    for (SizeType i{0}; i < c.Count(); ++i)
-        MConj(result, f(c[i], cs[i]...));
+    if constexpr (IsRandomAccessCollection<C>)
+    {
+        // read the elements with cursors, so a CycleCollection is traversed with its iterator, rather than indexed
+        [&](auto... cursors)
+        {
+            const auto n{MinArgument(c.Count(), count)};
+            for (SizeType i{0}; i < n; ++i)
+                MConj(result, f(cursors.Next()...));
+        }(ElementCursor{c}, ElementCursor{cs}...);
+    }
+    else
+    {
+        // a collection like a FilterView finds its count only by iterating, so it is iterated once, rather than
+        // counted and then read with a cursor, and the iteration stops without reading past the last element mapped
+        [&](auto... cursors)
+        {
+            if constexpr (count > 0)
+            {
+                SizeType i{0};
+                for (const auto& element : c)
+                {
+                    MConj(result, f(element, cursors.Next()...));
+                    if (count == ++i)
+                        break;
+                }
+            }
+        }(ElementCursor{cs}...);
+    }
     return result;
 }
 
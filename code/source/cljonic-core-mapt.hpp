@@ -0,0 +1,48 @@
+#ifndef CLJONIC_CORE_MAPT_HPP
+#define CLJONIC_CORE_MAPT_HPP
+
+#include <utility>
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_MapT
+* The \b MapT function returns a \b transducer, for use with \ref Core_Transduce "Transduce" and
+* \ref Core_Into "Into", that passes on the result of calling its parameter, which must be a \b unary \b function, with
+* each element it receives.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto Add = [](const int a, const int b) { return a + b; };
+    constexpr auto Square = [](const int i) { return i * i; };
+
+    constexpr auto t0{Transduce(MapT(Square), Add, 0, Array{1, 2, 3})};             // 14
+    constexpr auto t1{Into(Array<int, 5>{}, MapT(Square), Range<1, 4>{})};          // immutable, sparse, 1, 4, and 9
+    constexpr auto t2{Into(Array<int, 5>{}, Compose(MapT(Square), MapT(Square)), Range<1, 3>{})}; // 1 and 16
+
+    return 0;
+}
+~~~~~
+*/
+template <typename F>
+[[nodiscard]] constexpr auto MapT(F&& f) noexcept
+{
+    return [f = std::forward<F>(f)](auto step)
+    {
+        return [f, step](auto& accumulator, const auto& element) mutable { return step(accumulator, f(element)); };
+    };
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_MAPT_HPP
@@ -1,7 +1,9 @@
 #ifndef CLJONIC_CORE_MAX_HPP
 #define CLJONIC_CORE_MAX_HPP
 
+#include <type_traits>
 #include "cljonic-concepts.hpp"
+#include "cljonic-core-reducers.hpp"
 #include "cljonic-shared.hpp"
 
 namespace cljonic
@@ -13,7 +15,10 @@ namespace core
 /** \anchor Core_Max
 * The \b Max function returns the maximum value of either the values in its only \b cljonic \b collection parameter or
 * all of its parameters. If its only \b cljonic \b collection parameter is empty, then \b Max returns the default value
-* of its only \b cljonic \b collection parameter.
+* of its only \b cljonic \b collection parameter.  When the collection stores integer elements contiguously, like an
+* \b Array, \b Max finds the maximum in vectorizable lanes, like \ref Core_Reduce "Reduce" with the
+* \ref Core_Reducers "reducer" \b Maximum, and the maximum of a \b Range, which is its first or last element, is found
+* without scanning.  \ref Core_IndexOfMax "IndexOfMax" returns the index of the maximum.
 ~~~~~{.cpp}
 #include "cljonic.hpp"
 
@@ -53,15 +58,32 @@ template <typename T, typename... Ts>
     {
         static_assert(IsCljonicCollection<T>, "Max's parameter must be a cljonic collection");
 
-        auto result{t.DefaultElement()};
-        if (t.Count() > 0)
+        if constexpr (IsCljonicRange<T>)
         {
-            result = t[0];
-            for (SizeType i{1}; i < t.Count(); ++i)
-                if (result < t[i])
-                    result = t[i];
+            // a Range is monotonic, so its maximum is its first or last element
+            return (0 == t.Count()) ? t.DefaultElement() : Max(t[0], t[t.Count() - 1]);
+        }
+        else if constexpr (IsCljonicRepeat<T>)
+        {
+            return t[0]; // every element is the same, and an empty Repeat returns its default element
+        }
+        else if constexpr (IsLaneReducer<MaximumReducer, typename T::value_type> and
+                           std::is_pointer_v<decltype(t.begin())>)
+        {
+            return (0 == t.Count()) ? t.DefaultElement() : ReduceInLanes(Maximum, t.begin(), t.Count());
+        }
+        else
+        {
+            auto result{t.DefaultElement()};
+            if (t.Count() > 0)
+            {
+                result = t[0];
+                for (SizeType i{1}; i < t.Count(); ++i)
+                    if (result < t[i])
+                        result = t[i];
+            }
+            return result;
         }
-        return result;
     }
     else
     {
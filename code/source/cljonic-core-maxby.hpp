@@ -3,6 +3,7 @@
 
 #include "cljonic-concepts.hpp"
 #include "cljonic-shared.hpp"
+#include "cljonic-core-reducers.hpp"
 
 namespace cljonic
 {
@@ -15,6 +16,8 @@ namespace core
 * first parameter is less than its second parameter, to return the maximum value of either the values in its \b cljonic
 * \b collection second parameter or its second through last parameters. If its \b cljonic \b collection second parameter
 * is empty, then \b MaxBy returns the default value of its \b cljonic \b collection second parameter.
+* When the collection stores integer elements contiguously, like an \b Array, \b MaxBy scans them in vectorizable
+* lanes, and, like a left-to-right scan, returns the first of several elements that the predicate finds equivalent.
 ~~~~~{.cpp}
 #include "cljonic.hpp"
 
@@ -62,15 +65,8 @@ template <typename F, typename T, typename... Ts>
         static_assert(IsBinaryPredicate<F, typename T::value_type, typename T::value_type>,
                       "MaxBy function is not a valid binary predicate for the collection value type");
 
-        auto result{t.DefaultElement()};
-        if (t.Count() > 0)
-        {
-            result = t[0];
-            for (SizeType i{1}; i < t.Count(); ++i)
-                if (f(result, t[i]))
-                    result = t[i];
-        }
-        return result;
+        const auto index{IndexOfBest(f, t)};
+        return (CLJONIC_INVALID_INDEX == index) ? t.DefaultElement() : t[index];
     }
     else
     {
@@ -1,7 +1,9 @@
 #ifndef CLJONIC_CORE_MIN_HPP
 #define CLJONIC_CORE_MIN_HPP
 
+#include <type_traits>
 #include "cljonic-concepts.hpp"
+#include "cljonic-core-reducers.hpp"
 #include "cljonic-shared.hpp"
 
 namespace cljonic
@@ -13,7 +15,10 @@ namespace core
 /** \anchor Core_Min
 * The \b Min function returns the minimum value of either the values in its only \b cljonic \b collection parameter or
 * all of its parameters. If its only \b cljonic \b collection parameter is empty, then \b Min returns the default value
-* of its only \b cljonic \b collection parameter.
+* of its only \b cljonic \b collection parameter.  When the collection stores integer elements contiguously, like an
+* \b Array, \b Min finds the minimum in vectorizable lanes, like \ref Core_Reduce "Reduce" with the
+* \ref Core_Reducers "reducer" \b Minimum, and the minimum of a \b Range, which is its first or last element, is found
+* without scanning.  \ref Core_IndexOfMin "IndexOfMin" returns the index of the minimum.
 ~~~~~{.cpp}
 #include "cljonic.hpp"
 
@@ -53,15 +58,32 @@ template <typename T, typename... Ts>
     {
         static_assert(IsCljonicCollection<T>, "Min's parameter must be a cljonic collection");
 
-        auto result{t.DefaultElement()};
-        if (t.Count() > 0)
+        if constexpr (IsCljonicRange<T>)
         {
-            result = t[0];
-            for (SizeType i{1}; i < t.Count(); ++i)
-                if (t[i] < result)
-                    result = t[i];
+            // a Range is monotonic, so its minimum is its first or last element
+            return (0 == t.Count()) ? t.DefaultElement() : Min(t[0], t[t.Count() - 1]);
+        }
+        else if constexpr (IsCljonicRepeat<T>)
+        {
+            return t[0]; // every element is the same, and an empty Repeat returns its default element
+        }
+        else if constexpr (IsLaneReducer<MinimumReducer, typename T::value_type> and
+                           std::is_pointer_v<decltype(t.begin())>)
+        {
+            return (0 == t.Count()) ? t.DefaultElement() : ReduceInLanes(Minimum, t.begin(), t.Count());
+        }
+        else
+        {
+            auto result{t.DefaultElement()};
+            if (t.Count() > 0)
+            {
+                result = t[0];
+                for (SizeType i{1}; i < t.Count(); ++i)
+                    if (t[i] < result)
+                        result = t[i];
+            }
+            return result;
         }
-        return result;
     }
     else
     {
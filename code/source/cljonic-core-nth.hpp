@@ -48,7 +48,20 @@ template <typename C>
     static_assert(IsCljonicCollection<C> and (not IsCljonicSet<C>),
                   "Nth's first parameter must be a cljonic collection other than a Set");
 
-    return c[index];
+    if constexpr (IsCljonicIterator<C>)
+    {
+        // an Iterator has no index operator, so its elements are computed up to the one at index
+        if (index >= c.Count())
+            return c.DefaultElement();
+        auto it{c.begin()};
+        for (SizeType i{0}; i < index; ++i)
+            ++it;
+        return *it;
+    }
+    else
+    {
+        return c[index];
+    }
 }
 
 template <typename C, typename T>
@@ -60,7 +73,7 @@ template <typename C, typename T>
     static_assert(std::same_as<typename C::value_type, T>,
                   "Nth's third parameter must have the same type as the values in the first parameter");
 
-    return (index < c.Count()) ? c[index] : t;
+    return (index < c.Count()) ? Nth(c, index) : t;
 }
 
 } // namespace core
@@ -3,7 +3,9 @@
 
 #include <tuple>
 #include <numeric>
+#include <type_traits>
 #include "cljonic-concepts.hpp"
+#include "cljonic-core-reducers.hpp"
 
 namespace cljonic
 {
@@ -29,6 +31,14 @@ namespace core
 * parameter, and continues this process until all elements of its third parameter have been used in a call to its first
 * parameter. If the third parameter has no elements the second parameter is returned, and the first parameter is never
 * called.
+*
+* When the function is one of the \ref Core_Reducers "reducers" \b Plus or \b Multiplies, and the collection stores
+* arithmetic elements contiguously, or \b BitAnd, \b BitOr, \b Minimum, or \b Maximum, and the collection stores
+* integer elements contiguously, \b Reduce combines the elements in vectorizable lanes, rather than one at a time.
+* The \b Plus, \b Minimum, and \b Maximum of a \ref Range "Range", and the \b Multiplies of a \b Range that includes
+* zero, are computed in constant time, because its elements are an arithmetic progression.  The reducers combine the
+* copies of the element of a \ref Repeat "Repeat" with O(log n) operations, by repeated doubling for \b Plus and
+* squaring for \b Multiplies, and \b Minimum, \b Maximum, \b BitAnd, and \b BitOr of a \b Repeat are its element.
 ~~~~~{.cpp}
 #include "cljonic.hpp"
 
@@ -49,14 +59,18 @@ int main()
     constexpr auto a{Array{1, 2, 3, 4}};
     constexpr auto n0{Reduce(Add, a)};
     constexpr auto n1{Reduce(Add, 11, a)};
+    constexpr auto n7{Reduce(Plus, a)};     // 10, combining the elements in lanes
+    constexpr auto n8{Reduce(Plus, 11, a)}; // 21, combining the elements in lanes
 
     constexpr auto rng{Range<5>{}};
     constexpr auto n2{Reduce(Add, rng)};
     constexpr auto n3{Reduce(Add, 11, rng)};
+    constexpr auto n9{Reduce(Plus, rng)}; // 10, in constant time
 
     constexpr auto rpt{Repeat<5, int>{5}};
     constexpr auto n4{Reduce(Add, rpt)};
     constexpr auto n5{Reduce(Add, 11, rpt)};
+    constexpr auto n10{Reduce(Multiplies, rpt)}; // 3125, with three multiplications
 
     constexpr auto s{String{"Hello"}};
     constexpr auto n6{Reduce([](const int count, const char b) { return count + 1; }, 0, s)};
@@ -104,8 +118,16 @@ template <typename F, typename C>
         std::regular_invocable<F, ResultType, typename C::value_type>,
         "Reduce's function cannot be called with parameters of function result type, and collection value type");
 
-    return (0 == c.Count()) ? c.DefaultElement()
-                            : std::accumulate((c.begin() + 1), c.end(), *c.begin(), std::forward<F>(f));
+    if constexpr (IsCljonicRange<C> and IsRangeReducer<std::decay_t<F>>)
+        return (0 == c.Count()) ? c.DefaultElement() : ReduceRange(f, c);
+    else if constexpr (IsCljonicRepeat<C> and IsLaneReducer<std::decay_t<F>, typename C::value_type>)
+        return (0 == c.Count()) ? c.DefaultElement() : ReduceRepeated(f, c.At(0), c.Count());
+    else if constexpr (IsLaneReducer<std::decay_t<F>, typename C::value_type> and
+                       std::is_pointer_v<decltype(c.begin())>)
+        return (0 == c.Count()) ? c.DefaultElement() : ReduceInLanes(f, c.begin(), c.Count());
+    else
+        return (0 == c.Count()) ? c.DefaultElement()
+                                : std::accumulate((c.begin() + 1), c.end(), *c.begin(), std::forward<F>(f));
 }
 
 template <typename F, typename T, typename C>
@@ -122,7 +144,16 @@ template <typename F, typename T, typename C>
         std::regular_invocable<F, ResultType, typename C::value_type>,
         "Reduce's function cannot be called with parameters of function result type, and collection value type");
 
-    return (0 == c.Count()) ? t : std::accumulate(c.begin(), c.end(), t, std::forward<F>(f));
+    if constexpr (IsCljonicRange<C> and IsRangeReducer<std::decay_t<F>> and std::is_same_v<T, int>)
+        return (0 == c.Count()) ? t : static_cast<T>(f(t, ReduceRange(f, c)));
+    else if constexpr (IsCljonicRepeat<C> and IsLaneReducer<std::decay_t<F>, typename C::value_type> and
+                       std::is_same_v<T, typename C::value_type>)
+        return (0 == c.Count()) ? t : static_cast<T>(f(t, ReduceRepeated(f, c.At(0), c.Count())));
+    else if constexpr (IsLaneReducer<std::decay_t<F>, typename C::value_type> and
+                       std::is_same_v<T, typename C::value_type> and std::is_pointer_v<decltype(c.begin())>)
+        return (0 == c.Count()) ? t : static_cast<T>(f(t, ReduceInLanes(f, c.begin(), c.Count())));
+    else
+        return (0 == c.Count()) ? t : std::accumulate(c.begin(), c.end(), t, std::forward<F>(f));
 }
 
 } // namespace core
@@ -0,0 +1,293 @@
+#ifndef CLJONIC_CORE_REDUCERS_HPP
+#define CLJONIC_CORE_REDUCERS_HPP
+
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+#include "cljonic-collection-maximum-element-count.hpp"
+#include "cljonic-shared.hpp"
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_Reducers
+* The \b Plus, \b Multiplies, \b BitAnd, \b BitOr, \b Minimum, and \b Maximum reducers are binary function objects that
+* return the sum, product, bitwise and, bitwise or, minimum, and maximum of their two parameters.  They can be passed to
+* any function that takes a binary function, but \ref Core_Reduce "Reduce" recognizes them: when its \b cljonic
+* \b collection stores arithmetic elements contiguously, like an \b Array, a \b String, a \ref SpanView "SpanView", or
+* a \ref SliceView "SliceView" of one of those, \b Reduce combines the elements in eight independent lanes, which the
+* compiler turns into SSE, AVX, or NEON instructions, and then combines the lanes.  Combining in lanes reassociates the
+* operation, so the \b Plus and \b Multiplies of \b float and \b double elements may differ in their last bits from a
+* left-to-right reduction, but the lanes are combined in the same order during constant evaluation, so a constant
+* \b Reduce and a run time \b Reduce agree.  \b Minimum and \b Maximum are named so they do not collide with
+* \ref Core_Min "Min" and \ref Core_Max "Max".
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto a{Array{3, 1, 4, 1, 5, 9, 2, 6}};
+    constexpr auto sum{Reduce(Plus, a)};             // 31
+    constexpr auto product{Reduce(Multiplies, a)};   // 6480
+    constexpr auto all{Reduce(BitAnd, a)};           // 0
+    constexpr auto any{Reduce(BitOr, a)};            // 15
+    constexpr auto smallest{Reduce(Minimum, a)};     // 1
+    constexpr auto largest{Reduce(Maximum, a)};      // 9
+    constexpr auto sumPlus10{Reduce(Plus, 10, a)};   // 41
+    constexpr auto three{Plus(1, 2)};                // 3
+
+    return 0;
+}
+~~~~~
+*/
+struct PlusReducer
+{
+    template <typename T, typename U>
+    [[nodiscard]] constexpr auto operator()(const T& t, const U& u) const noexcept
+    {
+        return t + u;
+    }
+};
+
+struct MultipliesReducer
+{
+    template <typename T, typename U>
+    [[nodiscard]] constexpr auto operator()(const T& t, const U& u) const noexcept
+    {
+        return t * u;
+    }
+};
+
+struct BitAndReducer
+{
+    template <typename T, typename U>
+    [[nodiscard]] constexpr auto operator()(const T& t, const U& u) const noexcept
+    {
+        return t & u;
+    }
+};
+
+struct BitOrReducer
+{
+    template <typename T, typename U>
+    [[nodiscard]] constexpr auto operator()(const T& t, const U& u) const noexcept
+    {
+        return t | u;
+    }
+};
+
+struct MinimumReducer
+{
+    template <typename T>
+    [[nodiscard]] constexpr T operator()(const T& t, const T& u) const noexcept
+    {
+        return (u < t) ? u : t;
+    }
+};
+
+struct MaximumReducer
+{
+    template <typename T>
+    [[nodiscard]] constexpr T operator()(const T& t, const T& u) const noexcept
+    {
+        return (t < u) ? u : t;
+    }
+};
+
+inline constexpr PlusReducer Plus{};
+inline constexpr MultipliesReducer Multiplies{};
+inline constexpr BitAndReducer BitAnd{};
+inline constexpr BitOrReducer BitOr{};
+inline constexpr MinimumReducer Minimum{};
+inline constexpr MaximumReducer Maximum{};
+
+} // namespace core
+
+// The reducers that Reduce combines in lanes over contiguous arithmetic elements; BitAnd and BitOr need integers, and
+// so do Minimum and Maximum, because a NaN kept in one lane would drop the later elements of that lane, and then be
+// dropped itself when the lanes are combined, where a left-to-right scan compares every element after the NaN
+template <typename F, typename T>
+concept IsLaneReducer =
+    std::is_arithmetic_v<T> and not std::is_same_v<T, bool> and
+    (std::is_same_v<F, core::PlusReducer> or std::is_same_v<F, core::MultipliesReducer> or
+     (std::is_integral_v<T> and (std::is_same_v<F, core::MinimumReducer> or std::is_same_v<F, core::MaximumReducer> or
+                                 std::is_same_v<F, core::BitAndReducer> or std::is_same_v<F, core::BitOrReducer>)));
+
+// The reducers that Reduce computes without visiting each element of a Range
+template <typename F>
+concept IsRangeReducer = std::is_same_v<F, core::PlusReducer> or std::is_same_v<F, core::MultipliesReducer> or
+                         std::is_same_v<F, core::MinimumReducer> or std::is_same_v<F, core::MaximumReducer>;
+
+// Reduces the elements of a Range with at least one element, which are an arithmetic progression, in constant time:
+// their sum is half the product of their count and the sum of the first and last elements, their minimum and maximum
+// are the first or last elements, and their product is zero when they pass through zero; a product that does not pass
+// through zero overflows an int within a few dozen elements, so it is computed left to right
+template <typename F, typename R>
+[[nodiscard]] constexpr int ReduceRange(const F& f, const R& r) noexcept
+{
+    const auto first{r[0]};
+    const auto last{r[r.Count() - 1]};
+    if constexpr (std::is_same_v<F, core::PlusReducer>)
+    {
+        return static_cast<int>(((static_cast<std::int64_t>(first) + last) * static_cast<std::int64_t>(r.Count())) / 2);
+    }
+    else if constexpr (std::is_same_v<F, core::MultipliesReducer>)
+    {
+        if (CLJONIC_INVALID_INDEX != RangeIndexOf<false>(r, 0))
+            return 0;
+        auto result{first};
+        for (SizeType i{1}; i < r.Count(); ++i)
+            result = f(result, r[i]);
+        return result;
+    }
+    else
+    {
+        return f(first, last);
+    }
+}
+
+// Reduces count > 0 copies of t, the elements of a Repeat, with O(log count) operations, rather than count - 1:
+// Minimum, Maximum, BitAnd, and BitOr of t and t are t, and Plus and Multiplies combine t with itself by repeated
+// doubling, as in exponentiation by squaring, which reassociates float and double Plus and Multiplies, as lanes do;
+// the integer Plus of count copies is their product with count, computed modulo 2^64, so it wraps as the sum does
+template <typename F, typename T>
+[[nodiscard]] constexpr T ReduceRepeated(const F& f, const T& t, const SizeType count) noexcept
+{
+    if constexpr (std::is_same_v<F, core::PlusReducer> and std::is_integral_v<T>)
+    {
+        return static_cast<T>(static_cast<std::uint64_t>(t) * static_cast<std::uint64_t>(count));
+    }
+    else if constexpr (std::is_same_v<F, core::PlusReducer> or std::is_same_v<F, core::MultipliesReducer>)
+    {
+        auto result{t};
+        auto power{t}; // t combined with itself 2^k times, for the k-th bit of the count of the other copies
+        for (auto remaining{count - 1}; remaining > 0; remaining /= 2)
+        {
+            if (0 != (remaining % 2))
+                result = static_cast<T>(f(result, power));
+            if (remaining > 1)
+                power = static_cast<T>(f(power, power));
+        }
+        return result;
+    }
+    else
+    {
+        return t;
+    }
+}
+
+// Reduces count > 0 contiguous elements in eight independent lanes, so each step of the main loop is eight independent
+// operations, which the compiler vectorizes, rather than one long chain of dependent operations, which it cannot;
+// the result is converted back to T after each operation, as std::accumulate does with an initial value of type T
+template <typename F, typename T>
+[[nodiscard]] constexpr T ReduceInLanes(const F& f, const T* elements, const SizeType count) noexcept
+{
+    constexpr SizeType laneCount{8};
+    if (count < (2 * laneCount))
+    {
+        auto result{elements[0]};
+        for (SizeType i{1}; i < count; ++i)
+            result = static_cast<T>(f(result, elements[i]));
+        return result;
+    }
+    T lanes[laneCount];
+    for (SizeType j{0}; j < laneCount; ++j)
+        lanes[j] = elements[j];
+    SizeType i{laneCount};
+    for (; (i + laneCount) <= count; i += laneCount)
+#pragma GCC unroll 8 // so the lanes stay in registers, rather than in memory between iterations
+        for (SizeType j{0}; j < laneCount; ++j)
+            lanes[j] = static_cast<T>(f(lanes[j], elements[i + j]));
+    for (SizeType width{laneCount / 2}; width > 0; width /= 2)
+        for (SizeType j{0}; j < width; ++j)
+            lanes[j] = static_cast<T>(f(lanes[j], lanes[j + width]));
+    auto result{lanes[0]};
+    for (; i < count; ++i)
+        result = static_cast<T>(f(result, elements[i]));
+    return result;
+}
+
+// Returns the best of the laneCount * laneCount contiguous elements of a block, where better(a, b) is true when b is
+// better than a, by keeping the best of every laneCount-th element in each of laneCount independent lanes
+template <SizeType laneCount, typename F, typename T>
+[[nodiscard]] constexpr T BestOfBlock(F& better, const T* elements) noexcept
+{
+    T lanes[laneCount];
+    for (SizeType j{0}; j < laneCount; ++j)
+        lanes[j] = elements[j];
+    for (SizeType i{laneCount}; i < (laneCount * laneCount); i += laneCount)
+#pragma GCC unroll 8 // so the lanes stay in registers, rather than in memory between iterations
+        for (SizeType j{0}; j < laneCount; ++j)
+            lanes[j] = better(lanes[j], elements[i + j]) ? elements[i + j] : lanes[j];
+    for (SizeType width{laneCount / 2}; width > 0; width /= 2)
+        for (SizeType j{0}; j < width; ++j)
+            lanes[j] = better(lanes[j], lanes[j + width]) ? lanes[j + width] : lanes[j];
+    return lanes[0];
+}
+
+// Returns the index of count > 0 contiguous elements that a left-to-right scan, which moves to an element whenever
+// better(element at the current index, element) is true, ends on.  Tracking an index per lane would mix element and
+// index widths, which defeats vectorization, so the best of each block is found in lanes, the first block whose best
+// is better than the best so far is remembered, and only that block and the tail are scanned left to right; a block
+// whose best is merely as good as the best so far replaces it exactly when the left-to-right scan would move to it
+template <typename F, typename T>
+[[nodiscard]] constexpr SizeType IndexOfBestInLanes(F&& better, const T* elements, const SizeType count) noexcept
+{
+    constexpr SizeType laneCount{8};
+    constexpr SizeType blockSize{laneCount * laneCount};
+    SizeType result{0};
+    SizeType i{1};
+    if (count >= (2 * blockSize))
+    {
+        auto best{BestOfBlock<laneCount>(better, elements)};
+        for (i = blockSize; (i + blockSize) <= count; i += blockSize)
+        {
+            const auto blockBest{BestOfBlock<laneCount>(better, elements + i)};
+            if (better(best, blockBest))
+            {
+                best = blockBest;
+                result = i;
+            }
+        }
+        const auto blockEnd{result + blockSize};
+        for (auto j{result + 1}; j < blockEnd; ++j)
+            if (better(elements[result], elements[j]))
+                result = j;
+    }
+    for (; i < count; ++i)
+        if (better(elements[result], elements[i]))
+            result = i;
+    return result;
+}
+
+// Returns the index that a left-to-right scan of a collection, which moves to an element whenever better(element at
+// the current index, element) is true, ends on, or CLJONIC_INVALID_INDEX if the collection is empty; contiguous
+// integers are scanned in lanes, but not floating point values, whose NaNs make the lanes disagree with the scan
+template <typename F, typename C>
+[[nodiscard]] constexpr SizeType IndexOfBest(F&& better, const C& c) noexcept
+{
+    if (0 == c.Count())
+        return CLJONIC_INVALID_INDEX;
+    if constexpr (std::is_integral_v<typename C::value_type> and std::is_pointer_v<decltype(c.begin())>)
+    {
+        return IndexOfBestInLanes(better, c.begin(), c.Count());
+    }
+    else
+    {
+        SizeType result{0};
+        for (SizeType i{1}; i < c.Count(); ++i)
+            if (better(ElementAt(c, result), ElementAt(c, i)))
+                result = i;
+        return result;
+    }
+}
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_REDUCERS_HPP
@@ -2,6 +2,7 @@
 #define CLJONIC_CORE_SORT_HPP
 
 #include "cljonic-concepts.hpp"
+#include "cljonic-core-reverse.hpp"
 #include "cljonic-core-seq.hpp"
 #include "cljonic-shared.hpp"
 
@@ -12,8 +13,11 @@ namespace core
 {
 
 /** \anchor Core_Sort
-* The \b Sort function uses an \b Insertion \b Sort algorithm to sort its parameter, which must be a \b cljonic
-* \b collection, into its result, which is a \b cljonic \b Array with the same \b MaximumCount as its parameter.
+* The \b Sort function uses an \b Introsort algorithm, which is O(n log n) in the worst case, to sort its parameter,
+* which must be a \b cljonic \b collection, into its result, which is a \b cljonic \b Array with the same
+* \b MaximumCount as its parameter. The sort is \b not \b stable.  A \ref Range "Range" is already in ascending or
+* descending order, so it is copied, or copied in reverse, without comparing its elements, and a \ref Repeat "Repeat"
+* is copied.
 ~~~~~{.cpp}
 #include "cljonic.hpp"
 
@@ -51,24 +55,19 @@ int main()
 template <typename C>
 [[nodiscard]] constexpr auto Sort(const C& c) noexcept
 {
-    // #lizard forgives -- The length and complexity of this function is acceptable
-
     static_assert(IsCljonicCollection<C>, "Sort's parameter must be a cljonic collection");
 
-    // Insertion sort algorithm
-    auto result{Seq(c)};
-    for (SizeType i{1}; i < result.Count(); ++i)
+    if constexpr (IsCljonicRange<C>)
+    {
+        return (c[0] <= c[c.Count() - 1]) ? Seq(c) : Reverse(c); // an empty Range reads its default element twice
+    }
+    else
     {
-        auto key = result[i];
-        SizeType j = i;
-        while ((j > 0) and FirstLessThanSecond(key, result[j - 1]))
-        {
-            MSet(result, result[j - 1], j);
-            --j;
-        }
-        MSet(result, key, j);
+        auto result{Seq(c)};
+        if constexpr (not(IsCljonicSortedSet<C> or IsCljonicRepeat<C>)) // these are already sorted
+            MSortBy(result, [](const auto& a, const auto& b) { return FirstLessThanSecond(a, b); });
+        return result;
     }
-    return result;
 }
 
 } // namespace core
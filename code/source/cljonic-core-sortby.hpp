@@ -1,6 +1,7 @@
 #ifndef CLJONIC_CORE_SORTBY_HPP
 #define CLJONIC_CORE_SORTBY_HPP
 
+#include <utility>
 #include "cljonic-concepts.hpp"
 #include "cljonic-core-seq.hpp"
 
@@ -12,9 +13,9 @@ namespace core
 
 /** \anchor Core_SortBy
 * The \b SortBy function uses its first parameter, which must be a \b binary \b predicate that returns \b true if its
-* first parameter is less than its second parameter, in an \b Insertion \b Sort algorithm to sort its second parameter,
-* which must be a \b cljonic \b collection, into its result, which is a \b cljonic \b Array with the same
-* \b MaximumCount as its second parameter.
+* first parameter is less than its second parameter, in an \b Introsort algorithm, which is O(n log n) in the worst
+* case, to sort its second parameter, which must be a \b cljonic \b collection, into its result, which is a
+* \b cljonic \b Array with the same \b MaximumCount as its second parameter. The sort is \b not \b stable.
 ~~~~~{.cpp}
 #include "cljonic.hpp"
 
@@ -54,26 +55,13 @@ int main()
 template <typename F, typename C>
 [[nodiscard]] constexpr auto SortBy(F&& f, const C& c) noexcept
 {
-    // #lizard forgives -- The length and complexity of this function is acceptable
-
     static_assert(IsCljonicCollection<C>, "SortBy's second parameter must be a cljonic collection");
 
     static_assert(IsBinaryPredicate<std::decay_t<F>, typename C::value_type, typename C::value_type>,
                   "SortBy's function is not a valid binary predicate for the collection value type");
 
-    // Insertion sort algorithm
     auto result{Seq(c)};
-    for (SizeType i{1}; i < result.Count(); ++i)
-    {
-        auto key = result[i];
-        SizeType j = i;
-        while ((j > 0) and f(key, result[j - 1]))
-        {
-            MSet(result, result[j - 1], j);
-            --j;
-        }
-        MSet(result, key, j);
-    }
+    MSortBy(result, std::forward<F>(f));
     return result;
 }
 
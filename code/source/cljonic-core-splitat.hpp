@@ -2,7 +2,11 @@
 #define CLJONIC_CORE_SPLITAT_HPP
 
 #include <tuple>
+#include <type_traits>
+#include <utility>
 #include "cljonic-concepts.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-spanview.hpp"
 #include "cljonic-core-drop.hpp"
 #include "cljonic-core-take.hpp"
 
@@ -48,6 +52,50 @@ template <typename C>
     return Array{Take(count, c), Drop(count, c)};
 }
 
+/** \anchor Core_SplitAtView
+* The \b SplitAtView function returns a \b std::pair of two \ref SliceView "SliceViews" of its second parameter, which
+* must be a \b random \b access \b cljonic \b collection, such as an \b Array, a \b Range, or a \ref MapView "MapView"
+* of one, the first of its first elements, the number of which is given by its first parameter, and the second of the
+* rest of its elements, so they have the same elements as the two \b Arrays returned by \ref Core_SplitAt "SplitAt", but
+* creating them takes constant time and memory, because <b>they do not copy them</b>.  The second parameter must be an
+* \b lvalue, which the \b SliceViews refer to, and which must outlive them, or a \ref SpanView "SpanView", which each
+* \b SliceView copies, rather than a temporary collection, which each would have to copy.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    const auto a{Array{11, 12, 13, 14}};
+    const auto [first, rest]{SplitAtView(2, a)};             // SliceViews of 11 and 12, and of 13 and 14
+    const auto [f, r]{SplitAtView(1, SpanView{a.AsSpan()})}; // SliceViews of 11, and of 12, 13, and 14
+
+    // Compiler Error: SplitAtView's second parameter must be a cljonic collection
+    // constexpr auto s{SplitAtView(2, "Hello")};
+
+    // Compiler Error: SplitAtView's second parameter must be an lvalue, or a SpanView, which both SliceViews refer to
+    // constexpr auto s{SplitAtView(3, Range<5>{})};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C>
+[[nodiscard]] constexpr auto SplitAtView(const SizeType count, C&& c) noexcept
+{
+    using Collection = std::remove_cvref_t<C>;
+
+    static_assert(IsCljonicCollection<Collection>, "SplitAtView's second parameter must be a cljonic collection");
+
+    static_assert(std::is_lvalue_reference_v<C> or
+                      std::is_same_v<Collection, SpanView<typename Collection::value_type>>,
+                  "SplitAtView's second parameter must be an lvalue, or a SpanView, which both SliceViews refer to");
+
+    return std::pair{SliceView<C>{c, 0, count}, SliceView<C>{c, count}};
+}
+
 } // namespace core
 
 } // namespace cljonic
@@ -1,8 +1,12 @@
 #ifndef CLJONIC_CORE_SPLITWITH_HPP
 #define CLJONIC_CORE_SPLITWITH_HPP
 
+#include <type_traits>
+#include <utility>
 #include "cljonic-array.hpp"
 #include "cljonic-concepts.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-spanview.hpp"
 #include "cljonic-core-drop.hpp"
 #include "cljonic-core-takewhile.hpp"
 
@@ -62,9 +66,68 @@ template <typename F, typename C>
     static_assert(IsUnaryPredicate<std::decay_t<F>, typename C::value_type>,
                   "SplitWith's function is not a valid unary predicate for the collection value type");
 
-    const auto firstArray{TakeWhile(f, c)};
-    const auto secondArray{Drop(firstArray.Count(), c)};
-    return Array{firstArray, secondArray};
+    auto firstArray{TakeWhile(f, c)};
+    auto secondArray{Drop(firstArray.Count(), c)};
+    return Array{std::move(firstArray), std::move(secondArray)};
+}
+
+/** \anchor Core_SplitWithView
+* The \b SplitWithView function returns a \b std::pair of two \ref SliceView "SliceViews" of its second parameter, which
+* must be a \b random \b access \b cljonic \b collection, such as an \b Array, a \b Range, or a \ref MapView "MapView"
+* of one, the first of its first elements for which its first parameter, which must be a \b unary \b predicate, returns
+* \b true, and the second of the rest of its elements, so they have the same elements as the two \b Arrays returned by
+* \ref Core_SplitWith "SplitWith", but creating them takes no memory beyond the \b SliceViews, and time only to find the
+* split, because <b>they do not copy the elements</b>.  The second parameter must be an \b lvalue, which the
+* \b SliceViews refer to, and which must outlive them, or a \ref SpanView "SpanView", which each \b SliceView copies,
+* rather than a temporary collection, which each would have to copy.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto IsLessThan13 = [](const int a) { return a < 13; };
+
+    const auto a{Array{11, 12, 13, 14}};
+    const auto [first, rest]{SplitWithView(IsLessThan13, a)}; // SliceViews of 11 and 12, and of 13 and 14
+
+    // Compiler Error: SplitWithView's second parameter must be a cljonic collection
+    // constexpr auto s{SplitWithView(IsLessThan13, "Hello")};
+
+    // Compiler Error: SplitWithView's second parameter must be an lvalue, or a SpanView, which both SliceViews refer to
+    // constexpr auto s{SplitWithView(IsLessThan13, Range<10, 16>{})};
+
+    // Compiler Error: SplitWithView's function is not a valid unary predicate for the collection value type
+    // constexpr auto s{SplitWithView(IsLessThan13, Array<const char*, 5>{})};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename F, typename C>
+[[nodiscard]] constexpr auto SplitWithView(F&& f, C&& c) noexcept
+{
+    using Collection = std::remove_cvref_t<C>;
+
+    static_assert(IsCljonicCollection<Collection>, "SplitWithView's second parameter must be a cljonic collection");
+
+    static_assert(std::is_lvalue_reference_v<C> or
+                      std::is_same_v<Collection, SpanView<typename Collection::value_type>>,
+                  "SplitWithView's second parameter must be an lvalue, or a SpanView, which both SliceViews refer to");
+
+    static_assert(IsUnaryPredicate<std::decay_t<F>, typename Collection::value_type>,
+                  "SplitWithView's function is not a valid unary predicate for the collection value type");
+
+    auto count{SizeType{0}};
+    for (const auto& element : c)
+    {
+        if (not f(element))
+            break;
+        ++count;
+    }
+    return std::pair{SliceView<C>{c, 0, count}, SliceView<C>{c, count}};
 }
 
 } // namespace core
@@ -0,0 +1,68 @@
+#ifndef CLJONIC_CORE_STABLESORT_HPP
+#define CLJONIC_CORE_STABLESORT_HPP
+
+#include "cljonic-concepts.hpp"
+#include "cljonic-core-seq.hpp"
+#include "cljonic-shared.hpp"
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_StableSort
+* The \b StableSort function uses a \b bottom-up \b merge \b sort algorithm, which is O(n log n) in the worst case,
+* to sort its parameter, which must be a \b cljonic \b collection, into its result, which is a \b cljonic \b Array
+* with the same \b MaximumCount as its parameter. The sort is \b stable, and it uses a scratch C array the size of its
+* result on the stack.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto a{Array{11, 12, 13, 14}};
+    constexpr auto stableSortA{StableSort(a)};
+
+    constexpr auto b{Array{11, 13, 12, 14}};
+    constexpr auto stableSortB{StableSort(b)};
+
+    constexpr auto stableSortRng{StableSort(Range<0>{})};
+
+    constexpr auto stableSortRpt{StableSort(Repeat<4, int>{11})};
+
+    constexpr auto stableSortSet0{StableSort(Set{11, 12, 13, 14})};
+    constexpr auto stableSortSet1{StableSort(Set{11, 13, 12, 14})};
+
+    constexpr auto stableSortStr0{StableSort(String{"abcd"})};
+    constexpr auto stableSortStr1{StableSort(String{"axbycz"})};
+
+    constexpr auto stableSortCStr0{StableSort(Array{"four", "one", "three", "two"})};
+    constexpr auto stableSortCStr1{StableSort(Array{"one", "two", "three", "four"})};
+
+    // Compiler Error: StableSort's parameter must be a cljonic collection
+    // constexpr auto sb{StableSort("Hello")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C>
+[[nodiscard]] constexpr auto StableSort(const C& c) noexcept
+{
+    static_assert(IsCljonicCollection<C>, "StableSort's parameter must be a cljonic collection");
+
+    auto result{Seq(c)};
+    if constexpr (not IsCljonicSortedSet<C>) // a SortedSet is already sorted
+        MStableSortBy(result, [](const auto& a, const auto& b) { return FirstLessThanSecond(a, b); });
+    return result;
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_STABLESORT_HPP
@@ -0,0 +1,78 @@
+#ifndef CLJONIC_CORE_STABLESORTBY_HPP
+#define CLJONIC_CORE_STABLESORTBY_HPP
+
+#include <utility>
+#include "cljonic-concepts.hpp"
+#include "cljonic-core-seq.hpp"
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_StableSortBy
+* The \b StableSortBy function uses its first parameter, which must be a \b binary \b predicate that returns \b true
+* if its first parameter is less than its second parameter, in a \b bottom-up \b merge \b sort algorithm, which is
+* O(n log n) in the worst case, to sort its second parameter, which must be a \b cljonic \b collection, into its
+* result, which is a \b cljonic \b Array with the same \b MaximumCount as its second parameter. The sort is
+* \b stable, so elements that are not less than each other keep their order, and it uses a scratch C array the size
+* of its result on the stack.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto IsALessThanB = [](const int a, const int b) { return a < b; };
+
+    constexpr auto a{Array{11, 12, 13, 14}};
+    constexpr auto stableSortByA{StableSortBy(IsALessThanB, a)};
+
+    constexpr auto b{Array{11, 13, 12, 14}};
+    constexpr auto stableSortByB{StableSortBy(IsALessThanB, b)};
+
+    constexpr auto stableSortByRng{StableSortBy(IsALessThanB, Range<0>{})};
+
+    constexpr auto stableSortByRpt{StableSortBy(IsALessThanB, Repeat<4, int>{11})};
+
+    constexpr auto stableSortBySet0{StableSortBy(IsALessThanB, Set{11, 12, 13, 14})};
+    constexpr auto stableSortBySet1{StableSortBy(IsALessThanB, Set{11, 13, 12, 14})};
+
+    constexpr auto stableSortByStr0{StableSortBy([](const char i, const char j) { return i < j; }, String{"abcd"})};
+    constexpr auto stableSortByStr1{StableSortBy([](const char i, const char j) { return i < j; }, String{"axbycz"})};
+
+    constexpr auto IsAFirstLessThanBFirst = [](const auto& a, const auto& b) { return a.first < b.first; };
+    constexpr auto pairs{Array{std::pair{2, 'a'}, std::pair{1, 'b'}, std::pair{2, 'c'}, std::pair{1, 'd'}}};
+    constexpr auto stableSortByPairs{StableSortBy(IsAFirstLessThanBFirst, pairs)}; // {1,b} {1,d} {2,a} {2,c}
+
+    // Compiler Error: StableSortBy's second parameter must be a cljonic collection
+    // constexpr auto sb{StableSortBy(IsALessThanB, "Hello")};
+
+    // Compiler Error: StableSortBy's function is not a valid binary predicate for the collection value type
+    // constexpr auto sb{StableSortBy(IsALessThanB, Array<const char*, 5>{})};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename F, typename C>
+[[nodiscard]] constexpr auto StableSortBy(F&& f, const C& c) noexcept
+{
+    static_assert(IsCljonicCollection<C>, "StableSortBy's second parameter must be a cljonic collection");
+
+    static_assert(IsBinaryPredicate<std::decay_t<F>, typename C::value_type, typename C::value_type>,
+                  "StableSortBy's function is not a valid binary predicate for the collection value type");
+
+    auto result{Seq(c)};
+    MStableSortBy(result, std::forward<F>(f));
+    return result;
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_STABLESORTBY_HPP
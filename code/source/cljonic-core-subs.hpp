@@ -1,8 +1,10 @@
 #ifndef CLJONIC_CORE_subs_HPP
 #define CLJONIC_CORE_subs_HPP
 
-#include "cljonic-core-drop.hpp"
-#include "cljonic-core-take.hpp"
+#include <type_traits>
+#include <utility>
+#include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
 
 namespace cljonic
 {
@@ -51,9 +53,26 @@ template <typename C>
 {
     static_assert(IsCljonicCollection<C>, "Subs's first parameter must be a cljonic collection");
 
-    return ((c.Count() == 0) or (start >= c.Count()) or (end <= start))
-               ? Array<typename C::value_type, c.MaximumCount()>{}
-               : Take((end - start), Drop(start, c));
+    // copy the elements once, rather than into one Array by Drop and then another by Take
+    auto result{Array<typename C::value_type, c.MaximumCount()>{}};
+    if constexpr (IsRandomAccessCollection<C>)
+    {
+        for (const auto& element : SliceView{c, start, end})
+            MConj(result, element);
+    }
+    else
+    {
+        // a FilterView can only reach its start element by stepping over the ones before it
+        auto index{SizeType{0}};
+        for (const auto& element : c)
+        {
+            if (index == end)
+                break;
+            if (index++ >= start)
+                MConj(result, element);
+        }
+    }
+    return result;
 }
 
 template <typename C>
@@ -64,6 +83,51 @@ template <typename C>
     return Subs(c, start, c.Count());
 }
 
+/** \anchor Core_SubsView
+* The \b SubsView function returns a \ref SliceView "SliceView" of the elements of its first parameter, which must be a
+* \b random \b access \b cljonic \b collection, such as an \b Array, a \b Range, or a \ref MapView "MapView" of one,
+* starting with index \b start, and ending with either index \b end-1, or the \b Count of the first parameter minus one,
+* so it has the same elements as the \b Array returned by \ref Core_Subs "Subs", but creating it takes constant time and
+* memory, because <b>it does not copy them</b>.  The \b SliceView refers to an \b lvalue first parameter, which must
+* outlive it, and holds a copy of an \b rvalue first parameter.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    const auto a{Array{11, 12, 13, 14}};
+    const auto subsA{SubsView(a, 0, 3)};                     // SliceView of 11, 12, and 13, referring to a
+    constexpr auto subsRng{SubsView(Range<1, 5>{}, 1)};      // SliceView of 2, 3, and 4
+    constexpr auto subsStr{SubsView(String{"Hello"}, 2, 4)}; // SliceView of 'l' and 'l'
+
+    // Compiler Error: SubsView's first parameter must be a cljonic collection
+    // constexpr auto c{SubsView("Hello", 2, 4)};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C>
+[[nodiscard]] constexpr auto SubsView(C&& c, const SizeType start, const SizeType end) noexcept
+{
+    static_assert(IsCljonicCollection<std::remove_cvref_t<C>>,
+                  "SubsView's first parameter must be a cljonic collection");
+
+    return SliceView<C>{std::forward<C>(c), start, end};
+}
+
+template <typename C>
+[[nodiscard]] constexpr auto SubsView(C&& c, const SizeType start) noexcept
+{
+    static_assert(IsCljonicCollection<std::remove_cvref_t<C>>,
+                  "SubsView's first parameter must be a cljonic collection");
+
+    return SliceView<C>{std::forward<C>(c), start};
+}
+
 } // namespace core
 
 } // namespace cljonic
@@ -1,7 +1,10 @@
 #ifndef CLJONIC_CORE_TAKE_HPP
 #define CLJONIC_CORE_TAKE_HPP
 
+#include <type_traits>
+#include <utility>
 #include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
 
 namespace cljonic
 {
@@ -34,6 +37,7 @@ int main()
     constexpr auto tRpt7{Take(50, Repeat<7, const char*>{"11"})}; // immutable, full Array, with seven "11"s
     constexpr auto tSet5{Take(5, Set{'a', 'b'})};                 // immutable, sparse Array, with 'a' and 'b'
     constexpr auto tStr3{Take(3, String{"Hello"})};               // immutable, sparse Array, with 'H', 'e', and 'l'
+    constexpr auto tCyc{Take(5, Cycle(Array{1, 2}))};             // immutable, sparse Array, with 1, 2, 1, 2, and 1
 
     // Compiler Error: Take's second parameter must be a cljonic collection
     // constexpr auto t{Take(10, "Hello")};
@@ -48,12 +52,69 @@ template <typename C>
     static_assert(IsCljonicCollection<C>, "Take's second parameter must be a cljonic collection");
 
     auto result{Array<typename C::value_type, c.MaximumCount()>{}};
-    auto maxIndex{MinArgument(count, c.Count())};
-    for (SizeType i{0}; (i < maxIndex); ++i)
-        MConj(result, c[i]);
+    if constexpr (IsContiguousCollection<C>)
+    {
+        MConjElements(result, c.begin(), MinArgument(count, c.Count()));
+    }
+    else if constexpr (IsContiguousCycle<C>)
+    {
+        // copy the first cycle, then double the copied cycles, so n elements take O(log n) bulk copies
+        const auto takeCount{MinArgument(count, c.Count())};
+        MConjElements(result, c.Collection().begin(), MinArgument(takeCount, c.Collection().Count()));
+        while (result.Count() < takeCount)
+            MConjElements(result, result.begin(), MinArgument(result.Count(), takeCount - result.Count()));
+    }
+    else
+    {
+        // iterate, rather than index, so lazy views like FilterView are traversed once, and no further than needed
+        auto it{c.begin()};
+        const auto end{c.end()};
+        for (SizeType i{0}; ((i < count) and (it != end)); ++i)
+        {
+            MConj(result, *it);
+            if ((i + 1) < count)
+                ++it;
+        }
+    }
     return result;
 }
 
+/** \anchor Core_TakeView
+* The \b TakeView function returns a \ref SliceView "SliceView" of the first elements of its second parameter, which
+* must be a \b random \b access \b cljonic \b collection, such as an \b Array, a \b Range, or a \ref MapView "MapView"
+* of one, with the number of elements given by its first parameter, so it has the same elements as the \b Array returned
+* by \ref Core_Take "Take", but creating it takes constant time and memory, because <b>it does not copy them</b>.  The
+* \b SliceView refers to an \b lvalue second parameter, which must outlive it, and holds a copy of an \b rvalue second
+* parameter.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    const auto a{Array{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    const auto t5{TakeView(5, a)};                   // SliceView of 0 to 4, referring to a
+    constexpr auto t3{TakeView(3, Range<10>{})};     // SliceView of 0, 1, and 2
+    constexpr auto tStr{TakeView(50, String{"Hi"})}; // SliceView of 'H' and 'i'
+
+    // Compiler Error: TakeView's second parameter must be a cljonic collection
+    // constexpr auto t{TakeView(10, "Hello")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C>
+[[nodiscard]] constexpr auto TakeView(const SizeType count, C&& c) noexcept
+{
+    static_assert(IsCljonicCollection<std::remove_cvref_t<C>>,
+                  "TakeView's second parameter must be a cljonic collection");
+
+    return SliceView<C>{std::forward<C>(c), 0, count};
+}
+
 } // namespace core
 
 } // namespace cljonic
@@ -1,8 +1,11 @@
 #ifndef CLJONIC_CORE_TAKELAST_HPP
 #define CLJONIC_CORE_TAKELAST_HPP
 
+#include <type_traits>
+#include <utility>
 #include "cljonic-array.hpp"
 #include "cljonic-concepts.hpp"
+#include "cljonic-sliceview.hpp"
 
 namespace cljonic
 {
@@ -48,10 +51,46 @@ template <typename C>
     auto result{Array<typename C::value_type, c.MaximumCount()>{}};
     auto startIndex{(c.Count() > count) ? (c.Count() - count) : 0};
     for (SizeType i{startIndex}; (i < c.Count()); ++i)
-        MConj(result, c[i]);
+        MConj(result, ElementAt(c, i));
     return result;
 }
 
+/** \anchor Core_TakeLastView
+* The \b TakeLastView function returns a \ref SliceView "SliceView" of the last elements of its second parameter, which
+* must be a \b random \b access \b cljonic \b collection, such as an \b Array, a \b Range, or a \ref MapView "MapView"
+* of one, with the number of elements given by its first parameter, so it has the same elements as the \b Array returned
+* by \ref Core_TakeLast "TakeLast", but creating it takes constant time and memory, because <b>it does not copy
+* them</b>.  The \b SliceView refers to an \b lvalue second parameter, which must outlive it, and holds a copy of an
+* \b rvalue second parameter.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    const auto a{Array{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    const auto t2{TakeLastView(2, a)};               // SliceView of 8 and 9, referring to a
+    constexpr auto t3{TakeLastView(3, Range<10>{})}; // SliceView of 7, 8, and 9
+
+    // Compiler Error: TakeLastView's second parameter must be a cljonic collection
+    // constexpr auto t{TakeLastView(10, "Hello")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C>
+[[nodiscard]] constexpr auto TakeLastView(const SizeType count, C&& c) noexcept
+{
+    static_assert(IsCljonicCollection<std::remove_cvref_t<C>>,
+                  "TakeLastView's second parameter must be a cljonic collection");
+
+    const auto start{(c.Count() > count) ? (c.Count() - count) : 0};
+    return SliceView<C>{std::forward<C>(c), start};
+}
+
 } // namespace core
 
 } // namespace cljonic
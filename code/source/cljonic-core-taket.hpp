@@ -0,0 +1,52 @@
+#ifndef CLJONIC_CORE_TAKET_HPP
+#define CLJONIC_CORE_TAKET_HPP
+
+#include "cljonic-collection-maximum-element-count.hpp"
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_TakeT
+* The \b TakeT function returns a \b transducer, for use with \ref Core_Transduce "Transduce" and
+* \ref Core_Into "Into", that passes on the number of elements given by its parameter, and then stops the reduction, so
+* no more elements of the collection are visited.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto Add = [](const int a, const int b) { return a + b; };
+
+    constexpr auto t0{Transduce(TakeT(3), Add, 0, Range<1000>{})};             // 3
+    constexpr auto t1{Into(Array<int, 10>{}, TakeT(3), Repeat<1000, int>{7})}; // immutable, sparse, 7, 7, and 7
+    constexpr auto t2{Into(Array<int, 10>{}, TakeT(0), Range<10>{})};          // immutable, empty
+
+    return 0;
+}
+~~~~~
+*/
+[[nodiscard]] constexpr auto TakeT(const SizeType count) noexcept
+{
+    return [count](auto step)
+    {
+        return [count, step, taken = SizeType{0}](auto& accumulator, const auto& element) mutable
+        {
+            if (taken == count)
+                return false;
+            ++taken;
+            return step(accumulator, element) and (taken < count);
+        };
+    };
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_TAKET_HPP
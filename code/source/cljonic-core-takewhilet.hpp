@@ -0,0 +1,48 @@
+#ifndef CLJONIC_CORE_TAKEWHILET_HPP
+#define CLJONIC_CORE_TAKEWHILET_HPP
+
+#include <utility>
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_TakeWhileT
+* The \b TakeWhileT function returns a \b transducer, for use with \ref Core_Transduce "Transduce" and
+* \ref Core_Into "Into", that passes on elements while its parameter, which must be a \b unary \b predicate, returns
+* \b true for them, and stops the reduction at the first element for which it returns \b false.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto Add = [](const int a, const int b) { return a + b; };
+    constexpr auto LessThan4 = [](const int i) { return i < 4; };
+
+    constexpr auto t0{Transduce(TakeWhileT(LessThan4), Add, 0, Range<1000>{})};        // 6
+    constexpr auto t1{Into(Array<int, 10>{}, TakeWhileT(LessThan4), Array{1, 5, 2})}; // immutable, sparse, 1
+
+    return 0;
+}
+~~~~~
+*/
+template <typename F>
+[[nodiscard]] constexpr auto TakeWhileT(F&& f) noexcept
+{
+    return [f = std::forward<F>(f)](auto step)
+    {
+        return [f, step](auto& accumulator, const auto& element) mutable
+        { return f(element) and step(accumulator, element); };
+    };
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_TAKEWHILET_HPP
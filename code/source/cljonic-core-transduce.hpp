@@ -0,0 +1,74 @@
+#ifndef CLJONIC_CORE_TRANSDUCE_HPP
+#define CLJONIC_CORE_TRANSDUCE_HPP
+
+#include <utility>
+#include "cljonic-concepts.hpp"
+
+namespace cljonic
+{
+
+namespace core
+{
+
+/** \anchor Core_Transduce
+* The \b Transduce function reduces its fourth parameter, which must be a \b cljonic \b collection, with its second
+* parameter, which must be a \b binary \b function of an accumulated value and an element that returns the next
+* accumulated value, starting with its third parameter, after transforming the elements with its first parameter, which
+* must be a \b transducer, and returns the final accumulated value.
+*
+* A \b transducer, such as the result of \ref Core_MapT "MapT", \ref Core_FilterT "FilterT", \ref Core_TakeT "TakeT",
+* \ref Core_TakeWhileT "TakeWhileT", or \ref Core_DedupeT "DedupeT", is a function that takes a \b step function and
+* returns a new \b step function. A \b step function is called with a reference to the accumulated value and an element,
+* updates the accumulated value, and returns \b false when the reduction should stop. Transducers compose with
+* \ref Core_Compose "Compose", and the elements flow through them from left to right, so
+* <b>Compose(MapT(f), FilterT(p))</b> maps each element and then filters it.  The whole pipeline runs in a single pass
+* over the collection, without storing any intermediate results, and stops as soon as any transducer says it is done.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+int main()
+{
+    constexpr auto Add = [](const int a, const int b) { return a + b; };
+    constexpr auto Square = [](const int i) { return i * i; };
+    constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+
+    // the sum of the squares of the first three even numbers, 0 + 4 + 16
+    constexpr auto t0{Transduce(Compose(FilterT(Even), MapT(Square), TakeT(3)), Add, 0, Range<1000>{})}; // 20
+
+    constexpr auto t1{Transduce(MapT(Square), Add, 0, Array{1, 2, 3})};   // 14
+    constexpr auto t2{Transduce(TakeT(2), Add, 100, Repeat<10, int>{1})}; // 102
+    constexpr auto t3{Transduce(MapT(Square), Add, 7, Array<int, 5>{})};  // 7
+
+    // Compiler Error: Transduce's fourth parameter must be a cljonic collection
+    // constexpr auto t{Transduce(MapT(Square), Add, 0, 7)};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename XF, typename F, typename T, typename C>
+[[nodiscard]] constexpr auto Transduce(XF&& xf, F&& f, const T& t, const C& c) noexcept
+{
+    static_assert(IsCljonicCollection<C>, "Transduce's fourth parameter must be a cljonic collection");
+
+    auto result{t};
+    auto step{xf(
+        [&f](T& accumulator, const auto& element)
+        {
+            accumulator = f(accumulator, element);
+            return true;
+        })};
+    for (const auto& element : c)
+        if (not step(result, element))
+            break;
+    return result;
+}
+
+} // namespace core
+
+} // namespace cljonic
+
+#endif // CLJONIC_CORE_TRANSDUCE_HPP
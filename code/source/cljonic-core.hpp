@@ -66,11 +66,19 @@
  *
  * ## Collection Types
  *
- * - \ref Array  "cljonic::Array"
- * - \ref Range  "cljonic::Range"
- * - \ref Repeat "cljonic::Repeat"
- * - \ref Set    "cljonic::Set"
- * - \ref String "cljonic::String"
+ * - \ref Array      "cljonic::Array"
+ * - \ref FilterView "cljonic::FilterView"
+ * - \ref HashMap    "cljonic::HashMap"
+ * - \ref HashSet    "cljonic::HashSet"
+ * - \ref MapView    "cljonic::MapView"
+ * - \ref Range      "cljonic::Range"
+ * - \ref RemoveView "cljonic::RemoveView"
+ * - \ref Repeat     "cljonic::Repeat"
+ * - \ref Set        "cljonic::Set"
+ * - \ref SliceView  "cljonic::SliceView"
+ * - \ref SortedSet  "cljonic::SortedSet"
+ * - \ref SpanView   "cljonic::SpanView"
+ * - \ref String     "cljonic::String"
  *
  * ## Core Functions
  *
@@ -113,30 +121,43 @@
  *
  * ### Seq (i.e., Sequence: Array, Range, Repeat, Set, And/Or String)
  *
+ * - \ref Core_ArrayOf "ArrayOf", \ref Core_Assoc "Assoc"
  * - \ref Core_Compose "Compose", \ref Core_Concat "Concat", \ref Core_Conj "Conj", \ref
  * Core_Conj_M "Conj_M", \ref Core_Count "Count", \ref Core_Count_M "Count_M", \ref Core_Cycle "Cycle"
  * - \ref Core_Dedupe "Dedupe", \ref Core_DedupeBy "DedupeBy", \ref Core_DefaultElement "DefaultElement",
- * \ref Core_DefaultElement_M "DefaultElement_M", \ref Core_Different "Different", \ref Core_Distinct "Distinct",
- * \ref Core_DistinctBy "DistinctBy", \ref Core_Drop "Drop", \ref Core_DropLast "DropLast",
+ * \ref Core_DefaultElement_M "DefaultElement_M", \ref Core_Different "Different", \ref Core_Dissoc "Dissoc",
+ * \ref Core_Distinct "Distinct", \ref Core_DistinctBy "DistinctBy", \ref Core_Drop "Drop",
+ * \ref Core_DropView "DropView", \ref Core_DropLast "DropLast", \ref Core_DropLastView "DropLastView",
  * \ref Core_DropWhile "DropWhile"
  * - \ref Core_Empty_M "Empty_M", \ref Core_Equal "Equal", \ref Core_EqualBy "EqualBy", \ref Core_Every "Every"
  * - \ref Core_Filter "Filter", \ref Core_First "First", \ref Core_Flatten "Flatten",
- * \ref Core_FlattenSize "FlattenSize", \ref Core_Frequencies "Frequencies", \ref Core_FrequenciesBy "FrequenciesBy"
+ * \ref Core_FlattenSize "FlattenSize", \ref Core_Freeze "Freeze", \ref Core_Frequencies "Frequencies",
+ * \ref Core_FrequenciesBy "FrequenciesBy"
  * - \ref Core_Identical "Identical", \ref Core_Identity "Identity", \ref Core_IndexOf "IndexOf", \ref Core_IndexOfBy
- * "IndexOfBy", \ref Core_Interleave "Interleave", \ref Core_Interpose "Interpose", \ref Core_IsDistinct "IsDistinct",
- * \ref Core_IsDistinctBy "IsDistinctBy", \ref Core_IsEmpty "IsEmpty", \ref Core_IsFull "IsFull", \ref Core_Iterate
- * "Iterate"
+ * "IndexOfBy", \ref Core_IndexOfMax "IndexOfMax", \ref Core_IndexOfMin "IndexOfMin", \ref Core_Interleave
+ * "Interleave", \ref Core_Interpose "Interpose", \ref Core_IsDistinct "IsDistinct", \ref Core_IsDistinctBy
+ * "IsDistinctBy", \ref Core_IsEmpty "IsEmpty", \ref Core_IsFull "IsFull", \ref Core_Iterate "Iterate"
  * - \ref Core_Juxt "Juxt"
  * - \ref Core_Last "Last", \ref Core_LastIndexOf "LastIndexOf", \ref Core_LastIndexOfBy "LastIndexOfBy"
  * - \ref Core_Map "Map", \ref Core_Max "Max", \ref Core_MaxBy "MaxBy", \ref Core_Min "Min", \ref Core_MinBy "MinBy"
  * - \ref Core_NotAny "NotAny", \ref Core_NotEvery "NotEvery", \ref Core_Nth "Nth", \ref Core_Nth_M "Nth_M"
  * - \ref Core_Partition "Partition", \ref Core_PartitionAll "PartitionAll", \ref Core_PartitionBy "PartitionBy"
- * - \ref Core_Reduce "Reduce", \ref Core_Reductions "Reductions", \ref Core_Remove "Remove",
- * \ref Core_Replace "Replace", \ref Core_Reverse "Reverse"
+ * - \ref Core_Reduce "Reduce", \ref Core_Reducers "Reducers", \ref Core_Reductions "Reductions",
+ * \ref Core_Remove "Remove", \ref Core_Replace "Replace", \ref Core_Reverse "Reverse"
  * - \ref Core_Second "Second", \ref Core_Seq "Seq", \ref Core_Size "Size", \ref Core_Some "Some",
- * \ref Core_Sort "Sort", \ref Core_SortBy "SortBy", \ref Core_SplitAt "SplitAt", \ref Core_SplitWith "SplitWith",
- * \ref Core_Subs "Subs"
- * - \ref Core_Take "Take", \ref Core_TakeLast "TakeLast", \ref Core_TakeNth "TakeNth", \ref Core_TakeWhile "TakeWhile"
+ * \ref Core_Sort "Sort", \ref Core_SortBy "SortBy", \ref Core_SplitAt "SplitAt", \ref Core_SplitAtView "SplitAtView",
+ * \ref Core_SplitWith "SplitWith", \ref Core_SplitWithView "SplitWithView", \ref Core_StableSort "StableSort",
+ * \ref Core_StableSortBy "StableSortBy", \ref Core_Subs "Subs", \ref Core_SubsView "SubsView"
+ * - \ref Core_Take "Take", \ref Core_TakeView "TakeView", \ref Core_TakeLast "TakeLast",
+ * \ref Core_TakeLastView "TakeLastView", \ref Core_TakeNth "TakeNth", \ref Core_TakeWhile "TakeWhile"
+ *
+ * ### Transducer
+ *
+ * - \ref Core_DedupeT "DedupeT"
+ * - \ref Core_FilterT "FilterT"
+ * - \ref Core_Into "Into"
+ * - \ref Core_MapT "MapT"
+ * - \ref Core_TakeT "TakeT", \ref Core_TakeWhileT "TakeWhileT", \ref Core_Transduce "Transduce"
  *
  * ## Regex Functions
  *
@@ -156,16 +177,17 @@
  *
  * - \ref String_Capitalize "Capitalize", \ref String_Compare "Compare", \ref String_Concat "Concat"
  * - \ref String_EndsWith "EndsWith"
- * - \ref String_FloatToString "FloatToString", \ref String_Format "Format"
- * - \ref String_Includes "Includes", \ref String_IndexOf "IndexOf", \ref String_Interpose "Interpose",
- * \ref String_IntToString "IntToString", \ref String_IntToStringHex "IntToStringHex", \ref String_IsBlank "IsBlank"
- * - \ref String_LastIndexOf "LastIndexOf", \ref String_Lowercase "Lowercase"
- * - \ref String_Partition "Partition", \ref String_PartitionAll "PartitionAll", \ref String_PartitionBy "PartitionBy"
+ * - \ref String_Format "Format"
+ * - \ref String_Includes "Includes", \ref String_IndexOfSubstring "IndexOfSubstring",
+ * \ref String_Interpose "Interpose", \ref String_IntToStringHex "IntToStringHex", \ref String_IsBlank "IsBlank"
+ * - \ref String_Join "Join"
+ * - \ref String_LastIndexOfSubstring "LastIndexOfSubstring", \ref String_Lowercase "Lowercase"
+ * - \ref String_ParseAll "ParseAll", \ref String_ParseFloat "ParseFloat", \ref String_ParseInt "ParseInt",
+ * \ref String_Partition "Partition", \ref String_PartitionAll "PartitionAll", \ref String_PartitionBy "PartitionBy"
  * - \ref String_Replace "Replace", \ref String_ReplaceFirst "ReplaceFirst"
  * - \ref String_Split "Split", \ref String_SplitCount "SplitCount", \ref String_SplitLine "SplitLine",
- * \ref String_StartsWith "StartsWith", \ref String_StrLen "StrLen", \ref String_StrOfChar "StrOfChar",
- * \ref String_StrToFloat "StrToFloat", \ref String_StrToIntDecimal "StrToIntDecimal",
- * \ref String_StrToIntHex "StrToIntHex", \ref String_Subs "Subs"
+ * \ref String_StartsWith "StartsWith", \ref String_Str "Str", \ref String_StrLen "StrLen",
+ * \ref String_StrOfChar "StrOfChar", \ref String_StrToIntHex "StrToIntHex", \ref String_Subs "Subs"
  * - \ref String_Trim "Trim", \ref String_TrimLeft "TrimLeft", \ref String_TrimNewLine "TrimNewLine",
  * \ref String_TrimRight "TrimRight"
  * - \ref String_Uppercase "Uppercase"
@@ -173,8 +195,18 @@
 
 /** \anchor Namespace_Core
  * The \b Core namespace provides the vast majority of \b cljonic functions.  Many \b Core functions deal with
- * \ref Array, \ref Range, \ref Repeat, \ref Set, and \ref String, collections. The variety and capability of the
- * \b Core functions provide much of the overall value of the <b>cljonic functional style of programming</b>.
+ * \ref Array, \ref HashMap, \ref HashSet, \ref Range, \ref Repeat, \ref Set, \ref SortedSet, and \ref String,
+ * collections, with the lazy \ref MapView, \ref FilterView, and \ref RemoveView views of them, and \ref SliceView
+ * slices of them, and with \ref SpanView
+ * views of contiguous data, such as a \b std::span or \b std::string_view, stored elsewhere. The variety and
+ * capability of the \b Core functions provide much of the overall value of the <b>cljonic functional style of
+ * programming</b>.
+ */
+
+/** \anchor Namespace_String
+ * The \b String namespace provides functions, like \b Clojure's \b clojure.string functions, that search and
+ * transform chars.  They accept a \ref String, a char \ref Array, a \ref SpanView or \ref SliceView of contiguous
+ * chars, and, where they only read them, a \b C \b string, and they return \b Strings rather than \b Arrays.
  */
 
 namespace cljonic
@@ -184,6 +216,10 @@ namespace core
 {
 } // namespace core
 
+namespace string
+{
+} // namespace string
+
 } // namespace cljonic
 
 #endif // CLJONIC_CORE_HPP
@@ -0,0 +1,229 @@
+#ifndef CLJONIC_FILTERVIEW_HPP
+#define CLJONIC_FILTERVIEW_HPP
+
+#include <type_traits>
+#include <utility>
+#include "cljonic-collection-type.hpp"
+#include "cljonic-concepts.hpp"
+#include "cljonic-shared.hpp"
+
+namespace cljonic
+{
+
+// The lazy view shared by FilterView, which keeps the elements that match its predicate, and RemoveView, which keeps
+// the elements that do not
+template <typename F, typename C, bool KeepMatches>
+class SelectView
+{
+    using Collection = std::remove_cvref_t<C>;
+
+    static_assert(IsCljonicCollection<Collection>,
+                  "A FilterView or RemoveView collection must be a cljonic collection");
+
+    static_assert(IsUnaryPredicate<const F&, typename Collection::value_type>,
+                  "A FilterView or RemoveView function is not a valid unary predicate for the collection value type");
+
+    using ElementType = typename Collection::value_type;
+    using CollectionIteratorType = decltype(std::declval<const Collection&>().begin());
+
+    F m_f;
+    std::conditional_t<std::is_lvalue_reference_v<C>, const Collection&, Collection> m_collection;
+
+    class SelectViewIterator
+    {
+        const F& m_f;
+        CollectionIteratorType m_iterator;
+        CollectionIteratorType m_end;
+        ElementType m_element; // the selected element, so an element of a view chain is computed only once
+
+        constexpr void SkipUnselectedElements() noexcept
+        {
+            for (; m_iterator != m_end; ++m_iterator)
+            {
+                m_element = *m_iterator;
+                if (KeepMatches == static_cast<bool>(m_f(m_element)))
+                    break;
+            }
+        }
+
+      public:
+        constexpr SelectViewIterator(const F& f,
+                                     const CollectionIteratorType& iterator,
+                                     const CollectionIteratorType& end) noexcept
+            : m_f(f), m_iterator(iterator), m_end(end), m_element(ElementType{})
+        {
+            SkipUnselectedElements();
+        }
+
+        [[nodiscard]] constexpr ElementType operator*() const noexcept
+        {
+            return m_element;
+        }
+
+        constexpr SelectViewIterator& operator++() noexcept
+        {
+            ++m_iterator;
+            SkipUnselectedElements();
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool operator!=(const SelectViewIterator& other) const noexcept
+        {
+            return m_iterator != other.m_iterator;
+        }
+
+        constexpr SelectViewIterator& operator+=(const int value) noexcept
+        {
+            for (auto i{0}; ((i < value) and (m_iterator != m_end)); ++i)
+                ++(*this);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr SelectViewIterator operator+(const int value) const noexcept
+        {
+            SelectViewIterator temp = *this;
+            temp += value;
+            return temp;
+        }
+    }; // SelectViewIterator
+
+  public:
+    using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::View>;
+    using size_type = SizeType;
+    using value_type = ElementType;
+
+    template <typename G, typename D>
+    constexpr SelectView(G&& f, D&& collection) noexcept
+        : m_f(std::forward<G>(f)), m_collection(std::forward<D>(collection))
+    {
+    }
+
+    constexpr SelectView(const SelectView& other) noexcept = default; // Copy constructor
+    constexpr SelectView(SelectView&& other) noexcept = default;      // Move constructor
+
+    [[nodiscard]] constexpr SelectViewIterator begin() const noexcept
+    {
+        return SelectViewIterator{m_f, m_collection.begin(), m_collection.end()};
+    }
+
+    [[nodiscard]] constexpr SelectViewIterator end() const noexcept
+    {
+        return SelectViewIterator{m_f, m_collection.end(), m_collection.end()};
+    }
+
+    [[nodiscard]] constexpr ElementType operator[](const SizeType index) const noexcept
+    {
+        // the selected elements are not stored, so finding one of them is a linear search
+        SizeType i{0};
+        for (const auto& element : *this)
+            if (index == i++)
+                return element;
+        return DefaultElement();
+    }
+
+    [[nodiscard]] constexpr SizeType Count() const noexcept
+    {
+        SizeType result{0};
+        for (auto it{begin()}; it != end(); ++it)
+            ++result;
+        return result;
+    }
+
+    [[nodiscard]] constexpr const ElementType& DefaultElement() const noexcept
+    {
+        return m_collection.DefaultElement();
+    }
+
+    [[nodiscard]] static consteval SizeType MaximumCount() noexcept
+    {
+        return Collection::MaximumCount();
+    }
+}; // class SelectView
+
+/** \anchor FilterView
+ * The \b FilterView type is a \b lazy collection type in cljonic.  A \b FilterView holds a \b unary \b predicate and
+ * a \b cljonic \b collection, and has the elements of the collection for which the predicate returns \b true, so it
+ * has the same elements as the \b Array returned by \ref Core_Filter "Filter", but <b>does not store them</b>.  Its
+ * elements are found as it is iterated, so its \b Count and its indexing operator are linear in the size of the
+ * collection, while iterating over it, as \ref Core_Seq "Seq" and \ref Core_Take "Take" do, is a single pass.  Like
+ * \ref MapView "MapView", a \b FilterView holds a reference to an \b lvalue collection, and a copy of an \b rvalue
+ * collection, such as another view, and \ref Core_Equal "Equal" compares it, element by element, with an \b Array, a
+ * \b Range, a \b Repeat, or another view.
+ *
+ ~~~~~{.cpp}
+ #include "cljonic.hpp"
+
+ using namespace cljonic;
+ using namespace cljonic::core;
+
+ int main()
+ {
+     constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+     constexpr auto Square = [](const int i) { return i * i; };
+
+     const auto a{Array{1, 2, 3, 4}};
+     const auto v0{FilterView{Even, a}};                                  // lazy 2 and 4, referring to a
+     constexpr auto v1{FilterView{Even, MapView{Square, Range<1000>{}}}}; // lazy 0, 4, 16, ..., 996004
+     constexpr auto a0{Take(3, v1)};                                      // immutable, sparse Array, 0, 4, and 16
+
+     // Compiler Error: A FilterView or RemoveView collection must be a cljonic collection
+     // const auto v{FilterView{Even, 4}};
+
+     // Compiler Error: A FilterView or RemoveView function is not a valid unary predicate for the collection value
+     //                 type
+     // const auto v{FilterView{Even, Array<const char*, 5>{}}};
+
+     return 0;
+ }
+ ~~~~~
+ */
+template <typename F, typename C>
+class FilterView : public SelectView<F, C, true>
+{
+  public:
+    using SelectView<F, C, true>::SelectView;
+}; // class FilterView
+
+// Support declarations like: auto v{FilterView{f, a}};
+// Equivalent to auto v{FilterView<decltype(f), const A&>{f, a}};
+template <typename F, typename C>
+FilterView(F&&, C&&) -> FilterView<std::decay_t<F>, C>;
+
+/** \anchor RemoveView
+ * The \b RemoveView type is a \b lazy collection type in cljonic that is exactly like a \ref FilterView "FilterView",
+ * except that it has the elements of its collection for which its predicate returns \b false, so it has the same
+ * elements as the \b Array returned by \ref Core_Remove "Remove".
+ *
+ ~~~~~{.cpp}
+ #include "cljonic.hpp"
+
+ using namespace cljonic;
+ using namespace cljonic::core;
+
+ int main()
+ {
+     constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+
+     const auto a{Array{1, 2, 3, 4}};
+     const auto v0{RemoveView{Even, a}};                    // lazy 1 and 3, referring to a
+     constexpr auto a0{Seq(RemoveView{Even, Range<10>{}})}; // immutable, sparse Array, 1, 3, 5, 7, and 9
+
+     return 0;
+ }
+ ~~~~~
+ */
+template <typename F, typename C>
+class RemoveView : public SelectView<F, C, false>
+{
+  public:
+    using SelectView<F, C, false>::SelectView;
+}; // class RemoveView
+
+// Support declarations like: auto v{RemoveView{f, a}};
+// Equivalent to auto v{RemoveView<decltype(f), const A&>{f, a}};
+template <typename F, typename C>
+RemoveView(F&&, C&&) -> RemoveView<std::decay_t<F>, C>;
+
+} // namespace cljonic
+
+#endif // CLJONIC_FILTERVIEW_HPP
@@ -0,0 +1,284 @@
+#ifndef CLJONIC_HASHMAP_HPP
+#define CLJONIC_HASHMAP_HPP
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+#include "cljonic-collection-type.hpp"
+#include "cljonic-concepts.hpp"
+#include "cljonic-shared.hpp"
+
+namespace cljonic
+{
+
+/** \anchor HashMap
+ * The \b HashMap type is a fundamental immutable associative collection type in cljonic, similar to a \b Clojure
+ * \b hash-map.  It is implemented as a C array of \b std::pair key/value entries plus an \b open \b addressing hash
+ * table of indexes into that array, and <b>does not use dynamic memory</b>.  A \b HashMap has a specified maximum
+ * number of entries, each with a \b unique key of the same specified type, which must be an \b integral,
+ * \b enumeration, or \b C \b string type, and a value of the same specified type.  A \b HashMap is a function of its
+ * keys. A \b HashMap called with a key that it does not contain will return the \b default value (i.e., V{}).
+ *
+ * A \b HashMap is a collection of its \b std::pair<K, V> entries, in \b no \b particular \b order, so \b Core
+ * functions like \ref Core_Map "Map", \ref Core_Filter "Filter" and \ref Core_Reduce "Reduce" work with its entries.
+ * The \ref Core_Assoc "Assoc" and \ref Core_Dissoc "Dissoc" functions return new \b HashMaps with an entry added,
+ * replaced, or removed.
+ *
+ * The \b HashMap constructor returns an instance of HashMap initialized with its key/value pair arguments. When a key
+ * is repeated the last value wins.
+ *
+ ~~~~~{.cpp}
+ #include "cljonic.hpp"
+
+ using namespace cljonic;
+
+ int main()
+ {
+     constexpr auto m0{HashMap<int, int, 10>{}};                                    // immutable, empty
+     constexpr auto m1{HashMap<int, int, 10>{std::pair{1, 11}, std::pair{2, 22}}};  // immutable, sparse
+     constexpr auto m2{HashMap{std::pair{1, 11}, std::pair{2, 22}}};                // immutable, full
+     const auto m3{HashMap{std::pair{"one", 1.1}, std::pair{"two", 2.2}}};          // immutable, full
+     constexpr auto v0{m1.Get(2)};                                                  // 22
+     constexpr auto v1{m1(3)};                                                      // 0
+     constexpr auto b0{m1.ContainsKey(1)};                                          // true
+
+     // Compiler Error: HashMap initialized with too many entries
+     // constexpr auto m{HashMap<int, int, 1>{std::pair{1, 11}, std::pair{2, 22}}};
+
+     // Compiler Error: A HashMap key type must be an integral, enumeration, or C string type
+     // constexpr auto m{HashMap<double, int, 10>{}};
+
+     // Compiler Error: Attempt to create a HashMap bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT
+     // constexpr auto m{HashMap<int, int, 1111>{}};
+
+     return 0;
+ }
+ ~~~~~
+ */
+template <typename K, ValidCljonicContainerElementType V, SizeType MaxElements>
+class HashMap
+{
+    static_assert(IsHashable<K>, "A HashMap key type must be an integral, enumeration, or C string type");
+
+    static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+
+    static_assert(maximumElements == MaxElements,
+                  "Attempt to create a HashMap bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+
+    static constexpr SizeType slotCount{HashSlotCount(maximumElements)};
+
+    using Entry = std::pair<K, V>;
+    using SlotType = HashSlotType<maximumElements>;
+
+    SizeType m_elementCount;
+    Entry m_elementDefault;
+    Entry m_elements[maximumElements]{};
+    SlotType m_slots[slotCount]{}; // zero is an empty slot, otherwise one more than the index of an entry
+
+    template <typename L, typename W, SizeType N>
+    constexpr friend void MAssoc(HashMap<L, W, N>& map, const L& key, const W& value);
+
+    template <typename L, typename W, SizeType N>
+    constexpr friend void MDissoc(HashMap<L, W, N>& map, const L& key);
+
+    [[nodiscard]] static constexpr SizeType HomeSlotIndex(const K& key) noexcept
+    {
+        return HashValue(key) & (slotCount - 1);
+    }
+
+    [[nodiscard]] constexpr SizeType SlotIndex(const K& key) const noexcept
+    {
+        // linear probing always finds the key, or an empty slot, because the table is never more than half full
+        auto i{HomeSlotIndex(key)};
+        while ((0 != m_slots[i]) and not AreEqual(key, m_elements[m_slots[i] - 1].first))
+            i = (i + 1) & (slotCount - 1);
+        return i;
+    }
+
+    constexpr void Assoc(const K& key, const V& value) noexcept
+    {
+        const auto i{SlotIndex(key)};
+        if (0 != m_slots[i])
+        {
+            m_elements[m_slots[i] - 1].second = value;
+        }
+        else if (m_elementCount < maximumElements)
+        {
+            m_elements[m_elementCount++] = Entry{key, value};
+            m_slots[i] = static_cast<SlotType>(m_elementCount);
+        }
+    }
+
+    constexpr void RemoveSlot(SizeType i) noexcept
+    {
+        // backward shift deletion keeps every remaining key reachable from its home slot without tombstones
+        for (auto j{(i + 1) & (slotCount - 1)}; 0 != m_slots[j]; j = (j + 1) & (slotCount - 1))
+        {
+            const auto home{HomeSlotIndex(m_elements[m_slots[j] - 1].first)};
+            const auto homeIsBetweenIAndJ{(i <= j) ? ((i < home) and (home <= j)) : ((i < home) or (home <= j))};
+            if (not homeIsBetweenIAndJ)
+            {
+                m_slots[i] = m_slots[j];
+                i = j;
+            }
+        }
+        m_slots[i] = 0;
+    }
+
+    constexpr void Dissoc(const K& key) noexcept
+    {
+        const auto i{SlotIndex(key)};
+        if (0 != m_slots[i])
+        {
+            const auto index{static_cast<SizeType>(m_slots[i] - 1)};
+            const auto lastIndex{m_elementCount - 1};
+            RemoveSlot(i);
+            if (index != lastIndex) // move the last entry into the hole, and point its slot at its new index
+            {
+                m_elements[index] = m_elements[lastIndex];
+                m_slots[SlotIndex(m_elements[index].first)] = static_cast<SlotType>(index + 1);
+            }
+            m_elements[lastIndex] = m_elementDefault;
+            --m_elementCount;
+        }
+    }
+
+  public:
+    using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::HashMap>;
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = SizeType;
+    using value_type = Entry;
+
+    constexpr HashMap() noexcept : m_elementCount(0), m_elementDefault(Entry{})
+    {
+    }
+
+    template <typename... Args>
+    constexpr explicit HashMap(const Args&... entries) noexcept : m_elementCount(0), m_elementDefault(Entry{})
+    {
+        static_assert(sizeof...(Args) <= MaximumCount(), "HashMap initialized with too many entries");
+        (Assoc(entries.first, entries.second), ...);
+    }
+
+    // Copy constructor; std::pair entries defeat a defaulted copy constructor in constant expressions
+    constexpr HashMap(const HashMap& other) noexcept
+        : m_elementCount(other.m_elementCount), m_elementDefault(other.m_elementDefault)
+    {
+        for (SizeType i{0}; i < m_elementCount; ++i)
+            m_elements[i] = other.m_elements[i];
+        for (SizeType i{0}; i < slotCount; ++i)
+            m_slots[i] = other.m_slots[i];
+    }
+
+    constexpr HashMap(HashMap&& other) noexcept : HashMap(other) // Move constructor
+    {
+    }
+
+  private:
+    using Iterator = const Entry*; // the elements are contiguous, so a pointer is a contiguous iterator
+
+  public:
+    [[nodiscard]] constexpr Iterator begin() const noexcept
+    {
+        return m_elements;
+    }
+
+    [[nodiscard]] constexpr Iterator end() const noexcept
+    {
+        return m_elements + m_elementCount;
+    }
+
+    [[nodiscard]] constexpr Entry operator[](const SizeType index) const noexcept
+    {
+        return At(index);
+    }
+
+    [[nodiscard]] constexpr V operator()(const K& key) const noexcept
+    {
+        return Get(key);
+    }
+
+    constexpr HashMap& operator=(const HashMap& other) noexcept
+    {
+        if (this != &other)
+        {
+            m_elementCount = other.m_elementCount;
+            m_elementDefault = other.m_elementDefault;
+            for (SizeType i{0}; i < m_elementCount; ++i)
+                m_elements[i] = other.m_elements[i];
+            for (SizeType i{0}; i < slotCount; ++i)
+                m_slots[i] = other.m_slots[i];
+        }
+        return *this;
+    }
+
+    constexpr HashMap& operator=(HashMap&& other) noexcept
+    {
+        return *this = other; // Delegate to copy assignment
+    }
+
+    [[nodiscard]] constexpr const Entry& At(const SizeType index) const noexcept
+    {
+        return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr bool ContainsKey(const K& key) const noexcept
+    {
+        return 0 != m_slots[SlotIndex(key)];
+    }
+
+    [[nodiscard]] constexpr SizeType Count() const noexcept
+    {
+        return m_elementCount;
+    }
+
+    [[nodiscard]] constexpr const Entry& DefaultElement() const noexcept
+    {
+        return m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
+                                                                const Entry& entry) const noexcept
+    {
+        return (index < m_elementCount) and ContainsKey(entry.first) and AreEqual(Get(entry.first), entry.second);
+    }
+
+    [[nodiscard]] constexpr V Get(const K& key) const noexcept
+    {
+        const auto i{SlotIndex(key)};
+        return (0 != m_slots[i]) ? m_elements[m_slots[i] - 1].second : m_elementDefault.second;
+    }
+
+    [[nodiscard]] constexpr V Get(const K& key, const V& notFound) const noexcept
+    {
+        const auto i{SlotIndex(key)};
+        return (0 != m_slots[i]) ? m_elements[m_slots[i] - 1].second : notFound;
+    }
+
+    [[nodiscard]] static consteval SizeType MaximumCount() noexcept
+    {
+        return maximumElements;
+    }
+}; // class HashMap
+
+// Support declarations like: auto m{HashMap{std::pair{1, 11}, std::pair{2, 22}}};
+// Equivalent to auto m{HashMap<int, int, 2>{std::pair{1, 11}, std::pair{2, 22}}};
+template <typename K, typename V, typename... Args>
+HashMap(std::pair<K, V>, Args...) -> HashMap<K, V, 1 + sizeof...(Args)>;
+
+template <typename L, typename W, SizeType N>
+constexpr void MAssoc(HashMap<L, W, N>& map, const L& key, const W& value)
+{
+    map.Assoc(key, value);
+}
+
+template <typename L, typename W, SizeType N>
+constexpr void MDissoc(HashMap<L, W, N>& map, const L& key)
+{
+    map.Dissoc(key);
+}
+
+} // namespace cljonic
+
+#endif // CLJONIC_HASHMAP_HPP
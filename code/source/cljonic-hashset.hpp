@@ -0,0 +1,203 @@
+#ifndef CLJONIC_HASHSET_HPP
+#define CLJONIC_HASHSET_HPP
+
+#include <concepts>
+#include <type_traits>
+#include "cljonic-collection-type.hpp"
+#include "cljonic-concepts.hpp"
+#include "cljonic-shared.hpp"
+
+namespace cljonic
+{
+
+/** \anchor HashSet
+ * The \b HashSet type is an immutable collection type in cljonic that behaves exactly like a \ref Set "Set", but
+ * answers \b Contains in \b constant \b expected \b time. It is implemented as a C array of elements, kept in insertion
+ * order, plus an \b open \b addressing hash table of indexes into that array, and <b>does not use dynamic memory</b>.
+ * A \b HashSet has a specified maximum number of \b unique elements each of the same specified type, which must be an
+ * \b integral, \b enumeration, or \b C \b string type.  A \b HashSet is a function of its elements. A \b HashSet
+ * called with a value not contained within the set will return its \b default \b element.  A \b HashSet is a \b Set
+ * as far as the \ref Namespace_Core "Core" functions are concerned, so a \b HashSet may be compared with a \b Set.
+ *
+ * The \b HashSet constructor returns an instance of HashSet initialized with the unique elements in its arguments.
+ *
+ ~~~~~{.cpp}
+ #include "cljonic.hpp"
+
+ using namespace cljonic;
+
+ int main()
+ {
+     const auto s0{HashSet<int, 10>{}};           // immutable, empty
+     const auto s1{HashSet<int, 10>{1, 2, 3, 4}}; // immutable, sparse
+     const auto s2{HashSet<int, 4>{1, 2, 3, 4}};  // immutable, full
+     const auto s5{HashSet{1, 2, 3, 4}};          // immutable, full of four int values
+     const auto s6{HashSet{1, 2, 1, 4}};          // immutable, sparse with three unique int values
+
+     // Compiler Error: HashSet initialized with too many elements
+     // constexpr auto s{HashSet<int, 4>{0, 2, 4, 5, 6, 7, 8, 9}};
+
+     // Compiler Error:
+     //     Floating point types should not be compared for equality,
+     //     hence HashSets of floating point types are not allowed
+     // const auto s{HashSet{1.1, 2.2}};
+
+     // Compiler Error: A HashSet type must be an integral, enumeration, or C string type
+     // struct Point
+     // {
+     //     int x;
+     //     int y;
+     //     bool operator==(const Point&) const = default;
+     // };
+     // const auto s{HashSet<Point, 10>{}};
+
+     // Compiler Error: Attempt to create a HashSet bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT
+     // const auto s{HashSet<int, 1111>{}};
+
+     return 0;
+ }
+ ~~~~~
+ */
+template <ValidCljonicContainerElementType T, SizeType MaxElements>
+class HashSet
+{
+    static_assert(not std::floating_point<T>,
+                  "Floating point types should not be compared for equality, hence HashSets of floating point types "
+                  "are not allowed");
+
+    static_assert(std::equality_comparable<T>, "A HashSet type must be equality comparable");
+
+    static_assert(IsHashable<T>, "A HashSet type must be an integral, enumeration, or C string type");
+
+    static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+
+    static_assert(maximumElements == MaxElements,
+                  "Attempt to create a HashSet bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+
+    static constexpr SizeType slotCount{HashSlotCount(maximumElements)};
+
+    using SlotType = HashSlotType<maximumElements>;
+
+    SizeType m_elementCount;
+    T m_elementDefault;
+    T m_elements[maximumElements]{};
+    SlotType m_slots[slotCount]{}; // zero is an empty slot, otherwise one more than the index of an element
+
+    [[nodiscard]] constexpr SizeType SlotIndex(const T& element) const noexcept
+    {
+        // linear probing always finds the element, or an empty slot, because the table is never more than half full
+        auto i{HashValue(element) & (slotCount - 1)};
+        while ((0 != m_slots[i]) and not AreEqual(element, m_elements[m_slots[i] - 1]))
+            i = (i + 1) & (slotCount - 1);
+        return i;
+    }
+
+    constexpr void Insert(const T& element) noexcept
+    {
+        const auto i{SlotIndex(element)};
+        if (0 == m_slots[i])
+        {
+            m_elements[m_elementCount++] = element;
+            m_slots[i] = static_cast<SlotType>(m_elementCount);
+        }
+    }
+
+    [[nodiscard]] constexpr bool IsUniqueElementBy(const auto& f, const T& element) const noexcept
+    {
+        auto result{true};
+        for (SizeType i{0}; (result and (i < m_elementCount)); ++i)
+            result = not AreEqualBy(f, element, m_elements[i]);
+        return result;
+    }
+
+  public:
+    using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Set>;
+    using size_type = SizeType;
+    using value_type = T;
+
+    constexpr HashSet() noexcept : m_elementCount(0), m_elementDefault(T{})
+    {
+    }
+
+    template <typename... Args>
+    constexpr explicit HashSet(Args... elements) noexcept : m_elementCount(0), m_elementDefault(T{})
+    {
+        static_assert(sizeof...(Args) <= MaximumCount(), "HashSet initialized with too many elements");
+        (Insert(elements), ...);
+    }
+
+    constexpr HashSet(const HashSet& other) noexcept = default; // Copy constructor
+    constexpr HashSet(HashSet&& other) noexcept = default;      // Move constructor
+
+  private:
+    using Iterator = const T*; // the elements are contiguous, so a pointer is a contiguous iterator
+
+  public:
+    [[nodiscard]] constexpr Iterator begin() const noexcept
+    {
+        return m_elements;
+    }
+
+    [[nodiscard]] constexpr Iterator end() const noexcept
+    {
+        return m_elements + m_elementCount;
+    }
+
+    [[nodiscard]] constexpr T operator[](const SizeType index) const noexcept
+    {
+        return At(index);
+    }
+
+    [[nodiscard]] constexpr T operator()(const T& t) const noexcept
+    {
+        return Contains(t) ? t : m_elementDefault;
+    }
+
+    constexpr HashSet& operator=(const HashSet& other) noexcept = default;
+
+    constexpr HashSet& operator=(HashSet&& other) noexcept = default;
+
+    [[nodiscard]] constexpr const T& At(const SizeType index) const noexcept
+    {
+        return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr SizeType Count() const noexcept
+    {
+        return m_elementCount;
+    }
+
+    [[nodiscard]] constexpr bool ContainsBy(const auto& f, const T& element) const noexcept
+    {
+        return not IsUniqueElementBy(f, element);
+    }
+
+    [[nodiscard]] constexpr bool Contains(const T& element) const noexcept
+    {
+        return 0 != m_slots[SlotIndex(element)];
+    }
+
+    [[nodiscard]] constexpr const T& DefaultElement() const noexcept
+    {
+        return m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
+                                                                const T& element) const noexcept
+    {
+        return (index < m_elementCount) and Contains(element);
+    }
+
+    [[nodiscard]] static consteval SizeType MaximumCount() noexcept
+    {
+        return maximumElements;
+    }
+}; // class HashSet
+
+// Support declarations like: auto v{HashSet{1, 2, 3}}; // Equivalent to auto v{HashSet<int, 3>{1, 2, 3}};
+template <typename... Args>
+HashSet(Args...) -> HashSet<std::common_type_t<Args...>, sizeof...(Args)>;
+
+} // namespace cljonic
+
+#endif // CLJONIC_HASHSET_HPP
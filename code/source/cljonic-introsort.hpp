@@ -0,0 +1,138 @@
+#ifndef CLJONIC_INTROSORT_HPP
+#define CLJONIC_INTROSORT_HPP
+
+#include <utility>
+#include "cljonic-collection-maximum-element-count.hpp"
+
+namespace cljonic
+{
+
+// Partitions smaller than this are finished with an insertion sort, which is faster than quicksort for them
+constexpr SizeType IntroSortInsertionSortCutoff{16};
+
+template <typename T, typename F>
+constexpr void InsertionSortBy(T* elements, const SizeType count, F& lessThan) noexcept
+{
+    for (SizeType i{1}; i < count; ++i)
+    {
+        auto key{std::move(elements[i])};
+        auto j{i};
+        while ((j > 0) and lessThan(key, elements[j - 1]))
+        {
+            elements[j] = std::move(elements[j - 1]);
+            --j;
+        }
+        elements[j] = std::move(key);
+    }
+}
+
+template <typename T, typename F>
+constexpr void SiftDownBy(T* elements, SizeType root, const SizeType count, F& lessThan) noexcept
+{
+    for (auto child{(2 * root) + 1}; child < count; child = (2 * root) + 1)
+    {
+        if (((child + 1) < count) and lessThan(elements[child], elements[child + 1]))
+            ++child;
+        if (not lessThan(elements[root], elements[child]))
+            return;
+        std::swap(elements[root], elements[child]);
+        root = child;
+    }
+}
+
+template <typename T, typename F>
+constexpr void HeapSortBy(T* elements, const SizeType count, F& lessThan) noexcept
+{
+    for (auto i{count / 2}; i > 0; --i)
+        SiftDownBy(elements, (i - 1), count, lessThan);
+    for (auto end{count}; end > 1; --end)
+    {
+        std::swap(elements[0], elements[end - 1]);
+        SiftDownBy(elements, 0, (end - 1), lessThan);
+    }
+}
+
+template <typename T, typename F>
+constexpr SizeType PartitionBy(T* elements, const SizeType count, F& lessThan) noexcept
+{
+    // #lizard forgives -- The complexity of this function is acceptable
+
+    // order the first, middle and last elements, then use their median, moved to the front, as the pivot
+    const auto middle{count / 2};
+    const auto last{count - 1};
+    if (lessThan(elements[middle], elements[0]))
+        std::swap(elements[middle], elements[0]);
+    if (lessThan(elements[last], elements[middle]))
+    {
+        std::swap(elements[last], elements[middle]);
+        if (lessThan(elements[middle], elements[0]))
+            std::swap(elements[middle], elements[0]);
+    }
+    std::swap(elements[0], elements[middle]);
+
+    // Hoare partition, which stops on elements equal to the pivot so runs of duplicates split evenly; the index checks
+    // keep a predicate that is not a strict weak ordering from walking off either end; the pivot is referred to, rather
+    // than copied, because the loop never swaps elements[0]
+    const auto& pivot{elements[0]};
+    SizeType i{0};
+    SizeType j{count};
+    while (true)
+    {
+        do
+            ++i;
+        while ((i < last) and lessThan(elements[i], pivot));
+        do
+            --j;
+        while ((j > 0) and lessThan(pivot, elements[j]));
+        if (i >= j)
+            break;
+        std::swap(elements[i], elements[j]);
+    }
+    std::swap(elements[0], elements[j]);
+    return j;
+}
+
+template <typename T, typename F>
+constexpr void IntroSortBy(T* elements, SizeType count, SizeType depthLimit, F& lessThan) noexcept
+{
+    while (count > IntroSortInsertionSortCutoff)
+    {
+        if (0 == depthLimit) // quicksort is degenerating, so guarantee O(n log n) with heapsort
+        {
+            HeapSortBy(elements, count, lessThan);
+            return;
+        }
+        --depthLimit;
+        const auto p{PartitionBy(elements, count, lessThan)};
+        if (p < (count - p - 1)) // recurse on the smaller side, and loop on the larger, to bound the stack depth
+        {
+            IntroSortBy(elements, p, depthLimit, lessThan);
+            elements += (p + 1);
+            count -= (p + 1);
+        }
+        else
+        {
+            IntroSortBy((elements + p + 1), (count - p - 1), depthLimit, lessThan);
+            count = p;
+        }
+    }
+    InsertionSortBy(elements, count, lessThan);
+}
+
+/* IntroSort
+ * Sorts count elements in place with an introsort: a median-of-three quicksort that switches to heapsort when its
+ * recursion depth exceeds 2*log2(count), and to insertion sort for small partitions.  It is O(n log n) in the worst
+ * case, constexpr, and uses neither the heap nor exceptions.  It is not stable.
+ */
+template <typename T, typename F>
+constexpr void IntroSort(T* elements, const SizeType count, F& lessThan) noexcept
+{
+    SizeType depthLimit{0};
+    for (auto n{count}; n > 1; n /= 2)
+        depthLimit += 2;
+    IntroSortBy(elements, count, depthLimit, lessThan);
+}
+
+} // namespace cljonic
+
+#endif // CLJONIC_INTROSORT_HPP
@@ -18,11 +18,20 @@ namespace cljonic
  * first parameter \b "f" and the second parameter \b "x" then the sequence is: \b x, \b f(x), \b f(f(x)),
  * \b f(f(f(x))), etc.
  *
+ * An \b Iterator does not store its elements: each one is computed from the one before it when the \b Iterator is
+ * iterated, so \ref Core_Take "Take", \ref Core_TakeWhile "TakeWhile", \ref Core_Some "Some", \ref Core_Every
+ * "Every", \ref Core_IndexOf "IndexOf", \ref Core_Map "Map", \ref Core_First "First", and \ref Core_Nth "Nth" call
+ * the function only as many times as they need elements, rather than \b MaximumCount times, an \b Iterator can be
+ * the collection of a \ref FilterView "FilterView" or a \ref MapView "MapView", and all of them can be used in a
+ * constant expression.  An \b Iterator has no index operator, because the element at an index is computed from all
+ * of the ones before it.  Like every \b cljonic \b collection, an \b Iterator ends after \b MaximumCount elements.
+ *
  * The \b Iterator constructor returns an instance of Iterator initialized with its parameters.
 ~~~~~{.cpp}
 #include "cljonic.hpp"
 
 using namespace cljonic;
+using namespace cljonic::core;
 
 int TimesTen(const int x) noexcept
 {
@@ -33,6 +42,9 @@ int main()
 {
     auto i0{Iterator{[](const double d) { return 1.1 * d; }, 11.1}};
     auto i1{Iterator{TimesTen, 1}};
+    constexpr auto Double = [](const int i) { return 2 * i; };
+    constexpr auto a0{Take(4, Iterator{Double, 1})}; // immutable, sparse Array, 1, 2, 4, and 8, calling Double 3 times
+    constexpr auto n{Nth(Iterator{Double, 1}, 10)};  // 1024, calling Double 10 times
 
     // Compiler Error: Iterator constructor's first parameter is not a unary function of its second parameter
     // const auto i{Iterator{[](const double d) { return 1.1 * d; }, "Hello"}};
@@ -46,12 +58,15 @@ class Iterator
 {
     F m_f;
     T m_initialValue;
+    T m_elementDefault;
 
+    // Holds the Iterator by pointer, rather than copying its function, and computes the next element only when it is
+    // incremented, so a function that stops iterating after n elements calls the function n - 1 times
     class Itr
     {
-        F m_f;
+        const Iterator* m_iterator;
         SizeType m_index;
-        T m_nextValue;
+        T m_value;
 
       public:
         using value_type = T;
@@ -59,27 +74,27 @@ class Iterator
         using pointer = T*;
         using reference = T&;
 
-        Itr(const Iterator& iterator, SizeType index)
-            : m_f{iterator.m_f}, m_index{index}, m_nextValue{iterator.m_initialValue}
+        constexpr Itr(const Iterator& iterator, const SizeType index) noexcept
+            : m_iterator{&iterator}, m_index{index}, m_value{iterator.m_initialValue}
         {
         }
 
-        [[nodiscard]] T operator*() const
+        [[nodiscard]] constexpr T operator*() const noexcept
         {
-            return m_nextValue;
+            return m_value;
         }
 
-        Itr& operator++()
+        constexpr Itr& operator++() noexcept
         {
-            if (m_index < Iterator::MaximumCount())
-            {
-                m_nextValue = m_f(m_nextValue);
-                ++m_index;
-            }
+            // the element after the last one is not computed, because it is never read
+            if (++m_index < Iterator::MaximumCount())
+                m_value = m_iterator->m_f(m_value);
+            else
+                m_index = Iterator::MaximumCount();
             return *this;
         }
 
-        [[nodiscard]] bool operator!=(const Itr& other) const
+        [[nodiscard]] constexpr bool operator!=(const Itr& other) const noexcept
         {
             return m_index != other.m_index;
         }
@@ -90,7 +105,8 @@ class Iterator
     using size_type = SizeType;
     using value_type = T;
 
-    constexpr explicit Iterator(F&& f, const T& t) noexcept : m_f{std::forward<F>(f)}, m_initialValue{t}
+    constexpr explicit Iterator(F&& f, const T& t) noexcept
+        : m_f{std::forward<F>(f)}, m_initialValue{t}, m_elementDefault{T{}}
     {
         static_assert(IsUnaryFunction<F, T>,
                       "Iterator constructor's first parameter is not a unary function of its second parameter");
@@ -99,24 +115,29 @@ class Iterator
     constexpr Iterator(const Iterator& other) = default; // Copy constructor
     constexpr Iterator(Iterator&& other) = default;      // Move constructor
 
-    [[nodiscard]] Itr begin()
+    [[nodiscard]] constexpr Itr begin() const noexcept
     {
         return Itr(*this, 0);
     }
 
-    [[nodiscard]] Itr end()
+    [[nodiscard]] constexpr Itr end() const noexcept
     {
         return Itr(*this, MaximumCount());
     }
 
     [[nodiscard]] constexpr SizeType Count() const noexcept
     {
-        return CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT;
+        return MaximumCount();
+    }
+
+    [[nodiscard]] constexpr const T& DefaultElement() const noexcept
+    {
+        return m_elementDefault;
     }
 
-    [[nodiscard]] static constexpr auto MaximumCount() noexcept
+    [[nodiscard]] static consteval SizeType MaximumCount() noexcept
     {
-        return CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT;
+        return CljonicCollectionMaximumElementCount;
     }
 }; // class Iterator
 
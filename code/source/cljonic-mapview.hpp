@@ -0,0 +1,168 @@
+#ifndef CLJONIC_MAPVIEW_HPP
+#define CLJONIC_MAPVIEW_HPP
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+#include "cljonic-collection-type.hpp"
+#include "cljonic-concepts.hpp"
+#include "cljonic-shared.hpp"
+
+namespace cljonic
+{
+
+/** \anchor MapView
+ * The \b MapView type is a \b lazy collection type in cljonic.  A \b MapView holds a function and a \b cljonic
+ * \b collection, and computes each of its elements on demand by calling the function with the corresponding element of
+ * the collection, so it has the same elements as the \b Array returned by \ref Core_Map "Map", but <b>does not store
+ * them</b>.  A \b MapView holds a reference to a collection that is an \b lvalue, and a copy of a collection that is
+ * an \b rvalue, such as another view, so chains of views like \b MapView and \ref FilterView "FilterView" fuse into a
+ * single pass over the original collection, which happens when the chain is passed to a \ref Namespace_Core "Core"
+ * function such as \ref Core_Seq "Seq" or \ref Core_Take "Take".  \ref Core_Equal "Equal" compares a \b MapView,
+ * element by element, with an \b Array, a \b Range, a \b Repeat, or another view.
+ *
+ ~~~~~{.cpp}
+ #include "cljonic.hpp"
+
+ using namespace cljonic;
+ using namespace cljonic::core;
+
+ int main()
+ {
+     constexpr auto TwoTimes = [](const int i) { return 2 * i; };
+     constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+
+     const auto a{Array{1, 2, 3, 4}};
+     const auto v0{MapView{TwoTimes, a}};                                 // lazy 2, 4, 6, and 8, referring to a
+     constexpr auto v1{MapView{TwoTimes, Range<10>{}}};                   // lazy 0, 2, 4, ..., 18
+     constexpr auto v2{MapView{TwoTimes, FilterView{Even, Range<10>{}}}}; // lazy 0, 4, 8, 12, and 16
+     constexpr auto a0{Seq(v2)};                                          // immutable, sparse Array, 0, 4, 8, 12, 16
+     constexpr auto e0{v1[3]};                                            // 6
+
+     // Compiler Error: A MapView collection must be a cljonic collection
+     // const auto v{MapView{TwoTimes, 4}};
+
+     // Compiler Error: A MapView function cannot be called with values from its cljonic collection
+     // const auto v{MapView{[](const char* s) { return s[0]; }, Array{1, 2, 3}}};
+
+     return 0;
+ }
+ ~~~~~
+ */
+template <typename F, typename C>
+class MapView
+{
+    using Collection = std::remove_cvref_t<C>;
+
+    static_assert(IsCljonicCollection<Collection>, "A MapView collection must be a cljonic collection");
+
+    static_assert(std::invocable<const F&, typename Collection::value_type>,
+                  "A MapView function cannot be called with values from its cljonic collection");
+
+    using ElementType = std::decay_t<std::invoke_result_t<const F&, typename Collection::value_type>>;
+    using CollectionIteratorType = decltype(std::declval<const Collection&>().begin());
+
+    F m_f;
+    std::conditional_t<std::is_lvalue_reference_v<C>, const Collection&, Collection> m_collection;
+    ElementType m_elementDefault;
+
+    class MapViewIterator
+    {
+        const F& m_f;
+        CollectionIteratorType m_iterator;
+
+      public:
+        constexpr MapViewIterator(const F& f, const CollectionIteratorType& iterator) noexcept
+            : m_f(f), m_iterator(iterator)
+        {
+        }
+
+        [[nodiscard]] constexpr ElementType operator*() const noexcept
+        {
+            return m_f(*m_iterator);
+        }
+
+        [[nodiscard]] constexpr ElementType operator[](const SizeType index) const noexcept
+            requires requires(const CollectionIteratorType& it, const SizeType i) { it[i]; }
+        {
+            return m_f(m_iterator[index]);
+        }
+
+        constexpr MapViewIterator& operator++() noexcept
+        {
+            ++m_iterator;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool operator!=(const MapViewIterator& other) const noexcept
+        {
+            return m_iterator != other.m_iterator;
+        }
+
+        constexpr MapViewIterator& operator+=(const int value) noexcept
+        {
+            m_iterator += value;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr MapViewIterator operator+(const int value) const noexcept
+        {
+            MapViewIterator temp = *this;
+            temp += value;
+            return temp;
+        }
+    }; // MapViewIterator
+
+  public:
+    using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::View>;
+    using size_type = SizeType;
+    using value_type = ElementType;
+
+    template <typename G, typename D>
+    constexpr MapView(G&& f, D&& collection) noexcept
+        : m_f(std::forward<G>(f)), m_collection(std::forward<D>(collection)), m_elementDefault(ElementType{})
+    {
+    }
+
+    constexpr MapView(const MapView& other) noexcept = default; // Copy constructor
+    constexpr MapView(MapView&& other) noexcept = default;      // Move constructor
+
+    [[nodiscard]] constexpr MapViewIterator begin() const noexcept
+    {
+        return MapViewIterator{m_f, m_collection.begin()};
+    }
+
+    [[nodiscard]] constexpr MapViewIterator end() const noexcept
+    {
+        return MapViewIterator{m_f, m_collection.end()};
+    }
+
+    [[nodiscard]] constexpr ElementType operator[](const SizeType index) const noexcept
+    {
+        return (index < m_collection.Count()) ? m_f(m_collection[index]) : m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr SizeType Count() const noexcept
+    {
+        return m_collection.Count();
+    }
+
+    [[nodiscard]] constexpr const ElementType& DefaultElement() const noexcept
+    {
+        return m_elementDefault;
+    }
+
+    [[nodiscard]] static consteval SizeType MaximumCount() noexcept
+    {
+        return Collection::MaximumCount();
+    }
+}; // class MapView
+
+// Support declarations like: auto v{MapView{f, a}};
+// Equivalent to auto v{MapView<decltype(f), const A&>{f, a}};
+template <typename F, typename C>
+MapView(F&&, C&&) -> MapView<std::decay_t<F>, C>;
+
+} // namespace cljonic
+
+#endif // CLJONIC_MAPVIEW_HPP
@@ -0,0 +1,69 @@
+#ifndef CLJONIC_MERGESORT_HPP
+#define CLJONIC_MERGESORT_HPP
+
+#include <utility>
+#include "cljonic-collection-maximum-element-count.hpp"
+#include "cljonic-introsort.hpp"
+
+namespace cljonic
+{
+
+// Runs of this many elements are sorted with an insertion sort before they are merged
+constexpr SizeType MergeSortRunLength{16};
+
+template <typename T, typename F>
+constexpr void MergeBy(T* source,
+                       T* destination,
+                       const SizeType begin,
+                       const SizeType middle,
+                       const SizeType end,
+                       F& lessThan) noexcept
+{
+    // take from the right run only when it is strictly less, so equal elements keep their order; the source elements
+    // are moved, rather than copied, because the next pass overwrites them
+    auto i{begin};
+    auto j{middle};
+    auto k{begin};
+    while ((i < middle) and (j < end))
+        destination[k++] = lessThan(source[j], source[i]) ? std::move(source[j++]) : std::move(source[i++]);
+    while (i < middle)
+        destination[k++] = std::move(source[i++]);
+    while (j < end)
+        destination[k++] = std::move(source[j++]);
+}
+
+/* MergeSort
+ * Sorts count elements in place with a bottom-up merge sort: runs of MergeSortRunLength elements are insertion sorted,
+ * then merged pairwise back and forth between elements and scratch, which must have room for count elements.  It is
+ * stable, O(n log n) in the worst case, constexpr, and uses neither the heap nor exceptions.
+ */
+template <typename T, typename F>
+constexpr void MergeSort(T* elements, T* scratch, const SizeType count, F& lessThan) noexcept
+{
+    for (SizeType begin{0}; begin < count; begin += MergeSortRunLength)
+    {
+        const auto runLength{((count - begin) < MergeSortRunLength) ? (count - begin) : MergeSortRunLength};
+        InsertionSortBy((elements + begin), runLength, lessThan);
+    }
+    auto source{elements};
+    auto destination{scratch};
+    for (auto width{MergeSortRunLength}; width < count; width *= 2)
+    {
+        for (SizeType begin{0}; begin < count; begin += (2 * width))
+        {
+            const auto middle{((count - begin) < width) ? count : (begin + width)};
+            const auto end{((count - middle) < width) ? count : (middle + width)};
+            MergeBy(source, destination, begin, middle, end, lessThan);
+        }
+        const auto merged{destination};
+        destination = source;
+        source = merged;
+    }
+    if (source != elements)
+        for (SizeType i{0}; i < count; ++i)
+            elements[i] = std::move(source[i]);
+}
+
+} // namespace cljonic
+
+#endif // CLJONIC_MERGESORT_HPP
@@ -9,21 +9,51 @@ namespace cljonic
 template <ValidCljonicContainerElementType T, SizeType MaxElements>
 class Array;
 
+template <typename F, typename C>
+class FilterView;
+
+template <typename K, ValidCljonicContainerElementType V, SizeType MaxElements>
+class HashMap;
+
+template <ValidCljonicContainerElementType T, SizeType MaxElements>
+class HashSet;
+
+template <typename F, typename C>
+class MapView;
+
 template <int... StartEndStep>
 class Range;
 
+template <typename F, typename C>
+class RemoveView;
+
 template <SizeType MaxElements, typename T>
 class Repeat;
 
 template <ValidCljonicContainerElementType T, SizeType MaxElements>
 class Set;
 
+template <ValidCljonicContainerElementType T, SizeType MaxElements>
+class SortedSet;
+
+template <typename C>
+class SliceView;
+
+template <typename T>
+class SpanView;
+
 template <SizeType MaxElements>
 class String;
 
 namespace core
 {
 
+template <SizeType N, auto f>
+consteval auto ArrayOf() noexcept;
+
+template <typename C, typename K, typename V>
+constexpr auto Assoc(const C& c, const K& k, const V& v) noexcept;
+
 template <typename F1, typename F2>
 constexpr auto Compose(F1&& f1, F2&& f2) noexcept;
 
@@ -47,15 +77,27 @@ constexpr auto Dedupe(const C& c) noexcept;
 template <typename F, typename C>
 constexpr auto DedupeBy(F&& f, const C& c) noexcept;
 
+template <typename T>
+constexpr auto DedupeT() noexcept;
+
 template <typename C>
 constexpr auto DefaultElement(const C& c) noexcept;
 
+template <typename C, typename K>
+constexpr auto Dissoc(const C& c, const K& k) noexcept;
+
 template <typename C>
 constexpr auto Drop(const SizeType count, const C& c) noexcept;
 
+template <typename C>
+constexpr auto DropView(const SizeType count, C&& c) noexcept;
+
 template <typename C>
 constexpr auto DropLast(const SizeType count, const C& c) noexcept;
 
+template <typename C>
+constexpr auto DropLastView(const SizeType count, C&& c) noexcept;
+
 template <typename F, typename C>
 constexpr auto DropWhile(F&& f, const C& c) noexcept;
 
@@ -71,9 +113,15 @@ constexpr auto Every(F&& f, const C& c) noexcept;
 template <typename F, typename C>
 constexpr auto Filter(F&& f, const C& c) noexcept;
 
+template <typename F>
+constexpr auto FilterT(F&& f) noexcept;
+
 template <typename C>
 constexpr auto First(const C& coll) noexcept;
 
+template <auto pipeline>
+consteval auto Freeze() noexcept;
+
 template <typename T, typename... Ts>
 constexpr auto Identical(const T& t, const Ts&... ts) noexcept;
 
@@ -89,6 +137,12 @@ constexpr auto IndexOf(const C& c, const T& t) noexcept;
 template <typename F, typename C, typename T>
 constexpr auto IndexOfBy(F&& f, const C& c, const T& t) noexcept;
 
+template <typename C>
+constexpr SizeType IndexOfMax(const C& c) noexcept;
+
+template <typename C>
+constexpr SizeType IndexOfMin(const C& c) noexcept;
+
 constexpr auto Interleave() noexcept;
 
 template <typename C, typename... Cs>
@@ -97,6 +151,9 @@ constexpr auto Interleave(const C& c, const Cs&... cs) noexcept;
 template <typename T, typename C>
 constexpr auto Interpose(const T& t, const C& c) noexcept;
 
+template <typename A, typename XF, typename C>
+constexpr auto Into(const A& a, XF&& xf, const C& c) noexcept;
+
 template <typename T, typename... Ts>
 constexpr auto IsDistinct(const T& t, const Ts&... ts) noexcept;
 
@@ -124,6 +181,9 @@ constexpr auto LastIndexOfBy(F&& f, const C& c, const T& t) noexcept;
 template <typename F, typename C, typename... Cs>
 constexpr auto Map(F&& f, const C& c, const Cs&... cs) noexcept;
 
+template <typename F>
+constexpr auto MapT(F&& f) noexcept;
+
 template <typename T, typename... Ts>
 constexpr auto Max(const T& t, const Ts&... ts) noexcept;
 
@@ -181,27 +241,59 @@ constexpr auto Sort(F&& f, const C& c) noexcept;
 template <typename F, typename C>
 constexpr auto SortBy(F&& f, const C& c) noexcept;
 
+template <typename C>
+constexpr auto StableSort(const C& c) noexcept;
+
+template <typename F, typename C>
+constexpr auto StableSortBy(F&& f, const C& c) noexcept;
+
 template <typename C>
 constexpr auto SplitAt(const SizeType count, const C& c) noexcept;
 
+template <typename C>
+constexpr auto SplitAtView(const SizeType count, C&& c) noexcept;
+
 template <typename F, typename C>
 constexpr auto SplitWith(F&& f, const C& c) noexcept;
 
+template <typename F, typename C>
+constexpr auto SplitWithView(F&& f, C&& c) noexcept;
+
 template <typename C>
 constexpr auto Subs(const C& c, const SizeType start, const SizeType end) noexcept;
 
+template <typename C>
+constexpr auto SubsView(C&& c, const SizeType start, const SizeType end) noexcept;
+
+template <typename C>
+constexpr auto SubsView(C&& c, const SizeType start) noexcept;
+
 template <typename C>
 constexpr auto Take(const SizeType count, const C& c) noexcept;
 
+template <typename C>
+constexpr auto TakeView(const SizeType count, C&& c) noexcept;
+
 template <typename C>
 constexpr auto TakeLast(const SizeType count, const C& c) noexcept;
 
+template <typename C>
+constexpr auto TakeLastView(const SizeType count, C&& c) noexcept;
+
 template <typename C>
 constexpr auto TakeNth(const SizeType nth, const C& c) noexcept;
 
+constexpr auto TakeT(const SizeType count) noexcept;
+
 template <typename F, typename C>
 constexpr auto TakeWhile(F&& f, const C& c) noexcept;
 
+template <typename F>
+constexpr auto TakeWhileT(F&& f) noexcept;
+
+template <typename XF, typename F, typename T, typename C>
+constexpr auto Transduce(XF&& xf, F&& f, const T& t, const C& c) noexcept;
+
 } // namespace core
 
 } // namespace cljonic
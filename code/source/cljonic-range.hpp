@@ -53,7 +53,7 @@ int main()
 ~~~~~
  */
 template <int... StartEndStep>
-class Range : public IndexInterface<int>
+class Range
 {
   private:
     static_assert(sizeof...(StartEndStep) <= 3, "Number of Range parameters must be less than or equal to three");
@@ -232,12 +232,12 @@ class Range : public IndexInterface<int>
         return Iterator{*this, m_elementCount};
     }
 
-    [[nodiscard]] constexpr int operator[](const SizeType index) const noexcept override
+    [[nodiscard]] constexpr int operator[](const SizeType index) const noexcept
     {
         return ValueAtIndex(index);
     }
 
-    [[nodiscard]] constexpr SizeType Count() const noexcept override
+    [[nodiscard]] constexpr SizeType Count() const noexcept
     {
         return m_elementCount;
     }
@@ -248,7 +248,7 @@ class Range : public IndexInterface<int>
     }
 
     [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
-                                                                const int& element) const noexcept override
+                                                                const int& element) const noexcept
     {
         return (index < m_elementCount) and AreEqual(ValueAtIndex(index), element);
     }
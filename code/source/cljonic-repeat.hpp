@@ -40,7 +40,7 @@ namespace cljonic
  ~~~~~
  */
 template <SizeType MaxElements, typename T>
-class Repeat : public IndexInterface<T>
+class Repeat
 {
     using Iterator = CollectionIterator<Repeat>;
 
@@ -53,11 +53,6 @@ class Repeat : public IndexInterface<T>
     const T m_elementDefault;
     const T m_elementValue;
 
-    constexpr auto ValueAtIndex(const SizeType index) const noexcept
-    {
-        return ((m_elementCount <= 0) or (index >= m_elementCount)) ? m_elementDefault : m_elementValue;
-    }
-
   public:
     using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Repeat>;
     using size_type = SizeType;
@@ -81,12 +76,17 @@ class Repeat : public IndexInterface<T>
         return Iterator{*this, m_elementCount};
     }
 
-    [[nodiscard]] constexpr T operator[](const SizeType index) const noexcept override
+    [[nodiscard]] constexpr T operator[](const SizeType index) const noexcept
+    {
+        return At(index);
+    }
+
+    [[nodiscard]] constexpr const T& At(const SizeType index) const noexcept
     {
-        return ValueAtIndex(index);
+        return (index < m_elementCount) ? m_elementValue : m_elementDefault;
     }
 
-    [[nodiscard]] constexpr SizeType Count() const noexcept override
+    [[nodiscard]] constexpr SizeType Count() const noexcept
     {
         return m_elementCount;
     }
@@ -97,9 +97,9 @@ class Repeat : public IndexInterface<T>
     }
 
     [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
-                                                                const T& element) const noexcept override
+                                                                const T& element) const noexcept
     {
-        return (index < m_elementCount) and AreEqual(ValueAtIndex(index), element);
+        return (index < m_elementCount) and AreEqual(m_elementValue, element);
     }
 
     [[nodiscard]] static consteval auto MaximumCount() noexcept
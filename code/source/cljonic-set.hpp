@@ -5,7 +5,6 @@
 #include <cstring>
 #include <initializer_list>
 #include <type_traits>
-#include "cljonic-collection-iterator.hpp"
 #include "cljonic-collection-type.hpp"
 #include "cljonic-concepts.hpp"
 #include "cljonic-shared.hpp"
@@ -59,7 +58,7 @@ namespace cljonic
  ~~~~~
  */
 template <ValidCljonicContainerElementType T, SizeType MaxElements>
-class Set : public IndexInterface<T>
+class Set
 {
     static_assert(not std::floating_point<T>,
                   "Floating point types should not be compared for equality, hence Sets of floating point types are "
@@ -74,7 +73,7 @@ class Set : public IndexInterface<T>
 
     SizeType m_elementCount;
     const T m_elementDefault;
-    T m_elements[maximumElements]{};
+    T m_elements[maximumElements]; // only the first m_elementCount are initialized, see InitializeUnusedElements
 
     [[nodiscard]] constexpr bool IsUniqueElementBy(const auto& f, const T& element) const noexcept
     {
@@ -86,10 +85,17 @@ class Set : public IndexInterface<T>
 
     [[nodiscard]] constexpr bool IsUniqueElement(const T& element) const noexcept
     {
-        auto result{true};
-        for (SizeType i{0}; (result and (i < m_elementCount)); ++i)
-            result = not AreEqual(element, m_elements[i]);
-        return result;
+        if constexpr (IsBulkSearchable<T, T>)
+        {
+            return CLJONIC_INVALID_INDEX == IndexOfElement(m_elements, m_elementCount, element);
+        }
+        else
+        {
+            auto result{true};
+            for (SizeType i{0}; (result and (i < m_elementCount)); ++i)
+                result = not AreEqual(element, m_elements[i]);
+            return result;
+        }
     }
 
   public:
@@ -99,6 +105,7 @@ class Set : public IndexInterface<T>
 
     constexpr Set() noexcept : m_elementCount(0), m_elementDefault(T{})
     {
+        InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
     }
 
     template <typename... Args>
@@ -106,28 +113,39 @@ class Set : public IndexInterface<T>
     {
         static_assert(sizeof...(Args) <= MaximumCount(), "Set initialized with too many elements");
         ((IsUniqueElement(elements) ? (m_elements[m_elementCount++] = elements, void()) : void()), ...);
+        InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
     }
 
-    constexpr Set(const Set& other) noexcept = default; // Copy constructor
-    constexpr Set(Set&& other) noexcept = default;      // Move constructor
+    // Copy constructor; copies only the elements in use, rather than the whole capacity
+    constexpr Set(const Set& other) noexcept
+        : m_elementCount(other.m_elementCount), m_elementDefault(other.m_elementDefault)
+    {
+        for (SizeType i{0}; i < m_elementCount; ++i)
+            m_elements[i] = other.m_elements[i];
+        InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+    }
+
+    constexpr Set(Set&& other) noexcept : Set(static_cast<const Set&>(other)) // Move constructor
+    {
+    }
 
   private:
-    using Iterator = CollectionIterator<Set>;
+    using Iterator = const T*; // the elements are contiguous, so a pointer is a contiguous iterator
 
   public:
     [[nodiscard]] constexpr Iterator begin() const noexcept
     {
-        return Iterator{*this, 0};
+        return m_elements;
     }
 
     [[nodiscard]] constexpr Iterator end() const noexcept
     {
-        return Iterator{*this, m_elementCount};
+        return m_elements + m_elementCount;
     }
 
-    [[nodiscard]] constexpr T operator[](const SizeType index) const noexcept override
+    [[nodiscard]] constexpr T operator[](const SizeType index) const noexcept
     {
-        return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+        return At(index);
     }
 
     [[nodiscard]] constexpr T operator()(const T& t) const noexcept
@@ -152,7 +170,12 @@ class Set : public IndexInterface<T>
         return *this = other; // Delegate to copy assignment
     }
 
-    [[nodiscard]] constexpr SizeType Count() const noexcept override
+    [[nodiscard]] constexpr const T& At(const SizeType index) const noexcept
+    {
+        return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr SizeType Count() const noexcept
     {
         return m_elementCount;
     }
@@ -173,7 +196,7 @@ class Set : public IndexInterface<T>
     }
 
     [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
-                                                                const T& element) const noexcept override
+                                                                const T& element) const noexcept
     {
         return (index < m_elementCount) and Contains(element);
     }
@@ -2,24 +2,100 @@
 #define CLJONIC_COMMON_HPP
 
 #include <concepts>
+#include <cstdint>
 #include <cstring>
 #include <limits>
+#include <type_traits>
+#include <utility>
 #include "cljonic-concepts.hpp"
 #include "cljonic-collection-maximum-element-count.hpp"
 
 namespace cljonic
 {
 
+constexpr auto CLJONIC_INVALID_INDEX{std::numeric_limits<SizeType>::max()};
+
+// Whether a collection stores its elements contiguously, like an Array, a String, or a SpanView or SliceView of one, so
+// its begin is a pointer to its first element
+template <typename C>
+concept IsContiguousCollection =
+    IsCljonicCollection<C> and std::is_pointer_v<decltype(std::declval<const C&>().begin())>;
+
+// Whether a collection's iterator indexes its elements, like a pointer, or the iterator of a Range or Repeat, rather
+// than computing each element from the one before it, like the iterator of an Iterator
+template <typename C>
+concept IsRandomAccessCollection =
+    IsCljonicCollection<C> and requires(const C& c) { c.begin()[SizeType{0}]; };
+
+// Whether a collection is a CycleCollection of a collection that stores its elements contiguously, so its elements can
+// be copied a cycle at a time
+template <typename C>
+concept IsContiguousCycle =
+    IsCljonicCycle<C> and IsContiguousCollection<typename C::collection_type>;
+
+// Whether contiguous elements can be compared in bulk with memcmp, because they are integers, or enumerations, whose
+// equal values have equal bytes; floating point values, pointers, which AreEqual compares as C strings, and classes,
+// whose operator== need not compare bytes, are compared one at a time
+template <typename T>
+concept IsBytewiseComparable = (std::integral<T> or std::is_enum_v<T>) and std::has_unique_object_representations_v<T>;
+
+// Whether two collections store the same bytewise comparable element type contiguously, so they can be compared with
+// ElementsAreEqual
+template <typename T, typename U>
+concept AreBytewiseComparableCollections =
+    IsContiguousCollection<T> and IsContiguousCollection<U> and
+    std::same_as<typename T::value_type, typename U::value_type> and IsBytewiseComparable<typename T::value_type>;
+
+// Whether count contiguous t elements equal count contiguous u elements; at run time bytewise comparable elements are
+// compared with memcmp
 template <typename T>
-class IndexInterface
+[[nodiscard]] constexpr bool ElementsAreEqual(const T* t, const T* u, const SizeType count) noexcept
 {
-  public:
-    virtual constexpr SizeType Count() const noexcept = 0;
-    virtual constexpr T operator[](const SizeType index) const noexcept = 0;
-    virtual constexpr bool ElementAtIndexIsEqualToElement(const SizeType index, const T& element) const noexcept = 0;
-};
+    if constexpr (IsBytewiseComparable<T>)
+        if (not std::is_constant_evaluated())
+            return 0 == std::memcmp(t, u, count * sizeof(T));
+    auto result{true};
+    for (SizeType i{0}; (result and (i < count)); ++i)
+        result = (t[i] == u[i]);
+    return result;
+}
 
-constexpr auto CLJONIC_INVALID_INDEX{std::numeric_limits<SizeType>::max()};
+// Copies count contiguous source elements to destination; at run time trivially copyable elements are copied with
+// memcpy, rather than one assignment at a time
+template <typename T>
+constexpr void CopyElements(T* destination, const T* source, const SizeType count) noexcept
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        if (not std::is_constant_evaluated())
+        {
+            std::memcpy(destination, source, count * sizeof(T));
+            return;
+        }
+    }
+    for (SizeType i{0}; i < count; ++i)
+        destination[i] = source[i];
+}
+
+// Whether two collections are compared by iterating both, rather than by counting and indexing them, because one of
+// them, like a FilterView or an Iterator, finds its count and its elements only by iterating
+template <typename T, typename U>
+concept AreIteratedCollections = IsCljonicCollection<T> and IsCljonicCollection<U> and
+                                 not(IsRandomAccessCollection<T> and IsRandomAccessCollection<U>);
+
+// Whether f is true for each pair of t and u elements, and they have the same count, in a single pass over both
+template <typename F, typename T, typename U>
+[[nodiscard]] constexpr bool ElementsAreEqualBy(F&& f, const T& t, const U& u) noexcept
+{
+    auto tIt{t.begin()};
+    auto uIt{u.begin()};
+    const auto tEnd{t.end()};
+    const auto uEnd{u.end()};
+    for (; ((tIt != tEnd) and (uIt != uEnd)); ++tIt, ++uIt)
+        if (not f(*tIt, *uIt))
+            return false;
+    return (not(tIt != tEnd)) and (not(uIt != uEnd));
+}
 
 template <typename F, typename T, typename U>
 [[nodiscard]] constexpr bool AreEqualBy(F&& f, const T& t, const U& u) noexcept
@@ -33,6 +109,10 @@ template <typename F, typename T, typename U>
             result = t.ContainsBy(f, u[i]);
         return result;
     }
+    else if constexpr (AreIteratedCollections<T, U>)
+    {
+        return ElementsAreEqualBy(f, t, u);
+    }
     else if constexpr (IsCljonicCollection<T> or IsCljonicCollection<U>)
     {
         auto result{t.Count() == u.Count()};
@@ -55,6 +135,25 @@ template <typename T, typename U>
     {
         return std::strcmp(t, u) == 0;
     }
+    else if constexpr (IsCljonicHashMap<T> and IsCljonicHashMap<U>)
+    {
+        // entries are in no particular order, so each entry of u is looked up by key in t
+        auto result{t.Count() == u.Count()};
+        for (SizeType i{0}; (result and (i < u.Count())); ++i)
+        {
+            const auto entry{u[i]};
+            result = t.ContainsKey(entry.first) and AreEqual(t.Get(entry.first), entry.second);
+        }
+        return result;
+    }
+    else if constexpr (IsCljonicSortedSet<T> and IsCljonicSortedSet<U>)
+    {
+        // both sets hold their unique elements in ascending order, so a single linear pass compares them
+        auto result{t.Count() == u.Count()};
+        for (SizeType i{0}; (result and (i < t.Count())); ++i)
+            result = AreEqual(t[i], u[i]);
+        return result;
+    }
     else if constexpr (IsCljonicSet<T> or IsCljonicSet<U>)
     {
         auto result{t.Count() == u.Count()};
@@ -62,6 +161,25 @@ template <typename T, typename U>
             result = t.Contains(u[i]);
         return result;
     }
+    else if constexpr (IsCljonicRange<T> and IsCljonicRange<U>)
+    {
+        // the elements of a Range are an arithmetic progression, determined by its count and first two elements, and
+        // the missing elements of a short Range are its default element, zero
+        return (t.Count() == u.Count()) and (t[0] == u[0]) and (t[1] == u[1]);
+    }
+    else if constexpr (IsCljonicRepeat<T> and IsCljonicRepeat<U>)
+    {
+        // every element of a Repeat is the same
+        return (t.Count() == u.Count()) and ((0 == t.Count()) or AreEqual(t.At(0), u.At(0)));
+    }
+    else if constexpr (AreBytewiseComparableCollections<T, U>)
+    {
+        return (t.Count() == u.Count()) and ElementsAreEqual(t.begin(), u.begin(), t.Count());
+    }
+    else if constexpr (AreIteratedCollections<T, U>)
+    {
+        return ElementsAreEqualBy([](const auto& a, const auto& b) { return AreEqual(a, b); }, t, u);
+    }
     else if constexpr (IsCljonicCollection<T> or IsCljonicCollection<U>)
     {
         auto result{t.Count() == u.Count()};
@@ -88,6 +206,29 @@ template <typename T, typename U>
     }
 }
 
+template <typename T>
+[[nodiscard]] constexpr SizeType HashValue(const T& t) noexcept
+{
+    if constexpr (IsCString<T>)
+    {
+        auto result{static_cast<std::uint64_t>(14695981039346656037ull)}; // FNV-1a
+        for (SizeType i{0}; '\0' != t[i]; ++i)
+            result = (result ^ static_cast<unsigned char>(t[i])) * 1099511628211ull;
+        return static_cast<SizeType>(result);
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        return HashValue(static_cast<std::underlying_type_t<T>>(t));
+    }
+    else
+    {
+        auto result{static_cast<std::uint64_t>(t)}; // splitmix64 finalizer
+        result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ull;
+        result = (result ^ (result >> 27)) * 0x94d049bb133111ebull;
+        return static_cast<SizeType>(result ^ (result >> 31));
+    }
+}
+
 template <typename T, typename... Ts>
 [[nodiscard]] constexpr auto MinArgument(T a, Ts... args) noexcept
 {
@@ -127,11 +268,206 @@ template <typename C, typename... Cs>
     }
 }
 
+[[nodiscard]] consteval SizeType HashSlotCount(const SizeType count) noexcept
+{
+    // smallest power of two that keeps the load factor of an open addressing table at or below one half
+    auto result{static_cast<SizeType>(1)};
+    while (result < (2 * count))
+        result *= 2;
+    return result;
+}
+
+template <SizeType Count>
+using HashSlotType = std::conditional_t<(Count < std::numeric_limits<std::uint16_t>::max()), std::uint16_t, SizeType>;
+
 [[nodiscard]] consteval SizeType MaximumElements(const SizeType count) noexcept
 {
     return MinArgument(count, CljonicCollectionMaximumElementCount);
 }
 
+// At run time a collection leaves the elements beyond its count uninitialized, so creating or copying one costs
+// O(Count) rather than O(MaximumCount), but a constant expression may not hold an uninitialized value, so during
+// constant evaluation those elements are value initialized
+template <typename T>
+constexpr void InitializeUnusedElements(T* elements, const SizeType count, const SizeType maximumCount) noexcept
+{
+    if (std::is_constant_evaluated())
+        for (auto i{count}; i < maximumCount; ++i)
+            elements[i] = T{};
+}
+
+// The element of a collection at an index, by const reference when the collection stores its elements and so has an
+// At member, which spares copying an element, such as a nested Array, only to read it or copy it again
+template <typename C>
+[[nodiscard]] constexpr decltype(auto) ElementAt(const C& c, const SizeType index) noexcept
+{
+    if constexpr (requires { c.At(index); })
+        return c.At(index);
+    else
+        return c[index];
+}
+
+// Reads the elements of a collection in index order with its iterator, rather than by index, so an Iterator, or a
+// view of one, computes each element once, rather than from its first element at each index, and provides the default
+// element past the last element; the iterator is advanced before an element is read, rather than after, so it never
+// computes an element that is not read
+template <typename C>
+class ElementCursor
+{
+    using Iterator = decltype(std::declval<const C&>().begin());
+
+    const C& m_c;
+    Iterator m_it;
+    Iterator m_end;
+    bool m_isStarted;
+
+  public:
+    constexpr explicit ElementCursor(const C& c) noexcept
+        : m_c(c), m_it(c.begin()), m_end(c.end()), m_isStarted(false)
+    {
+    }
+
+    [[nodiscard]] constexpr typename C::value_type Next() noexcept
+    {
+        if (m_isStarted and (m_it != m_end))
+            ++m_it;
+        m_isStarted = true;
+        if (m_it != m_end)
+            return *m_it;
+        return m_c.DefaultElement();
+    }
+};
+
+// Reads the elements of a collection whose iterator indexes its elements, like an Array or a Range, by index, with
+// ElementAt, which also provides the default element past the last element, because indexing such a collection
+// computes no element but the one at the index
+template <typename C>
+    requires IsRandomAccessCollection<C>
+class ElementCursor<C>
+{
+    const C& m_c;
+    SizeType m_index;
+
+  public:
+    constexpr explicit ElementCursor(const C& c) noexcept : m_c(c), m_index(0)
+    {
+    }
+
+    [[nodiscard]] constexpr decltype(auto) Next() noexcept
+    {
+        return ElementAt(m_c, m_index++);
+    }
+};
+
+// Reads the elements of a CycleCollection in index order with its iterator, which wraps around to the first element
+// of the cycled collection without the division that indexing a CycleCollection takes
+template <typename C>
+    requires IsCljonicCycle<C>
+class ElementCursor<C>
+{
+    decltype(std::declval<const C&>().begin()) m_it;
+
+  public:
+    constexpr explicit ElementCursor(const C& c) noexcept : m_it(c.begin())
+    {
+    }
+
+    [[nodiscard]] constexpr auto Next() noexcept
+    {
+        auto result{*m_it};
+        ++m_it;
+        return result;
+    }
+};
+
+// Whether a search for a U among T elements can compare elements with == in bulk, rather than one at a time with
+// AreEqual, because they are integers, or the same enumeration, and so have bitwise equality
+template <typename T, typename U>
+concept IsBulkSearchable = (std::integral<T> and std::integral<U>) or (std::is_enum_v<T> and std::is_same_v<T, U>);
+
+// Whether any of a block of contiguous elements equals t; the comparisons are combined without branching, into an
+// accumulator no wider than the elements, so the compiler compares the block a vector of elements at a time
+template <SizeType blockSize, typename T>
+[[nodiscard]] constexpr bool BlockContains(const T* elements, const T& t) noexcept
+{
+    unsigned result{0};
+    for (SizeType i{0}; i < blockSize; ++i)
+        result |= static_cast<unsigned>(elements[i] == t);
+    return 0 != result;
+}
+
+// Returns the index of the first of count contiguous elements equal to t, or CLJONIC_INVALID_INDEX; at run time one
+// byte elements are found with memchr, and wider elements are skipped a block at a time until a block contains t
+template <typename T>
+[[nodiscard]] constexpr SizeType IndexOfElement(const T* elements, const SizeType count, const T& t) noexcept
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        if (not std::is_constant_evaluated())
+        {
+            const auto found{static_cast<const T*>(std::memchr(elements, static_cast<unsigned char>(t), count))};
+            return (nullptr == found) ? CLJONIC_INVALID_INDEX : static_cast<SizeType>(found - elements);
+        }
+    }
+    constexpr SizeType blockSize{16};
+    SizeType i{0};
+    while (((i + blockSize) <= count) and not BlockContains<blockSize>(elements + i, t))
+        i += blockSize;
+    for (; i < count; ++i)
+        if (elements[i] == t)
+            return i;
+    return CLJONIC_INVALID_INDEX;
+}
+
+// Returns the index of the last of count contiguous elements equal to t, or CLJONIC_INVALID_INDEX, skipping a block at
+// a time from the end until a block contains t
+template <typename T>
+[[nodiscard]] constexpr SizeType LastIndexOfElement(const T* elements, const SizeType count, const T& t) noexcept
+{
+    constexpr SizeType blockSize{16};
+    SizeType i{count};
+    while ((i >= blockSize) and not BlockContains<blockSize>(elements + (i - blockSize), t))
+        i -= blockSize;
+    for (; i > 0; --i)
+        if (elements[i - 1] == t)
+            return i - 1;
+    return CLJONIC_INVALID_INDEX;
+}
+
+// Returns the index of the first, or last, element of a contiguous collection equal to u, or CLJONIC_INVALID_INDEX; u
+// is converted to the element type once, and if the conversion does not preserve its value then no element equals it
+template <bool last, typename T, typename U>
+[[nodiscard]] constexpr SizeType BulkIndexOf(const T* elements, const SizeType count, const U& u) noexcept
+{
+    const auto t{static_cast<T>(u)};
+    if (not(static_cast<U>(t) == u))
+        return CLJONIC_INVALID_INDEX;
+    if constexpr (last)
+        return LastIndexOfElement(elements, count, t);
+    else
+        return IndexOfElement(elements, count, t);
+}
+
+// Returns the index of the first, or last, element of a Range equal to t, or CLJONIC_INVALID_INDEX, in constant time;
+// the elements of a Range are the arithmetic progression first, first + step, first + 2 * step, and so on, so t is an
+// element when its distance from first is a multiple of step less than count steps, and a Range whose step is zero
+// repeats first
+template <bool last, typename R, typename T>
+[[nodiscard]] constexpr SizeType RangeIndexOf(const R& r, const T& t) noexcept
+{
+    const auto value{static_cast<int>(t)};
+    if ((0 == r.Count()) or not(static_cast<T>(value) == t))
+        return CLJONIC_INVALID_INDEX;
+    const auto offset{static_cast<std::int64_t>(value) - r[0]};
+    const auto step{(r.Count() > 1) ? (static_cast<std::int64_t>(r[1]) - r[0]) : std::int64_t{0}};
+    if (0 == step)
+        return (0 != offset) ? CLJONIC_INVALID_INDEX : (last ? (r.Count() - 1) : 0);
+    const auto index{offset / step};
+    return ((0 != (offset % step)) or (index < 0) or (index >= static_cast<std::int64_t>(r.Count())))
+               ? CLJONIC_INVALID_INDEX
+               : static_cast<SizeType>(index);
+}
+
 } // namespace cljonic
 
 #endif // CLJONIC_COMMON_HPP
@@ -0,0 +1,156 @@
+#ifndef CLJONIC_SLICEVIEW_HPP
+#define CLJONIC_SLICEVIEW_HPP
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+#include "cljonic-collection-type.hpp"
+#include "cljonic-concepts.hpp"
+#include "cljonic-shared.hpp"
+
+namespace cljonic
+{
+
+/** \anchor SliceView
+ * The \b SliceView type is a \b non-owning collection type in cljonic, similar to a \b Clojure \b subvec.  A
+ * \b SliceView holds a \b cljonic \b collection, a \b start index, and a \b count, and has the elements of the
+ * collection from index \b start up to, but not including, index \b end, or the end of the collection, so it has the
+ * same elements as the \b Array returned by \ref Core_Subs "Subs", but <b>does not copy them</b>.  Creating a
+ * \b SliceView takes constant time and memory, and indexing one takes the same time as indexing its collection, so its
+ * collection must be a <b>random access</b> collection, such as an \b Array, a \b Range, a \b String, a
+ * \ref SpanView "SpanView", or a \ref MapView "MapView" of one, and not a \ref FilterView "FilterView", which can only
+ * reach an element by stepping over the ones before it.  Like \ref MapView "MapView", a \b SliceView refers to an
+ * \b lvalue collection, and holds a copy of an \b rvalue collection, such as another view, and \ref Core_Equal "Equal"
+ * compares it, element by element, with an \b Array, a \b Range, a \b Repeat, or another view.  The
+ * \ref Core_SubsView "SubsView", \ref Core_TakeView "TakeView", \ref Core_DropView "DropView",
+ * \ref Core_TakeLastView "TakeLastView", \ref Core_DropLastView "DropLastView", \ref Core_SplitAtView "SplitAtView",
+ * and \ref Core_SplitWithView "SplitWithView" functions return \b SliceViews.
+ *
+ ~~~~~{.cpp}
+ #include "cljonic.hpp"
+
+ using namespace cljonic;
+ using namespace cljonic::core;
+
+ int main()
+ {
+     const auto a{Array{11, 12, 13, 14}};
+     const auto v0{SliceView{a, 1, 3}};              // 12 and 13, referring to a
+     const auto v1{SliceView{a, 2}};                 // 13 and 14, referring to a
+     constexpr auto v2{SliceView{Range<100>{}, 90}}; // 90, 91, ..., 99
+     constexpr auto e0{v2[0]};                       // 90
+     constexpr auto a0{Seq(SliceView{v2, 8})};       // immutable, sparse Array, 98 and 99
+
+     // Compiler Error: A SliceView collection must be a cljonic collection
+     // const auto v{SliceView{4, 0}};
+
+     // Compiler Error: A SliceView collection must be a random access collection, not a FilterView
+     // const auto v{SliceView{FilterView{[](const int i) { return i > 11; }, a}, 1}};
+
+     return 0;
+ }
+ ~~~~~
+ */
+template <typename C>
+class SliceView
+{
+    using Collection = std::remove_cvref_t<C>;
+
+    static_assert(IsCljonicCollection<Collection>, "A SliceView collection must be a cljonic collection");
+
+    static_assert(IsRandomAccessCollection<Collection>,
+                  "A SliceView collection must be a random access collection, not a FilterView");
+
+    using ElementType = typename Collection::value_type;
+
+    std::conditional_t<std::is_lvalue_reference_v<C>, const Collection&, Collection> m_collection;
+    SizeType m_start;
+    SizeType m_elementCount;
+    ElementType m_elementDefault;
+
+    template <typename Iterator>
+    [[nodiscard]] static constexpr Iterator Advance(Iterator it, const SizeType n) noexcept
+    {
+        it += static_cast<int>(n); // random access iterators jump
+        return it;
+    }
+
+  public:
+    using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::View>;
+    using size_type = SizeType;
+    using value_type = ElementType;
+
+    template <typename D>
+    constexpr SliceView(D&& collection, const SizeType start, const SizeType end) noexcept
+        : m_collection(std::forward<D>(collection)),
+          m_start(MinArgument(start, m_collection.Count())),
+          m_elementCount(MinArgument(end, m_collection.Count()) - MinArgument(start, end, m_collection.Count())),
+          m_elementDefault(ElementType{})
+    {
+    }
+
+    template <typename D>
+    constexpr SliceView(D&& collection, const SizeType start) noexcept
+        : SliceView(std::forward<D>(collection), start, CljonicCollectionMaximumElementCount)
+    {
+    }
+
+    constexpr SliceView(const SliceView& other) noexcept = default; // Copy constructor
+    constexpr SliceView(SliceView&& other) noexcept = default;      // Move constructor
+
+    [[nodiscard]] constexpr auto begin() const noexcept
+    {
+        return Advance(m_collection.begin(), m_start);
+    }
+
+    [[nodiscard]] constexpr auto end() const noexcept
+    {
+        return Advance(m_collection.begin(), m_start + m_elementCount);
+    }
+
+    [[nodiscard]] constexpr ElementType operator[](const SizeType index) const noexcept
+    {
+        return (index < m_elementCount) ? m_collection[m_start + index] : m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr const ElementType& At(const SizeType index) const noexcept
+        requires requires(const Collection& c, const SizeType i) {
+            { c.At(i) } -> std::same_as<const ElementType&>;
+        }
+    {
+        return (index < m_elementCount) ? m_collection.At(m_start + index) : m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr SizeType Count() const noexcept
+    {
+        return m_elementCount;
+    }
+
+    [[nodiscard]] constexpr const ElementType& DefaultElement() const noexcept
+    {
+        return m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
+                                                                const ElementType& element) const noexcept
+    {
+        return (index < m_elementCount) and AreEqual(ElementAt(m_collection, m_start + index), element);
+    }
+
+    [[nodiscard]] static consteval SizeType MaximumCount() noexcept
+    {
+        return Collection::MaximumCount();
+    }
+}; // class SliceView
+
+// Support declarations like: auto v{SliceView{a, 1, 3}};
+// Equivalent to auto v{SliceView<const A&>{a, 1, 3}};
+template <typename C>
+SliceView(C&&, SizeType, SizeType) -> SliceView<C>;
+
+template <typename C>
+SliceView(C&&, SizeType) -> SliceView<C>;
+
+} // namespace cljonic
+
+#endif // CLJONIC_SLICEVIEW_HPP
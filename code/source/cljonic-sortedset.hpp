@@ -0,0 +1,233 @@
+#ifndef CLJONIC_SORTEDSET_HPP
+#define CLJONIC_SORTEDSET_HPP
+
+#include <concepts>
+#include <type_traits>
+#include "cljonic-collection-type.hpp"
+#include "cljonic-concepts.hpp"
+#include "cljonic-shared.hpp"
+
+namespace cljonic
+{
+
+/** \anchor SortedSet
+ * The \b SortedSet type is an immutable collection type in cljonic that behaves like a \ref Set "Set", but keeps its
+ * \b unique elements in \b ascending \b order.  It is implemented as a C array, and <b>does not use dynamic memory</b>.
+ * Because the elements are ordered, iteration over a \b SortedSet is deterministic, \b Contains uses a \b binary
+ * \b search, and \ref Core_Equal "Equal" compares two \b SortedSets in a single linear pass. The elements are ordered
+ * by their \b less-than operator, except for \b C \b strings, which are ordered by \b strcmp.  A \b SortedSet is a
+ * function of its elements. A \b SortedSet called with a value not contained within the set will return its
+ * \b default \b element.  A \b SortedSet is a \b Set as far as the \ref Namespace_Core "Core" functions are
+ * concerned, so a \b SortedSet may be compared with a \b Set.
+ *
+ * The \b SortedSet constructor returns an instance of SortedSet initialized with the unique elements in its arguments.
+ *
+ ~~~~~{.cpp}
+ #include "cljonic.hpp"
+
+ using namespace cljonic;
+
+ int main()
+ {
+     const auto s0{SortedSet<int, 10>{}};           // immutable, empty
+     const auto s1{SortedSet<int, 10>{4, 2, 3, 1}}; // immutable, sparse, with 1, 2, 3, and 4
+     const auto s2{SortedSet<int, 4>{4, 2, 3, 1}};  // immutable, full, with 1, 2, 3, and 4
+     const auto s5{SortedSet{4, 3, 2, 1}};          // immutable, full of four int values, 1, 2, 3, and 4
+     const auto s6{SortedSet{4, 2, 1, 4}};          // immutable, sparse with three unique int values, 1, 2, and 4
+
+     // Compiler Error: SortedSet initialized with too many elements
+     // constexpr auto s{SortedSet<int, 4>{0, 2, 4, 5, 6, 7, 8, 9}};
+
+     // Compiler Error:
+     //     Floating point types should not be compared for equality,
+     //     hence SortedSets of floating point types are not allowed
+     // const auto s{SortedSet{1.1, 2.2}};
+
+     // Compiler Error: A SortedSet type must be totally ordered
+     // struct Unordered
+     // {
+     //     bool operator==(const Unordered&) const = default;
+     // };
+     // const auto s{SortedSet<Unordered, 10>{}};
+
+     // Compiler Error: Attempt to create a SortedSet bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT
+     // const auto s{SortedSet<int, 1111>{}};
+
+     return 0;
+ }
+ ~~~~~
+ */
+template <ValidCljonicContainerElementType T, SizeType MaxElements>
+class SortedSet
+{
+    static_assert(not std::floating_point<T>,
+                  "Floating point types should not be compared for equality, hence SortedSets of floating point types "
+                  "are not allowed");
+
+    static_assert(std::totally_ordered<T> or IsCString<T>, "A SortedSet type must be totally ordered");
+
+    static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
+
+    static_assert(maximumElements == MaxElements,
+                  "Attempt to create a SortedSet bigger than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT");
+
+    SizeType m_elementCount;
+    T m_elementDefault;
+    T m_elements[maximumElements]; // only the first m_elementCount are initialized, see InitializeUnusedElements
+
+    [[nodiscard]] constexpr SizeType LowerBound(const T& element) const noexcept
+    {
+        // index of the first element that is not less than element, or m_elementCount if there isn't one
+        SizeType low{0};
+        SizeType high{m_elementCount};
+        while (low < high)
+        {
+            const auto middle{low + ((high - low) / 2)};
+            if (FirstLessThanSecond(m_elements[middle], element))
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return low;
+    }
+
+    constexpr void Insert(const T& element) noexcept
+    {
+        const auto index{LowerBound(element)};
+        if ((index == m_elementCount) or not AreEqual(element, m_elements[index]))
+        {
+            for (auto i{m_elementCount}; i > index; --i)
+                m_elements[i] = m_elements[i - 1];
+            m_elements[index] = element;
+            ++m_elementCount;
+        }
+    }
+
+    [[nodiscard]] constexpr bool IsUniqueElementBy(const auto& f, const T& element) const noexcept
+    {
+        auto result{true};
+        for (SizeType i{0}; (result and (i < m_elementCount)); ++i)
+            result = not AreEqualBy(f, element, m_elements[i]);
+        return result;
+    }
+
+  public:
+    using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::Set>;
+    using cljonic_sorted_set = std::true_type;
+    using size_type = SizeType;
+    using value_type = T;
+
+    constexpr SortedSet() noexcept : m_elementCount(0), m_elementDefault(T{})
+    {
+        InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+    }
+
+    template <typename... Args>
+    constexpr explicit SortedSet(Args... elements) noexcept : m_elementCount(0), m_elementDefault(T{})
+    {
+        static_assert(sizeof...(Args) <= MaximumCount(), "SortedSet initialized with too many elements");
+        (Insert(elements), ...);
+        InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+    }
+
+    // Copy constructor; copies only the elements in use, rather than the whole capacity
+    constexpr SortedSet(const SortedSet& other) noexcept
+        : m_elementCount(other.m_elementCount), m_elementDefault(other.m_elementDefault)
+    {
+        for (SizeType i{0}; i < m_elementCount; ++i)
+            m_elements[i] = other.m_elements[i];
+        InitializeUnusedElements(m_elements, m_elementCount, maximumElements);
+    }
+
+    // Move constructor
+    constexpr SortedSet(SortedSet&& other) noexcept : SortedSet(static_cast<const SortedSet&>(other))
+    {
+    }
+
+  private:
+    using Iterator = const T*; // the elements are contiguous, so a pointer is a contiguous iterator
+
+  public:
+    [[nodiscard]] constexpr Iterator begin() const noexcept
+    {
+        return m_elements;
+    }
+
+    [[nodiscard]] constexpr Iterator end() const noexcept
+    {
+        return m_elements + m_elementCount;
+    }
+
+    [[nodiscard]] constexpr T operator[](const SizeType index) const noexcept
+    {
+        return At(index);
+    }
+
+    [[nodiscard]] constexpr T operator()(const T& t) const noexcept
+    {
+        return Contains(t) ? t : m_elementDefault;
+    }
+
+    constexpr SortedSet& operator=(const SortedSet& other) noexcept
+    {
+        if (this != &other)
+        {
+            m_elementCount = other.m_elementCount;
+            m_elementDefault = other.m_elementDefault;
+            for (SizeType i{0}; i < m_elementCount; ++i)
+                m_elements[i] = other.m_elements[i];
+        }
+        return *this;
+    }
+
+    constexpr SortedSet& operator=(SortedSet&& other) noexcept
+    {
+        return *this = other; // Delegate to copy assignment
+    }
+
+    [[nodiscard]] constexpr const T& At(const SizeType index) const noexcept
+    {
+        return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr SizeType Count() const noexcept
+    {
+        return m_elementCount;
+    }
+
+    [[nodiscard]] constexpr bool ContainsBy(const auto& f, const T& element) const noexcept
+    {
+        // f is an arbitrary equality predicate, which need not agree with the ordering, so it is a linear search
+        return not IsUniqueElementBy(f, element);
+    }
+
+    [[nodiscard]] constexpr bool Contains(const T& element) const noexcept
+    {
+        const auto index{LowerBound(element)};
+        return (index < m_elementCount) and AreEqual(element, m_elements[index]);
+    }
+
+    [[nodiscard]] constexpr const T& DefaultElement() const noexcept
+    {
+        return m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
+                                                                const T& element) const noexcept
+    {
+        return (index < m_elementCount) and Contains(element);
+    }
+
+    [[nodiscard]] static consteval SizeType MaximumCount() noexcept
+    {
+        return maximumElements;
+    }
+}; // class SortedSet
+
+// Support declarations like: auto v{SortedSet{3, 1, 2}}; // Equivalent to auto v{SortedSet<int, 3>{3, 1, 2}};
+template <typename... Args>
+SortedSet(Args...) -> SortedSet<std::common_type_t<Args...>, sizeof...(Args)>;
+
+} // namespace cljonic
+
+#endif // CLJONIC_SORTEDSET_HPP
@@ -0,0 +1,158 @@
+#ifndef CLJONIC_SPANVIEW_HPP
+#define CLJONIC_SPANVIEW_HPP
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "cljonic-collection-maximum-element-count.hpp"
+#include "cljonic-collection-type.hpp"
+#include "cljonic-shared.hpp"
+
+namespace cljonic
+{
+
+/** \anchor SpanView
+ * The \b SpanView type is a \b non-owning collection type in cljonic.  A \b SpanView refers to elements that are
+ * stored contiguously somewhere else, such as in a \b std::span, a \b std::string_view, a \b std::array, or the
+ * \b Data of an \b Array or \b String, and <b>does not copy them</b>, so data received from DMA, \b read(2), or a C
+ * API can be passed to the \ref Namespace_Core "Core" functions without first being copied into an \b Array.  A
+ * \b SpanView is constructed from anything with \b data() and \b size() members, or from a pointer and a count, and
+ * \ref Core_Equal "Equal" compares it, element by element, with an \b Array or another view.  A \b SpanView has at
+ * most \b CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT elements, so its constructors assert that they are given no more,
+ * and, when assertions are disabled by \b NDEBUG, it refers to only that many elements of a longer sequence.  The
+ * elements must outlive the \b SpanView.  A \b SpanView can be assigned, so it can be an element of an
+ * \b Array, like the fields returned by \ref String_Split "Split".
+ *
+ ~~~~~{.cpp}
+ #include <span>
+ #include <string_view>
+ #include "cljonic.hpp"
+
+ using namespace cljonic;
+ using namespace cljonic::core;
+
+ int main()
+ {
+     constexpr auto IsDigit = [](const char c) { return ('0' <= c) and (c <= '9'); };
+     constexpr auto Add = [](const int i, const int j) { return i + j; };
+
+     const int buffer[]{1, 2, 3, 4};
+     const auto v0{SpanView{std::span{buffer}}};              // 1, 2, 3, and 4, referring to buffer
+     const auto n0{Reduce(Add, v0)};                          // 10
+     constexpr auto v1{SpanView{std::string_view{"a1b2c3"}}}; // 'a', '1', 'b', '2', 'c', and '3'
+     constexpr auto n1{Count(Filter(IsDigit, v1))};           // 3
+     constexpr auto e0{v1[1]};                                // '1'
+     const auto v2{SpanView{buffer + 1, 2}};                  // 2 and 3, referring to buffer
+
+     // Assertion failure: more than CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT elements
+     // static int big[CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT + 1]{};
+     // const auto v3{SpanView{std::span{big}}};
+
+     return 0;
+ }
+ ~~~~~
+ */
+template <typename T>
+class SpanView
+{
+    const T* m_elements;
+    SizeType m_elementCount;
+    T m_elementDefault;
+
+  public:
+    using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::View>;
+    using size_type = SizeType;
+    using value_type = T;
+
+    constexpr SpanView() noexcept : m_elements(nullptr), m_elementCount(0), m_elementDefault(T{})
+    {
+    }
+
+    template <typename C>
+        requires requires(const C& c) {
+            { c.data() } -> std::convertible_to<const T*>;
+            { c.size() } -> std::convertible_to<std::size_t>;
+        }
+    // Asserts that contiguous has at most CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT elements, and, when assertions are
+    // disabled, refers to only that many of them
+    constexpr explicit SpanView(const C& contiguous) noexcept
+        : m_elements(contiguous.data()),
+          m_elementCount(MinArgument(static_cast<SizeType>(contiguous.size()), CljonicCollectionMaximumElementCount)),
+          m_elementDefault(T{})
+    {
+        assert(static_cast<SizeType>(contiguous.size()) <= CljonicCollectionMaximumElementCount);
+    }
+
+    // Asserts that count is at most CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT, and, when assertions are disabled,
+    // refers to only that many elements
+    constexpr SpanView(const T* elements, const SizeType count) noexcept
+        : m_elements(elements), m_elementCount(MinArgument(count, CljonicCollectionMaximumElementCount)),
+          m_elementDefault(T{})
+    {
+        assert(count <= CljonicCollectionMaximumElementCount);
+    }
+
+    constexpr SpanView(const SpanView& other) noexcept = default; // Copy constructor
+    constexpr SpanView(SpanView&& other) noexcept = default;      // Move constructor
+
+    constexpr SpanView& operator=(const SpanView& other) noexcept = default;
+
+    constexpr SpanView& operator=(SpanView&& other) noexcept = default;
+
+    [[nodiscard]] constexpr const T* begin() const noexcept
+    {
+        return m_elements;
+    }
+
+    [[nodiscard]] constexpr const T* end() const noexcept
+    {
+        return m_elements + m_elementCount;
+    }
+
+    [[nodiscard]] constexpr T operator[](const SizeType index) const noexcept
+    {
+        return At(index);
+    }
+
+    [[nodiscard]] constexpr const T& At(const SizeType index) const noexcept
+    {
+        return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr SizeType Count() const noexcept
+    {
+        return m_elementCount;
+    }
+
+    [[nodiscard]] constexpr const T* Data() const noexcept
+    {
+        return m_elements;
+    }
+
+    [[nodiscard]] constexpr const T& DefaultElement() const noexcept
+    {
+        return m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
+                                                                const T& element) const noexcept
+    {
+        return (index < m_elementCount) and AreEqual(m_elements[index], element);
+    }
+
+    [[nodiscard]] static consteval SizeType MaximumCount() noexcept
+    {
+        return CljonicCollectionMaximumElementCount;
+    }
+}; // class SpanView
+
+// Support declarations like: auto v{SpanView{std::string_view{"Hello"}}};
+// Equivalent to auto v{SpanView<char>{std::string_view{"Hello"}}};
+template <typename C>
+SpanView(const C&) -> SpanView<std::remove_cvref_t<decltype(*std::declval<const C&>().data())>>;
+
+} // namespace cljonic
+
+#endif // CLJONIC_SPANVIEW_HPP
@@ -0,0 +1,61 @@
+#ifndef CLJONIC_STRING_ENDSWITH_HPP
+#define CLJONIC_STRING_ENDSWITH_HPP
+
+#include "cljonic-shared.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+namespace cljonic
+{
+
+namespace string
+{
+
+/** \anchor String_EndsWith
+* The \b EndsWith function returns \b true if its first parameter ends with its second parameter, otherwise \b false.
+* Each parameter must be a \b C \b string or a \b cljonic \b collection of contiguous chars, like a \b String, a char
+* \b Array, or a \ref SpanView "SpanView" or \ref SliceView "SliceView" of one.  Every first parameter ends with an
+* empty second parameter.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+int main()
+{
+    constexpr auto s{String{"Hello, World"}};
+    constexpr auto b0{EndsWith(s, "World")};         // true
+    constexpr auto b1{EndsWith(s, String{"Hello"})}; // false
+    constexpr auto b2{EndsWith("ld", "World")};      // false
+    constexpr auto b3{EndsWith(s, "")};              // true
+
+    // Compiler Error: EndsWith's second parameter must be a C string or a collection of contiguous chars
+    // constexpr auto b{EndsWith(s, 'd')};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename T, typename U>
+[[nodiscard]] constexpr bool EndsWith(const T& t, const U& u) noexcept
+{
+    static_assert(IsText<T>, "EndsWith's first parameter must be a C string or a collection of contiguous chars");
+
+    static_assert(IsText<U>, "EndsWith's second parameter must be a C string or a collection of contiguous chars");
+
+    const auto text{AsText(t)};
+    const auto suffix{AsText(u)};
+    if (suffix.count > text.count)
+        return false;
+    const auto start{text.count - suffix.count};
+    for (SizeType i{0}; i < suffix.count; ++i)
+        if (text.chars[start + i] != suffix.chars[i])
+            return false;
+    return true;
+}
+
+} // namespace string
+
+} // namespace cljonic
+
+#endif // CLJONIC_STRING_ENDSWITH_HPP
@@ -0,0 +1,54 @@
+#ifndef CLJONIC_STRING_INCLUDES_HPP
+#define CLJONIC_STRING_INCLUDES_HPP
+
+#include "cljonic-shared.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+namespace cljonic
+{
+
+namespace string
+{
+
+/** \anchor String_Includes
+* The \b Includes function returns \b true if its second parameter occurs in its first parameter, otherwise \b false.
+* Each parameter must be a \b C \b string or a \b cljonic \b collection of contiguous chars, like a \b String, a char
+* \b Array, or a \ref SpanView "SpanView" or \ref SliceView "SliceView" of one.  An empty second parameter occurs in
+* every first parameter.  Like \ref String_IndexOfSubstring "IndexOfSubstring", \b Includes takes time proportional to
+* the sum of the lengths of its parameters.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+int main()
+{
+    constexpr auto s{String{"Hello, World"}};
+    constexpr auto b0{Includes(s, "World")};                 // true
+    constexpr auto b1{Includes(s, String{"world"})};         // false
+    constexpr auto b2{Includes(Array{'a', 'b', 'c'}, "bc")}; // true
+    constexpr auto b3{Includes("Hello", "")};                // true
+
+    // Compiler Error: Includes's second parameter must be a C string or a collection of contiguous chars
+    // constexpr auto b{Includes(s, 'W')};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename T, typename U>
+[[nodiscard]] constexpr bool Includes(const T& t, const U& u) noexcept
+{
+    static_assert(IsText<T>, "Includes's first parameter must be a C string or a collection of contiguous chars");
+
+    static_assert(IsText<U>, "Includes's second parameter must be a C string or a collection of contiguous chars");
+
+    return CLJONIC_INVALID_INDEX != IndexOfText(AsText(t), AsText(u));
+}
+
+} // namespace string
+
+} // namespace cljonic
+
+#endif // CLJONIC_STRING_INCLUDES_HPP
@@ -0,0 +1,59 @@
+#ifndef CLJONIC_STRING_INDEXOFSUBSTRING_HPP
+#define CLJONIC_STRING_INDEXOFSUBSTRING_HPP
+
+#include "cljonic-shared.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+namespace cljonic
+{
+
+namespace string
+{
+
+/** \anchor String_IndexOfSubstring
+* The \b IndexOfSubstring function returns the index of the first occurrence of its second parameter in its first
+* parameter, or \b CLJONIC_INVALID_INDEX if there is none.  Each parameter must be a \b C \b string or a \b cljonic
+* \b collection of contiguous chars, like a \b String, a char \b Array, or a \ref SpanView "SpanView" or
+* \ref SliceView "SliceView" of one.  An empty second parameter occurs at index 0.  A single char is found with
+* \b memchr, and a longer substring with the \b Two-Way algorithm, which takes time proportional to the sum of the
+* lengths of the parameters and no heap, where \b std::string_view::find can take time proportional to their product.
+* It is named so it does not collide with \ref Core_IndexOf "IndexOf", which finds a single element.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+int main()
+{
+    constexpr auto s{String{"Hello, World"}};
+    constexpr auto i0{IndexOfSubstring(s, "o")};             // 4
+    constexpr auto i1{IndexOfSubstring(s, String{"World"})}; // 7
+    constexpr auto i2{IndexOfSubstring(s, "world")};         // CLJONIC_INVALID_INDEX
+    constexpr auto i3{IndexOfSubstring("abcabc", "ca")};     // 2
+    constexpr auto i4{IndexOfSubstring(s, "")};              // 0
+
+    // Compiler Error: IndexOfSubstring's first parameter must be a C string or a collection of contiguous chars
+    // constexpr auto i{IndexOfSubstring(Range<10>{}, "o")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename T, typename U>
+[[nodiscard]] constexpr SizeType IndexOfSubstring(const T& t, const U& u) noexcept
+{
+    static_assert(IsText<T>,
+                  "IndexOfSubstring's first parameter must be a C string or a collection of contiguous chars");
+
+    static_assert(IsText<U>,
+                  "IndexOfSubstring's second parameter must be a C string or a collection of contiguous chars");
+
+    return IndexOfText(AsText(t), AsText(u));
+}
+
+} // namespace string
+
+} // namespace cljonic
+
+#endif // CLJONIC_STRING_INDEXOFSUBSTRING_HPP
@@ -0,0 +1,114 @@
+#ifndef CLJONIC_STRING_JOIN_HPP
+#define CLJONIC_STRING_JOIN_HPP
+
+#include <concepts>
+#include "cljonic-collection-maximum-element-count.hpp"
+#include "cljonic-concepts.hpp"
+#include "cljonic-shared.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+namespace cljonic
+{
+
+// The most chars that a char, a C string, or a collection of contiguous chars can have
+template <typename T>
+[[nodiscard]] consteval SizeType MaximumTextCount() noexcept
+{
+    if constexpr (std::same_as<T, char>)
+        return 1;
+    else if constexpr (IsCString<T>)
+        return CljonicCollectionMaximumElementCount;
+    else
+        return T::MaximumCount();
+}
+
+template <SizeType N, typename C>
+[[nodiscard]] constexpr auto JoinTexts(const Text& separator, const C& c) noexcept
+{
+    auto result{String<N>{}};
+    auto first{true};
+    for (const auto& element : c)
+    {
+        if (not first)
+            for (SizeType i{0}; i < separator.count; ++i)
+                MConj(result, separator.chars[i]);
+        first = false;
+        const auto text{AsText(element)};
+        for (SizeType i{0}; i < text.count; ++i)
+            MConj(result, text.chars[i]);
+    }
+    return result;
+}
+
+namespace string
+{
+
+/** \anchor String_Join
+* The \b Join function returns a \b String of the chars of the elements of its last parameter, which must be a
+* \b cljonic \b collection of \b C \b strings or \b cljonic \b collections of contiguous chars, like char \b Arrays or
+* the fields returned by \ref String_Split "Split", separated by its first parameter, if it has two, which must be a
+* \b char, a \b C \b string, or a \b cljonic \b collection of contiguous chars.  The chars are written directly into
+* the \b String, without the intermediate \b Arrays of \ref Core_Interpose "Interpose" and \ref Core_Concat "Concat".
+* The \b String can hold the most chars the parameters can have, up to \b CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT,
+* and, like the \b String constructor, silently ignores the chars that do not fit.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+int main()
+{
+    constexpr auto s0{Join(", ", Array{"one", "two", "three"})};           // String<1000>{"one, two, three"}
+    constexpr auto s1{Join('-', Array{Array{'a', 'b'}, Array{'c', 'd'}})}; // String<5>{"ab-cd"}
+    constexpr auto s2{Join(Array{Array{'a', 'b'}, Array{'c', 'd'}})};      // String<4>{"abcd"}
+    const auto s{String{"a,b,c"}};
+    const auto s3{Join(';', Split(s, ','))};                               // String<1000>{"a;b;c"}
+
+    // Compiler Error: Join's elements must be C strings or collections of contiguous chars
+    // constexpr auto s{Join(',', Array{1, 2, 3})};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename T, typename C>
+[[nodiscard]] constexpr auto Join(const T& separator, const C& c) noexcept
+{
+    static_assert(std::same_as<T, char> or IsText<T>,
+                  "Join's first parameter must be a char, a C string, or a collection of contiguous chars");
+
+    static_assert(IsCljonicCollection<C>, "Join's second parameter must be a cljonic collection");
+
+    static_assert(IsText<typename C::value_type>,
+                  "Join's elements must be C strings or collections of contiguous chars");
+
+    constexpr auto separatorCount{(0 == C::MaximumCount()) ? 0 : (C::MaximumCount() - 1)};
+    constexpr auto maximumCount{MinArgument((C::MaximumCount() * MaximumTextCount<typename C::value_type>()) +
+                                                (separatorCount * MaximumTextCount<T>()),
+                                            CljonicCollectionMaximumElementCount)};
+    if constexpr (std::same_as<T, char>)
+        return JoinTexts<maximumCount>(Text{&separator, 1}, c);
+    else
+        return JoinTexts<maximumCount>(AsText(separator), c);
+}
+
+template <typename C>
+[[nodiscard]] constexpr auto Join(const C& c) noexcept
+{
+    static_assert(IsCljonicCollection<C>, "Join's parameter must be a cljonic collection");
+
+    static_assert(IsText<typename C::value_type>,
+                  "Join's elements must be C strings or collections of contiguous chars");
+
+    constexpr auto elementCount{MaximumTextCount<typename C::value_type>()};
+    constexpr auto maximumCount{MinArgument(C::MaximumCount() * elementCount, CljonicCollectionMaximumElementCount)};
+    return JoinTexts<maximumCount>(Text{nullptr, 0}, c);
+}
+
+} // namespace string
+
+} // namespace cljonic
+
+#endif // CLJONIC_STRING_JOIN_HPP
@@ -0,0 +1,58 @@
+#ifndef CLJONIC_STRING_LASTINDEXOFSUBSTRING_HPP
+#define CLJONIC_STRING_LASTINDEXOFSUBSTRING_HPP
+
+#include "cljonic-shared.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+namespace cljonic
+{
+
+namespace string
+{
+
+/** \anchor String_LastIndexOfSubstring
+* The \b LastIndexOfSubstring function returns the index of the last occurrence of its second parameter in its first
+* parameter, or \b CLJONIC_INVALID_INDEX if there is none.  Each parameter must be a \b C \b string or a \b cljonic
+* \b collection of contiguous chars, like a \b String, a char \b Array, or a \ref SpanView "SpanView" or
+* \ref SliceView "SliceView" of one.  An empty second parameter occurs at the index one past the last char.  Like
+* \ref String_IndexOfSubstring "IndexOfSubstring", it runs the \b Two-Way algorithm, reading both parameters from
+* their ends, so it takes time proportional to the sum of their lengths.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+int main()
+{
+    constexpr auto s{String{"Hello, World"}};
+    constexpr auto i0{LastIndexOfSubstring(s, "o")};         // 8
+    constexpr auto i1{LastIndexOfSubstring(s, String{"l"})}; // 10
+    constexpr auto i2{LastIndexOfSubstring(s, "world")};     // CLJONIC_INVALID_INDEX
+    constexpr auto i3{LastIndexOfSubstring("abcabc", "bc")}; // 4
+    constexpr auto i4{LastIndexOfSubstring(s, "")};          // 12
+
+    // Compiler Error: LastIndexOfSubstring's second parameter must be a C string or a collection of contiguous chars
+    // constexpr auto i{LastIndexOfSubstring(s, 'o')};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename T, typename U>
+[[nodiscard]] constexpr SizeType LastIndexOfSubstring(const T& t, const U& u) noexcept
+{
+    static_assert(IsText<T>,
+                  "LastIndexOfSubstring's first parameter must be a C string or a collection of contiguous chars");
+
+    static_assert(IsText<U>,
+                  "LastIndexOfSubstring's second parameter must be a C string or a collection of contiguous chars");
+
+    return LastIndexOfText(AsText(t), AsText(u));
+}
+
+} // namespace string
+
+} // namespace cljonic
+
+#endif // CLJONIC_STRING_LASTINDEXOFSUBSTRING_HPP
@@ -0,0 +1,90 @@
+#ifndef CLJONIC_STRING_PARSEALL_HPP
+#define CLJONIC_STRING_PARSEALL_HPP
+
+#include <concepts>
+#include <type_traits>
+#include "cljonic-array.hpp"
+#include "cljonic-charconv.hpp"
+#include "cljonic-shared.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+namespace cljonic
+{
+
+namespace string
+{
+
+/** \anchor String_ParseAll
+* The \b ParseAll function returns an \b Array of the numbers of type \b T in the fields of its first parameter that are
+* separated by its second parameter, which must be a \b char.  The first parameter must be a \b cljonic \b collection
+* of contiguous chars, like a \b String, a char \b Array, or a \ref SpanView "SpanView" or \ref SliceView "SliceView" of
+* one.  Each field is parsed as \ref String_ParseInt "ParseInt" parses it if \b T is an integer type, and as
+* \ref String_ParseFloat "ParseFloat" parses it if \b T is \b float or \b double, and a field that is not a number is
+* the third parameter, if there is one, and zero otherwise.  The fields are parsed as they are found, in one pass over
+* the chars, without the intermediate \b SpanViews of \ref String_Split "Split".  Like \b Split, empty fields are kept,
+* so each number keeps its position in a record, and the \b Array can hold one more number than the first parameter
+* can hold chars, up to \b CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+int main()
+{
+    constexpr auto a0{ParseAll<int>(String{"3,-1,4"}, ',')};         // Array<int, 7>{3, -1, 4}
+    constexpr auto a1{ParseAll<double>(String{"0.5 1e3"}, ' ')};     // Array<double, 8>{0.5, 1000.0}
+    constexpr auto a2{ParseAll<int>(String{"7,,x,8"}, ',')};         // Array<int, 7>{7, 0, 0, 8}
+    constexpr auto a3{ParseAll<int>(String{"7,,x,8"}, ',', -1)};     // Array<int, 7>{7, -1, -1, 8}
+
+    // Compiler Error: ParseAll's type must be an integer type, other than bool or a char type, or float or double
+    // constexpr auto a{ParseAll<bool>(String{"1,0"}, ',')};
+
+    // Compiler Error: ParseAll's second parameter must be a char
+    // constexpr auto a{ParseAll<int>(String{"1, 0"}, ", ")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename T, typename C, typename D>
+[[nodiscard]] constexpr auto ParseAll(const C& c, const D& delimiter, const T notANumber) noexcept
+{
+    static_assert(IsNumberInteger<T> or IsNumberFloating<T>,
+                  "ParseAll's type must be an integer type, other than bool or a char type, or float or double");
+
+    static_assert(IsText<C> and not IsCString<C>,
+                  "ParseAll's first parameter must be a collection of contiguous chars");
+
+    static_assert(std::same_as<D, char>, "ParseAll's second parameter must be a char");
+
+    constexpr auto maximumCount{MinArgument(C::MaximumCount() + 1, CljonicCollectionMaximumElementCount)};
+    auto result{Array<T, maximumCount>{}};
+    const auto text{AsText(c)};
+    const auto Field = [&](const SizeType start, const SizeType end) {
+        auto number{notANumber};
+        static_cast<void>(ParseNumberText(Text{text.chars + start, end - start}, number));
+        MConj(result, number);
+    };
+    SizeType start{0};
+    for (SizeType i{0}; i < text.count; ++i)
+        if (delimiter == text.chars[i])
+        {
+            Field(start, i);
+            start = i + 1;
+        }
+    Field(start, text.count);
+    return result;
+}
+
+template <typename T, typename C, typename D>
+[[nodiscard]] constexpr auto ParseAll(const C& c, const D& delimiter) noexcept
+{
+    return ParseAll(c, delimiter, T{0});
+}
+
+} // namespace string
+
+} // namespace cljonic
+
+#endif // CLJONIC_STRING_PARSEALL_HPP
@@ -0,0 +1,74 @@
+#ifndef CLJONIC_STRING_PARSEFLOAT_HPP
+#define CLJONIC_STRING_PARSEFLOAT_HPP
+
+#include "cljonic-charconv.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+namespace cljonic
+{
+
+namespace string
+{
+
+/** \anchor String_ParseFloat
+* The \b ParseFloat function returns the \b float or \b double \b T, which is \b double by default, nearest to the
+* number that its first parameter spells: an optional \b + or \b - sign, decimal digits with an optional decimal point,
+* and an optional exponent, or \b inf, \b infinity, or \b nan, ignoring case, and nothing else, not even spaces.  The
+* first parameter must be a \b C \b string, or a \b cljonic \b collection of contiguous chars.  A number too large for
+* \b T is infinity, and one too small is zero.  If the chars do not spell a number, \b ParseFloat returns its second
+* parameter, if it has one, and zero otherwise, where \b clojure.core/parse-double returns \b nil.  At run time
+* \b ParseFloat calls \b std::from_chars, whose Eisel-Lemire algorithm needs no allocation, no locale, and no
+* \b errno, and is several times faster than \b strtod.  During constant evaluation, where \b std::from_chars is not
+* constexpr, a number whose digits and power of ten are both exact in \b T, which covers most numbers that people write,
+* is converted with a single multiplication or division, and any other number with exact big integer arithmetic, so
+* the result is always the nearest \b T, and a constant \b ParseFloat and a run time \b ParseFloat agree.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+int main()
+{
+    constexpr auto d0{ParseFloat("-2.5e3")};               // -2500.0
+    constexpr auto d1{ParseFloat("0.1")};                  // 0.1, the double nearest to one tenth
+    constexpr auto f0{ParseFloat<float>("3.14159")};       // 3.14159f
+    constexpr auto d2{ParseFloat("1e400")};                // infinity
+    constexpr auto d3{ParseFloat("INF")};                  // infinity
+    constexpr auto d4{ParseFloat("1.5x")};                 // 0.0, because of the x
+    constexpr auto d5{ParseFloat("1.5x", -1.0)};           // -1.0, because of the x
+    constexpr auto d6{ParseFloat(String{".5"})};           // 0.5
+
+    // Compiler Error: ParseFloat's type must be float or double
+    // constexpr auto d{ParseFloat<long double>("1")};
+
+    // Compiler Error: ParseFloat's first parameter must be a C string, or a collection of contiguous chars
+    // constexpr auto d{ParseFloat(1.5)};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename T = double, typename C>
+[[nodiscard]] constexpr T ParseFloat(const C& c, const T notANumber) noexcept
+{
+    static_assert(IsNumberFloating<T>, "ParseFloat's type must be float or double");
+
+    static_assert(IsText<C>, "ParseFloat's first parameter must be a C string, or a collection of contiguous chars");
+
+    auto result{notANumber};
+    static_cast<void>(ParseFloatingText(AsText(c), result));
+    return result;
+}
+
+template <typename T = double, typename C>
+[[nodiscard]] constexpr T ParseFloat(const C& c) noexcept
+{
+    return ParseFloat<T>(c, T{0});
+}
+
+} // namespace string
+
+} // namespace cljonic
+
+#endif // CLJONIC_STRING_PARSEFLOAT_HPP
@@ -0,0 +1,71 @@
+#ifndef CLJONIC_STRING_PARSEINT_HPP
+#define CLJONIC_STRING_PARSEINT_HPP
+
+#include "cljonic-charconv.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+namespace cljonic
+{
+
+namespace string
+{
+
+/** \anchor String_ParseInt
+* The \b ParseInt function returns the integer of type \b T, which is \b int by default, that its first parameter
+* spells: an optional \b + or \b - sign followed by decimal digits, and nothing else, not even spaces.  The first
+* parameter must be a \b C \b string, or a \b cljonic \b collection of contiguous chars, like a \b String, a char
+* \b Array, or a field returned by \ref String_Split "Split".  If the chars do not spell an integer that \b T can hold,
+* \b ParseInt returns its second parameter, if it has one, and zero otherwise, where \b clojure.core/parse-long returns
+* \b nil.  The digits are accumulated one at a time, each checked against the limit of \b T without a division, as
+* \b std::from_chars does, with no locale, no \b errno, and no allocation, and, unlike \b std::from_chars before
+* \b C++23, during constant evaluation too.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+int main()
+{
+    constexpr auto i0{ParseInt("-42")};                     // -42
+    constexpr auto i1{ParseInt<std::uint8_t>("255")};       // 255
+    constexpr auto i2{ParseInt<std::uint8_t>("256")};       // 0, because 256 does not fit
+    constexpr auto i3{ParseInt<std::uint8_t>("256", 99)};   // 99, because 256 does not fit
+    constexpr auto i4{ParseInt(" 7")};                      // 0, because of the space
+    constexpr auto i5{ParseInt<long long>(String{"+123"})}; // 123
+    const auto s{String{"x=17"}};
+    const auto i6{ParseInt(Split(s, '=')[1])};              // 17
+
+    // Compiler Error: ParseInt's type must be an integer type, other than bool or a char type
+    // constexpr auto i{ParseInt<double>("1")};
+
+    // Compiler Error: ParseInt's first parameter must be a C string, or a collection of contiguous chars
+    // constexpr auto i{ParseInt(Array{1, 2})};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename T = int, typename C>
+[[nodiscard]] constexpr T ParseInt(const C& c, const T notANumber) noexcept
+{
+    static_assert(IsNumberInteger<T>, "ParseInt's type must be an integer type, other than bool or a char type");
+
+    static_assert(IsText<C>, "ParseInt's first parameter must be a C string, or a collection of contiguous chars");
+
+    auto result{notANumber};
+    static_cast<void>(ParseIntegerText(AsText(c), result));
+    return result;
+}
+
+template <typename T = int, typename C>
+[[nodiscard]] constexpr T ParseInt(const C& c) noexcept
+{
+    return ParseInt<T>(c, T{0});
+}
+
+} // namespace string
+
+} // namespace cljonic
+
+#endif // CLJONIC_STRING_PARSEINT_HPP
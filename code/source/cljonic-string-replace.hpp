@@ -0,0 +1,92 @@
+#ifndef CLJONIC_STRING_REPLACE_HPP
+#define CLJONIC_STRING_REPLACE_HPP
+
+#include "cljonic-shared.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+namespace cljonic
+{
+
+namespace string
+{
+
+/** \anchor String_Replace
+* The \b Replace function returns a \b String of its first parameter with every occurrence of its second parameter
+* replaced by its third parameter.  The first parameter must be a \b cljonic \b collection of contiguous chars, like a
+* \b String, a char \b Array, or a \ref SpanView "SpanView" or \ref SliceView "SliceView" of one, and the second and
+* third parameters must be \b C \b strings or \b cljonic \b collections of contiguous chars.  The occurrences are
+* found left to right, without overlapping, with the \b Two-Way algorithm, so \b Replace takes time proportional to
+* the sum of the lengths of its parameters and its result.  An empty second parameter occurs before every char and at
+* the end.  The result has the same maximum count as the first parameter, and, like the \b String constructor,
+* silently ignores the chars that do not fit.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+int main()
+{
+    constexpr auto s{String<20>{"Hello, World"}};
+    constexpr auto s0{Replace(s, "World", "There")};            // String<20>{"Hello, There"}
+    constexpr auto s1{Replace(s, "l", "")};                     // String<20>{"Heo, Word"}
+    constexpr auto s2{Replace(s, String{"o"}, "00")};           // String<20>{"Hell00, W00rld"}
+    constexpr auto s3{Replace(String{"abc"}, "", "-")};         // String<3>{"-a-"}
+    constexpr auto s4{Replace(Array{'a', 'b', 'a'}, "a", "c")}; // String<3>{"cbc"}
+
+    // Compiler Error: Replace's first parameter must be a collection of contiguous chars
+    // constexpr auto s{Replace("Hello", "l", "L")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C, typename T, typename U>
+[[nodiscard]] constexpr auto Replace(const C& c, const T& match, const U& replacement) noexcept
+{
+    static_assert(IsText<C> and not IsCString<C>, "Replace's first parameter must be a collection of contiguous chars");
+
+    static_assert(IsText<T>, "Replace's second parameter must be a C string or a collection of contiguous chars");
+
+    static_assert(IsText<U>, "Replace's third parameter must be a C string or a collection of contiguous chars");
+
+    auto result{String<C::MaximumCount()>{}};
+    const auto Append = [&](const char* chars, const SizeType n) {
+        for (SizeType i{0}; i < n; ++i)
+            MConj(result, chars[i]);
+    };
+
+    const auto text{AsText(c)};
+    const auto from{AsText(match)};
+    const auto to{AsText(replacement)};
+    if (0 == from.count)
+    {
+        for (SizeType i{0}; i < text.count; ++i)
+        {
+            Append(to.chars, to.count);
+            Append(text.chars + i, 1);
+        }
+        Append(to.chars, to.count);
+    }
+    else
+    {
+        // each search starts past the previous match, so the searches read every char of the text once in total
+        SizeType start{0};
+        for (auto index{IndexOfText(text, from)}; CLJONIC_INVALID_INDEX != index;
+             index = IndexOfText(text, from, start))
+        {
+            Append(text.chars + start, index - start);
+            Append(to.chars, to.count);
+            start = index + from.count;
+        }
+        Append(text.chars + start, text.count - start);
+    }
+    return result;
+}
+
+} // namespace string
+
+} // namespace cljonic
+
+#endif // CLJONIC_STRING_REPLACE_HPP
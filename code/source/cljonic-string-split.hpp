@@ -0,0 +1,118 @@
+#ifndef CLJONIC_STRING_SPLIT_HPP
+#define CLJONIC_STRING_SPLIT_HPP
+
+#include <concepts>
+#include <type_traits>
+#include "cljonic-array.hpp"
+#include "cljonic-shared.hpp"
+#include "cljonic-spanview.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+namespace cljonic
+{
+
+namespace string
+{
+
+/** \anchor String_Split
+* The \b Split function returns an \b Array of the fields of its first parameter that are separated by its second
+* parameter.  The first parameter must be a \b cljonic \b collection of contiguous chars, like a \b String, a char
+* \b Array, or a \ref SpanView "SpanView" or \ref SliceView "SliceView" of one, and the second parameter must be a
+* \b char, a \b C \b string, or a \b cljonic \b collection of contiguous chars.  Each field is a
+* \ref SpanView "SpanView" that refers to the chars of the first parameter, so <b>the fields are not copied</b>, and
+* splitting takes time proportional to the length of the first parameter.  The chars must outlive the fields, so the
+* first parameter must be an \b lvalue, unless it is a \b SpanView, like a field of an earlier \b Split.  Unlike
+* \b clojure.string/split, empty fields, even trailing ones, are kept, so each field keeps its position in a record,
+* and an empty second parameter splits the first into its chars, or, like any second parameter, an empty first
+* parameter into one empty field.  The \b Array can hold one more field than the first parameter can hold chars, so no
+* field is dropped unless that exceeds \b CLJONIC_COLLECTION_MAXIMUM_ELEMENT_COUNT.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+int main()
+{
+    const auto s{String{"id=7,,name=bob"}};
+    const auto fields{Split(s, ',')};          // SpanViews of "id=7", "", and "name=bob", referring to s
+    const auto count{fields.Count()};          // 3
+    const auto name{Split(fields[2], '=')[1]}; // SpanView of "bob", referring to s
+    const auto chars{Split(s, "")};            // SpanViews of each of the 14 chars of s
+
+    // Compiler Error: Split's first parameter must be an lvalue, or a SpanView, whose chars the fields refer to
+    // const auto f{Split(String{"a,b"}, ',')};
+
+    // Compiler Error: Split's second parameter must be a char, a C string, or a collection of contiguous chars
+    // const auto f{Split(s, 44)};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename C, typename T>
+[[nodiscard]] constexpr auto Split(C&& c, const T& delimiter) noexcept
+{
+    using Collection = std::remove_cvref_t<C>;
+
+    static_assert(std::is_lvalue_reference_v<C> or std::is_same_v<Collection, SpanView<char>>,
+                  "Split's first parameter must be an lvalue, or a SpanView, whose chars the fields refer to");
+
+    static_assert(IsText<Collection> and not IsCString<Collection>,
+                  "Split's first parameter must be a collection of contiguous chars");
+
+    static_assert(std::same_as<T, char> or IsText<T>,
+                  "Split's second parameter must be a char, a C string, or a collection of contiguous chars");
+
+    constexpr auto maximumCount{MinArgument(Collection::MaximumCount() + 1, CljonicCollectionMaximumElementCount)};
+    auto result{Array<SpanView<char>, maximumCount>{}};
+    const auto text{AsText(c)};
+    const auto Field = [&](const SizeType start, const SizeType end) {
+        MConj(result, SpanView<char>{text.chars + start, end - start});
+    };
+
+    const auto separator{[&]() {
+        if constexpr (std::same_as<T, char>)
+            return Text{&delimiter, 1};
+        else
+            return AsText(delimiter);
+    }()};
+    if (0 == separator.count)
+    {
+        // an empty separator matches everywhere, so it is not searched for, which would never move past it
+        for (SizeType i{0}; i < text.count; ++i)
+            Field(i, i + 1);
+        if (0 == text.count)
+            Field(0, 0);
+    }
+    else if (1 == separator.count)
+    {
+        // the fields of a record are usually short, so one scan beats a call to memchr for each field
+        SizeType start{0};
+        for (SizeType i{0}; i < text.count; ++i)
+            if (separator.chars[0] == text.chars[i])
+            {
+                Field(start, i);
+                start = i + 1;
+            }
+        Field(start, text.count);
+    }
+    else
+    {
+        SizeType start{0};
+        for (auto index{IndexOfText(text, separator)}; CLJONIC_INVALID_INDEX != index;
+             index = IndexOfText(text, separator, start))
+        {
+            Field(start, index);
+            start = index + ((0 == separator.count) ? 1 : separator.count); // always move past a match
+        }
+        Field(start, text.count);
+    }
+    return result;
+}
+
+} // namespace string
+
+} // namespace cljonic
+
+#endif // CLJONIC_STRING_SPLIT_HPP
@@ -0,0 +1,60 @@
+#ifndef CLJONIC_STRING_STARTSWITH_HPP
+#define CLJONIC_STRING_STARTSWITH_HPP
+
+#include "cljonic-shared.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+namespace cljonic
+{
+
+namespace string
+{
+
+/** \anchor String_StartsWith
+* The \b StartsWith function returns \b true if its first parameter starts with its second parameter, otherwise
+* \b false.  Each parameter must be a \b C \b string or a \b cljonic \b collection of contiguous chars, like a
+* \b String, a char \b Array, or a \ref SpanView "SpanView" or \ref SliceView "SliceView" of one.  Every first
+* parameter starts with an empty second parameter.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+int main()
+{
+    constexpr auto s{String{"Hello, World"}};
+    constexpr auto b0{StartsWith(s, "Hello")};         // true
+    constexpr auto b1{StartsWith(s, String{"World"})}; // false
+    constexpr auto b2{StartsWith("Hi", "Hello")};      // false
+    constexpr auto b3{StartsWith(s, "")};              // true
+
+    // Compiler Error: StartsWith's second parameter must be a C string or a collection of contiguous chars
+    // constexpr auto b{StartsWith(s, 'H')};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename T, typename U>
+[[nodiscard]] constexpr bool StartsWith(const T& t, const U& u) noexcept
+{
+    static_assert(IsText<T>, "StartsWith's first parameter must be a C string or a collection of contiguous chars");
+
+    static_assert(IsText<U>, "StartsWith's second parameter must be a C string or a collection of contiguous chars");
+
+    const auto text{AsText(t)};
+    const auto prefix{AsText(u)};
+    if (prefix.count > text.count)
+        return false;
+    for (SizeType i{0}; i < prefix.count; ++i)
+        if (text.chars[i] != prefix.chars[i])
+            return false;
+    return true;
+}
+
+} // namespace string
+
+} // namespace cljonic
+
+#endif // CLJONIC_STRING_STARTSWITH_HPP
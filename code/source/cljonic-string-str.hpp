@@ -0,0 +1,67 @@
+#ifndef CLJONIC_STRING_STR_HPP
+#define CLJONIC_STRING_STR_HPP
+
+#include <concepts>
+#include "cljonic-charconv.hpp"
+#include "cljonic-string.hpp"
+
+namespace cljonic
+{
+
+namespace string
+{
+
+/** \anchor String_Str
+* The \b Str function returns a \b String of the chars of its parameter, which must be a number, a \b bool, or a
+* \b char, like \b clojure.core/str.  An integer is written in decimal, a \b bool is \b true or \b false, and a \b char
+* is itself.  A \b float or \b double is written with the fewest digits that \ref String_ParseFloat "ParseFloat" parses
+* back to the same value, in fixed or scientific notation, whichever is shorter, or as \b inf or \b nan, exactly as
+* \b std::to_chars writes it.  At run time \b Str calls \b std::to_chars, whose Ryu algorithm needs no allocation, and
+* during constant evaluation, where \b std::to_chars is not constexpr, \b Str converts the exact value to decimal
+* digits and finds the fewest that parse back to it, so a constant \b Str and a run time \b Str agree.  The \b String
+* is just big enough for any value of the type, so no char is ever dropped.
+~~~~~{.cpp}
+#include "cljonic.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+int main()
+{
+    constexpr auto s0{Str(-42)};                         // String<11>{"-42"}
+    constexpr auto s1{Str(std::uint8_t{255})};           // String<4>{"255"}
+    constexpr auto s2{Str(0.1)};                         // String<24>{"0.1"}
+    constexpr auto s3{Str(1e22)};                        // String<24>{"1e+22"}
+    constexpr auto s4{Str(0.1f + 0.2f)};                 // String<16>{"0.3"}
+    constexpr auto s5{Str(0.1 + 0.2)};                   // String<24>{"0.30000000000000004"}
+    constexpr auto s6{Str(true)};                        // String<5>{"true"}
+    constexpr auto s7{Str('c')};                         // String<1>{"c"}
+
+    // Compiler Error: Str's parameter must be a number, a bool, or a char
+    // constexpr auto s{Str("text")};
+
+    return 0;
+}
+~~~~~
+*/
+template <typename T>
+[[nodiscard]] constexpr auto Str(const T t) noexcept
+{
+    static_assert(IsNumberInteger<T> or IsNumberFloating<T> or std::same_as<T, bool> or std::same_as<T, char>,
+                  "Str's parameter must be a number, a bool, or a char");
+
+    if constexpr (std::same_as<T, bool>)
+        return t ? String<5>{"true"} : String<5>{"false"};
+    else if constexpr (std::same_as<T, char>)
+        return String<1>{t};
+    else if constexpr (IsNumberInteger<T>)
+        return IntegerString(t);
+    else
+        return FloatingString(t);
+}
+
+} // namespace string
+
+} // namespace cljonic
+
+#endif // CLJONIC_STRING_STR_HPP
@@ -3,8 +3,8 @@
 
 #include <cstring>
 #include <initializer_list>
+#include <span>
 #include <type_traits>
-#include "cljonic-collection-iterator.hpp"
 #include "cljonic-collection-type.hpp"
 #include "cljonic-shared.hpp"
 
@@ -15,24 +15,31 @@ namespace cljonic
  * and <b>does not use dynamic memory</b>. A \b String has a specified maximum number of \b ordered char elements, which
  * are always \b NUL terminated. A \b String is a function of its indexable elements. A \b String called with an
  * out-of-bounds index will return its \b default \b element (i.e., a NUL char). Many \ref Namespace_Core "Core"
- * functions accept String arguments.
+ * functions accept String arguments.  Because its chars are contiguous and \b NUL terminated, \b Data returns a C
+ * string of them, \b AsSpan returns a \b std::span of them, and \b AsStringView returns a string view of them, such
+ * as a \b std::string_view, so they can be passed to C APIs and I/O functions without being copied.  The string view
+ * type is a template parameter of \b AsStringView, so cljonic does not include <b>\<string_view\></b>, which
+ * libstdc++ implements with the heap.
  *
  * The \b String constructor returns an instance of String initialized with the chars in its argument(s). If the
  * number of chars in a \b char* argument exceeds the maximum number of elements, the extras are silently ignored.
  ~~~~~{.cpp}
+ #include <string_view>
  #include "cljonic.hpp"
 
  using namespace cljonic;
 
  int main()
  {
-     const auto s0{String<10>{}};                    // immutable, empty
-     const auto s1{String<10>{"Hello"}};             // immutable, sparse
-     const auto s2{String<5>{"Hello"}};              // immutable, full
-     const auto s3{String<5>{"Hello, World"}};       // immutable, full, and contains "Hello"
-     const auto s4{String<3>{'H', 'e', 'l'}};        // immutable, full
-     const auto s5{String{"Hello"}};                 // immutable, full
-     const auto s6{String{'H', 'e', 'l', 'l', 'o'}}; // immutable, full
+     const auto s0{String<10>{}};                       // immutable, empty
+     const auto s1{String<10>{"Hello"}};                // immutable, sparse
+     const auto s2{String<5>{"Hello"}};                 // immutable, full
+     const auto s3{String<5>{"Hello, World"}};          // immutable, full, and contains "Hello"
+     const auto s4{String<3>{'H', 'e', 'l'}};           // immutable, full
+     const auto s5{String{"Hello"}};                    // immutable, full
+     const auto s6{String{'H', 'e', 'l', 'l', 'o'}};    // immutable, full
+     const auto p{s5.Data()};                           // const char* C string "Hello"
+     const auto v{s5.AsStringView<std::string_view>()}; // std::string_view "Hello"
 
      // Compiler Error: String initialized with too many elements
      // const auto s{String<3>{'H', 'e', 'l', 'l', 'o'}};
@@ -45,9 +52,9 @@ namespace cljonic
  ~~~~~
  */
 template <SizeType MaxElements>
-class String : public IndexInterface<char>
+class String
 {
-    using Iterator = CollectionIterator<String>;
+    using Iterator = const char*; // the elements are contiguous, so a pointer is a contiguous iterator
 
     static constexpr SizeType maximumElements{MaximumElements(MaxElements)};
 
@@ -56,12 +63,10 @@ class String : public IndexInterface<char>
 
     SizeType m_elementCount;
     const char m_elementDefault;
-    char m_elements[maximumElements + 1]{}; // +1 for the null terminator
+    char m_elements[maximumElements + 1]; // +1 for the null terminator, which is followed by uninitialized chars
 
-    [[nodiscard]] constexpr auto ValueAtIndex(const SizeType index) const noexcept
-    {
-        return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
-    }
+    template <SizeType N>
+    constexpr friend void MConj(String<N>& string, const char c);
 
   public:
     using cljonic_collection_type = std::integral_constant<CljonicCollectionType, CljonicCollectionType::String>;
@@ -71,6 +76,7 @@ class String : public IndexInterface<char>
     constexpr String() noexcept : m_elementCount(0), m_elementDefault('\0')
     {
         m_elements[0] = '\0';
+        InitializeUnusedElements(m_elements, (m_elementCount + 1), (maximumElements + 1));
     }
 
     template <typename... Args>
@@ -80,6 +86,7 @@ class String : public IndexInterface<char>
         static_assert(sizeof...(Args) <= MaximumCount(), "String initialized with too many elements");
         ((m_elements[m_elementCount++] = args), ...);
         m_elements[m_elementCount] = '\0';
+        InitializeUnusedElements(m_elements, (m_elementCount + 1), (maximumElements + 1));
     }
 
     constexpr explicit String(const char* c_str) noexcept : m_elementCount(0), m_elementDefault('\0')
@@ -90,24 +97,35 @@ class String : public IndexInterface<char>
             m_elementCount += 1;
         }
         m_elements[m_elementCount] = '\0';
+        InitializeUnusedElements(m_elements, (m_elementCount + 1), (maximumElements + 1));
     }
 
-    constexpr String(const String& other) noexcept = default; // Copy constructor
-    constexpr String(String&& other) noexcept = default;      // Move constructor
+    // Copy constructor; copies only the chars in use, and the null terminator, rather than the whole capacity
+    constexpr String(const String& other) noexcept
+        : m_elementCount(other.m_elementCount), m_elementDefault(other.m_elementDefault)
+    {
+        for (SizeType i{0}; i <= m_elementCount; ++i)
+            m_elements[i] = other.m_elements[i];
+        InitializeUnusedElements(m_elements, (m_elementCount + 1), (maximumElements + 1));
+    }
+
+    constexpr String(String&& other) noexcept : String(static_cast<const String&>(other)) // Move constructor
+    {
+    }
 
     [[nodiscard]] constexpr Iterator begin() const noexcept
     {
-        return Iterator{*this, 0};
+        return m_elements;
     }
 
     [[nodiscard]] constexpr Iterator end() const noexcept
     {
-        return Iterator{*this, m_elementCount};
+        return m_elements + m_elementCount;
     }
 
-    [[nodiscard]] constexpr char operator[](const SizeType index) const noexcept override
+    [[nodiscard]] constexpr char operator[](const SizeType index) const noexcept
     {
-        return ValueAtIndex(index);
+        return At(index);
     }
 
     [[nodiscard]] constexpr char operator()(const SizeType index) const noexcept
@@ -115,20 +133,41 @@ class String : public IndexInterface<char>
         return this->operator[](index);
     }
 
-    [[nodiscard]] constexpr SizeType Count() const noexcept override
+    [[nodiscard]] constexpr std::span<const char> AsSpan() const noexcept
+    {
+        return std::span<const char>{Data(), m_elementCount};
+    }
+
+    template <typename StringView>
+    [[nodiscard]] constexpr StringView AsStringView() const noexcept
+    {
+        return StringView{Data(), m_elementCount};
+    }
+
+    [[nodiscard]] constexpr const char& At(const SizeType index) const noexcept
+    {
+        return (index < m_elementCount) ? m_elements[index] : m_elementDefault;
+    }
+
+    [[nodiscard]] constexpr SizeType Count() const noexcept
     {
         return m_elementCount;
     }
 
+    [[nodiscard]] constexpr const char* Data() const noexcept
+    {
+        return m_elements;
+    }
+
     [[nodiscard]] constexpr const char& DefaultElement() const noexcept
     {
         return m_elementDefault;
     }
 
     [[nodiscard]] constexpr bool ElementAtIndexIsEqualToElement(const SizeType index,
-                                                                const char& element) const noexcept override
+                                                                const char& element) const noexcept
     {
-        return (index < m_elementCount) and AreEqual(ValueAtIndex(index), element);
+        return (index < m_elementCount) and AreEqual(m_elements[index], element);
     }
 
     [[nodiscard]] static consteval SizeType MaximumCount() noexcept
@@ -146,6 +185,16 @@ String(const char (&)[N]) -> String<N - 1>;
 template <typename... Args>
 String(Args...) -> String<sizeof...(Args)>;
 
+template <SizeType N>
+constexpr void MConj(String<N>& string, const char c)
+{
+    if (string.m_elementCount < string.MaximumCount())
+    {
+        string.m_elements[string.m_elementCount++] = c;
+        string.m_elements[string.m_elementCount] = '\0';
+    }
+}
+
 } // namespace cljonic
 
 #endif // CLJONIC_STRING_HPP
@@ -0,0 +1,226 @@
+#ifndef CLJONIC_TWOWAYSEARCH_HPP
+#define CLJONIC_TWOWAYSEARCH_HPP
+
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "cljonic-collection-maximum-element-count.hpp"
+#include "cljonic-concepts.hpp"
+#include "cljonic-shared.hpp"
+
+namespace cljonic
+{
+
+// The chars that a substring function searches, or searches for
+struct Text
+{
+    const char* chars;
+    SizeType count;
+};
+
+// A C string, or a collection of contiguous chars, like a String, a char Array, or a SpanView or SliceView of one
+template <typename T>
+concept IsText = IsCString<T> or (IsCljonicCollection<T> and std::same_as<typename T::value_type, char> and
+                                  std::is_pointer_v<decltype(std::declval<const T&>().begin())>);
+
+template <typename T>
+[[nodiscard]] constexpr Text AsText(const T& t) noexcept
+{
+    if constexpr (IsCString<T>)
+    {
+        const char* chars{t};
+        if (not std::is_constant_evaluated())
+            return Text{chars, std::strlen(chars)};
+        SizeType count{0};
+        while ('\0' != chars[count])
+            ++count;
+        return Text{chars, count};
+    }
+    else
+    {
+        return Text{t.begin(), t.Count()};
+    }
+}
+
+// The Two-Way string matching algorithm of Crochemore and Perrin finds a needle in a haystack in linear time and
+// constant space, and never reads a haystack char more than twice, where std::string_view::find can take time
+// proportional to the product of their lengths.  The needle is split at a critical factorization, its right part is
+// compared left to right, then its left part right to left, and a mismatch shifts the needle by an amount that skips
+// every window that cannot match; a periodic needle remembers how much of its left part the previous window matched.
+// Windows that cannot match are skipped before they are compared: the next window starts at the next occurrence of
+// the first char of the needle, which memchr, or a block compare, finds many chars at a time, and a window whose last
+// char is not in the needle is skipped with a 256 bit set, rather than the 256 word bad char table of the C library
+// implementations, to keep the stack small.  The needle and haystack are read backward when backward is true, so the
+// first match found is the last match in the haystack, at its reversed index.
+template <bool backward>
+class TwoWaySearcher
+{
+    const Text m_needle;
+    SizeType m_split;        // the length of the left part of the needle
+    SizeType m_period;       // the shift after a full match
+    SizeType m_memoryPeriod; // the length of the left part known to match after a full match, when periodic
+    std::uint32_t m_chars[8];
+
+    [[nodiscard]] static constexpr unsigned char CharAt(const Text& text, const SizeType index) noexcept
+    {
+        return static_cast<unsigned char>(text.chars[backward ? (text.count - 1 - index) : index]);
+    }
+
+    [[nodiscard]] constexpr unsigned char NeedleAt(const SizeType index) const noexcept
+    {
+        return CharAt(m_needle, index);
+    }
+
+    [[nodiscard]] constexpr bool NeedleHasChar(const unsigned char c) const noexcept
+    {
+        return 0 != (m_chars[c / 32] & (std::uint32_t{1} << (c % 32)));
+    }
+
+    // Returns the first index at or after start of the first char of the needle, or CLJONIC_INVALID_INDEX
+    [[nodiscard]] constexpr SizeType NextStart(const Text& haystack, const SizeType start) const noexcept
+    {
+        const auto c{static_cast<char>(NeedleAt(0))};
+        if constexpr (backward)
+        {
+            const auto index{LastIndexOfElement(haystack.chars, haystack.count - start, c)};
+            return (CLJONIC_INVALID_INDEX == index) ? index : (haystack.count - 1 - index);
+        }
+        else
+        {
+            const auto index{IndexOfElement(haystack.chars + start, haystack.count - start, c)};
+            return (CLJONIC_INVALID_INDEX == index) ? index : (start + index);
+        }
+    }
+
+    // Returns the start and period of the maximal suffix of the needle, where greater picks the order of the chars
+    [[nodiscard]] constexpr std::pair<SizeType, SizeType> MaximalSuffix(const bool greater) const noexcept
+    {
+        SizeType suffix{0};
+        SizeType j{0};
+        SizeType k{1};
+        SizeType period{1};
+        while ((j + k) < m_needle.count)
+        {
+            const auto a{NeedleAt(suffix + k - 1)};
+            const auto b{NeedleAt(j + k)};
+            if (a == b)
+            {
+                if (k == period)
+                {
+                    j += period;
+                    k = 1;
+                }
+                else
+                {
+                    ++k;
+                }
+            }
+            else if (greater ? (a > b) : (a < b))
+            {
+                j += k;
+                k = 1;
+                period = j + 1 - suffix;
+            }
+            else
+            {
+                suffix = ++j;
+                k = 1;
+                period = 1;
+            }
+        }
+        return {suffix, period};
+    }
+
+  public:
+    constexpr explicit TwoWaySearcher(const Text& needle) noexcept
+        : m_needle(needle), m_split(0), m_period(1), m_memoryPeriod(0), m_chars{}
+    {
+        for (SizeType i{0}; i < m_needle.count; ++i)
+            m_chars[NeedleAt(i) / 32] |= std::uint32_t{1} << (NeedleAt(i) % 32);
+        const auto [split0, period0]{MaximalSuffix(true)};
+        const auto [split1, period1]{MaximalSuffix(false)};
+        m_split = (split1 > split0) ? split1 : split0;
+        m_period = (split1 > split0) ? period1 : period0;
+        auto periodic{(m_split + m_period) <= m_needle.count};
+        for (SizeType i{0}; (periodic and (i < m_split)); ++i)
+            periodic = (NeedleAt(i) == NeedleAt(i + m_period));
+        if (periodic)
+            m_memoryPeriod = m_needle.count - m_period;
+        else
+            m_period = ((m_split > (m_needle.count - m_split)) ? m_split : (m_needle.count - m_split)) + 1;
+    }
+
+    // Returns the index of the first match at or after start, or CLJONIC_INVALID_INDEX if there is none
+    [[nodiscard]] constexpr SizeType Find(const Text& haystack, SizeType start) const noexcept
+    {
+        // #lizard forgives -- The complexity of this function is acceptable
+
+        const auto count{m_needle.count};
+        SizeType memory{0};
+        while ((start <= haystack.count) and (count <= (haystack.count - start)))
+        {
+            if (0 == count)
+                return start;
+            if ((0 == memory) and (NeedleAt(0) != CharAt(haystack, start)))
+            {
+                // the windows before the next occurrence of the first char of the needle cannot match
+                start = NextStart(haystack, start);
+                if ((CLJONIC_INVALID_INDEX == start) or (count > (haystack.count - start)))
+                    return CLJONIC_INVALID_INDEX;
+            }
+            if (not NeedleHasChar(CharAt(haystack, start + count - 1)))
+            {
+                start += count;
+                memory = 0;
+                continue;
+            }
+            auto k{(m_split > memory) ? m_split : memory};
+            while ((k < count) and (NeedleAt(k) == CharAt(haystack, start + k)))
+                ++k;
+            if (k < count)
+            {
+                start += k - m_split + 1;
+                memory = 0;
+                continue;
+            }
+            k = m_split;
+            while ((k > memory) and (NeedleAt(k - 1) == CharAt(haystack, start + k - 1)))
+                --k;
+            if (k <= memory)
+                return start;
+            start += m_period;
+            memory = m_memoryPeriod;
+        }
+        return CLJONIC_INVALID_INDEX;
+    }
+}; // class TwoWaySearcher
+
+// Returns the index of the first occurrence of part in text at or after start, or CLJONIC_INVALID_INDEX
+[[nodiscard]] constexpr SizeType IndexOfText(const Text& text, const Text& part, const SizeType start = 0) noexcept
+{
+    if ((start > text.count) or (part.count > (text.count - start)))
+        return CLJONIC_INVALID_INDEX;
+    if (1 == part.count)
+    {
+        const auto index{IndexOfElement(text.chars + start, text.count - start, part.chars[0])};
+        return (CLJONIC_INVALID_INDEX == index) ? index : (start + index);
+    }
+    return TwoWaySearcher<false>{part}.Find(text, start);
+}
+
+// Returns the index of the last occurrence of part in text, or CLJONIC_INVALID_INDEX
+[[nodiscard]] constexpr SizeType LastIndexOfText(const Text& text, const Text& part) noexcept
+{
+    if (part.count > text.count)
+        return CLJONIC_INVALID_INDEX;
+    if (1 == part.count)
+        return LastIndexOfElement(text.chars, text.count, part.chars[0]);
+    const auto index{TwoWaySearcher<true>{part}.Find(text, 0)};
+    return (CLJONIC_INVALID_INDEX == index) ? index : (text.count - part.count - index);
+}
+
+} // namespace cljonic
+
+#endif // CLJONIC_TWOWAYSEARCH_HPP
@@ -1,4 +1,7 @@
+#include <span>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include "catch.hpp"
 #include "cljonic-array.hpp"
 
@@ -148,4 +151,98 @@ SCENARIO("Array", "[CljonicArray]")
         CHECK(4 == a(3));
         CHECK(0 == a(4)); // index out-of-bounds so return default element, which is 0 in this case
     }
+
+    {
+        // the elements are contiguous, so they can be accessed without being copied
+        const auto a{Array<int, 10>{1, 2, 3, 4}};
+        const int* p{a.Data()};
+        CHECK(p == a.begin());
+        CHECK(1 == p[0]);
+        CHECK(4 == p[3]);
+        const std::span<const int> s{a.AsSpan()};
+        CHECK(4 == s.size());
+        CHECK(p == s.data());
+        CHECK(3 == s[2]);
+        CHECK(0 == Array<int, 10>{}.AsSpan().size());
+    }
+
+    {
+        // only the elements in use are copied, and the unused ones are never read
+        constexpr auto a0{Array<int, 1000>{1, 2, 3}};
+        constexpr auto a1{a0};
+        static_assert((3 == a1.Count()) and (1 == a1[0]) and (3 == a1[2]) and (0 == a1[3]));
+        auto a2{Array<int, 1000>{4, 5}};
+        const auto a3{std::move(a2)};
+        CHECK(2 == a3.Count());
+        CHECK(5 == a3[1]);
+        CHECK(0 == a3[2]);
+        auto a4{Array<int, 1000>{}};
+        MConj(a4, 6);
+        const auto a5{std::as_const(a4)};
+        CHECK(1 == a5.Count());
+        CHECK(6 == a5[0]);
+        CHECK(0 == a5[1]);
+    }
+
+    {
+        // At returns a const reference to an element, or to the default element when the index is out-of-bounds
+        constexpr auto a{Array<int, 10>{1, 2, 3, 4}};
+        static_assert(std::is_same_v<const int&, decltype(a.At(0))>);
+        static_assert((1 == a.At(0)) and (4 == a.At(3)) and (0 == a.At(4)));
+        CHECK(&a.At(2) == (a.Data() + 2));
+        CHECK(&a.At(4) == &a.DefaultElement());
+        constexpr auto nested{Array{Array{1, 2}, Array{3, 4}}};
+        CHECK(4 == nested.At(1).At(1));
+        CHECK(&nested.At(1) == (nested.Data() + 1));
+    }
+
+    {
+        // moving an Array of Arrays moves its elements, and a non-const Array copies with the copy constructor
+        auto a0{Array{Array{1, 2}, Array{3, 4}}};
+        auto a1{a0};
+        CHECK(((2 == a1.Count()) and (2 == a1.At(0).At(1)) and (3 == a1.At(1).At(0))));
+        const auto a2{std::move(a0)};
+        CHECK(((2 == a2.Count()) and (2 == a2.At(0).At(1)) and (3 == a2.At(1).At(0))));
+        auto a3{Array<Array<int, 2>, 2>{Array{7, 8}}};
+        a3 = std::move(a1);
+        CHECK(((2 == a3.Count()) and (2 == a3.At(0).At(1)) and (3 == a3.At(1).At(0))));
+        auto row{Array{5, 6}};
+        auto a4{Array<Array<int, 2>, 3>{a3.At(0), a3.At(1)}};
+        MConj(a4, std::move(row));
+        CHECK(3 == a4.Count());
+        CHECK(6 == a4.At(2).At(1));
+        auto& self{a4};
+        a4 = std::move(self); // a self move assignment leaves the Array unchanged
+        CHECK(3 == a4.Count());
+        CHECK(6 == a4.At(2).At(1));
+    }
+
+    {
+        // MConjElements appends contiguous elements in bulk, as many as fit
+        const int elements[]{1, 2, 3, 4, 5};
+        auto a0{Array<int, 4>{0}};
+        MConjElements(a0, elements, 2);
+        CHECK(3 == a0.Count());
+        CHECK(2 == a0[2]);
+        MConjElements(a0, elements + 2, 3);
+        CHECK(4 == a0.Count());
+        CHECK(3 == a0[3]);
+        MConjElements(a0, elements, 5);
+        CHECK(4 == a0.Count());
+        constexpr auto a1{[]
+                          {
+                              const char chars[]{"Hi"};
+                              auto result{Array<char, 5>{'!'}};
+                              MConjElements(result, chars, 2);
+                              return result;
+                          }()};
+        static_assert((3 == a1.Count()) and ('!' == a1[0]) and ('i' == a1[2]) and ('\0' == a1[3]));
+        auto a2{Array<Array<int, 2>, 2>{}};
+        const Array<int, 2> rows[]{Array{1, 2}, Array{3, 4}};
+        MConjElements(a2, rows, 2);
+        CHECK(((2 == a2.Count()) and (2 == a2.At(0).At(1)) and (3 == a2.At(1).At(0))));
+        auto a3{Array<Array<int, 2>, 2>{}};
+        a3 = a2;
+        CHECK(((2 == a3.Count()) and (4 == a3.At(1).At(1))));
+    }
 }
@@ -0,0 +1,242 @@
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include "catch.hpp"
+#include "cljonic-charconv.hpp"
+
+using namespace cljonic;
+
+namespace
+{
+
+template <SizeType N>
+constexpr std::string_view View(const String<N>& s)
+{
+    return s.template AsStringView<std::string_view>();
+}
+
+std::uint64_t Next(std::uint64_t& state)
+{
+    // splitmix64, so the numbers are the same on every platform
+    auto z{state += 0x9E3779B97F4A7C15u};
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+    return z ^ (z >> 31);
+}
+
+Text AsText(const char* chars)
+{
+    return Text{chars, std::strlen(chars)};
+}
+
+template <typename T>
+T ExactlyParsed(const char* chars)
+{
+    auto number{DecimalNumber{}};
+    REQUIRE(ParseDecimalText(AsText(chars), number));
+    return DecimalToFloatingExactly<T>(number, AsText(chars));
+}
+
+template <typename T>
+T FromChars(const char* chars)
+{
+    auto result{T{}};
+    const auto [end, error]{std::from_chars(chars, chars + std::strlen(chars), result)};
+    static_cast<void>(end);
+    if (std::errc::result_out_of_range == error)
+    {
+        auto number{DecimalNumber{}};
+        static_cast<void>(ParseDecimalText(AsText(chars), number));
+        const auto overflow{(number.exponent + DecimalDigitCount(number.digits)) > 0};
+        result = overflow ? std::numeric_limits<T>::infinity() : T{0};
+    }
+    return result;
+}
+
+template <typename T, typename Bits>
+bool SameBits(const T a, const T b)
+{
+    Bits x{};
+    Bits y{};
+    std::memcpy(&x, &a, sizeof(T));
+    std::memcpy(&y, &b, sizeof(T));
+    return x == y;
+}
+
+// Returns the significant digits that std::to_chars writes for t, without the decimal point and trailing zeros
+template <typename T>
+std::uint64_t ToCharsDigits(const T t)
+{
+    char chars[64]{};
+    static_cast<void>(std::to_chars(chars, chars + 63, t, std::chars_format::scientific));
+    std::uint64_t result{0};
+    for (SizeType i{0}; ('\0' != chars[i]) and ('e' != chars[i]); ++i)
+        if ('.' != chars[i])
+            result = (result * 10) + static_cast<std::uint64_t>(chars[i] - '0');
+    while (0 == (result % 10))
+        result /= 10;
+    return result;
+}
+
+template <typename T, typename Bits>
+void CheckAgainstCharconv()
+{
+    std::uint64_t state{42};
+    for (auto i{0}; i < 3000; ++i)
+    {
+        // the digits of a random T, and the exact big integer parsing of them, agree with std::charconv
+        auto bits{static_cast<Bits>(Next(state))};
+        auto t{T{}};
+        std::memcpy(&t, &bits, sizeof(T));
+        if ((t != t) or ((t - t) != (t - t)) or (T{0} == t))
+            continue;
+        const auto value{(t < 0) ? -t : t};
+        CHECK(ToCharsDigits(value) == ShortestDecimal(value).digits);
+        char chars[64]{};
+        static_cast<void>(std::to_chars(chars, chars + 63, value));
+        CHECK(SameBits<T, Bits>(value, ExactlyParsed<T>(chars)));
+    }
+    for (auto i{0}; i < 3000; ++i)
+    {
+        // random decimal numbers of up to 19 digits, and of about 60, whose digits after the first 19 decide ties
+        char chars[128]{};
+        if (0 == (i % 3))
+            std::snprintf(chars, sizeof(chars), "%llu%llu%llue%d", static_cast<unsigned long long>(Next(state)),
+                          static_cast<unsigned long long>(Next(state)), static_cast<unsigned long long>(Next(state)),
+                          static_cast<int>(Next(state) % 700) - 380);
+        else
+            std::snprintf(chars, sizeof(chars), "%llue%d", static_cast<unsigned long long>(Next(state) >> (i % 64)),
+                          static_cast<int>(Next(state) % 700) - 350);
+        CHECK(SameBits<T, Bits>(FromChars<T>(chars), ExactlyParsed<T>(chars)));
+        auto parsed{T{}};
+        CHECK(ParseFloatingText(AsText(chars), parsed));
+        CHECK(SameBits<T, Bits>(FromChars<T>(chars), parsed));
+    }
+}
+
+} // namespace
+
+SCENARIO("CharConv", "[CljonicCharConv]")
+{
+    {
+        // integers parse exactly up to the limits of their type, and no further
+        auto i{0};
+        CHECK((ParseIntegerText(AsText("2147483647"), i) and (2147483647 == i)));
+        CHECK((ParseIntegerText(AsText("-2147483648"), i) and (std::numeric_limits<int>::min() == i)));
+        CHECK(not ParseIntegerText(AsText("2147483648"), i));
+        CHECK(not ParseIntegerText(AsText("-2147483649"), i));
+        CHECK(std::numeric_limits<int>::min() == i);
+        auto u{std::uint64_t{0}};
+        CHECK(ParseIntegerText(AsText("18446744073709551615"), u));
+        CHECK(std::numeric_limits<std::uint64_t>::max() == u);
+        CHECK(not ParseIntegerText(AsText("18446744073709551616"), u));
+        CHECK(not ParseIntegerText(AsText("-1"), u));
+        auto s{std::int8_t{0}};
+        CHECK((ParseIntegerText(AsText("-128"), s) and (-128 == s)));
+        CHECK(not ParseIntegerText(AsText("128"), s));
+        CHECK(not ParseIntegerText(AsText("+"), s));
+        CHECK(not ParseIntegerText(AsText(""), s));
+        CHECK(not ParseIntegerText(AsText("1 "), s));
+        CHECK(not ParseIntegerText(AsText("1\xb1"), s));
+    }
+
+    {
+        // integers are written in decimal, with a '-' if negative
+        CHECK(std::string_view{"-9223372036854775808"} ==
+              View(IntegerString(std::numeric_limits<std::int64_t>::min())));
+        CHECK(std::string_view{"18446744073709551615"} ==
+              View(IntegerString(std::numeric_limits<std::uint64_t>::max())));
+        CHECK(std::string_view{"0"} == View(IntegerString(0)));
+        CHECK(std::string_view{"-128"} == View(IntegerString(std::int8_t{-128})));
+    }
+
+    {
+        // the decimal grammar is an optional sign, digits with an optional point, and an optional exponent
+        auto number{DecimalNumber{}};
+        CHECK(ParseDecimalText(AsText("-12.50e+2"), number));
+        CHECK(((1250 == number.digits) and (0 == number.exponent) and number.negative and not number.truncated));
+        CHECK((ParseDecimalText(AsText("0.000123"), number) and (123 == number.digits) and (-6 == number.exponent)));
+        CHECK((ParseDecimalText(AsText(".5"), number) and (5 == number.digits) and (-1 == number.exponent)));
+        CHECK((ParseDecimalText(AsText("5."), number) and (5 == number.digits) and (0 == number.exponent)));
+        CHECK(ParseDecimalText(AsText("12345678901234567890123"), number));
+        CHECK(((1234567890123456789 == number.digits) and (4 == number.exponent) and number.truncated));
+        CHECK(not ParseDecimalText(AsText("."), number));
+        CHECK(not ParseDecimalText(AsText("1e"), number));
+        CHECK(not ParseDecimalText(AsText("1e+"), number));
+        CHECK(not ParseDecimalText(AsText("-"), number));
+        CHECK(not ParseDecimalText(AsText("1.2.3"), number));
+        CHECK(not ParseDecimalText(AsText("0x10"), number));
+    }
+
+    {
+        // the run time grammar of std::from_chars, adjusted, is the constant evaluation grammar
+        const char* texts[]{"1",      "-1.5",    "+1.5",    "+-5",  "-+5",      "nan",   "-NaN",  "+inf",   "Infinity",
+                            "nan(1)", "nanx",    "infinit", "infx", "1e",       ".e1",   "1e+",   "0x1p3",  " 1",
+                            "1 ",     "+.5",     "-.",      "5e-0", "1.e5",     "1e5.",  "",      "-",      "1,5",
+                            "1e+05",  "1E-0005", "00.00",   ".",    "1.5e309x", "1e400", "-1e-400"};
+        for (const auto text : texts)
+        {
+            auto number{DecimalNumber{}};
+            const auto sign{(('-' == text[0]) or ('+' == text[0])) ? SizeType{1} : SizeType{0}};
+            const auto constantAccepts{ParseDecimalText(AsText(text), number) or
+                                       IsNameOfText(AsText(text), sign, "inf") or
+                                       IsNameOfText(AsText(text), sign, "infinity") or
+                                       IsNameOfText(AsText(text), sign, "nan")};
+            auto value{0.0};
+            CAPTURE(text);
+            CHECK(constantAccepts == ParseFloatingText(AsText(text), value));
+        }
+    }
+
+    {
+        // the exact big integer paths agree with std::from_chars and std::to_chars
+        CheckAgainstCharconv<double, std::uint64_t>();
+        CheckAgainstCharconv<float, std::uint32_t>();
+    }
+
+    {
+        // the boundaries of subnormals, of overflow, and of halfway cases
+        CHECK(std::numeric_limits<double>::denorm_min() == ExactlyParsed<double>("4.9406564584124654e-324"));
+        CHECK(std::numeric_limits<double>::denorm_min() == ExactlyParsed<double>("2.4703282292062328e-324"));
+        CHECK(0.0 == ExactlyParsed<double>("2.4703282292062327e-324"));
+        CHECK(std::numeric_limits<double>::max() == ExactlyParsed<double>("1.7976931348623158e308"));
+        CHECK(std::numeric_limits<double>::infinity() == ExactlyParsed<double>("1.7976931348623159e308"));
+        CHECK(9007199254740992.0 == ExactlyParsed<double>("9007199254740993"));
+        CHECK(9007199254740994.0 == ExactlyParsed<double>("9007199254740993.0000000000000000000001"));
+        CHECK(std::numeric_limits<float>::denorm_min() == ExactlyParsed<float>("1e-45"));
+        CHECK(std::numeric_limits<float>::max() == ExactlyParsed<float>("3.4028235e38"));
+    }
+
+    {
+        // constant evaluation formats and parses without std::charconv, and agrees with it
+        static_assert(std::string_view{"0.1"} == View(FloatingString(0.1)));
+        static_assert(std::string_view{"0.30000000000000004"} == View(FloatingString(0.1 + 0.2)));
+        static_assert(std::string_view{"-1.5e-07"} == View(FloatingString(-1.5e-7)));
+        static_assert(std::string_view{"1e+22"} == View(FloatingString(1e22)));
+        static_assert(std::string_view{"5e-324"} == View(FloatingString(5e-324)));
+        static_assert(std::string_view{"-0"} == View(FloatingString(-0.0)));
+        constexpr auto infinity{FloatingString(-std::numeric_limits<double>::infinity())};
+        static_assert(std::string_view{"-inf"} == View(infinity));
+        constexpr auto nan{FloatingString(std::numeric_limits<float>::quiet_NaN())};
+        static_assert(std::string_view{"nan"} == View(nan));
+        constexpr auto max{FloatingString(std::numeric_limits<double>::max())};
+        static_assert(std::string_view{"1.7976931348623157e+308"} == View(max));
+        constexpr auto floatMax{FloatingString(std::numeric_limits<float>::max())};
+        static_assert(std::string_view{"3.4028235e+38"} == View(floatMax));
+        constexpr auto floatMin{FloatingString(std::numeric_limits<float>::denorm_min())};
+        static_assert(std::string_view{"1e-45"} == View(floatMin));
+        constexpr auto integer{FloatingString(1.2345678901234568e20)}; // written with its exact digits
+        CHECK(View(FloatingString(1.2345678901234568e20)) == View(integer));
+        constexpr auto small{FloatingString(-1.2345678e-5f)};
+        CHECK(View(FloatingString(-1.2345678e-5f)) == View(small));
+        constexpr auto parsed{[]() {
+            auto result{0.0};
+            static_cast<void>(ParseFloatingText(Text{"2.2250738585072011e-308", 23}, result));
+            return result;
+        }()};
+        CHECK(parsed == FromChars<double>("2.2250738585072011e-308"));
+    }
+}
@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <utility>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-collection-iterator.hpp"
+#include "cljonic-hashmap.hpp"
+#include "cljonic-hashset.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-sortedset.hpp"
+#include "cljonic-string.hpp"
+
+using namespace cljonic;
+
+SCENARIO("CollectionIterator", "[CljonicCollectionIterator]")
+{
+    {
+        // collections that store their elements iterate with pointers, which are contiguous iterators
+        static_assert(std::ranges::contiguous_range<Array<int, 10>>);
+        static_assert(std::ranges::contiguous_range<String<10>>);
+        static_assert(std::ranges::contiguous_range<Set<int, 10>>);
+        static_assert(std::ranges::contiguous_range<SortedSet<int, 10>>);
+        static_assert(std::ranges::contiguous_range<HashSet<int, 10>>);
+        static_assert(std::ranges::contiguous_range<HashMap<int, int, 10>>);
+
+        // collections that compute their elements iterate with CollectionIterator, which is a random access iterator
+        static_assert(std::random_access_iterator<CollectionIterator<Range<10>>>);
+        static_assert(std::random_access_iterator<CollectionIterator<Repeat<10, int>>>);
+        static_assert(std::ranges::random_access_range<Range<10>>);
+        static_assert(std::ranges::random_access_range<Repeat<10, int>>);
+        static_assert(std::ranges::sized_range<Range<10>>);
+    }
+
+    {
+        constexpr auto r{Range<10>{}};
+        const auto b{r.begin()};
+        const auto e{r.end()};
+        CHECK(10 == (e - b));
+        CHECK(-10 == (b - e));
+        CHECK(0 == *b);
+        CHECK(3 == b[3]);
+        CHECK(3 == *(b + 3));
+        CHECK(3 == *(3 + b));
+        CHECK(9 == *(e - 1));
+        CHECK(b < e);
+        CHECK(e > b);
+        CHECK(b == r.begin());
+        CHECK(b != e);
+
+        auto it{b};
+        CHECK(0 == *it++);
+        CHECK(1 == *it);
+        CHECK(2 == *++it);
+        CHECK(2 == *it--);
+        CHECK(0 == *--it);
+        it += 5;
+        CHECK(5 == *it);
+        it -= 2;
+        CHECK(3 == *it);
+        CHECK(CollectionIterator<Range<10>>{} == CollectionIterator<Range<10>>{});
+    }
+
+    {
+        constexpr auto r{Range<1, 11>{}};
+        CHECK(55 == std::accumulate(r.begin(), r.end(), 0));
+        CHECK(10 == std::ranges::distance(r));
+        CHECK(7 == *std::ranges::find(r, 7));
+        CHECK(r.end() == std::ranges::find(r, 11));
+        CHECK(std::ranges::binary_search(r, 5));
+        CHECK(std::ranges::equal(r | std::views::reverse | std::views::take(3), Array{10, 9, 8}));
+    }
+
+    {
+        constexpr auto r{Repeat<5, int>{7}};
+        CHECK(5 == std::ranges::distance(r));
+        CHECK(5 == std::ranges::count(r, 7));
+        CHECK(7 == r.begin()[4]);
+    }
+
+    {
+        auto a{Array{3, 1, 2}};
+        CHECK(3 == std::ranges::size(a));
+        CHECK(std::ranges::data(a) == a.begin());
+        CHECK(3 == *std::ranges::max_element(a));
+        CHECK(std::ranges::equal(a, Array{3, 1, 2}));
+        CHECK(6 == std::accumulate(a.begin(), a.end(), 0));
+    }
+
+    {
+        constexpr auto s{String{"Hello"}};
+        CHECK(5 == std::ranges::size(s));
+        CHECK('l' == *std::ranges::find(s, 'l'));
+        CHECK(2 == std::ranges::count(s, 'l'));
+        CHECK(std::ranges::equal(s, Array{'H', 'e', 'l', 'l', 'o'}));
+    }
+
+    {
+        constexpr auto s{SortedSet{4, 2, 3, 1}};
+        CHECK(std::ranges::is_sorted(s));
+        CHECK(std::ranges::binary_search(s, 3));
+        constexpr auto m{HashMap{std::pair{1, 11}, std::pair{2, 22}}};
+        CHECK(33 == std::accumulate(m.begin(), m.end(), 0, [](const int x, const auto& e) { return x + e.second; }));
+    }
+
+    {
+        // the iterators are usable in constant expressions
+        constexpr auto sum{[]()
+                           {
+                               constexpr auto r{Range<5>{}};
+                               auto result{0};
+                               for (auto it{r.end()}; it != r.begin();)
+                                   result += *--it;
+                               return result;
+                           }()};
+        static_assert(10 == sum);
+    }
+}
@@ -0,0 +1,34 @@
+#include <type_traits>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-concepts.hpp"
+#include "cljonic-hashmap.hpp"
+#include "cljonic-hashset.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-sortedset.hpp"
+#include "cljonic-string.hpp"
+
+using namespace cljonic;
+
+SCENARIO("Concepts", "[CljonicConcepts]")
+{
+    // collections are indexed through static dispatch, so they carry no vtable pointer
+    static_assert(IsCljonicIndexable<Array<int, 10>>);
+    static_assert(not std::is_polymorphic_v<Array<int, 10>>);
+    static_assert(IsCljonicIndexable<HashMap<int, int, 10>>);
+    static_assert(not std::is_polymorphic_v<HashMap<int, int, 10>>);
+    static_assert(IsCljonicIndexable<HashSet<int, 10>>);
+    static_assert(not std::is_polymorphic_v<HashSet<int, 10>>);
+    static_assert(IsCljonicIndexable<Range<10>>);
+    static_assert(not std::is_polymorphic_v<Range<10>>);
+    static_assert(IsCljonicIndexable<Repeat<10, int>>);
+    static_assert(not std::is_polymorphic_v<Repeat<10, int>>);
+    static_assert(IsCljonicIndexable<Set<int, 10>>);
+    static_assert(not std::is_polymorphic_v<Set<int, 10>>);
+    static_assert(IsCljonicIndexable<SortedSet<int, 10>>);
+    static_assert(not std::is_polymorphic_v<SortedSet<int, 10>>);
+    static_assert(IsCljonicIndexable<String<10>>);
+    static_assert(not std::is_polymorphic_v<String<10>>);
+}
@@ -0,0 +1,48 @@
+#include <utility>
+#include "catch.hpp"
+#include "cljonic-hashmap.hpp"
+#include "cljonic-core-assoc.hpp"
+#include "cljonic-core-equal.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("Assoc", "[CljonicCoreAssoc]")
+{
+    constexpr auto m{HashMap<int, int, 3>{std::pair{1, 11}, std::pair{2, 22}}};
+
+    constexpr auto m0{Assoc(m, 3, 33)};
+    CHECK(3 == m0.Count());
+    CHECK(11 == m0.Get(1));
+    CHECK(22 == m0.Get(2));
+    CHECK(33 == m0.Get(3));
+    CHECK(2 == m.Count());
+
+    constexpr auto m1{Assoc(m, 1, 99)};
+    CHECK(2 == m1.Count());
+    CHECK(99 == m1.Get(1));
+    CHECK(22 == m1.Get(2));
+    CHECK(11 == m.Get(1));
+
+    constexpr auto m2{Assoc(m0, 4, 44)};
+    CHECK(3 == m2.Count());
+    CHECK(not m2.ContainsKey(4));
+    CHECK(Equal(m0, m2));
+
+    constexpr auto m3{Assoc(HashMap<char, int, 2>{}, 'a', 1)};
+    CHECK(1 == m3.Count());
+    CHECK(1 == m3.Get('a'));
+
+    constexpr auto m4{Assoc(HashMap<long, short, 2>{}, 1, 2)}; // convertible key and value
+    CHECK(1 == m4.Count());
+    CHECK(2 == m4.Get(1));
+
+    auto m5{HashMap<int, int, 100>{}};
+    for (auto i{0}; i < 100; ++i)
+        m5 = Assoc(m5, i * 64, i);
+    CHECK(100 == m5.Count());
+    auto allFound{true};
+    for (auto i{0}; i < 100; ++i)
+        allFound = allFound and (i == m5.Get(i * 64)) and (not m5.ContainsKey((i * 64) + 1));
+    CHECK(allFound);
+}
@@ -3,8 +3,10 @@
 #include "cljonic-range.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
+#include "cljonic-sliceview.hpp"
 #include "cljonic-string.hpp"
 #include "cljonic-core-concat.hpp"
+#include "cljonic-core-equal.hpp"
 
 using namespace cljonic;
 using namespace cljonic::core;
@@ -41,4 +43,19 @@ SCENARIO("Concat", "[CljonicCoreConcat]")
     CHECK(111 == c[20]);
     CHECK(0 == c[21]);
     CHECK(0 == Concat().Count());
+
+    {
+        // Concat copies nested Arrays straight from the collections, without first copying each to a temporary
+        constexpr auto nested{Concat(Array<Array<int, 2>, 1>{Array{1, 2}}, Array{Array{3, 4}, Array{5, 6}})};
+        static_assert(3 == nested.Count());
+        static_assert((1 == nested.At(0).At(0)) and (4 == nested.At(1).At(1)) and (5 == nested.At(2).At(0)));
+    }
+
+    {
+        // contiguous collections of the result type are copied in bulk, and others are converted one at a time
+        const auto a{Array{1, 2, 3}};
+        const auto c0{Concat(SliceView{a, 1}, a, Array<short, 2>{short{7}, short{8}}, String{"ab"})};
+        CHECK(Equal(Array{2, 3, 1, 2, 3, 7, 8, 97, 98}, c0));
+        static_assert(Equal(Array{'a', 'b', 'c'}, Concat(String{"ab"}, Array{'c'})));
+    }
 }
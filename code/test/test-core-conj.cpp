@@ -3,8 +3,10 @@
 #include "cljonic-range.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
+#include "cljonic-sliceview.hpp"
 #include "cljonic-string.hpp"
 #include "cljonic-core-conj.hpp"
+#include "cljonic-core-equal.hpp"
 
 using namespace cljonic;
 using namespace cljonic::core;
@@ -73,4 +75,14 @@ SCENARIO("Conj", "[CljonicCoreConj]")
     CHECK('!' == cStrBang[6]);
     CHECK('!' == cStrBang[7]);
     CHECK('\0' == cStrBang[8]);
+
+    {
+        // contiguous collections are copied in bulk, at run time and in a constant expression
+        const auto a{Array{1, 2, 3, 4}};
+        CHECK(Equal(Array{2, 3, 5}, Conj(SliceView{a, 1, 3}, 5)));
+        CHECK(Equal(Array{1, 2, 3, 4, 5, 6}, Conj(a, 5, 6)));
+        static_assert(Equal(Array{'H', 'i', '!'}, Conj(String{"Hi"}, '!')));
+        const auto nested{Conj(Array<Array<int, 2>, 1>{Array{1, 2}}, Array{3, 4})}; // Arrays are not trivially copyable
+        CHECK(((2 == nested.Count()) and Equal(Array{1, 2}, nested[0]) and Equal(Array{3, 4}, nested[1])));
+    }
 }
@@ -158,3 +158,29 @@ SCENARIO("Cycle", "[CljonicCoreCycle]")
     CHECK('\0' == cycleStr2[5]);
     CHECK('\0' == cycleStr2[MAX_SIZE_T - 1]);
 }
+
+SCENARIO("Cycle iteration", "[CljonicCoreCycle]")
+{
+    // the iterator wraps around to the first element without dividing, and agrees with indexing
+    const auto Check = [](const auto& cycle)
+    {
+        auto count{static_cast<SizeType>(0)};
+        auto allEqual{true};
+        for (const auto& element : cycle)
+            allEqual = allEqual and (element == cycle[count++]);
+        CHECK(cycle.Count() == count);
+        CHECK(allEqual);
+        CHECK(cycle[7] == *(cycle.begin() + 7));
+    };
+    Check(Cycle(Array{11, 12, 13, 14}));
+    Check(Cycle(Array{11}));
+    Check(Cycle(Array<int, 5>{}));
+    Check(Cycle(Range<1, 8, 2>{}));
+    Check(Cycle(Repeat<3, int>{11}));
+    Check(Cycle(Set{1, 2, 1, 3}));
+    Check(Cycle(String{"Hello"}));
+
+    static_assert(14 == *(Cycle(Array{11, 12, 13, 14}).begin() + 999));
+    static_assert(0 == Cycle(Array<int, 0>{}).MaximumCount());
+    static_assert(CljonicCollectionMaximumElementCount == Cycle(Array<int, 4>{}).MaximumCount());
+}
@@ -0,0 +1,34 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-compose.hpp"
+#include "cljonic-core-dedupe.hpp"
+#include "cljonic-core-dedupet.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-into.hpp"
+#include "cljonic-core-mapt.hpp"
+#include "cljonic-core-transduce.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("DedupeT", "[CljonicCoreDedupeT]")
+{
+    constexpr auto Add = [](const int a, const int b) { return a + b; };
+
+    CHECK(4 == Transduce(DedupeT<int>(), Add, 0, Array{1, 1, 2, 2, 1}));
+    CHECK(Equal(Array{'H', 'e', 'l', 'o'}, Into(Array<char, 10>{}, DedupeT<char>(), String{"Hello"})));
+    CHECK(Equal(Array{"a", "b"}, Into(Array<const char*, 10>{}, DedupeT<const char*>(), Array{"a", "a", "b"})));
+    CHECK(Equal(Array<int, 10>{}, Into(Array<int, 10>{}, DedupeT<int>(), Array<int, 10>{})));
+
+    // the first element is passed on even when it is the default value
+    CHECK(Equal(Array{0, 1}, Into(Array<int, 10>{}, DedupeT<int>(), Array{0, 0, 1})));
+
+    // deduplication of mapped values
+    const auto Tens = [](const int i) { return i / 10; };
+    CHECK(Equal(Dedupe(Array{0, 1, 2}), Into(Array<int, 10>{}, Compose(MapT(Tens), DedupeT<int>()), Range<30>{})));
+
+    static_assert(4 == Transduce(DedupeT<int>(), Add, 0, Array{1, 1, 2, 2, 1}),
+                  "DedupeT should be usable at compile time");
+}
@@ -0,0 +1,52 @@
+#include <utility>
+#include "catch.hpp"
+#include "cljonic-hashmap.hpp"
+#include "cljonic-core-assoc.hpp"
+#include "cljonic-core-dissoc.hpp"
+#include "cljonic-core-equal.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("Dissoc", "[CljonicCoreDissoc]")
+{
+    constexpr auto m{HashMap{std::pair{1, 11}, std::pair{2, 22}, std::pair{3, 33}}};
+
+    constexpr auto m0{Dissoc(m, 1)};
+    CHECK(2 == m0.Count());
+    CHECK(not m0.ContainsKey(1));
+    CHECK(22 == m0.Get(2));
+    CHECK(33 == m0.Get(3));
+    CHECK(3 == m.Count());
+
+    constexpr auto m1{Dissoc(m, 4)};
+    CHECK(Equal(m, m1));
+
+    constexpr auto m2{Dissoc(Dissoc(Dissoc(m, 3), 2), 1)};
+    CHECK(0 == m2.Count());
+    CHECK(not m2.ContainsKey(1));
+
+    constexpr auto m3{Assoc(Dissoc(m, 2), 4, 44)};
+    CHECK(3 == m3.Count());
+    CHECK(44 == m3.Get(4));
+    CHECK(not m3.ContainsKey(2));
+
+    // keys that share home slots exercise the backward shift deletion
+    auto m4{HashMap<int, int, 100>{}};
+    for (auto i{0}; i < 100; ++i)
+        m4 = Assoc(m4, i * 256, i);
+    for (auto i{0}; i < 100; i += 2)
+        m4 = Dissoc(m4, i * 256);
+    CHECK(50 == m4.Count());
+    auto allFound{true};
+    for (auto i{0}; i < 100; ++i)
+        allFound = allFound and ((0 == (i % 2)) ? (not m4.ContainsKey(i * 256)) : (i == m4.Get(i * 256)));
+    CHECK(allFound);
+    for (auto i{1}; i < 100; i += 2)
+        m4 = Dissoc(m4, i * 256);
+    CHECK(0 == m4.Count());
+    for (auto i{0}; i < 100; ++i)
+        m4 = Assoc(m4, i, i + 1);
+    CHECK(100 == m4.Count());
+    CHECK(100 == m4.Get(99));
+}
@@ -3,6 +3,8 @@
 #include "cljonic-range.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-spanview.hpp"
 #include "cljonic-string.hpp"
 #include "cljonic-core-equal.hpp"
 #include "cljonic-core-drop.hpp"
@@ -22,4 +24,31 @@ SCENARIO("Drop", "[CljonicCoreDrop]")
     CHECK(Equal(Array{"11", "11"}, Drop(5, Repeat<7, const char*>{"11"})));
     CHECK(Equal(Array<int, 0>{}, Drop(5, Set{'a', 'b'})));
     CHECK(Equal(Array{'l', 'o'}, Drop(3, String{"Hello"})));
+
+    {
+        // contiguous collections are copied in bulk, at run time and in a constant expression
+        const auto s{SpanView{a.Data() + 2, 5}};
+        CHECK(Equal(Array{5, 6}, Drop(3, s)));
+        CHECK(Equal(Array{6, 7}, Drop(2, SliceView{a, 4, 8})));
+        static_assert(Equal(Array{7, 8, 9}, Drop(7, a)));
+        static_assert(Equal(Array<int, 0>{}, Drop(10, a)));
+        const auto nested{Drop(1, Array{Array{1, 2}, Array{3, 4}})}; // Arrays are not trivially copyable
+        CHECK(((1 == nested.Count()) and Equal(Array{3, 4}, nested[0])));
+    }
+}
+
+SCENARIO("DropView", "[CljonicCoreDropView]")
+{
+    const auto a{Array{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    const auto v{DropView(5, a)};
+    CHECK(5 == v.Count());
+    CHECK((a.begin() + 5) == v.begin());
+    CHECK(a.end() == v.end());
+    CHECK(Equal(Drop(5, a), v));
+    CHECK(Equal(a, DropView(0, a)));
+    CHECK(Equal(Array<int, 0>{}, DropView(50, a)));
+
+    constexpr auto rng{DropView(7, Range<10>{})};
+    static_assert(Equal(Array{7, 8, 9}, rng));
+    CHECK(Equal(Array{'l', 'o'}, DropView(3, String{"Hello"})));
 }
@@ -23,3 +23,18 @@ SCENARIO("DropLast", "[CljonicCoreDropLast]")
     CHECK(Equal(Array<int, 0>{}, DropLast(5, Set{'a', 'b'})));
     CHECK(Equal(Array{'H', 'e'}, DropLast(3, String{"Hello"})));
 }
+
+SCENARIO("DropLastView", "[CljonicCoreDropLastView]")
+{
+    const auto a{Array{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    const auto v{DropLastView(8, a)};
+    CHECK(2 == v.Count());
+    CHECK(a.begin() == v.begin());
+    CHECK(Equal(DropLast(8, a), v));
+    CHECK(Equal(a, DropLastView(0, a)));
+    CHECK(Equal(Array<int, 0>{}, DropLastView(50, a)));
+
+    constexpr auto rng{DropLastView(7, Range<10>{})};
+    static_assert(Equal(Array{0, 1, 2}, rng));
+    CHECK(Equal(Array{'H', 'e'}, DropLastView(3, String{"Hello"})));
+}
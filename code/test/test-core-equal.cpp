@@ -3,6 +3,8 @@
 #include "cljonic-range.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-spanview.hpp"
 #include "cljonic-string.hpp"
 #include "cljonic-core-equal.hpp"
 
@@ -390,4 +392,27 @@ SCENARIO("Equal", "[CljonicCoreEqual]")
         CHECK(false == Equal(Array{4, 4, 4}, Repeat<4, int>{4}));
         CHECK(false == Equal(Array{4, 4, 4, 4}, Repeat<4, int>{5}));
     }
+
+    {
+        // contiguous integer collections are compared with memcmp at run time, and one element at a time in a constant
+        // expression, with the same results
+        enum class Color { Red, Green };
+        auto a{Array<int, 1000>{}};
+        for (auto i{0}; i < 1000; ++i)
+            MConj(a, i);
+        auto b{a};
+        CHECK(true == Equal(a, b));
+        CHECK(true == Equal(SliceView{a, 10, 20}, SliceView{b, 10, 20}, SpanView{a.Data() + 10, 10}));
+        CHECK(false == Equal(SliceView{a, 10, 20}, SliceView{b, 11, 21}));
+        MSet(b, 1000, 999);
+        CHECK(false == Equal(a, b));
+        CHECK(false == Equal(a, Array<int, 999>{}));
+        CHECK(true == Equal(Array{Color::Red, Color::Green}, Array{Color::Red, Color::Green}));
+        CHECK(false == Equal(Array{Color::Red, Color::Green}, Array{Color::Red, Color::Red}));
+        CHECK(true == Equal(Array{true, false}, Array{true, false}));
+        static_assert(Equal(String{"Hello"}, String{"Hello"}));
+        static_assert(not Equal(String{"Hello"}, String{"Help!"}));
+        constexpr char hello[]{"Hello"};
+        CHECK(true == Equal(Array{"Hello"}, Array{static_cast<const char*>(hello)})); // C strings compare by content
+    }
 }
@@ -0,0 +1,28 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-core-compose.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-filtert.hpp"
+#include "cljonic-core-into.hpp"
+#include "cljonic-core-transduce.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("FilterT", "[CljonicCoreFilterT]")
+{
+    constexpr auto Add = [](const int a, const int b) { return a + b; };
+    constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+    constexpr auto GreaterThan4 = [](const int i) { return i > 4; };
+
+    CHECK(20 == Transduce(FilterT(Even), Add, 0, Range<10>{}));
+    CHECK(0 == Transduce(FilterT(Even), Add, 0, Array{1, 3, 5}));
+    CHECK(Equal(Filter(Even, Range<10>{}), Into(Array<int, 10>{}, FilterT(Even), Range<10>{})));
+    CHECK(Equal(Array{6, 8}, Into(Array<int, 10>{}, Compose(FilterT(Even), FilterT(GreaterThan4)), Range<10>{})));
+    CHECK(6 == Transduce(FilterT(Even), Add, 0, Set{1, 2, 3, 4}));
+
+    static_assert(20 == Transduce(FilterT(Even), Add, 0, Range<10>{}), "FilterT should be usable at compile time");
+}
@@ -0,0 +1,90 @@
+#include <cstdint>
+#include <type_traits>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-filterview.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-freeze.hpp"
+#include "cljonic-core-indexof.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-reducers.hpp"
+#include "cljonic-core-take.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+namespace
+{
+
+constexpr auto Square = [](const int i) { return i * i; };
+constexpr auto Even = [](const int i) { return 0 == (i % 2); };
+
+constexpr auto squaresPipeline = [] { return Map(Square, Range<256>{}); };
+
+// The CRC-32 of one byte, which computes the entries of the usual lookup table
+[[nodiscard]] constexpr std::uint32_t Crc32OfByte(const SizeType byte) noexcept
+{
+    auto c{static_cast<std::uint32_t>(byte)};
+    for (auto k{0}; k < 8; ++k)
+        c = (0 != (c & 1)) ? (0xedb88320u ^ (c >> 1)) : (c >> 1);
+    return c;
+}
+
+} // namespace
+
+SCENARIO("Freeze", "[CljonicCoreFreeze]")
+{
+    constexpr auto squares{Freeze<squaresPipeline>()};
+    CHECK(Equal(Map(Square, Range<256>{}), squares));
+    CHECK(256 == squares.Count());
+    CHECK(144 == squares[12]);
+    CHECK(0 == squares[256]);
+    CHECK(12 == IndexOf(squares, 144));
+    static_assert(Equal(Map(Square, Range<256>{}), squares));
+    static_assert(Equal(Array{0, 1, 4}, Take(3, squares)));
+
+    // every Freeze of the same function refers to the same right-sized elements
+    CHECK(squares.Data() == Freeze<squaresPipeline>().Data());
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(*squares.Data())>, int>);
+    static_assert((256 * sizeof(int)) == sizeof(FrozenCollection<squaresPipeline>::frozen));
+
+    {
+        // any cljonic collection, including a lazy view, is copied in order
+        constexpr auto evens{Freeze<[] { return Filter(Even, Range<10>{}); }>()};
+        static_assert(Equal(Array{0, 2, 4, 6, 8}, evens));
+        static_assert(20 == Reduce(Plus, evens));
+        constexpr auto hello{Freeze<[] { return String{"Hello"}; }>()};
+        static_assert(Equal(Array{'H', 'e', 'l', 'l', 'o'}, hello));
+        constexpr auto squareEvens{Freeze<[] { return FilterView{Even, Map(Square, Range<5>{})}; }>()};
+        static_assert(Equal(Array{0, 4, 16}, squareEvens));
+        constexpr auto words{Freeze<[] { return Repeat<3, const char*>{"Hi"}; }>()};
+        static_assert(Equal(Array{"Hi", "Hi", "Hi"}, words));
+        constexpr auto empty{Freeze<[] { return Array<int, 10>{}; }>()};
+        static_assert(0 == empty.Count());
+        CHECK(0 == empty[0]);
+    }
+}
+
+SCENARIO("ArrayOf", "[CljonicCoreArrayOf]")
+{
+    constexpr auto crc{ArrayOf<256, [](const SizeType i) { return Crc32OfByte(i); }>()};
+    CHECK(256 == crc.Count());
+    CHECK(0x00000000u == crc[0]);
+    CHECK(0x77073096u == crc[1]);
+    CHECK(0x2d02ef8du == crc[255]);
+    static_assert(0xedb88320u == crc[128]);
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(*crc.Data())>, std::uint32_t>);
+
+    constexpr auto squares{ArrayOf<16, [](const SizeType i) { return i * i; }>()};
+    static_assert(16 == squares.Count());
+    static_assert(225 == squares[15]);
+    static_assert(1240 == Reduce(Plus, squares));
+
+    constexpr auto none{ArrayOf<0, [](const SizeType i) { return i; }>()};
+    static_assert(0 == none.Count());
+}
@@ -1,3 +1,4 @@
+#include <cstdint>
 #include "catch.hpp"
 #include "cljonic-array.hpp"
 #include "cljonic-range.hpp"
@@ -28,4 +29,48 @@ SCENARIO("IndexOf", "[CljonicCoreIndexOf]")
     CHECK(2 == IndexOf(String{"Hello"}, 'l'));
 
     CHECK(1 == IndexOf(Array{"one", "two", "three"}, "two"));
+
+    {
+        // contiguous integer elements are searched a block at a time, and one byte elements with memchr
+        for (SizeType count{0}; count <= 40; ++count)
+            for (SizeType position{0}; position <= count; ++position)
+            {
+                auto a{Array<int, 40>{}};
+                char text[41]{};
+                for (SizeType i{0}; i < count; ++i)
+                {
+                    MConj(a, ((i == position) or (i == (position + 17))) ? 99 : static_cast<int>(i % 7));
+                    text[i] = ((i == position) or (i == (position + 17))) ? 'z' : static_cast<char>('a' + (i % 7));
+                }
+                const auto s{String<40>{text}};
+                const auto expected{(position < count) ? position : CLJONIC_INVALID_INDEX};
+                CHECK(expected == IndexOf(a, 99));
+                CHECK(expected == IndexOf(s, 'z'));
+            }
+    }
+
+    {
+        // the value is compared with the elements as AreEqual compares them, even when its type is different
+        auto u{Array<std::uint8_t, 20>{}};
+        for (const auto i : Array{1, 2, 3, 255, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 44, 255})
+            MConj(u, static_cast<std::uint8_t>(i));
+        CHECK(3 == IndexOf(u, 255));
+        CHECK(CLJONIC_INVALID_INDEX == IndexOf(u, -1));
+        CHECK(CLJONIC_INVALID_INDEX == IndexOf(u, 300));
+        const auto i{Array<int, 20>{1, 2, 3, -1, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20}};
+        CHECK(3 == IndexOf(i, 0xFFFFFFFFu));
+        CHECK(CLJONIC_INVALID_INDEX == IndexOf(i, 0x100000001ll));
+        CHECK(0 == IndexOf(i, 1ll));
+    }
+
+    {
+        // a constant IndexOf finds the same index as a run time IndexOf
+        constexpr auto s{String{"The quick brown fox jumps over the lazy dog"}};
+        static_assert(35 == IndexOf(s, 'l'));
+        CHECK(35 == IndexOf(s, 'l'));
+        static_assert(CLJONIC_INVALID_INDEX == IndexOf(s, '!'));
+        constexpr auto a{Array{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 21}};
+        static_assert(20 == IndexOf(a, 21));
+        CHECK(20 == IndexOf(a, 21));
+    }
 }
@@ -0,0 +1,68 @@
+#include <limits>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-indexofmax.hpp"
+#include "cljonic-core-max.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("IndexOfMax", "[CljonicCoreIndexOfMax]")
+{
+    {
+        constexpr auto a{Array{11, 14, 13, 14}};
+        static_assert(1 == IndexOfMax(a));
+        CHECK(1 == IndexOfMax(a));
+        CHECK(CLJONIC_INVALID_INDEX == IndexOfMax(Array<int, 10>{}));
+        CHECK(0 == IndexOfMax(Array{11}));
+        CHECK(1 == IndexOfMax(String{"adcb"}));
+        CHECK(2 == IndexOfMax(Array{2.5, -1.0, 7.5, 7.5}));
+        CHECK(1 == IndexOfMax(Set{11, 14, 13}));
+    }
+
+    {
+        // a Range or a Repeat is not scanned
+        CHECK(CLJONIC_INVALID_INDEX == IndexOfMax(Range<0>{}));
+        CHECK(9 == IndexOfMax(Range<10>{}));
+        CHECK(0 == IndexOfMax(Range<100, 0, -10>{}));
+        CHECK(0 == IndexOfMax(Range<10, 20, 0>{}));
+        CHECK(0 == IndexOfMax(Repeat<4, int>{11}));
+        CHECK(CLJONIC_INVALID_INDEX == IndexOfMax(Repeat<0, int>{11}));
+    }
+
+    {
+        // every position of the first maximum, in every count above and below the lane threshold, is found
+        for (SizeType count{1}; count <= 60; ++count)
+            for (SizeType position{0}; position < count; ++position)
+            {
+                auto a{Array<int, 60>{}};
+                for (SizeType i{0}; i < count; ++i)
+                    MConj(a, (i == position) ? 9 : ((i > position) and (0 == (i % 3))) ? 9 : static_cast<int>(i % 5));
+                CHECK(position == IndexOfMax(a));
+                CHECK(a[IndexOfMax(a)] == Max(a));
+            }
+    }
+
+    {
+        // a constant IndexOfMax finds the same index as a run time IndexOfMax
+        constexpr auto d{Array{1.5, 2.5, 0.5, 9.5, 3.5, 9.5, 4.5, 5.5, 6.5, 7.5, 8.5, 9.5, 0.5, 1.5, 2.5, 3.5, 9.5}};
+        static_assert(3 == IndexOfMax(d));
+        CHECK(3 == IndexOfMax(d));
+        CHECK(2 == IndexOfMax(SliceView{d, 1, 10}));
+    }
+
+    {
+        // a NaN that is not first is skipped by the left-to-right scan, in a collection long enough for lanes
+        auto a{Array<double, 200>{}};
+        constexpr auto nan{std::numeric_limits<double>::quiet_NaN()};
+        for (SizeType i{0}; i < 200; ++i)
+            MConj(a, (3 == i) ? nan : (150 == i) ? 1000.0 : static_cast<double>(i));
+        CHECK(150 == IndexOfMax(a));
+        CHECK(1000.0 == Max(a));
+    }
+}
@@ -0,0 +1,57 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-indexofmin.hpp"
+#include "cljonic-core-min.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("IndexOfMin", "[CljonicCoreIndexOfMin]")
+{
+    {
+        constexpr auto a{Array{14, 11, 13, 11}};
+        static_assert(1 == IndexOfMin(a));
+        CHECK(1 == IndexOfMin(a));
+        CHECK(CLJONIC_INVALID_INDEX == IndexOfMin(Array<int, 10>{}));
+        CHECK(0 == IndexOfMin(Array{11}));
+        CHECK(1 == IndexOfMin(String{"dacb"}));
+        CHECK(1 == IndexOfMin(Array{2.5, -1.0, 7.5, -1.0}));
+        CHECK(1 == IndexOfMin(Set{14, 11, 13}));
+    }
+
+    {
+        // a Range or a Repeat is not scanned
+        CHECK(CLJONIC_INVALID_INDEX == IndexOfMin(Range<0>{}));
+        CHECK(0 == IndexOfMin(Range<10>{}));
+        CHECK(9 == IndexOfMin(Range<100, 0, -10>{}));
+        CHECK(0 == IndexOfMin(Range<10, 20, 0>{}));
+        CHECK(0 == IndexOfMin(Repeat<4, int>{11}));
+        CHECK(CLJONIC_INVALID_INDEX == IndexOfMin(Repeat<0, int>{11}));
+    }
+
+    {
+        // every position of the first minimum, in every count above and below the lane threshold, is found
+        for (SizeType count{1}; count <= 60; ++count)
+            for (SizeType position{0}; position < count; ++position)
+            {
+                auto a{Array<int, 60>{}};
+                for (SizeType i{0}; i < count; ++i)
+                    MConj(a, (i == position) ? -9 : ((i > position) and (0 == (i % 3))) ? -9 : static_cast<int>(i % 5));
+                CHECK(position == IndexOfMin(a));
+                CHECK(a[IndexOfMin(a)] == Min(a));
+            }
+    }
+
+    {
+        // a constant IndexOfMin finds the same index as a run time IndexOfMin
+        constexpr auto d{Array{1.5, 2.5, 9.5, 0.5, 3.5, 0.5, 4.5, 5.5, 6.5, 7.5, 8.5, 9.5, 0.5, 1.5, 2.5, 3.5, 0.5}};
+        static_assert(3 == IndexOfMin(d));
+        CHECK(3 == IndexOfMin(d));
+        CHECK(2 == IndexOfMin(SliceView{d, 1, 10}));
+    }
+}
@@ -0,0 +1,54 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-compose.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filtert.hpp"
+#include "cljonic-core-into.hpp"
+#include "cljonic-core-mapt.hpp"
+#include "cljonic-core-taket.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("Into", "[CljonicCoreInto]")
+{
+    constexpr auto Square = [](const int i) { return i * i; };
+    constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+
+    CHECK(Equal(Array{0, 4, 16, 36, 64}, Into(Array<int, 10>{}, Compose(FilterT(Even), MapT(Square)), Range<10>{})));
+    CHECK(Equal(Array{1, 2, 9, 16}, Into(Array<int, 10>{1, 2}, MapT(Square), Array{3, 4})));
+    CHECK(Equal(Array{7, 7}, Into(Array<int, 10>{}, TakeT(2), Repeat<1000, int>{7})));
+    CHECK(Equal(Array<int, 10>{}, Into(Array<int, 10>{}, TakeT(0), Range<10>{})));
+    CHECK(Equal(Array{'H', 'L', 'L', 'O'}, Into(Array<char, 4>{'H'},
+                                                MapT([](const char c) { return static_cast<char>(c - 'a' + 'A'); }),
+                                                String{"llo"})));
+
+    {
+        // appending stops as soon as the Array is full
+        auto calls{0};
+        const auto CountedSquare = [&calls](const int i)
+        {
+            ++calls;
+            return i * i;
+        };
+        const auto i{Into(Array<int, 3>{}, MapT(CountedSquare), Range<1000>{})};
+        CHECK(Equal(Array{0, 1, 4}, i));
+        CHECK(3 == i.MaximumCount());
+        CHECK(3 == calls);
+
+        calls = 0;
+        CHECK(Equal(Array{1, 2}, Into(Array{1, 2}, MapT(CountedSquare), Range<1000>{})));
+        CHECK(0 == calls);
+    }
+
+    {
+        // elements are converted to the Array's value type
+        CHECK(Equal(Array{0L, 1L, 2L}, Into(Array<long, 3>{}, MapT([](const int i) { return i; }), Range<3>{})));
+    }
+
+    constexpr auto i{Into(Array<int, 10>{}, Compose(FilterT(Even), MapT(Square), TakeT(2)), Range<1000>{})};
+    static_assert(Equal(Array{0, 4}, i), "Into should be usable at compile time");
+}
@@ -0,0 +1,27 @@
+#include <cstdint>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-iseven.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("IsEven", "[CljonicCoreIsEven]")
+{
+    CHECK(IsEven(0));
+    CHECK(IsEven(4));
+    CHECK(IsEven(-4));
+    CHECK(not IsEven(3));
+    CHECK(not IsEven(-3));
+    CHECK(IsEven(std::uint64_t{1} << 63));
+    CHECK(IsEven('b'));
+    CHECK(not IsEven(true));
+    static_assert(IsEven(10));
+
+    CHECK(Equal(Array{2, -4}, Filter(IsEven, Array{1, 2, 3, -4, -5})));
+    CHECK(Equal(Array{0, 2, 4, 6, 8}, Filter(IsEven, Range<10>{})));
+    CHECK(Equal(Array{-6, -4}, Filter(IsEven, Range<-6, -3>{})));
+}
@@ -0,0 +1,27 @@
+#include <cstdint>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-isodd.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("IsOdd", "[CljonicCoreIsOdd]")
+{
+    CHECK(not IsOdd(0));
+    CHECK(not IsOdd(4));
+    CHECK(not IsOdd(-4));
+    CHECK(IsOdd(3));
+    CHECK(IsOdd(-3));
+    CHECK(not IsOdd(std::uint64_t{1} << 63));
+    CHECK(IsOdd('a'));
+    CHECK(IsOdd(true));
+    static_assert(IsOdd(11));
+
+    CHECK(Equal(Array{1, 3, -5}, Filter(IsOdd, Array{1, 2, 3, -4, -5})));
+    CHECK(Equal(Array{1, 3, 5, 7, 9}, Filter(IsOdd, Range<10>{})));
+    CHECK(Equal(Array{-5}, Filter(IsOdd, Range<-6, -3>{})));
+}
@@ -1,4 +1,5 @@
 #include <tuple>
+#include <cstdint>
 #include "catch.hpp"
 #include "cljonic-array.hpp"
 #include "cljonic-range.hpp"
@@ -23,4 +24,38 @@ SCENARIO("LastIndexOf", "[CljonicCoreLastIndexOf]")
     CHECK(2 == LastIndexOf(Set{11, 14, 13, 14}, 13));
     CHECK(2 == LastIndexOf(String{"adcb"}, 'c'));
     CHECK(1 == LastIndexOf(Array{"zero", "one", "two"}, "one"));
+
+    {
+        // contiguous integer elements are searched a block at a time from the end
+        for (SizeType count{0}; count <= 40; ++count)
+            for (SizeType position{0}; position <= count; ++position)
+            {
+                auto a{Array<int, 40>{}};
+                char text[41]{};
+                for (SizeType i{0}; i < count; ++i)
+                {
+                    MConj(a, ((i == position) or ((i + 17) == position)) ? 99 : static_cast<int>(i % 7));
+                    text[i] = ((i == position) or ((i + 17) == position)) ? 'z' : static_cast<char>('a' + (i % 7));
+                }
+                const auto s{String<40>{text}};
+                const auto earlier{(position >= 17) ? (position - 17) : CLJONIC_INVALID_INDEX};
+                const auto expected{(position < count) ? position : earlier};
+                CHECK(expected == LastIndexOf(a, 99));
+                CHECK(expected == LastIndexOf(s, 'z'));
+            }
+    }
+
+    {
+        // the value is compared with the elements as AreEqual compares them, even when its type is different
+        auto u{Array<std::uint8_t, 20>{}};
+        for (const auto i : Array{255, 2, 3, 255, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 44, 19})
+            MConj(u, static_cast<std::uint8_t>(i));
+        CHECK(3 == LastIndexOf(u, 255));
+        CHECK(CLJONIC_INVALID_INDEX == LastIndexOf(u, -1));
+        CHECK(CLJONIC_INVALID_INDEX == LastIndexOf(u, 300));
+        constexpr auto a{Array{21, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23}};
+        static_assert(20 == LastIndexOf(a, 21));
+        CHECK(20 == LastIndexOf(a, 21));
+        CHECK(20 == LastIndexOf(a, 21ll));
+    }
 }
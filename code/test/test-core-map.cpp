@@ -4,8 +4,10 @@
 #include "cljonic-repeat.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
+#include "cljonic-core-cycle.hpp"
 #include "cljonic-core-equal.hpp"
 #include "cljonic-core-map.hpp"
+#include "cljonic-core-take.hpp"
 
 using namespace cljonic;
 using namespace cljonic::core;
@@ -25,4 +27,9 @@ SCENARIO("Map", "[CljonicCoreMap]")
     CHECK(Equal(Array{1, 3, 5, 7}, Map(Add2, Set{1, 2, 3, 4}, Range{})));
     CHECK(Equal(Array{2, 3, 4, 5}, Map(Add2, Set{1, 2, 3, 4}, Repeat{1})));
     CHECK(Equal(Array{4, 6, 8, 10}, Map(Add3, Set{1, 2, 3, 4}, Range{}, Repeat{3})));
+    CHECK(Equal(Array{11, 22, 13, 24}, Map(Add2, Array{1, 2, 3, 4}, Cycle(Array{10, 20}))));
+    CHECK(Equal(Array{10, 21, 32, 13, 24}, Map(Add2, Range<5>{}, Cycle(Range<10, 40, 10>{}))));
+    CHECK(Equal(Array{2, 4, 6}, Map(TwoTimes, Take(3, Cycle(Set{1, 2, 3, 1})))));
+    CHECK(Equal(Array{1, 2, 3, 4}, Map(Add2, Array{1, 2, 3, 4}, Cycle(Array<int, 4>{})))); // default elements
+    static_assert(Equal(Array{11, 22, 13}, Map(Add2, Array{1, 2, 3}, Cycle(Array{10, 20}))));
 }
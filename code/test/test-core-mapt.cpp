@@ -0,0 +1,35 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-core-compose.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-into.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-mapt.hpp"
+#include "cljonic-core-transduce.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("MapT", "[CljonicCoreMapT]")
+{
+    constexpr auto Add = [](const int a, const int b) { return a + b; };
+    constexpr auto Square = [](const int i) { return i * i; };
+    constexpr auto Inc = [](const int i) { return i + 1; };
+
+    CHECK(14 == Transduce(MapT(Square), Add, 0, Array{1, 2, 3}));
+    CHECK(Equal(Map(Square, Range<10>{}), Into(Array<int, 10>{}, MapT(Square), Range<10>{})));
+    CHECK(Equal(Array{1, 16}, Into(Array<int, 5>{}, Compose(MapT(Square), MapT(Square)), Range<1, 3>{})));
+
+    // transducers apply from left to right
+    CHECK(Equal(Array{1, 4, 9}, Into(Array<int, 5>{}, Compose(MapT(Inc), MapT(Square)), Range<3>{})));
+    CHECK(Equal(Array{1, 2, 5}, Into(Array<int, 5>{}, Compose(MapT(Square), MapT(Inc)), Range<3>{})));
+
+    // the mapped type may differ from the element type
+    const auto Name = [](const int i) { return (0 == i) ? "zero" : "other"; };
+    CHECK(2 == Transduce(
+                   MapT(Name), [](const int count, const char* s) { return count + (('o' == s[0]) ? 1 : 0); }, 0,
+                   Range<3>{}));
+
+    static_assert(14 == Transduce(MapT(Square), Add, 0, Array{1, 2, 3}), "MapT should be usable at compile time");
+}
@@ -1,9 +1,11 @@
+#include <limits>
 #include <tuple>
 #include "catch.hpp"
 #include "cljonic-array.hpp"
 #include "cljonic-range.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
+#include "cljonic-sliceview.hpp"
 #include "cljonic-string.hpp"
 #include "cljonic-core-max.hpp"
 
@@ -24,4 +26,19 @@ SCENARIO("Max", "[CljonicCoreMax]")
     CHECK('d' == Max(String{"adcb"}));
     CHECK(14 == Max(1, 2, 14, 7, 9));
     CHECK('9' == Max('1', '2', '9', '7', '9'));
+
+    // long contiguous collections are scanned in lanes, and a Range is not scanned
+    constexpr auto d{Array{1.5, 2.5, 0.5, 9.5, 3.5, 9.5, 4.5, 5.5, 6.5, 7.5, 8.5, 9.5, 0.5, 1.5, 2.5, 3.5, 10.5, 1.5}};
+    static_assert(10.5 == Max(d));
+    CHECK(10.5 == Max(d));
+    CHECK(9.5 == Max(SliceView{d, 0, 16}));
+    CHECK('x' == Max(String{"the quick brown fox"}));
+    CHECK(99 == Max(Range<100>{}));
+    CHECK(100 == Max(Range<100, 0, -10>{}));
+    CHECK(-3 == Max(Range<-3, -20, -2>{}));
+
+    // a NaN that is not first is skipped by the left-to-right scan, so the elements after it are still compared
+    constexpr auto nan{std::numeric_limits<double>::quiet_NaN()};
+    const auto e{Array<double, 20>{0, 1, 2, nan, 4, 5, 6, 7, 8, 9, 10, 100, 12, 13, 14, 15}};
+    CHECK(100.0 == Max(e));
 }
@@ -4,6 +4,7 @@
 #include "cljonic-range.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
+#include "cljonic-sliceview.hpp"
 #include "cljonic-string.hpp"
 #include "cljonic-core-maxby.hpp"
 
@@ -26,4 +27,12 @@ SCENARIO("MaxBy", "[CljonicCoreMaxBy]")
     CHECK('d' == MaxBy([](const char i, const char j) { return i < j; }, String{"adcb"}));
     CHECK(14 == MaxBy(IsALessThanB, 1, 2, 14, 7, 9));
     CHECK('9' == MaxBy([](const char i, const char j) { return i < j; }, '1', '2', '9', '7', '9'));
+
+    // long contiguous collections are scanned in lanes, and the first of several equivalent elements is returned
+    constexpr auto Abs = [](const int i) { return (i < 0) ? -i : i; };
+    constexpr auto IsAbsALessThanAbsB = [Abs](const int a, const int b) { return Abs(a) < Abs(b); };
+    constexpr auto c{Array{1, 2, 3, -9, 4, 5, 6, 9, 7, 8, 1, -9, 2, 3, 9, 4, 5, 6, -9, 7}};
+    static_assert(-9 == MaxBy(IsAbsALessThanAbsB, c));
+    CHECK(-9 == MaxBy(IsAbsALessThanAbsB, c));
+    CHECK(9 == MaxBy(IsAbsALessThanAbsB, SliceView{c, 4}));
 }
@@ -1,9 +1,11 @@
+#include <limits>
 #include <tuple>
 #include "catch.hpp"
 #include "cljonic-array.hpp"
 #include "cljonic-range.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
+#include "cljonic-sliceview.hpp"
 #include "cljonic-string.hpp"
 #include "cljonic-core-min.hpp"
 
@@ -24,4 +26,19 @@ SCENARIO("Min", "[CljonicCoreMin]")
     CHECK('a' == Min(String{"dacb"}));
     CHECK(1 == Min(1, 2, 14, 7, 9));
     CHECK('1' == Min('2', '1', '9', '7', '9'));
+
+    // long contiguous collections are scanned in lanes, and a Range is not scanned
+    constexpr auto d{Array{1.5, 2.5, 0.5, 9.5, 3.5, 9.5, 4.5, 5.5, 6.5, 7.5, 8.5, 9.5, 0.5, 1.5, 2.5, 3.5, -0.5, 1.5}};
+    static_assert(-0.5 == Min(d));
+    CHECK(-0.5 == Min(d));
+    CHECK(0.5 == Min(SliceView{d, 0, 16}));
+    CHECK(' ' == Min(String{"the quick brown fox"}));
+    CHECK(0 == Min(Range<100>{}));
+    CHECK(10 == Min(Range<100, 0, -10>{}));
+    CHECK(-19 == Min(Range<-3, -20, -2>{}));
+
+    // a NaN that is not first is skipped by the left-to-right scan, so the elements after it are still compared
+    constexpr auto nan{std::numeric_limits<double>::quiet_NaN()};
+    const auto e{Array<double, 20>{0, -1, -2, nan, -4, -5, -6, -7, -8, -9, -10, -100, -12, -13, -14, -15}};
+    CHECK(-100.0 == Min(e));
 }
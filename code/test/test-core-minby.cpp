@@ -4,6 +4,7 @@
 #include "cljonic-range.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
+#include "cljonic-sliceview.hpp"
 #include "cljonic-string.hpp"
 #include "cljonic-core-minby.hpp"
 
@@ -26,4 +27,12 @@ SCENARIO("MinBy", "[CljonicCoreMinBy]")
     CHECK('a' == MinBy([](const char i, const char j) { return i < j; }, String{"adcb"}));
     CHECK(1 == MinBy(IsALessThanB, 1, 2, 14, 7, 9));
     CHECK('1' == MinBy([](const char i, const char j) { return i < j; }, '1', '2', '9', '7', '9'));
+
+    // long contiguous collections are scanned in lanes, and the last of several equivalent elements is returned
+    constexpr auto Abs = [](const int i) { return (i < 0) ? -i : i; };
+    constexpr auto IsAbsALessThanAbsB = [Abs](const int a, const int b) { return Abs(a) < Abs(b); };
+    constexpr auto c{Array{5, 2, 3, -1, 4, 5, 6, 1, 7, 8, 2, -1, 2, 3, 1, 4, 5, 6, -1, 7}};
+    static_assert(-1 == MinBy(IsAbsALessThanAbsB, c));
+    CHECK(-1 == MinBy(IsAbsALessThanAbsB, c));
+    CHECK(1 == MinBy(IsAbsALessThanAbsB, SliceView{c, 0, 16}));
 }
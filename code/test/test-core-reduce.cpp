@@ -1,3 +1,4 @@
+#include <limits>
 #include "catch.hpp"
 #include "cljonic-array.hpp"
 #include "cljonic-range.hpp"
@@ -46,6 +47,16 @@ SCENARIO("Reduce", "[CljonicCoreReduce]")
     constexpr auto s{String{"Hello"}};
     CHECK(5 == Reduce([](const int count, [[maybe_unused]] const char b) { return count + 1; }, 0, s));
 
+    {
+        // a NaN that is not first is skipped by Minimum and Maximum, as by a left-to-right scan
+        constexpr auto nan{std::numeric_limits<double>::quiet_NaN()};
+        const auto e{Array<double, 20>{0, 1, 2, nan, 4, 5, 6, 7, 8, 9, 10, 100, 12, 13, 14, 15}};
+        CHECK(100.0 == Reduce(Maximum, e));
+        CHECK(0.0 == Reduce(Minimum, e));
+        CHECK(100.0 == Reduce(Maximum, 50.0, e));
+        CHECK(-1.0 == Reduce(Minimum, -1.0, e));
+    }
+
     // Compiler Error: Function cannot be called with two parameters of the collection value type
     // constexpr auto ints{Array{1, 2, 3, 4}};
     // CHECK(10 == Reduce([](const char* a, const int b) { return a[0] + b; }, a));
@@ -0,0 +1,121 @@
+#include <cstdint>
+#include <span>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-spanview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-reducers.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+namespace
+{
+
+template <typename T, SizeType N>
+constexpr auto Scatter(const SizeType count)
+{
+    auto result{Array<T, N>{}};
+    for (SizeType i{0}; i < count; ++i)
+        MConj(result, static_cast<T>(((i * 37) + 11) % 61));
+    return result;
+}
+
+template <typename T, typename F>
+constexpr T LeftToRight(const F& f, const T* elements, const SizeType count)
+{
+    auto result{elements[0]};
+    for (SizeType i{1}; i < count; ++i)
+        result = static_cast<T>(f(result, elements[i]));
+    return result;
+}
+
+} // namespace
+
+SCENARIO("Reducers", "[CljonicCoreReducers]")
+{
+    {
+        CHECK(3 == Plus(1, 2));
+        CHECK(6 == Multiplies(2, 3));
+        CHECK(2 == BitAnd(6, 3));
+        CHECK(7 == BitOr(6, 3));
+        CHECK(3 == Minimum(3, 6));
+        CHECK(6 == Maximum(3, 6));
+        CHECK(1.5 == Plus(1.0, 0.5));
+        static_assert(IsLaneReducer<MaximumReducer, int>);
+        static_assert(IsLaneReducer<PlusReducer, double>);
+        static_assert(not IsLaneReducer<MaximumReducer, double>);
+        static_assert(not IsLaneReducer<MinimumReducer, float>);
+        static_assert(IsLaneReducer<BitOrReducer, std::uint8_t>);
+        static_assert(not IsLaneReducer<BitOrReducer, double>);
+        static_assert(not IsLaneReducer<PlusReducer, bool>);
+        static_assert(not IsLaneReducer<PlusReducer, const char*>);
+    }
+
+    {
+        // every count, above and below the lane threshold, agrees with a left-to-right reduction
+        for (SizeType count{1}; count <= 100; ++count)
+        {
+            const auto a{Scatter<int, 100>(count)};
+            CHECK(LeftToRight(Plus, a.Data(), count) == Reduce(Plus, a));
+            CHECK(LeftToRight(BitAnd, a.Data(), count) == Reduce(BitAnd, a));
+            CHECK(LeftToRight(BitOr, a.Data(), count) == Reduce(BitOr, a));
+            CHECK(LeftToRight(Minimum, a.Data(), count) == Reduce(Minimum, a));
+            CHECK(LeftToRight(Maximum, a.Data(), count) == Reduce(Maximum, a));
+            CHECK((7 + LeftToRight(Plus, a.Data(), count)) == Reduce(Plus, 7, a));
+            CHECK(-1 == Reduce(Minimum, -1, a));
+            const auto d{Scatter<double, 100>(count)};
+            CHECK(LeftToRight(Plus, d.Data(), count) == Reduce(Plus, d)); // small integers sum exactly
+            CHECK(LeftToRight(Minimum, d.Data(), count) == Reduce(Minimum, d));
+            CHECK(LeftToRight(Maximum, d.Data(), count) == Reduce(Maximum, d));
+        }
+    }
+
+    {
+        // the product wraps, or overflows to infinity, the same way in any order for these element types
+        const auto u{Scatter<std::uint32_t, 1000>(1000)};
+        CHECK(LeftToRight(Multiplies, u.Data(), 1000) == Reduce(Multiplies, u));
+        const auto f{Array<float, 40>{1.0f, 2.0f, 0.5f, 4.0f, 0.25f, 2.0f, 2.0f, 0.5f, 1.0f, 2.0f, 0.5f, 4.0f,
+                                      0.25f, 2.0f, 2.0f, 0.5f, 3.0f, 1.0f}};
+        CHECK(12.0f == Reduce(Multiplies, f));
+    }
+
+    {
+        // an empty collection returns its default element, or the initial value
+        CHECK(0 == Reduce(Plus, Array<int, 10>{}));
+        CHECK(5 == Reduce(Plus, 5, Array<int, 10>{}));
+        CHECK(0.0 == Reduce(Maximum, Array<double, 10>{}));
+    }
+
+    {
+        // chars are combined as ints and converted back to char, as std::accumulate does
+        const auto s{String{"Hello, World"}};
+        CHECK('r' == Reduce(Maximum, s));
+        CHECK(' ' == Reduce(Minimum, s));
+        CHECK(static_cast<char>(LeftToRight(Plus, s.Data(), s.Count())) == Reduce(Plus, s));
+    }
+
+    {
+        // contiguous views are reduced in lanes, and other collections are reduced one element at a time
+        const auto a{Scatter<int, 100>(100)};
+        const auto expected{LeftToRight(Plus, a.Data(), 100)};
+        CHECK(expected == Reduce(Plus, SpanView{a.AsSpan()}));
+        CHECK(LeftToRight(Plus, a.Data() + 10, 50) == Reduce(Plus, SliceView{a, 10, 60}));
+        CHECK(4950 == Reduce(Plus, Range<100>{}));
+        CHECK(99 == Reduce(Maximum, Range<100>{}));
+        CHECK(44 == Reduce(Plus, Repeat<4, int>{11}));
+    }
+
+    {
+        // a constant Reduce combines the lanes in the same order as a run time Reduce
+        constexpr auto d{Scatter<double, 1000>(1000)};
+        constexpr auto sum{Reduce(Plus, d)};
+        CHECK(sum == Reduce(Plus, d));
+        static_assert(60 == Reduce(Maximum, Scatter<int, 1000>(1000)));
+        static_assert(0 == Reduce(Minimum, Scatter<int, 1000>(1000)));
+    }
+}
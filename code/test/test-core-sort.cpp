@@ -5,6 +5,8 @@
 #include "cljonic-set.hpp"
 #include "cljonic-string.hpp"
 #include "cljonic-core-equal.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-reverse.hpp"
 #include "cljonic-core-sort.hpp"
 
 using namespace cljonic;
@@ -30,4 +32,20 @@ SCENARIO("Sort", "[CljonicCoreSort]")
 
     CHECK(Equal(Array{"four", "one", "three", "two"}, Sort(Array{"one", "two", "three", "four"})));
     CHECK(Equal(Array{"four", "one", "three", "two"}, Sort(Array{"one", "two", "three", "four"})));
+
+    // large inputs exercise the quicksort partitioning and the insertion sort cutoff
+    constexpr auto Scatter = [](const int i) { return (i * 7919) % 1000; };
+    CHECK(Equal(Range<1000>{}, Sort(Map(Scatter, Range<1000>{}))));
+    CHECK(Equal(Range<1000>{}, Sort(Range<999, -1, -1>{})));
+    CHECK(Equal(Range<1000>{}, Sort(Range<1000>{})));
+
+    constexpr auto Tens = [](const int i) { return (i % 10); };
+    const auto sortDuplicates{Sort(Map(Tens, Range<1000>{}))};
+    auto isSorted{(1000 == sortDuplicates.Count())};
+    for (SizeType i{0}; i < sortDuplicates.Count(); ++i)
+        isSorted = isSorted and (static_cast<int>(i / 100) == sortDuplicates[i]);
+    CHECK(isSorted);
+
+    constexpr auto sortConstexpr{Sort(Reverse(Range<100>{}))};
+    static_assert(Equal(Range<100>{}, sortConstexpr), "Sort should be usable at compile time");
 }
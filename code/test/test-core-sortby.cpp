@@ -5,6 +5,7 @@
 #include "cljonic-set.hpp"
 #include "cljonic-string.hpp"
 #include "cljonic-core-equal.hpp"
+#include "cljonic-core-map.hpp"
 #include "cljonic-core-sortby.hpp"
 
 using namespace cljonic;
@@ -30,4 +31,19 @@ SCENARIO("SortBy", "[CljonicCoreSortBy]")
     CHECK(Equal(Array{'a', 'b', 'c', 'd'}, SortBy([](const char i, const char j) { return i < j; }, String{"abcd"})));
     CHECK(Equal(Array{'a', 'b', 'c', 'x', 'y', 'z'},
                 SortBy([](const char i, const char j) { return i < j; }, String{"axbycz"})));
+
+    // large inputs exercise the quicksort partitioning, and a predicate that is not a strict weak ordering stays in
+    // bounds
+    constexpr auto IsAGreaterThanB = [](const int a, const int b) { return a > b; };
+    constexpr auto Scatter = [](const int i) { return (i * 7919) % 1000; };
+    CHECK(Equal(Range<999, -1, -1>{}, SortBy(IsAGreaterThanB, Map(Scatter, Range<1000>{}))));
+    CHECK(Equal(Range<999, -1, -1>{}, SortBy(IsAGreaterThanB, Range<1000>{})));
+    CHECK(Equal(Range<1000>{}, SortBy([](const int a, const int b) { return a <= b; }, Map(Scatter, Range<1000>{}))));
+    CHECK(1000 == SortBy([](const int, const int) { return true; }, Range<1000>{}).Count());
+
+    // sorting an Array of Arrays moves the nested Arrays, rather than copying them
+    constexpr auto FirstLessThan = [](const Array<int, 2>& a, const Array<int, 2>& b) { return a[0] < b[0]; };
+    constexpr auto nested{Array{Array{3, 30}, Array{1, 10}, Array{2, 20}}};
+    constexpr auto sorted{SortBy(FirstLessThan, nested)};
+    static_assert(Equal(Array{Array{1, 10}, Array{2, 20}, Array{3, 30}}, sorted));
 }
@@ -3,6 +3,7 @@
 #include "cljonic-range.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
+#include "cljonic-spanview.hpp"
 #include "cljonic-string.hpp"
 #include "cljonic-core-equal.hpp"
 #include "cljonic-core-splitat.hpp"
@@ -22,3 +23,30 @@ SCENARIO("SplitAt", "[CljonicCoreSplitAt]")
     CHECK(Equal(Array{Array<char, 2>{'a', 'b'}, Array<char, 2>{}}, SplitAt(5, Set{'a', 'b'})));
     CHECK(Equal(Array{Array<char, 5>{'H', 'e', 'l'}, Array<char, 5>{'l', 'o'}}, SplitAt(3, String{"Hello"})));
 }
+
+SCENARIO("SplitAtView", "[CljonicCoreSplitAtView]")
+{
+    const auto a{Array{11, 12, 13, 14}};
+    const auto [first, rest]{SplitAtView(2, a)};
+    CHECK(a.begin() == first.begin());
+    CHECK(first.end() == rest.begin());
+    CHECK(Equal(Array{11, 12}, first));
+    CHECK(Equal(Array{13, 14}, rest));
+    CHECK(Equal(SplitAt(2, a)[0], first));
+    CHECK(Equal(SplitAt(2, a)[1], rest));
+
+    static constexpr auto rng{Range<5>{}};
+    constexpr auto split{SplitAtView(3, rng)};
+    static_assert(Equal(Array{0, 1, 2}, split.first));
+    static_assert(Equal(Array{3, 4}, split.second));
+    const auto str{String{"Hello"}};
+    const auto [h, t]{SplitAtView(5, str)};
+    CHECK(Equal(Array{'H', 'e', 'l', 'l', 'o'}, h));
+    CHECK(0 == t.Count());
+
+    // a SpanView is copied into both SliceViews, which refer to its elements
+    const auto [s0, s1]{SplitAtView(1, SpanView{str.AsSpan()})};
+    CHECK(str.begin() == s0.begin());
+    CHECK(str.begin() + 1 == s1.begin());
+    CHECK(Equal(Array{'e', 'l', 'l', 'o'}, s1));
+}
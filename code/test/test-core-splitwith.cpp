@@ -3,6 +3,7 @@
 #include "cljonic-range.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
+#include "cljonic-spanview.hpp"
 #include "cljonic-string.hpp"
 #include "cljonic-core-equal.hpp"
 #include "cljonic-core-splitwith.hpp"
@@ -32,4 +33,38 @@ SCENARIO("SplitWith", "[CljonicCoreSplitWith]")
     CHECK(Equal(Array{Array<char, 4>{'a', 'b'}, Array<char, 4>{'c', 'd'}}, SplitWith(NotC, String{"abcd"})));
     CHECK(
         Equal(Array{Array<char, 4>{'a', 'x', 'b', 'y'}, Array<char, 4>{'c', 'z'}}, SplitWith(NotC, String{"axbycz"})));
+
+    // SplitWith moves its two halves into the result, which is an Array of Arrays of Arrays here
+    constexpr auto FirstIsOdd = [](const Array<int, 2>& a) { return 1 == (a[0] % 2); };
+    constexpr auto nested{Array{Array{1, 10}, Array{3, 30}, Array{4, 40}}};
+    constexpr auto split{SplitWith(FirstIsOdd, nested)};
+    static_assert(Equal(Array{Array{1, 10}, Array{3, 30}}, split[0]));
+    static_assert(Equal(Array<Array<int, 2>, 1>{Array{4, 40}}, split[1]));
+}
+
+SCENARIO("SplitWithView", "[CljonicCoreSplitWithView]")
+{
+    constexpr auto IsLessThan13 = [](const int a) { return a < 13; };
+
+    const auto a{Array{11, 13, 12, 14}};
+    const auto [first, rest]{SplitWithView(IsLessThan13, a)};
+    CHECK(a.begin() == first.begin());
+    CHECK(first.end() == rest.begin());
+    CHECK(Equal(Array{11}, first));
+    CHECK(Equal(Array{13, 12, 14}, rest));
+
+    static constexpr auto rng{Range<10, 16>{}};
+    constexpr auto split{SplitWithView(IsLessThan13, rng)};
+    static_assert(Equal(Array{10, 11, 12}, split.first));
+    static_assert(Equal(Array{13, 14, 15}, split.second));
+    constexpr auto NotC = [](const char c) { return c != 'c'; };
+    const auto str{String{"axbycz"}};
+    const auto [h, t]{SplitWithView(NotC, str)};
+    CHECK(Equal(Array{'a', 'x', 'b', 'y'}, h));
+    CHECK(Equal(Array{'c', 'z'}, t));
+
+    // a SpanView is copied into both SliceViews, which refer to its elements
+    const auto [s0, s1]{SplitWithView(NotC, SpanView{str.AsSpan()})};
+    CHECK(str.begin() == s0.begin());
+    CHECK(str.begin() + 4 == s1.begin());
 }
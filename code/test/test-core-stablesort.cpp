@@ -0,0 +1,51 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-reverse.hpp"
+#include "cljonic-core-stablesort.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("StableSort", "[CljonicCoreStableSort]")
+{
+    constexpr auto a{Array{11, 12, 13, 14}};
+    CHECK(Equal(Array{11, 12, 13, 14}, StableSort(a)));
+
+    constexpr auto b{Array{11, 13, 12, 14}};
+    CHECK(Equal(Array{11, 12, 13, 14}, StableSort(b)));
+
+    CHECK(Equal(Array<int, 0>{}, StableSort(Range<0>{})));
+
+    CHECK(Equal(Array{11, 11, 11, 11}, StableSort(Repeat<4, int>{11})));
+
+    CHECK(Equal(Array{11, 12, 13, 14}, StableSort(Set{11, 12, 13, 14})));
+    CHECK(Equal(Array{11, 12, 13, 14}, StableSort(Set{11, 13, 12, 14})));
+
+    CHECK(Equal(Array{'a', 'b', 'c', 'd'}, StableSort(String{"abcd"})));
+    CHECK(Equal(Array{'a', 'b', 'c', 'x', 'y', 'z'}, StableSort(String{"axbycz"})));
+
+    CHECK(Equal(Array{"four", "one", "three", "two"}, StableSort(Array{"one", "two", "three", "four"})));
+    CHECK(Equal(Array{"four", "one", "three", "two"}, StableSort(Array{"one", "two", "three", "four"})));
+
+    // large inputs exercise the merging of runs
+    constexpr auto Scatter = [](const int i) { return (i * 7919) % 1000; };
+    CHECK(Equal(Range<1000>{}, StableSort(Map(Scatter, Range<1000>{}))));
+    CHECK(Equal(Range<1000>{}, StableSort(Range<999, -1, -1>{})));
+    CHECK(Equal(Range<1000>{}, StableSort(Range<1000>{})));
+
+    constexpr auto Tens = [](const int i) { return (i % 10); };
+    const auto sortDuplicates{StableSort(Map(Tens, Range<1000>{}))};
+    auto isSorted{(1000 == sortDuplicates.Count())};
+    for (SizeType i{0}; i < sortDuplicates.Count(); ++i)
+        isSorted = isSorted and (static_cast<int>(i / 100) == sortDuplicates[i]);
+    CHECK(isSorted);
+
+    constexpr auto sortConstexpr{StableSort(Reverse(Range<100>{}))};
+    static_assert(Equal(Range<100>{}, sortConstexpr), "StableSort should be usable at compile time");
+}
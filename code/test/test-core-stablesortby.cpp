@@ -0,0 +1,74 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-sortby.hpp"
+#include "cljonic-core-stablesortby.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("StableSortBy", "[CljonicCoreStableSortBy]")
+{
+    constexpr auto IsALessThanB = [](const int a, const int b) { return a < b; };
+
+    constexpr auto a{Array{11, 12, 13, 14}};
+    CHECK(Equal(Array{11, 12, 13, 14}, StableSortBy(IsALessThanB, a)));
+
+    constexpr auto b{Array{11, 13, 12, 14}};
+    CHECK(Equal(Array{11, 12, 13, 14}, StableSortBy(IsALessThanB, b)));
+
+    CHECK(Equal(Array<int, 0>{}, StableSortBy(IsALessThanB, Range<0>{})));
+
+    CHECK(Equal(Array{11, 11, 11, 11}, StableSortBy(IsALessThanB, Repeat<4, int>{11})));
+
+    CHECK(Equal(Array{11, 12, 13, 14}, StableSortBy(IsALessThanB, Set{11, 12, 13, 14})));
+    CHECK(Equal(Array{11, 12, 13, 14}, StableSortBy(IsALessThanB, Set{11, 13, 12, 14})));
+
+    CHECK(Equal(Array{'a', 'b', 'c', 'd'},
+                StableSortBy([](const char i, const char j) { return i < j; }, String{"abcd"})));
+    CHECK(Equal(Array{'a', 'b', 'c', 'x', 'y', 'z'},
+                StableSortBy([](const char i, const char j) { return i < j; }, String{"axbycz"})));
+
+    // large inputs exercise the merging of runs, and a predicate that is not a strict weak ordering stays in bounds
+    constexpr auto IsAGreaterThanB = [](const int a, const int b) { return a > b; };
+    constexpr auto Scatter = [](const int i) { return (i * 7919) % 1000; };
+    CHECK(Equal(Range<999, -1, -1>{}, StableSortBy(IsAGreaterThanB, Map(Scatter, Range<1000>{}))));
+    CHECK(Equal(Range<999, -1, -1>{}, StableSortBy(IsAGreaterThanB, Range<1000>{})));
+    CHECK(Equal(Range<1000>{},
+                StableSortBy([](const int a, const int b) { return a <= b; }, Map(Scatter, Range<1000>{}))));
+    CHECK(1000 == StableSortBy([](const int, const int) { return true; }, Range<1000>{}).Count());
+
+    // equal elements keep their order, which matches SortBy, whose insertion sort is stable for short collections
+    constexpr auto IsAFirstLessThanBFirst = [](const auto& a, const auto& b) { return a.first < b.first; };
+    constexpr auto pairs{Array{std::pair{2, 'a'}, std::pair{1, 'b'}, std::pair{2, 'c'}, std::pair{1, 'd'}}};
+    CHECK(Equal(Array{std::pair{1, 'b'}, std::pair{1, 'd'}, std::pair{2, 'a'}, std::pair{2, 'c'}},
+                StableSortBy(IsAFirstLessThanBFirst, pairs)));
+    CHECK(Equal(SortBy(IsAFirstLessThanBFirst, pairs), StableSortBy(IsAFirstLessThanBFirst, pairs)));
+
+    constexpr auto KeyAndIndex = [](const int i) { return std::pair{((i * 7919) % 10), i}; };
+    const auto stableSortByKey{StableSortBy(IsAFirstLessThanBFirst, Map(KeyAndIndex, Range<1000>{}))};
+    auto isStable{(1000 == stableSortByKey.Count())};
+    for (SizeType i{1}; i < stableSortByKey.Count(); ++i)
+    {
+        const auto previous{stableSortByKey[i - 1]};
+        const auto current{stableSortByKey[i]};
+        isStable = isStable and ((previous.first < current.first) or
+                                 ((previous.first == current.first) and (previous.second < current.second)));
+    }
+    CHECK(isStable);
+
+    constexpr auto stableSortByConstexpr{StableSortBy(IsAFirstLessThanBFirst, Map(KeyAndIndex, Range<100>{}))};
+    static_assert((0 == stableSortByConstexpr[0].second) and (10 == stableSortByConstexpr[1].second),
+                  "StableSortBy should be usable at compile time");
+
+    // stably sorting an Array of Arrays moves the nested Arrays through the scratch Array
+    constexpr auto FirstLessThan = [](const Array<int, 2>& a, const Array<int, 2>& b) { return a[0] < b[0]; };
+    constexpr auto nested{Array{Array{2, 20}, Array{1, 10}, Array{2, 21}, Array{1, 11}}};
+    static_assert(
+        Equal(Array{Array{1, 10}, Array{1, 11}, Array{2, 20}, Array{2, 21}}, StableSortBy(FirstLessThan, nested)));
+}
@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include "cljonic-array.hpp"
+#include "cljonic-filterview.hpp"
 #include "cljonic-range.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
@@ -28,4 +29,28 @@ SCENARIO("Subs", "[CljonicCoreSubs]")
 
     constexpr auto str{String{"Hello"}};
     CHECK(Equal(Array{'l', 'l'}, Subs(str, 2, 4)));
+
+    constexpr auto even{FilterView{[](const int i) { return 0 == (i % 2); }, Range<10>{}}};
+    CHECK(Equal(Array{2, 4, 6}, Subs(even, 1, 4)));
+    CHECK(Equal(Array{6, 8}, Subs(even, 3)));
+    CHECK(Equal(Array<int, 0>{}, Subs(even, 3, 1)));
+}
+
+SCENARIO("SubsView", "[CljonicCoreSubsView]")
+{
+    const auto a{Array{11, 12, 13, 14}};
+    const auto v{SubsView(a, 1, 3)};
+    CHECK(2 == v.Count());
+    CHECK(4 == v.MaximumCount());
+    CHECK(&a.At(1) == &v.At(0));
+    CHECK(Equal(Array{12, 13}, v));
+    CHECK(Equal(Subs(a, 1, 3), v));
+    CHECK(Equal(Array{13, 14}, SubsView(a, 2)));
+    CHECK(Equal(Array<int, 0>{}, SubsView(a, 3, 1)));
+    CHECK(Equal(Array<int, 0>{}, SubsView(a, 5)));
+
+    constexpr auto rng{SubsView(Range<1, 5>{}, 1)};
+    static_assert(Equal(Array{2, 3, 4}, rng));
+    CHECK(Equal(Array{11, 11, 11}, SubsView(Repeat<3, int>{11}, 0, 5)));
+    CHECK(Equal(Array{'l', 'l'}, SubsView(String{"Hello"}, 2, 4)));
 }
@@ -3,7 +3,10 @@
 #include "cljonic-range.hpp"
 #include "cljonic-repeat.hpp"
 #include "cljonic-set.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-spanview.hpp"
 #include "cljonic-string.hpp"
+#include "cljonic-core-cycle.hpp"
 #include "cljonic-core-equal.hpp"
 #include "cljonic-core-take.hpp"
 
@@ -22,4 +25,42 @@ SCENARIO("Take", "[CljonicCoreTake]")
     CHECK(Equal(Array{"11", "11", "11", "11", "11", "11", "11"}, Take(50, Repeat<7, const char*>{"11"})));
     CHECK(Equal(Array{'a', 'b'}, Take(5, Set{'a', 'b'})));
     CHECK(Equal(Array{'H', 'e', 'l'}, Take(3, String{"Hello"})));
+
+    {
+        // contiguous collections are copied in bulk, at run time and in a constant expression
+        const auto s{SpanView{a.Data() + 2, 5}};
+        CHECK(Equal(Array{2, 3, 4}, Take(3, s)));
+        CHECK(Equal(Array{4, 5}, Take(2, SliceView{a, 4, 8})));
+        static_assert(Equal(Array{0, 1, 2}, Take(3, a)));
+        static_assert(Equal(Array{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, Take(10, a)));
+        const auto nested{Take(1, Array{Array{1, 2}, Array{3, 4}})}; // Arrays are not trivially copyable
+        CHECK(((1 == nested.Count()) and Equal(Array{1, 2}, nested[0])));
+    }
+
+    {
+        // a Cycle of a contiguous collection is copied a cycle at a time
+        CHECK(Equal(Array{1, 2, 3, 1, 2, 3, 1}, Take(7, Cycle(Array{1, 2, 3}))));
+        CHECK(Equal(Array{'H', 'i', 'H', 'i'}, Take(4, Cycle(String{"Hi"}))));
+        CHECK(Equal(Array{2, 3, 2}, Take(3, Cycle(SliceView{a, 2, 4}))));
+        CHECK(Equal(Array{1, 2, 3, 1}, Take(4, Cycle(Range<1, 4>{}))));
+        CHECK(Equal(Array<int, 0>{}, Take(7, Cycle(Array<int, 3>{}))));
+        CHECK(1000 == Take(5000, Cycle(a)).Count());
+        CHECK(9 == Take(5000, Cycle(a))[999]);
+        static_assert(Equal(Array{1, 2, 3, 1, 2}, Take(5, Cycle(Array{1, 2, 3}))));
+    }
+}
+
+SCENARIO("TakeView", "[CljonicCoreTakeView]")
+{
+    const auto a{Array{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    const auto v{TakeView(5, a)};
+    CHECK(5 == v.Count());
+    CHECK(a.begin() == v.begin());
+    CHECK(Equal(Take(5, a), v));
+    CHECK(Equal(Array<int, 0>{}, TakeView(0, a)));
+    CHECK(Equal(a, TakeView(50, a)));
+
+    constexpr auto rng{TakeView(3, Range<10>{})};
+    static_assert(Equal(Array{0, 1, 2}, rng));
+    CHECK(Equal(Array{'H', 'e', 'l'}, TakeView(3, String{"Hello"})));
 }
@@ -20,3 +20,18 @@ SCENARIO("TakeLast", "[CljonicCoreTakeLast]")
     CHECK(Equal(Array{"11", "11", "11", "11", "11", "11", "11"}, TakeLast(50, Repeat<7, const char*>{"11"})));
     CHECK(Equal(Array{'l', 'l', 'o'}, TakeLast(3, String{"Hello"})));
 }
+
+SCENARIO("TakeLastView", "[CljonicCoreTakeLastView]")
+{
+    const auto a{Array{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    const auto v{TakeLastView(2, a)};
+    CHECK(2 == v.Count());
+    CHECK((a.begin() + 8) == v.begin());
+    CHECK(Equal(TakeLast(2, a), v));
+    CHECK(Equal(Array<int, 0>{}, TakeLastView(0, a)));
+    CHECK(Equal(a, TakeLastView(50, a)));
+
+    constexpr auto rng{TakeLastView(3, Range<10>{})};
+    static_assert(Equal(Array{7, 8, 9}, rng));
+    CHECK(Equal(Array{'l', 'l', 'o'}, TakeLastView(3, String{"Hello"})));
+}
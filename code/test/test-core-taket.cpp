@@ -0,0 +1,42 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-core-compose.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filtert.hpp"
+#include "cljonic-core-into.hpp"
+#include "cljonic-core-mapt.hpp"
+#include "cljonic-core-taket.hpp"
+#include "cljonic-core-transduce.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("TakeT", "[CljonicCoreTakeT]")
+{
+    constexpr auto Add = [](const int a, const int b) { return a + b; };
+    constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+
+    CHECK(3 == Transduce(TakeT(3), Add, 0, Range<1000>{}));
+    CHECK(0 == Transduce(TakeT(0), Add, 0, Range<1000>{}));
+    CHECK(45 == Transduce(TakeT(100), Add, 0, Range<10>{}));
+    CHECK(Equal(Array{7, 7, 7}, Into(Array<int, 10>{}, TakeT(3), Repeat<1000, int>{7})));
+    CHECK(Equal(Array{0, 2}, Into(Array<int, 10>{}, Compose(FilterT(Even), TakeT(2)), Range<10>{})));
+    CHECK(Equal(Array{0, 1}, Into(Array<int, 10>{}, Compose(TakeT(5), TakeT(2)), Range<10>{})));
+    CHECK(Equal(Array{0, 2, 4}, Into(Array<int, 10>{}, Compose(TakeT(5), FilterT(Even)), Range<10>{})));
+
+    {
+        // the reduction stops after the last element is taken, without visiting the next element
+        auto calls{0};
+        const auto Counted = [&calls](const int i)
+        {
+            ++calls;
+            return i;
+        };
+        CHECK(3 == Transduce(Compose(MapT(Counted), TakeT(3)), Add, 0, Range<1000>{}));
+        CHECK(3 == calls);
+    }
+
+    static_assert(3 == Transduce(TakeT(3), Add, 0, Range<1000>{}), "TakeT should be usable at compile time");
+}
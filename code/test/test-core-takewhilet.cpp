@@ -0,0 +1,39 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-core-compose.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-into.hpp"
+#include "cljonic-core-mapt.hpp"
+#include "cljonic-core-takewhile.hpp"
+#include "cljonic-core-takewhilet.hpp"
+#include "cljonic-core-transduce.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("TakeWhileT", "[CljonicCoreTakeWhileT]")
+{
+    constexpr auto Add = [](const int a, const int b) { return a + b; };
+    constexpr auto LessThan4 = [](const int i) { return i < 4; };
+
+    CHECK(6 == Transduce(TakeWhileT(LessThan4), Add, 0, Range<1000>{}));
+    CHECK(0 == Transduce(TakeWhileT(LessThan4), Add, 0, Array{5, 1, 2}));
+    CHECK(Equal(Array{1}, Into(Array<int, 10>{}, TakeWhileT(LessThan4), Array{1, 5, 2})));
+    CHECK(Equal(TakeWhile(LessThan4, Range<10>{}), Into(Array<int, 10>{}, TakeWhileT(LessThan4), Range<10>{})));
+
+    {
+        // the reduction stops at the first element for which the predicate is false
+        auto calls{0};
+        const auto Counted = [&calls](const int i)
+        {
+            ++calls;
+            return i;
+        };
+        CHECK(6 == Transduce(Compose(MapT(Counted), TakeWhileT(LessThan4)), Add, 0, Range<1000>{}));
+        CHECK(5 == calls);
+    }
+
+    static_assert(6 == Transduce(TakeWhileT(LessThan4), Add, 0, Range<1000>{}),
+                  "TakeWhileT should be usable at compile time");
+}
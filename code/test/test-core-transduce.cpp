@@ -0,0 +1,58 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-compose.hpp"
+#include "cljonic-core-dedupet.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-filtert.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-mapt.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-take.hpp"
+#include "cljonic-core-taket.hpp"
+#include "cljonic-core-transduce.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("Transduce", "[CljonicCoreTransduce]")
+{
+    constexpr auto Add = [](const int a, const int b) { return a + b; };
+    constexpr auto Square = [](const int i) { return i * i; };
+    constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+
+    CHECK(14 == Transduce(MapT(Square), Add, 0, Array{1, 2, 3}));
+    CHECK(7 == Transduce(MapT(Square), Add, 7, Array<int, 5>{}));
+    CHECK(102 == Transduce(TakeT(2), Add, 100, Repeat<10, int>{1}));
+    CHECK(6 == Transduce(FilterT(Even), Add, 0, Set{1, 2, 3, 4}));
+    CHECK(3 == Transduce(
+                   DedupeT<char>(), [](const int count, const char) { return count + 1; }, 0, String{"aabbbc"}));
+
+    {
+        // stages compose from left to right, and run in a single pass that stops as soon as TakeT is done
+        auto calls{0};
+        const auto CountedSquare = [&calls](const int i)
+        {
+            ++calls;
+            return i * i;
+        };
+        CHECK(20 == Transduce(Compose(FilterT(Even), MapT(CountedSquare), TakeT(3)), Add, 0, Range<1000>{}));
+        CHECK(3 == calls);
+        CHECK(Reduce(Add, Take(3, Map(Square, Filter(Even, Range<1000>{})))) ==
+              Transduce(Compose(FilterT(Even), MapT(Square), TakeT(3)), Add, 0, Range<1000>{}));
+    }
+
+    {
+        // the accumulated value may have a different type than the elements
+        const auto CountChars = [](const SizeType count, const char) { return count + 1; };
+        CHECK(5 == Transduce(MapT([](const char c) { return c; }), CountChars, SizeType{0}, String{"Hello"}));
+        const auto AddDoubles = [](const double a, const double b) { return a + b; };
+        CHECK(1.5 == Transduce(MapT([](const int i) { return i / 2.0; }), AddDoubles, 0.0, Range<3>{}));
+    }
+
+    static_assert(20 == Transduce(Compose(FilterT(Even), MapT(Square), TakeT(3)), Add, 0, Range<1000>{}),
+                  "Transduce should be usable at compile time");
+}
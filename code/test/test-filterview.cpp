@@ -0,0 +1,133 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-filterview.hpp"
+#include "cljonic-mapview.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-repeat.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-equalby.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-remove.hpp"
+#include "cljonic-core-seq.hpp"
+#include "cljonic-core-take.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("FilterView", "[CljonicFilterView]")
+{
+    constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+
+    {
+        const auto a{Array<int, 10>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+        const auto v{FilterView{Even, a}};
+        CHECK(5 == v.Count());
+        CHECK(10 == v.MaximumCount());
+        CHECK(0 == v[0]);
+        CHECK(4 == v[2]);
+        CHECK(8 == v[4]);
+        CHECK(0 == v[5]);
+        CHECK(0 == v.DefaultElement());
+        CHECK(Equal(Filter(Even, a), v));
+        CHECK(Equal(Array{0, 2, 4, 6, 8}, Seq(v)));
+
+        auto sum{0};
+        for (const auto& i : v)
+            sum += i;
+        CHECK(20 == sum);
+    }
+
+    {
+        const auto v0{FilterView{Even, Array<int, 10>{}}};
+        CHECK(0 == v0.Count());
+        CHECK(Equal(Array<int, 10>{}, Seq(v0)));
+
+        const auto v1{FilterView{Even, Repeat<10, int>{1}}};
+        CHECK(0 == v1.Count());
+
+        const auto v2{FilterView{[](const char c) { return ('l' == c); }, String{"Hello"}}};
+        CHECK(Equal(Array{'l', 'l'}, v2));
+
+        const auto v3{FilterView{Even, Set<int, 6>{1, 2, 3, 4, 5, 6}}};
+        CHECK(Equal(Array{2, 4, 6}, v3));
+    }
+
+    {
+        constexpr auto v{FilterView{Even, Range<10>{}}};
+        static_assert(5 == v.Count(), "FilterView should be usable at compile time");
+        static_assert(6 == v[3], "FilterView should be usable at compile time");
+        constexpr auto s{Seq(v)};
+        static_assert(Equal(Array{0, 2, 4, 6, 8}, s), "Seq should materialize a FilterView");
+    }
+
+    {
+        // a chain of views fuses into one pass, which Take stops as soon as it has enough elements
+        auto calls{0};
+        const auto Square = [&calls](const int i)
+        {
+            ++calls;
+            return i * i;
+        };
+        const auto v{FilterView{Even, MapView{Square, Range<1000>{}}}};
+        const auto t{Take(3, v)};
+        CHECK(Equal(Array{0, 4, 16}, t));
+        CHECK(5 == calls);
+        CHECK(1000 == t.MaximumCount());
+        CHECK(Equal(Take(3, Filter(Even, Map(Square, Range<1000>{}))), t));
+    }
+
+    {
+        // a FilterView is iterated, once, rather than counted and indexed, by Equal and Map
+        auto calls{0};
+        const auto CountingEven = [&calls](const int i)
+        {
+            ++calls;
+            return 0 == (i % 2);
+        };
+        const auto v{FilterView{CountingEven, Range<1000>{}}};
+        const auto evens{Filter(Even, Range<1000>{})};
+        static_assert(IsCljonicView<decltype(v)> and not IsCljonicArray<decltype(v)>);
+        CHECK(Equal(v, evens));
+        CHECK(1000 == calls);
+        calls = 0;
+        CHECK(not Equal(v, Take(499, evens)));
+        CHECK(999 == calls); // up to the 500th even element, which Take(499, evens) does not have
+        calls = 0;
+        CHECK(EqualBy([](const int a, const int b) { return a == b; }, evens, v));
+        CHECK(1000 == calls);
+        calls = 0;
+        const auto doubles{Map([](const int i) { return 2 * i; }, v)};
+        CHECK(500 == doubles.Count());
+        CHECK(996 == doubles[249]);
+        CHECK(1000 == calls);
+        calls = 0;
+        CHECK(Equal(Range<0, 1000, 2>{}, Map([](const int a, const int b) { return a + b; }, v, Repeat<1000, int>{0})));
+        CHECK(1000 == calls);
+    }
+}
+
+SCENARIO("RemoveView", "[CljonicRemoveView]")
+{
+    constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+
+    {
+        const auto a{Array<int, 10>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+        const auto v{RemoveView{Even, a}};
+        CHECK(5 == v.Count());
+        CHECK(10 == v.MaximumCount());
+        CHECK(1 == v[0]);
+        CHECK(9 == v[4]);
+        CHECK(0 == v[5]);
+        CHECK(Equal(Remove(Even, a), v));
+    }
+
+    {
+        constexpr auto v{RemoveView{Even, FilterView{[](const int i) { return i > 3; }, Range<10>{}}}};
+        static_assert(Equal(Array{5, 7, 9}, Seq(v)), "RemoveView should be usable at compile time");
+        CHECK(Equal(Array{5, 7}, Take(2, v)));
+        CHECK(Equal(Array{1, 1}, Seq(RemoveView{Even, Repeat<2, int>{1}})));
+    }
+}
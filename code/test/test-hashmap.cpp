@@ -0,0 +1,100 @@
+#include <utility>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-hashmap.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-isdistinct.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-sort.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("HashMap", "[CljonicHashMap]")
+{
+    {
+        constexpr auto m0{HashMap<int, int, 10>{}};
+        constexpr auto m1{HashMap<int, int, 10>{std::pair{1, 11}, std::pair{2, 22}}};
+        constexpr auto m2{HashMap{std::pair{1, 11}, std::pair{2, 22}, std::pair{1, 33}}};
+
+        CHECK(0 == m0.Count());
+        CHECK(2 == m1.Count());
+        CHECK(2 == m2.Count());
+        CHECK(10 == m1.MaximumCount());
+        CHECK(3 == m2.MaximumCount());
+
+        CHECK(not m0.ContainsKey(1));
+        CHECK(m1.ContainsKey(1));
+        CHECK(m1.ContainsKey(2));
+        CHECK(not m1.ContainsKey(3));
+
+        CHECK(0 == m0.Get(1));
+        CHECK(11 == m1.Get(1));
+        CHECK(22 == m1.Get(2));
+        CHECK(0 == m1.Get(3));
+        CHECK(99 == m1.Get(3, 99));
+        CHECK(11 == m1.Get(1, 99));
+        CHECK(33 == m2.Get(1));
+        CHECK(22 == m1(2));
+        CHECK(0 == m1(3));
+
+        CHECK(std::pair{1, 11} == m1[0]);
+        CHECK(std::pair{2, 22} == m1[1]);
+        CHECK(std::pair{0, 0} == m1[2]);
+        CHECK(std::pair{0, 0} == m1.DefaultElement());
+
+        CHECK(m1.ElementAtIndexIsEqualToElement(0, std::pair{2, 22}));
+        CHECK(not m1.ElementAtIndexIsEqualToElement(0, std::pair{2, 23}));
+        CHECK(not m1.ElementAtIndexIsEqualToElement(0, std::pair{3, 22}));
+        CHECK(not m1.ElementAtIndexIsEqualToElement(2, std::pair{2, 22}));
+
+        static_assert(m1.ContainsKey(1), "HashMap ContainsKey should be usable in a constant expression");
+        static_assert(22 == m1.Get(2), "HashMap Get should be usable in a constant expression");
+    }
+
+    {
+        const auto m{HashMap{std::pair{"one", 1.1}, std::pair{"two", 2.2}}};
+        CHECK(2 == m.Count());
+        CHECK(m.ContainsKey("one"));
+        CHECK(not m.ContainsKey("three"));
+        CHECK(2.2 == m.Get("two"));
+        CHECK(0.0 == m.Get("three"));
+    }
+
+    {
+        auto m0{HashMap<int, int, 10>{std::pair{1, 11}}};
+        const auto m1{HashMap<int, int, 10>{std::pair{4, 44}, std::pair{5, 55}}};
+        m0 = m1;
+        CHECK(2 == m0.Count());
+        CHECK(not m0.ContainsKey(1));
+        CHECK(55 == m0.Get(5));
+        m0 = HashMap<int, int, 10>{std::pair{7, 77}};
+        CHECK(1 == m0.Count());
+        CHECK(77 == m0.Get(7));
+    }
+
+    {
+        // core functions
+        constexpr auto m{HashMap{std::pair{1, 11}, std::pair{2, 22}, std::pair{3, 33}}};
+        constexpr auto Key = [](const std::pair<int, int>& e) { return e.first; };
+        CHECK(Equal(Array{1, 2, 3}, Sort(Map(Key, m))));
+        CHECK(Equal(Array{std::pair{2, 22}}, Filter([](const std::pair<int, int>& e) { return 2 == e.first; }, m)));
+        CHECK(66 == Reduce([](const int sum, const std::pair<int, int>& e) { return sum + e.second; }, 0, m));
+        CHECK(Equal(m, HashMap{std::pair{3, 33}, std::pair{1, 11}, std::pair{2, 22}}));
+        CHECK(not Equal(m, HashMap{std::pair{3, 33}, std::pair{1, 11}, std::pair{2, 23}}));
+        CHECK(not Equal(m, HashMap{std::pair{3, 33}, std::pair{1, 11}, std::pair{4, 22}}));
+        CHECK(not Equal(m, HashMap{std::pair{3, 33}, std::pair{1, 11}}));
+        CHECK(not IsDistinct(m, HashMap{std::pair{3, 33}, std::pair{1, 11}, std::pair{2, 22}}));
+        CHECK(IsDistinct(m, HashMap{std::pair{3, 33}, std::pair{1, 11}, std::pair{2, 23}}));
+    }
+
+    {
+        // At returns a const reference to an entry, or to the default entry when the index is out-of-bounds
+        constexpr auto m{HashMap{std::pair{1, 11}, std::pair{2, 22}}};
+        static_assert((0 == m.At(2).first) and (0 == m.At(2).second));
+        CHECK(&m.At(1) == (m.begin() + 1));
+        CHECK(m[1] == m.At(1));
+    }
+}
@@ -0,0 +1,151 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-hashset.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-isdistinct.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-some.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+enum class Color
+{
+    Red,
+    Green,
+    Blue
+};
+
+SCENARIO("HashSet", "[CljonicHashSet]")
+{
+    {
+        constexpr auto s0{HashSet<int, 10>{}};
+        constexpr auto s1{HashSet<int, 10>{1, 2, 3, 4}};
+        constexpr auto s2{HashSet<int, 4>{1, 2, 3, 4}};
+        constexpr auto s3{HashSet{1, 2, 3, 4}};
+        constexpr auto s4{HashSet{1, 2, 1, 4}};
+
+        CHECK(0 == s0.Count());
+        CHECK(4 == s1.Count());
+        CHECK(4 == s2.Count());
+        CHECK(4 == s3.Count());
+        CHECK(3 == s4.Count());
+
+        CHECK(10 == s0.MaximumCount());
+        CHECK(4 == s3.MaximumCount());
+
+        CHECK(0 == s0[0]);
+        CHECK(1 == s1[0]);
+        CHECK(2 == s1[1]);
+        CHECK(3 == s1[2]);
+        CHECK(4 == s1[3]);
+        CHECK(0 == s1[4]);
+        CHECK(1 == s4[0]);
+        CHECK(2 == s4[1]);
+        CHECK(4 == s4[2]);
+        CHECK(0 == s4[3]);
+
+        CHECK(not s0.Contains(0));
+        CHECK(s1.Contains(1));
+        CHECK(s1.Contains(4));
+        CHECK(not s1.Contains(5));
+        CHECK(not s4.Contains(3));
+        CHECK(s1.ContainsBy([](const int i, const int j) { return i == (j + 1); }, 5));
+        CHECK(not s1.ContainsBy([](const int i, const int j) { return i == (j + 1); }, 6));
+
+        CHECK(2 == s1(2));
+        CHECK(0 == s1(5));
+        CHECK(0 == s1.DefaultElement());
+
+        CHECK(s1.ElementAtIndexIsEqualToElement(0, 3));
+        CHECK(not s1.ElementAtIndexIsEqualToElement(4, 3));
+        CHECK(not s1.ElementAtIndexIsEqualToElement(0, 5));
+
+        static_assert(s1.Contains(3), "HashSet Contains should be usable in a constant expression");
+        static_assert(not s1.Contains(7), "HashSet Contains should be usable in a constant expression");
+    }
+
+    {
+        constexpr auto s{HashSet{"one", "two", "three", "two"}};
+        CHECK(3 == s.Count());
+        CHECK(s.Contains("one"));
+        CHECK(s.Contains("three"));
+        CHECK(not s.Contains("four"));
+        const char four[]{'t', 'w', 'o', '\0'};
+        CHECK(s.Contains(four));
+    }
+
+    {
+        constexpr auto s{HashSet{Color::Red, Color::Blue}};
+        CHECK(2 == s.Count());
+        CHECK(s.Contains(Color::Red));
+        CHECK(not s.Contains(Color::Green));
+        CHECK(s.Contains(Color::Blue));
+    }
+
+    {
+        constexpr auto s{HashSet<char, 5>{'a', 'b', 'c', 'b', 'a'}};
+        CHECK(3 == s.Count());
+        CHECK(s.Contains('c'));
+        CHECK(not s.Contains('d'));
+    }
+
+    {
+        auto s0{HashSet<int, 10>{1, 2, 3}};
+        const auto s1{HashSet<int, 10>{4, 5}};
+        CHECK(3 == s0.Count());
+        s0 = s1;
+        CHECK(2 == s0.Count());
+        CHECK(not s0.Contains(1));
+        CHECK(s0.Contains(5));
+        s0 = HashSet<int, 10>{7};
+        CHECK(1 == s0.Count());
+        CHECK(s0.Contains(7));
+        CHECK(not s0.Contains(5));
+    }
+
+    {
+        // negative, large, and colliding values, with the set filled to its maximum count
+        constexpr auto s{HashSet{-1, -2, 0, 1024, 2048, 4096, 8192, 16384, 2147483647, -2147483647}};
+        CHECK(10 == s.Count());
+        CHECK(s.Contains(-2));
+        CHECK(s.Contains(8192));
+        CHECK(s.Contains(-2147483647));
+        CHECK(not s.Contains(3));
+        CHECK(not s.Contains(512));
+
+        auto sum{0};
+        for (const auto& i : s)
+            sum += (i == 2147483647) ? 0 : 1;
+        CHECK(9 == sum);
+    }
+
+    {
+        // core functions
+        constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+        constexpr auto s{HashSet{1, 2, 3, 4, 5, 6}};
+        CHECK(Equal(Array{2, 4, 6}, Filter(Even, s)));
+        CHECK(Some(Even, s));
+        CHECK(not Some(Even, HashSet{1, 3, 5}));
+        CHECK(Equal(s, HashSet{6, 5, 4, 3, 2, 1}));
+        CHECK(Equal(s, Set{6, 5, 4, 3, 2, 1}));
+        CHECK(Equal(Set{6, 5, 4, 3, 2, 1}, s));
+        CHECK(not Equal(s, HashSet{6, 5, 4, 3, 2}));
+        CHECK(not Equal(s, HashSet{6, 5, 4, 3, 2, 7}));
+        CHECK(IsDistinct(s, HashSet{1, 2, 3}));
+        CHECK(not IsDistinct(s, HashSet{6, 5, 4, 3, 2, 1}));
+        CHECK(not IsDistinct(s, Set{6, 5, 4, 3, 2, 1}));
+        CHECK(Equal(Array{2, 3, 4, 5, 6, 7}, Map([](const int i) { return i + 1; }, s)));
+    }
+
+    {
+        // At returns a const reference to an element, or to the default element when the index is out-of-bounds
+        constexpr auto s{HashSet{3, 4, 5}};
+        static_assert(0 == s.At(3));
+        CHECK(&s.At(1) == (s.begin() + 1));
+        CHECK(s[1] == s.At(1));
+    }
+}
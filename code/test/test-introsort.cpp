@@ -0,0 +1,94 @@
+#include "catch.hpp"
+#include "cljonic-introsort.hpp"
+
+using namespace cljonic;
+
+namespace
+{
+
+template <SizeType N>
+constexpr bool IsNondecreasing(const int (&a)[N]) noexcept
+{
+    auto result{true};
+    for (SizeType i{1}; (result and (i < N)); ++i)
+        result = (a[i - 1] <= a[i]);
+    return result;
+}
+
+constexpr bool SortsAtCompileTime() noexcept
+{
+    auto IsALessThanB = [](const int a, const int b) { return a < b; };
+    int a[100]{};
+    for (SizeType i{0}; i < 100; ++i)
+        a[i] = static_cast<int>((i * 37) % 100);
+    IntroSort(a, 100, IsALessThanB);
+    return IsNondecreasing(a);
+}
+
+} // namespace
+
+SCENARIO("IntroSort", "[CljonicIntroSort]")
+{
+    auto IsALessThanB = [](const int a, const int b) { return a < b; };
+
+    {
+        int a[]{5, 3, 9, 1, 1, 7, 0, 2};
+        InsertionSortBy(a, 8, IsALessThanB);
+        CHECK(IsNondecreasing(a));
+        CHECK(0 == a[0]);
+        CHECK(9 == a[7]);
+    }
+
+    {
+        // a depth limit of zero sorts with heapsort alone
+        int a[200]{};
+        for (SizeType i{0}; i < 200; ++i)
+            a[i] = static_cast<int>((i * 7919) % 200);
+        IntroSortBy(a, 200, 0, IsALessThanB);
+        CHECK(IsNondecreasing(a));
+        for (SizeType i{0}; i < 200; ++i)
+            CHECK(static_cast<int>(i) == a[i]);
+    }
+
+    {
+        int a[]{4, 8, 1, 6, 3, 9, 2, 7, 5, 0};
+        const auto p{PartitionBy(a, 10, IsALessThanB)};
+        for (SizeType i{0}; i < p; ++i)
+            CHECK(not IsALessThanB(a[p], a[i]));
+        for (SizeType i{p + 1}; i < 10; ++i)
+            CHECK(not IsALessThanB(a[i], a[p]));
+    }
+
+    {
+        int sorted[500]{};
+        int reversed[500]{};
+        int sawtooth[500]{};
+        int duplicates[500]{};
+        for (SizeType i{0}; i < 500; ++i)
+        {
+            sorted[i] = static_cast<int>(i);
+            reversed[i] = static_cast<int>(500 - i);
+            sawtooth[i] = static_cast<int>(i % 17);
+            duplicates[i] = 42;
+        }
+        IntroSort(sorted, 500, IsALessThanB);
+        IntroSort(reversed, 500, IsALessThanB);
+        IntroSort(sawtooth, 500, IsALessThanB);
+        IntroSort(duplicates, 500, IsALessThanB);
+        CHECK(IsNondecreasing(sorted));
+        CHECK(IsNondecreasing(reversed));
+        CHECK(IsNondecreasing(sawtooth));
+        CHECK(IsNondecreasing(duplicates));
+        CHECK(1 == reversed[0]);
+        CHECK(500 == reversed[499]);
+    }
+
+    {
+        int a[1]{3};
+        IntroSort(a, 0, IsALessThanB);
+        IntroSort(a, 1, IsALessThanB);
+        CHECK(3 == a[0]);
+    }
+
+    static_assert(SortsAtCompileTime(), "IntroSort should be usable at compile time");
+}
@@ -1,7 +1,21 @@
 #include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-filterview.hpp"
 #include "cljonic-iterator.hpp"
+#include "cljonic-mapview.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-every.hpp"
+#include "cljonic-core-first.hpp"
+#include "cljonic-core-indexof.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-nth.hpp"
+#include "cljonic-core-some.hpp"
+#include "cljonic-core-take.hpp"
+#include "cljonic-core-takewhile.hpp"
 
 using namespace cljonic;
+using namespace cljonic::core;
 
 int TimesTenLI(const int x) noexcept
 {
@@ -36,3 +50,99 @@ SCENARIO("Iterator", "[CljonicIterator]")
         }
     }
 }
+
+SCENARIO("Iterator laziness", "[CljonicIterator]")
+{
+    constexpr auto Inc = [](const int i) { return 1 + i; };
+    constexpr auto Even = [](const int i) { return 0 == (i % 2); };
+    constexpr auto Square = [](const int i) { return i * i; };
+
+    {
+        // the function is called only for the elements that are read
+        auto calls{0};
+        const auto CountingInc = [&](const int i)
+        {
+            ++calls;
+            return 1 + i;
+        };
+        const auto i{Iterator{CountingInc, 1}};
+        CHECK(Equal(Array{1, 2, 3, 4, 5}, Take(5, i)));
+        CHECK(4 == calls);
+        calls = 0;
+        CHECK(Equal(Array{1, 2, 3}, TakeWhile([](const int j) { return j < 4; }, i)));
+        CHECK(3 == calls);
+        calls = 0;
+        CHECK(Some([](const int j) { return 7 == j; }, i));
+        CHECK(6 == calls);
+        calls = 0;
+        CHECK(1 == First(i));
+        CHECK(0 == calls);
+        CHECK(11 == Nth(i, 10));
+        CHECK(10 == calls);
+        calls = 0;
+        CHECK(Equal(Array<int, 0>{}, Take(0, i)));
+        CHECK(0 == calls);
+        CHECK(1000 == Take(5000, i).Count());
+        CHECK(999 == calls);
+        calls = 0;
+        CHECK(0 == Nth(i, 1000)); // the default element
+        CHECK(0 == calls);
+    }
+
+    {
+        // the functions that read every element compute each one once, rather than from the first one at each index
+        auto calls{0};
+        const auto CountingInc = [&](const int i)
+        {
+            ++calls;
+            return 1 + i;
+        };
+        const auto i{Iterator{CountingInc, 1}};
+        const auto squares{Map(Square, i)};
+        CHECK(1000 == squares.Count());
+        CHECK(1000000 == squares[999]);
+        CHECK(999 == calls);
+        calls = 0;
+        CHECK(Equal(Array{1, 3, 5}, Map([](const int j, const int k) { return j + k; }, Range<3>{}, i)));
+        CHECK(2 == calls);
+        calls = 0;
+        CHECK(Every([](const int j) { return j > 0; }, i));
+        CHECK(999 == calls);
+        calls = 0;
+        CHECK(not Every([](const int j) { return j < 4; }, i));
+        CHECK(3 == calls);
+        calls = 0;
+        CHECK(999 == IndexOf(i, 1000));
+        CHECK(999 == calls);
+        calls = 0;
+        CHECK(4 == IndexOf(i, 5));
+        CHECK(4 == calls);
+        calls = 0;
+        CHECK(CLJONIC_INVALID_INDEX == IndexOf(i, 0));
+        CHECK(999 == calls);
+        calls = 0;
+        CHECK(11 == Nth(i, 10, 0));
+        CHECK(10 == calls);
+        calls = 0;
+        CHECK(-1 == Nth(i, 1000, -1));
+        CHECK(0 == calls);
+    }
+
+    {
+        // an Iterator is usable in a constant expression, and by itself or in a lazy view
+        static_assert(Equal(Array{1, 2, 3}, Take(3, Iterator{Inc, 1})));
+        static_assert(Equal(Array{1, 2, 3}, TakeWhile([](const int i) { return i < 4; }, Iterator{Inc, 1})));
+        static_assert(Some([](const int i) { return 500 == i; }, Iterator{Inc, 1}));
+        static_assert(not Some([](const int i) { return 0 == i; }, Iterator{Inc, 1}));
+        static_assert(1 == First(Iterator{Inc, 1}));
+        static_assert(11 == Nth(Iterator{Inc, 1}, 10));
+        static_assert(1000 == Nth(Iterator{Inc, 1}, 999));
+        static_assert(1000 == Iterator{Inc, 1}.Count());
+        static_assert(Equal(Array{1, 4, 9}, Take(3, Map(Square, Iterator{Inc, 1}))));
+        static_assert(Every([](const int i) { return i > 0; }, Iterator{Inc, 1}));
+        static_assert(499 == IndexOf(Iterator{Inc, 1}, 500));
+        static_assert(Equal(Array{2, 4, 6}, Take(3, FilterView{Even, Iterator{Inc, 1}})));
+        static_assert(Equal(Array{1, 4, 9}, Take(3, MapView{Square, Iterator{Inc, 1}})));
+        static_assert(Equal(Array{4, 16, 36}, Take(3, FilterView{Even, MapView{Square, Iterator{Inc, 1}}})));
+    }
+}
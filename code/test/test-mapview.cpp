@@ -0,0 +1,80 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-filterview.hpp"
+#include "cljonic-mapview.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-count.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-first.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-seq.hpp"
+#include "cljonic-core-take.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("MapView", "[CljonicMapView]")
+{
+    constexpr auto TwoTimes = [](const int i) { return 2 * i; };
+
+    {
+        const auto a{Array<int, 10>{1, 2, 3, 4}};
+        const auto v{MapView{TwoTimes, a}};
+        CHECK(4 == v.Count());
+        CHECK(10 == v.MaximumCount());
+        CHECK(2 == v[0]);
+        CHECK(8 == v[3]);
+        CHECK(0 == v[4]);
+        CHECK(0 == v.DefaultElement());
+        CHECK(Equal(Map(TwoTimes, a), v));
+        CHECK(Equal(v, Array{2, 4, 6, 8}));
+
+        auto sum{0};
+        for (const auto& i : v)
+            sum += i;
+        CHECK(20 == sum);
+    }
+
+    {
+        // the view calls its function on demand, so it sees later changes to an lvalue collection it refers to
+        auto a{Array<int, 10>{1, 2, 3}};
+        const auto v{MapView{TwoTimes, a}};
+        CHECK(Equal(Array{2, 4, 6}, v));
+        MConj(a, 4);
+        CHECK(Equal(Array{2, 4, 6, 8}, v));
+    }
+
+    {
+        constexpr auto v{MapView{TwoTimes, Range<10>{}}};
+        static_assert(10 == v.Count(), "MapView should be usable at compile time");
+        static_assert(18 == v[9], "MapView should be usable at compile time");
+        constexpr auto s{Seq(v)};
+        static_assert(Equal(Array{0, 2, 4, 6, 8, 10, 12, 14, 16, 18}, s), "Seq should materialize a MapView");
+    }
+
+    {
+        // views of views, and views of other collection types
+        constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+        constexpr auto v{MapView{TwoTimes, FilterView{Even, Range<10>{}}}};
+        CHECK(Equal(Array{0, 4, 8, 12, 16}, Seq(v)));
+        CHECK(Equal(Array{0, 4}, Take(2, v)));
+        CHECK(40 == Reduce([](const int i, const int j) { return i + j; }, v));
+        CHECK(0 == First(v));
+        CHECK(5 == Count(v));
+
+        const auto s{MapView{[](const char c) { return static_cast<char>(c - 'a' + 'A'); }, String{"abc"}}};
+        CHECK(Equal(Array{'A', 'B', 'C'}, s));
+        CHECK(Equal(Array{4, 6}, Filter([](const int i) { return i > 2; }, MapView{TwoTimes, Set{1, 2, 3}})));
+    }
+
+    {
+        const auto v{MapView{[](const int i) { return static_cast<double>(i) / 2.0; }, Range<3>{}}};
+        CHECK(3 == v.Count());
+        CHECK(0.5 == v[1]);
+        CHECK(0.0 == v.DefaultElement());
+    }
+}
@@ -0,0 +1,56 @@
+#include <utility>
+#include "catch.hpp"
+#include "cljonic-mergesort.hpp"
+
+using namespace cljonic;
+
+namespace
+{
+
+constexpr bool SortsStablyAtCompileTime() noexcept
+{
+    auto IsAFirstLessThanBFirst = [](const auto& a, const auto& b) { return a.first < b.first; };
+    std::pair<int, int> a[100]{};
+    std::pair<int, int> scratch[100]{};
+    for (int i{0}; i < 100; ++i)
+        a[i] = std::pair{((i * 37) % 7), i};
+    MergeSort(a, scratch, 100, IsAFirstLessThanBFirst);
+    auto result{true};
+    for (SizeType i{1}; i < 100; ++i)
+        result = result and ((a[i - 1].first < a[i].first) or
+                             ((a[i - 1].first == a[i].first) and (a[i - 1].second < a[i].second)));
+    return result;
+}
+
+} // namespace
+
+SCENARIO("MergeSort", "[CljonicMergeSort]")
+{
+    auto IsALessThanB = [](const int a, const int b) { return a < b; };
+
+    {
+        int left[]{1, 3, 5, 7, 2, 4, 6}; // MergeBy moves from its source, so the source is not const
+        int merged[7]{};
+        MergeBy(left, merged, 0, 4, 7, IsALessThanB);
+        for (SizeType i{0}; i < 7; ++i)
+            CHECK(static_cast<int>(i + 1) == merged[i]);
+    }
+
+    {
+        // run counts that are, and are not, powers of two leave the result in either buffer
+        for (const SizeType count : {0u, 1u, 15u, 16u, 17u, 32u, 33u, 100u, 500u})
+        {
+            int a[500]{};
+            int scratch[500]{};
+            for (SizeType i{0}; i < count; ++i)
+                a[i] = static_cast<int>(count - i);
+            MergeSort(a, scratch, count, IsALessThanB);
+            auto isSorted{true};
+            for (SizeType i{0}; i < count; ++i)
+                isSorted = isSorted and (static_cast<int>(i + 1) == a[i]);
+            CHECK(isSorted);
+        }
+    }
+
+    static_assert(SortsStablyAtCompileTime(), "MergeSort should be stable, and usable at compile time");
+}
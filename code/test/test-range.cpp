@@ -1,8 +1,46 @@
+#include <cstdint>
 #include <type_traits>
 #include "catch.hpp"
 #include "cljonic-range.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-indexof.hpp"
+#include "cljonic-core-lastindexof.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-reducers.hpp"
+#include "cljonic-core-seq.hpp"
+#include "cljonic-core-sort.hpp"
 
 using namespace cljonic;
+using namespace cljonic::core;
+
+namespace
+{
+
+// Calls f with a default constructed Range of each shape: empty, ascending, descending, constant, and maximal
+template <typename F>
+void ForEachRange(F&& f)
+{
+    f(Range<0>{});
+    f(Range<-10>{});
+    f(Range<10>{});
+    f(Range<-3, 10>{});
+    f(Range<-3, -10>{});
+    f(Range<10, 10, 0>{});
+    f(Range<10, 20, 0>{});
+    f(Range<-7, 20, 0>{});
+    f(Range<3, 10, 4>{});
+    f(Range<3, 10, 3>{});
+    f(Range<-7, 8, 3>{});
+    f(Range<7, -8, -3>{});
+    f(Range<100, 0, -10>{});
+    f(Range<10, -10, -1>{});
+    f(Range<-11, 10, 7>{});
+    f(Range<-500, 500>{});
+    f(Range<>{});
+}
+
+} // namespace
 
 SCENARIO("Range", "[CljonicRange]")
 {
@@ -382,3 +420,77 @@ SCENARIO("Range", "[CljonicRange]")
         CHECK(0 == r[MAX_INDEX]);
     }
 }
+
+SCENARIO("Range closed forms", "[CljonicRange]")
+{
+    // each function that computes its result from the arithmetic progression of a Range, rather than by visiting its
+    // elements, agrees with the same function of the Array of those elements
+    const auto Add = [](const int x, const int y) { return x + y; };
+    const auto Even = [](const int i) { return 0 == (i % 2); };
+    const auto Odd = [](const int i) { return 0 != (i % 2); };
+    ForEachRange(
+        [&](const auto r)
+        {
+            const auto a{Seq(r)};
+            CHECK(Reduce(Add, a) == Reduce(Plus, r));
+            CHECK(Reduce(Add, 7, a) == Reduce(Plus, 7, r));
+            CHECK(Reduce(Minimum, a) == Reduce(Minimum, r));
+            CHECK(Reduce(Maximum, a) == Reduce(Maximum, r));
+            CHECK(Reduce(Minimum, -1000, a) == Reduce(Minimum, -1000, r));
+            CHECK(Equal(Sort(a), Sort(r)));
+            CHECK(Equal(Filter(Even, a), Filter(IsEven, r)));
+            CHECK(Equal(Filter(Odd, a), Filter(IsOdd, r)));
+            static_assert(IsCljonicRange<decltype(Filter(IsEven, r))>);
+            for (auto i{-25}; i <= 1000; ++i)
+            {
+                CHECK(IndexOf(a, i) == IndexOf(r, i));
+                CHECK(LastIndexOf(a, i) == LastIndexOf(r, i));
+            }
+            ForEachRange([&](const auto u) { CHECK(Equal(a, Seq(u)) == Equal(r, u)); });
+        });
+
+    {
+        // a product is zero when the Range passes through zero, and is computed left to right otherwise
+        CHECK(0 == Reduce(Multiplies, Range<-500, 500>{}));
+        CHECK(0 == Reduce(Multiplies, Range<7, -8, -7>{}));
+        CHECK(120 == Reduce(Multiplies, Range<1, 6>{}));
+        CHECK(-2 * -5 * -8 == Reduce(Multiplies, Range<-2, -9, -3>{}));
+        CHECK(10 * 1 * 4 * 7 == Reduce(Multiplies, 10, Range<1, 8, 3>{}));
+        static_assert(0 == Reduce(Multiplies, Range<10>{}));
+    }
+
+    {
+        // the sum is computed exactly, without overflow, and is the same in a constant expression
+        static_assert(499500 == Reduce(Plus, Range<>{}));
+        static_assert(-500 == Reduce(Plus, Range<-500, 500>{}));
+        static_assert(10 == Reduce(Plus, 7, Range<3>{}));
+        constexpr auto big{Range<1500000000, -500000000, -800000000>{}}; // a left-to-right sum overflows
+        static_assert(2100000000 == Reduce(Plus, big));
+        CHECK(2100000000 == Reduce(Plus, std::int64_t{0}, big));
+    }
+
+    {
+        // IndexOf finds an integer of any type that equals an element
+        constexpr auto r{Range<3, 100, 4>{}};
+        static_assert(2 == IndexOf(r, 11));
+        static_assert(2 == IndexOf(r, 11L));
+        static_assert(2 == LastIndexOf(r, std::uint8_t{11}));
+        static_assert(CLJONIC_INVALID_INDEX == IndexOf(r, 12));
+        static_assert(CLJONIC_INVALID_INDEX == IndexOf(r, 11L + (1L << 32)));
+        static_assert(CLJONIC_INVALID_INDEX == IndexOf(r, -1));
+        static_assert(CLJONIC_INVALID_INDEX == IndexOf(r, 103));
+        static_assert(0 == IndexOf(Range<10, 20, 0>{}, 10));
+        static_assert(999 == LastIndexOf(Range<10, 20, 0>{}, 10));
+    }
+
+    {
+        // Filter returns the Range of the even or odd elements, computed at compile time
+        static_assert(std::is_same_v<Range<0, 9, 2>, decltype(Filter(IsEven, Range<10>{}))>);
+        static_assert(std::is_same_v<Range<1, 10, 2>, decltype(Filter(IsOdd, Range<10>{}))>);
+        static_assert(std::is_same_v<Range<100, 0, -10>, decltype(Filter(IsEven, Range<100, 0, -10>{}))>);
+        static_assert(std::is_same_v<Range<0>, decltype(Filter(IsOdd, Range<100, 0, -10>{}))>);
+        static_assert(std::is_same_v<Range<0>, decltype(Filter(IsOdd, Range<0>{}))>);
+        static_assert(500 == Filter(IsEven, Range<>{}).Count());
+        static_assert(Equal(Filter(IsOdd, Range<7, -8, -3>{}), Array{7, 1, -5}));
+    }
+}
@@ -1,8 +1,61 @@
+#include <cstdint>
 #include <type_traits>
 #include "catch.hpp"
+#include "cljonic-array.hpp"
 #include "cljonic-repeat.hpp"
+#include "cljonic-core-dedupe.hpp"
+#include "cljonic-core-dedupeby.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-equalby.hpp"
+#include "cljonic-core-indexof.hpp"
+#include "cljonic-core-isdistinct.hpp"
+#include "cljonic-core-lastindexof.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-reducers.hpp"
+#include "cljonic-core-seq.hpp"
+#include "cljonic-core-sort.hpp"
+#include "cljonic-core-sortby.hpp"
 
 using namespace cljonic;
+using namespace cljonic::core;
+
+namespace
+{
+
+// Checks that each function that computes its result from the single element of a Repeat, rather than by visiting its
+// elements, agrees with the same function of the Array of those elements
+template <SizeType N, typename T>
+void CheckRepeatClosedForms(const T t)
+{
+    const auto r{Repeat<N, T>{t}};
+    const auto a{Seq(r)};
+    const auto Same = [](const T x, const T y) { return x == y; };
+    CHECK(Reduce(Plus, a) == Reduce(Plus, r));
+    CHECK(Reduce(Multiplies, a) == Reduce(Multiplies, r));
+    CHECK(Reduce(Minimum, a) == Reduce(Minimum, r));
+    CHECK(Reduce(Maximum, a) == Reduce(Maximum, r));
+    CHECK(Reduce(Plus, T{3}, a) == Reduce(Plus, T{3}, r));
+    CHECK(Reduce(Multiplies, T{3}, a) == Reduce(Multiplies, T{3}, r));
+    CHECK(EqualBy(Same, DedupeBy(Same, a), DedupeBy(Same, r)));
+    CHECK(EqualBy(Same, a, SortBy([](const T x, const T y) { return x < y; }, r)));
+    if constexpr (std::integral<T>)
+    {
+        CHECK(Equal(Dedupe(a), Dedupe(r)));
+        CHECK(Equal(a, Sort(r)));
+        CHECK(Reduce(BitAnd, a) == Reduce(BitAnd, r));
+        CHECK(Reduce(BitOr, a) == Reduce(BitOr, r));
+        CHECK(IndexOf(a, t) == IndexOf(r, t));
+        CHECK(LastIndexOf(a, t) == LastIndexOf(r, t));
+        CHECK(IndexOf(a, T{1}) == IndexOf(r, T{1}));
+        CHECK(LastIndexOf(a, T{1}) == LastIndexOf(r, T{1}));
+        CHECK(Equal(a, Seq(Repeat<N, T>{T{1}})) == Equal(r, Repeat<N, T>{T{1}}));
+        CHECK(Equal(a, Seq(Repeat<3, T>{t})) == Equal(r, Repeat<3, T>{t}));
+        CHECK(IsDistinct(a, Seq(Repeat<N, T>{T{1}})) == IsDistinct(r, Repeat<N, T>{T{1}}));
+        CHECK(true == Equal(r, Repeat<N, T>{t}));
+    }
+}
+
+} // namespace
 
 SCENARIO("Repeat", "[CljonicRepeat]")
 {
@@ -41,4 +94,58 @@ SCENARIO("Repeat", "[CljonicRepeat]")
             CHECK(1 == element);
         }
     }
+
+    {
+        // At returns a const reference to the repeated element, or to the default element when the index is
+        // out-of-bounds
+        constexpr auto r{Repeat<3, int>{7}};
+        static_assert((7 == r.At(0)) and (7 == r.At(2)) and (0 == r.At(3)));
+        CHECK(&r.At(0) == &r.At(2));
+    }
+}
+
+SCENARIO("Repeat closed forms", "[CljonicRepeat]")
+{
+    CheckRepeatClosedForms<0, int>(5);
+    CheckRepeatClosedForms<1, int>(5);
+    CheckRepeatClosedForms<2, int>(-5);
+    CheckRepeatClosedForms<3, int>(1);
+    CheckRepeatClosedForms<7, int>(-3);
+    CheckRepeatClosedForms<1000, int>(2);
+    CheckRepeatClosedForms<1000, std::uint32_t>(3);     // the sum and product wrap the same way in any order
+    CheckRepeatClosedForms<1000, std::uint64_t>(0xfff1);
+    CheckRepeatClosedForms<999, char>('a');
+    CheckRepeatClosedForms<255, std::uint8_t>(std::uint8_t{3});
+    CheckRepeatClosedForms<1000, double>(0.25);         // the sums and products of a power of two are exact
+    CheckRepeatClosedForms<5, float>(1.5f);
+
+    {
+        // the copies are combined with O(log n) operations
+        auto calls{0};
+        const auto CountingPlus = [&](const int x, const int y)
+        {
+            ++calls;
+            return x + y;
+        };
+        CHECK(3000 == Reduce(CountingPlus, Repeat<1000, int>{3}));
+        CHECK(999 == calls); // a function that is not a recognized reducer is called for each element
+        static_assert(3125 == Reduce(Multiplies, Repeat<5, int>{5}));
+        static_assert(3000 == Reduce(Plus, Repeat<1000, int>{3}));
+        static_assert(0 == Reduce(Plus, Repeat<0, int>{3}));
+        static_assert(7 == Reduce(Maximum, 7, Repeat<0, int>{3}));
+    }
+
+    {
+        // Dedupe, Sort, Equal, and IndexOf do not visit each element
+        static_assert(1 == Dedupe(Repeat<1000, int>{3}).Count());
+        static_assert(0 == Dedupe(Repeat<0, int>{3}).Count());
+        static_assert(1000 == Sort(Repeat<1000, int>{3}).Count());
+        static_assert(Equal(Repeat<1000, const char*>{"Hi"}, Repeat<1000, const char*>{"Hi"}));
+        static_assert(not Equal(Repeat<1000, const char*>{"Hi"}, Repeat<1000, const char*>{"Ho"}));
+        static_assert(Equal(Repeat<0, int>{1}, Repeat<0, int>{2}));
+        static_assert(Equal(Repeat<10, int>{1}, Repeat<10, char>{char{1}}));
+        static_assert(not IsDistinct(Repeat<10, int>{1}, Repeat<10, int>{2}, Repeat<10, int>{1}));
+        static_assert(999 == LastIndexOf(Repeat<1000, const char*>{"Hi"}, "Hi"));
+        static_assert(CLJONIC_INVALID_INDEX == IndexOf(Repeat<0, int>{1}, 1));
+    }
 }
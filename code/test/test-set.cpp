@@ -1,4 +1,5 @@
 #include <string>
+#include <utility>
 #include "catch.hpp"
 #include "cljonic-set.hpp"
 
@@ -144,4 +145,40 @@ SCENARIO("Set", "[CljonicSet]")
         CHECK(4 == s(4));
         CHECK(0 == s(5)); // value is not in the Set so return default element, which is 0 in this case
     }
+
+    {
+        // only the elements in use are copied, and the unused ones are never read
+        constexpr auto s0{Set<int, 1000>{1, 2, 3}};
+        constexpr auto s1{s0};
+        static_assert((3 == s1.Count()) and s1.Contains(3) and not s1.Contains(0));
+        auto s2{Set<int, 1000>{4, 5}};
+        const auto s3{std::move(s2)};
+        CHECK(2 == s3.Count());
+        CHECK(s3.Contains(5));
+        CHECK(0 == s3[2]);
+    }
+
+    {
+        // At returns a const reference to an element, or to the default element when the index is out-of-bounds
+        constexpr auto s{Set{3, 4, 5}};
+        static_assert((3 == s.At(0)) and (0 == s.At(3)));
+        CHECK(&s.At(2) == (s.begin() + 2));
+    }
+
+    {
+        // Contains searches integer and enumeration elements a block at a time
+        enum class Color { red, green, blue, alpha };
+        const auto s0{Set{10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140, 150, 160, 170, 180, 190, 200}};
+        for (int i{10}; i <= 200; i += 10)
+            CHECK(s0.Contains(i));
+        CHECK(not s0.Contains(0));
+        CHECK(not s0.Contains(201));
+        constexpr auto s1{Set{'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q'}};
+        static_assert(s1.Contains('q') and not s1.Contains('r'));
+        CHECK(s1.Contains('q'));
+        CHECK(not s1.Contains('r'));
+        const auto s2{Set{Color::red, Color::blue}};
+        CHECK(s2.Contains(Color::blue));
+        CHECK(not s2.Contains(Color::alpha));
+    }
 }
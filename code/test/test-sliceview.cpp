@@ -0,0 +1,84 @@
+#include <ranges>
+#include <type_traits>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-filterview.hpp"
+#include "cljonic-mapview.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-seq.hpp"
+#include "cljonic-core-take.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("SliceView", "[CljonicSliceView]")
+{
+    constexpr auto Add = [](const int i, const int j) { return i + j; };
+    constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+    constexpr auto TwoTimes = [](const int i) { return 2 * i; };
+
+    {
+        const auto a{Array{11, 12, 13, 14}};
+        static_assert(not std::is_polymorphic_v<SliceView<const Array<int, 4>&>>);
+        static_assert(IsCljonicIndexable<SliceView<const Array<int, 4>&>>);
+        static_assert(std::is_same_v<SliceView<const Array<int, 4>&>, decltype(SliceView{a, 1, 3})>);
+        static_assert(std::is_same_v<SliceView<Range<10>>, decltype(SliceView{Range<10>{}, 1})>);
+        static_assert(std::ranges::contiguous_range<SliceView<const Array<int, 4>&>>);
+    }
+
+    {
+        // a SliceView refers to the elements of an lvalue collection, rather than copying them
+        auto a{Array<int, 10>{11, 12, 13, 14}};
+        const auto v{SliceView{a, 1, 3}};
+        CHECK(2 == v.Count());
+        CHECK(10 == v.MaximumCount());
+        CHECK(12 == v[0]);
+        CHECK(13 == v[1]);
+        CHECK(0 == v[2]);
+        CHECK(0 == v.DefaultElement());
+        CHECK(&a.At(1) == &v.At(0));
+        CHECK(0 == v.At(2));
+        CHECK((a.begin() + 1) == v.begin());
+        CHECK((a.begin() + 3) == v.end());
+        CHECK(v.ElementAtIndexIsEqualToElement(1, 13));
+        CHECK(not v.ElementAtIndexIsEqualToElement(1, 14));
+        CHECK(not v.ElementAtIndexIsEqualToElement(2, 0));
+        CHECK(25 == Reduce(Add, v));
+        CHECK(Equal(Array{13, 14}, SliceView{a, 2}));
+    }
+
+    {
+        // the start and end are clamped to the collection, and an end before the start makes an empty SliceView
+        const auto a{Array{11, 12, 13, 14}};
+        CHECK(0 == SliceView{a, 4}.Count());
+        CHECK(0 == SliceView{a, 10, 20}.Count());
+        CHECK(0 == SliceView{a, 3, 1}.Count());
+        CHECK(Equal(Array{13, 14}, SliceView{a, 2, 100}));
+        CHECK(SliceView{a, 3, 1}.begin() == SliceView{a, 3, 1}.end());
+    }
+
+    {
+        // a SliceView holds a copy of an rvalue collection, so it can be a constant
+        constexpr auto v0{SliceView{Range<100>{}, 90}};
+        static_assert(10 == v0.Count());
+        static_assert(90 == v0[0]);
+        static_assert(Equal(Array{98, 99}, Seq(SliceView{v0, 8})));
+        constexpr auto v1{SliceView{String{"Hello"}, 1, 4}};
+        static_assert(Equal(Array{'e', 'l', 'l'}, v1));
+    }
+
+    {
+        // slices of random access lazy views, and lazy views of slices
+        const auto a{Array{1, 2, 3, 4, 5, 6, 7, 8}};
+        CHECK(Equal(Array{6, 8}, SliceView{MapView{TwoTimes, a}, 2, 4}));
+        CHECK(Equal(Array{4, 6}, FilterView{Even, SliceView{a, 2, 6}}));
+        CHECK(Equal(Array{14, 16}, SliceView{MapView{TwoTimes, Range<1, 9>{}}, 6}));
+        static_assert(IsRandomAccessCollection<decltype(MapView{TwoTimes, a})>);
+        static_assert(not IsRandomAccessCollection<decltype(FilterView{Even, a})>);
+        static_assert(not IsRandomAccessCollection<decltype(MapView{TwoTimes, FilterView{Even, a}})>);
+    }
+}
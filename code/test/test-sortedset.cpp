@@ -0,0 +1,136 @@
+#include <cstring>
+#include <utility>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-set.hpp"
+#include "cljonic-sortedset.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-isdistinct.hpp"
+#include "cljonic-core-some.hpp"
+#include "cljonic-core-sort.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("SortedSet", "[CljonicSortedSet]")
+{
+    {
+        constexpr auto s0{SortedSet<int, 10>{}};
+        constexpr auto s1{SortedSet<int, 10>{4, 2, 3, 1}};
+        constexpr auto s2{SortedSet<int, 4>{4, 2, 3, 1}};
+        constexpr auto s3{SortedSet{4, 3, 2, 1}};
+        constexpr auto s4{SortedSet{4, 2, 1, 4}};
+
+        CHECK(0 == s0.Count());
+        CHECK(4 == s1.Count());
+        CHECK(4 == s2.Count());
+        CHECK(4 == s3.Count());
+        CHECK(3 == s4.Count());
+
+        CHECK(10 == s0.MaximumCount());
+        CHECK(4 == s3.MaximumCount());
+
+        CHECK(0 == s0[0]);
+        CHECK(1 == s1[0]);
+        CHECK(2 == s1[1]);
+        CHECK(3 == s1[2]);
+        CHECK(4 == s1[3]);
+        CHECK(0 == s1[4]);
+        CHECK(1 == s4[0]);
+        CHECK(2 == s4[1]);
+        CHECK(4 == s4[2]);
+        CHECK(0 == s4[3]);
+
+        CHECK(not s0.Contains(0));
+        CHECK(s1.Contains(1));
+        CHECK(s1.Contains(4));
+        CHECK(not s1.Contains(0));
+        CHECK(not s1.Contains(5));
+        CHECK(not s4.Contains(3));
+        CHECK(s1.ContainsBy([](const int i, const int j) { return i == (j + 1); }, 5));
+        CHECK(not s1.ContainsBy([](const int i, const int j) { return i == (j + 1); }, 6));
+
+        CHECK(2 == s1(2));
+        CHECK(0 == s1(5));
+        CHECK(0 == s1.DefaultElement());
+
+        CHECK(s1.ElementAtIndexIsEqualToElement(0, 3));
+        CHECK(not s1.ElementAtIndexIsEqualToElement(4, 3));
+        CHECK(not s1.ElementAtIndexIsEqualToElement(0, 5));
+
+        static_assert(s1.Contains(3), "SortedSet Contains should be usable in a constant expression");
+        static_assert(not s1.Contains(7), "SortedSet Contains should be usable in a constant expression");
+
+        auto previous{0};
+        auto ordered{true};
+        for (const auto& i : s1)
+        {
+            ordered = ordered and (previous < i);
+            previous = i;
+        }
+        CHECK(ordered);
+    }
+
+    {
+        const auto s{SortedSet{"two", "three", "one", "two"}};
+        CHECK(3 == s.Count());
+        CHECK(0 == std::strcmp("one", s[0]));
+        CHECK(0 == std::strcmp("three", s[1]));
+        CHECK(0 == std::strcmp("two", s[2]));
+        CHECK(s.Contains("one"));
+        CHECK(not s.Contains("four"));
+    }
+
+    {
+        auto s0{SortedSet<int, 10>{3, 2, 1}};
+        const auto s1{SortedSet<int, 10>{5, 4}};
+        s0 = s1;
+        CHECK(2 == s0.Count());
+        CHECK(4 == s0[0]);
+        CHECK(not s0.Contains(1));
+        s0 = SortedSet<int, 10>{7};
+        CHECK(1 == s0.Count());
+        CHECK(s0.Contains(7));
+    }
+
+    {
+        // core functions
+        constexpr auto Even = [](const int i) { return (0 == (i % 2)); };
+        constexpr auto s{SortedSet{6, 1, 5, 2, 4, 3}};
+        CHECK(Equal(Array{2, 4, 6}, Filter(Even, s)));
+        CHECK(Some(Even, s));
+        CHECK(not Some(Even, SortedSet{5, 1, 3}));
+        CHECK(Equal(s, SortedSet{1, 2, 3, 4, 5, 6}));
+        CHECK(Equal(s, Set{6, 5, 4, 3, 2, 1}));
+        CHECK(Equal(Set{6, 5, 4, 3, 2, 1}, s));
+        CHECK(not Equal(s, SortedSet{6, 5, 4, 3, 2}));
+        CHECK(not Equal(s, SortedSet{6, 5, 4, 3, 2, 7}));
+        CHECK(IsDistinct(s, SortedSet{1, 2, 3}));
+        CHECK(not IsDistinct(s, SortedSet{6, 5, 4, 3, 2, 1}));
+        CHECK(Equal(Array{1, 2, 3, 4, 5, 6}, Sort(s)));
+    }
+
+    {
+        // only the elements in use are copied, and the unused ones are never read
+        constexpr auto s0{SortedSet<int, 1000>{3, 1, 2}};
+        constexpr auto s1{s0};
+        static_assert((3 == s1.Count()) and (1 == s1[0]) and (3 == s1[2]) and (0 == s1[3]));
+        auto s2{SortedSet<int, 1000>{5, 4}};
+        const auto s3{std::move(s2)};
+        CHECK(2 == s3.Count());
+        CHECK(4 == s3[0]);
+        auto s4{SortedSet<int, 1000>{}};
+        s4 = s3;
+        CHECK(2 == s4.Count());
+        CHECK(5 == s4[1]);
+        CHECK(0 == s4[2]);
+    }
+
+    {
+        // At returns a const reference to an element, or to the default element when the index is out-of-bounds
+        constexpr auto s{SortedSet{5, 3, 4}};
+        static_assert((3 == s.At(0)) and (5 == s.At(2)) and (0 == s.At(3)));
+        CHECK(&s.At(2) == (s.begin() + 2));
+    }
+}
@@ -0,0 +1,124 @@
+#include <array>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-filterview.hpp"
+#include "cljonic-mapview.hpp"
+#include "cljonic-spanview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-count.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-filter.hpp"
+#include "cljonic-core-map.hpp"
+#include "cljonic-core-reduce.hpp"
+#include "cljonic-core-seq.hpp"
+#include "cljonic-core-take.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+
+SCENARIO("SpanView", "[CljonicSpanView]")
+{
+    constexpr auto Add = [](const int i, const int j) { return i + j; };
+    constexpr auto IsDigit = [](const char c) { return ('0' <= c) and (c <= '9'); };
+
+    {
+        static_assert(not std::is_polymorphic_v<SpanView<int>>);
+        static_assert(IsCljonicIndexable<SpanView<int>>);
+        static_assert(std::ranges::contiguous_range<SpanView<int>>);
+        static_assert(std::is_same_v<SpanView<int>, decltype(SpanView{std::span<const int>{}})>);
+        static_assert(std::is_same_v<SpanView<int>, decltype(SpanView{std::span<int>{}})>);
+        static_assert(std::is_same_v<SpanView<char>, decltype(SpanView{std::string_view{}})>);
+        static_assert(std::is_same_v<SpanView<int>, decltype(SpanView{std::array<int, 3>{}})>);
+    }
+
+    {
+        constexpr auto v{SpanView<int>{}};
+        CHECK(0 == v.Count());
+        CHECK(CljonicCollectionMaximumElementCount == v.MaximumCount());
+        CHECK(nullptr == v.Data());
+        CHECK(0 == v[0]);
+        CHECK(0 == v.DefaultElement());
+        CHECK(v.begin() == v.end());
+    }
+
+    {
+        // a SpanView refers to the elements, rather than copying them
+        int buffer[]{1, 2, 3, 4};
+        const auto v{SpanView{std::span{buffer}}};
+        CHECK(4 == v.Count());
+        CHECK(buffer == v.Data());
+        CHECK(buffer == v.begin());
+        CHECK((buffer + 4) == v.end());
+        CHECK(1 == v[0]);
+        CHECK(4 == v[3]);
+        CHECK(0 == v[4]);
+        CHECK(v.ElementAtIndexIsEqualToElement(2, 3));
+        CHECK(not v.ElementAtIndexIsEqualToElement(2, 4));
+        CHECK(not v.ElementAtIndexIsEqualToElement(4, 0));
+        buffer[0] = 11;
+        CHECK(11 == v[0]);
+    }
+
+    {
+        // the Core functions accept a SpanView as an Array
+        const int buffer[]{1, 2, 3, 4};
+        const auto v{SpanView{std::span{buffer}}};
+        CHECK(10 == Reduce(Add, v));
+        CHECK(Equal(v, Array{1, 2, 3, 4}));
+        CHECK(Equal(Array{1, 2, 3, 4}, v));
+        CHECK(Equal(Seq(v), Array{1, 2, 3, 4}));
+        CHECK(Equal(Take(2, v), Array{1, 2}));
+        CHECK(Equal(Map([](const int i) { return 2 * i; }, v), Array{2, 4, 6, 8}));
+        CHECK(Equal(MapView{[](const int i) { return 2 * i; }, v}, Array{2, 4, 6, 8}));
+    }
+
+    {
+        // a SpanView of a std::string_view, or of the chars of a String
+        constexpr auto v0{SpanView{std::string_view{"a1b2c3"}}};
+        static_assert(6 == v0.Count());
+        static_assert('1' == v0[1]);
+        static_assert(3 == Count(Filter(IsDigit, v0)));
+        CHECK(Equal(FilterView{IsDigit, v0}, Array{'1', '2', '3'}));
+
+        const auto s{String{"Hello"}};
+        const auto v1{SpanView{s.AsSpan()}};
+        CHECK(s.Data() == v1.Data());
+        CHECK(Equal(v1, Array{'H', 'e', 'l', 'l', 'o'}));
+    }
+
+    {
+        // a SpanView can refer to CljonicCollectionMaximumElementCount elements, and asserts that it has no more
+        static int buffer[CljonicCollectionMaximumElementCount]{};
+        const auto v{SpanView{std::span{buffer}}};
+        CHECK(CljonicCollectionMaximumElementCount == v.Count());
+        CHECK((buffer + CljonicCollectionMaximumElementCount) == v.end());
+        const auto w{SpanView{buffer, CljonicCollectionMaximumElementCount}};
+        CHECK(CljonicCollectionMaximumElementCount == w.Count());
+    }
+
+    {
+        // At returns a const reference to the element it refers to
+        const int buffer[]{1, 2, 3};
+        const auto v{SpanView{std::span{buffer}}};
+        CHECK(&buffer[1] == &v.At(1));
+        CHECK(0 == v.At(3));
+    }
+
+    {
+        // a SpanView is constructed from a pointer and a count, and can be assigned, so it can be an Array element
+        const int buffer[]{1, 2, 3, 4};
+        auto v{SpanView{buffer + 1, 2}};
+        static_assert(std::is_same_v<SpanView<int>, decltype(SpanView{buffer + 1, 2})>);
+        static_assert(ValidCljonicContainerElementType<SpanView<int>>);
+        CHECK(Equal(Array{2, 3}, v));
+        v = SpanView{buffer, 4};
+        CHECK(Equal(Array{1, 2, 3, 4}, v));
+        auto a{Array<SpanView<int>, 2>{}};
+        MConj(a, v);
+        CHECK(buffer == a.At(0).Data());
+    }
+}
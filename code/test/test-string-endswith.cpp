@@ -0,0 +1,23 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-string-endswith.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+SCENARIO("String EndsWith", "[CljonicStringEndsWith]")
+{
+    constexpr auto s{String{"Hello, World"}};
+    static_assert(EndsWith(s, "World"));
+    static_assert(not EndsWith(s, String{"Hello"}));
+    static_assert(not EndsWith("ld", "World"));
+    static_assert(EndsWith(s, ""));
+
+    CHECK(EndsWith(s, s));
+    CHECK(EndsWith(Array{'a', 'b', 'c'}, "bc"));
+    CHECK(EndsWith(SliceView{s, 0, 5}, "llo"));
+    CHECK(not EndsWith(String<10>{}, "a"));
+    CHECK(EndsWith("", ""));
+}
@@ -0,0 +1,30 @@
+#include <span>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-spanview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-string-includes.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+SCENARIO("String Includes", "[CljonicStringIncludes]")
+{
+    constexpr auto s{String{"Hello, World"}};
+    static_assert(Includes(s, "World"));
+    static_assert(not Includes(s, String{"world"}));
+    static_assert(Includes(Array{'a', 'b', 'c'}, "bc"));
+    static_assert(Includes("Hello", ""));
+    static_assert(Includes("", ""));
+    static_assert(not Includes("", "a"));
+
+    CHECK(Includes(s, "o, W"));
+    CHECK(Includes(s, s));
+    CHECK(not Includes(String{"Hello"}, s));
+    CHECK(Includes(SliceView{s, 7}, Array{'W', 'o'}));
+    CHECK(not Includes(SliceView{s, 0, 5}, "World"));
+    const char chars[]{'a', 'b', 'c', 'd'};
+    CHECK(Includes(SpanView{std::span<const char>{chars}}, "cd"));
+    CHECK(not Includes(SpanView{std::span<const char>{chars, 3}}, "cd"));
+}
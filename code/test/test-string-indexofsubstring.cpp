@@ -0,0 +1,40 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-string-indexofsubstring.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+SCENARIO("String IndexOfSubstring", "[CljonicStringIndexOfSubstring]")
+{
+    constexpr auto s{String{"Hello, World"}};
+    static_assert(4 == IndexOfSubstring(s, "o"));
+    static_assert(7 == IndexOfSubstring(s, String{"World"}));
+    static_assert(CLJONIC_INVALID_INDEX == IndexOfSubstring(s, "world"));
+    static_assert(2 == IndexOfSubstring("abcabc", "ca"));
+    static_assert(0 == IndexOfSubstring(s, ""));
+
+    CHECK(0 == IndexOfSubstring(s, s));
+    CHECK(2 == IndexOfSubstring(s, Array{'l', 'l', 'o'}));
+    CHECK(2 == IndexOfSubstring(SliceView{s, 7}, "rld"));
+    CHECK(CLJONIC_INVALID_INDEX == IndexOfSubstring(String<20>{}, "a"));
+    CHECK(CLJONIC_INVALID_INDEX == IndexOfSubstring(s, "Hello, World!"));
+
+    {
+        // a needle that defeats a naive search is found in time proportional to the lengths
+        char text[1001]{};
+        for (SizeType i{0}; i < 1000; ++i)
+            text[i] = 'a';
+        text[999] = 'b';
+        const auto haystack{String<1000>{text}};
+        char part[101]{};
+        for (SizeType i{0}; i < 100; ++i)
+            part[i] = 'a';
+        part[99] = 'b';
+        CHECK(900 == IndexOfSubstring(haystack, part));
+        part[99] = 'c';
+        CHECK(CLJONIC_INVALID_INDEX == IndexOfSubstring(haystack, part));
+    }
+}
@@ -0,0 +1,68 @@
+#include <string_view>
+#include <type_traits>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-range.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-string-join.hpp"
+#include "cljonic-string-split.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+using namespace cljonic::string;
+
+namespace
+{
+
+template <typename T>
+std::string_view View(const T& t)
+{
+    return std::string_view{t.begin(), t.Count()};
+}
+
+} // namespace
+
+SCENARIO("String Join", "[CljonicStringJoin]")
+{
+    {
+        constexpr auto s0{Join(", ", Array{"one", "two", "three"})};
+        static_assert(std::is_same_v<const String<1000>, decltype(s0)>);
+        static_assert(Equal(String{"one, two, three"}, s0));
+        constexpr auto s1{Join('-', Array{Array{'a', 'b'}, Array{'c', 'd'}})};
+        static_assert(std::is_same_v<const String<5>, decltype(s1)>);
+        static_assert(Equal(String{"ab-cd"}, s1));
+        constexpr auto s2{Join(Array{Array{'a', 'b'}, Array{'c', 'd'}})};
+        static_assert(std::is_same_v<const String<4>, decltype(s2)>);
+        static_assert(Equal(String{"abcd"}, s2));
+        static_assert(Equal(String{"ab::cd"}, Join(String{"::"}, Array{"ab", "cd"})));
+    }
+
+    {
+        // empty collections and empty elements
+        CHECK(0 == Join(',', Array<const char*, 5>{}).Count());
+        CHECK("a" == View(Join(',', Array{"a"})));
+        CHECK(",," == View(Join(',', Array{"", "", ""})));
+    }
+
+    {
+        // Join undoes Split, writing the fields straight into one String
+        const auto s{String{"id=7,,name=bob,"}};
+        CHECK(Equal(s, Join(',', Split(s, ','))));
+        CHECK("id=7;;name=bob;" == View(Join(';', Split(s, ','))));
+        CHECK("id7,,namebob," == View(Join(Split(s, '='))));
+    }
+
+    {
+        // the String holds at most CljonicCollectionMaximumElementCount chars, and ignores the chars that do not fit
+        const auto big{Array<Array<char, 600>, 2>{Array<char, 600>{'a', 'b'}, Array<char, 600>{'c', 'd'}}};
+        CHECK(CljonicCollectionMaximumElementCount == decltype(Join('+', big))::MaximumCount());
+        CHECK("ab+cd" == View(Join('+', big)));
+        char text[1001]{};
+        for (SizeType i{0}; i < 1000; ++i)
+            text[i] = 'x';
+        const auto joined{Join(',', Array{static_cast<const char*>(text), "y"})};
+        CHECK(1000 == joined.Count());
+        CHECK('x' == joined[999]);
+    }
+}
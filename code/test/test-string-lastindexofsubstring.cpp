@@ -0,0 +1,41 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-string-lastindexofsubstring.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+SCENARIO("String LastIndexOfSubstring", "[CljonicStringLastIndexOfSubstring]")
+{
+    constexpr auto s{String{"Hello, World"}};
+    static_assert(8 == LastIndexOfSubstring(s, "o"));
+    static_assert(10 == LastIndexOfSubstring(s, String{"l"}));
+    static_assert(CLJONIC_INVALID_INDEX == LastIndexOfSubstring(s, "world"));
+    static_assert(4 == LastIndexOfSubstring("abcabc", "bc"));
+    static_assert(12 == LastIndexOfSubstring(s, ""));
+
+    CHECK(0 == LastIndexOfSubstring(s, s));
+    CHECK(9 == LastIndexOfSubstring(s, Array{'r', 'l'}));
+    CHECK(0 == LastIndexOfSubstring(SliceView{s, 0, 5}, "He"));
+    CHECK(CLJONIC_INVALID_INDEX == LastIndexOfSubstring(SliceView{s, 0, 5}, "World"));
+    CHECK(CLJONIC_INVALID_INDEX == LastIndexOfSubstring(String<20>{}, "a"));
+    CHECK(3 == LastIndexOfSubstring("aaaaa", "aa"));
+
+    {
+        // a needle that defeats a naive backward search is found in time proportional to the lengths
+        char text[1001]{};
+        for (SizeType i{0}; i < 1000; ++i)
+            text[i] = 'a';
+        text[0] = 'b';
+        const auto haystack{String<1000>{text}};
+        char part[101]{};
+        for (SizeType i{0}; i < 100; ++i)
+            part[i] = 'a';
+        part[0] = 'b';
+        CHECK(0 == LastIndexOfSubstring(haystack, part));
+        part[0] = 'c';
+        CHECK(CLJONIC_INVALID_INDEX == LastIndexOfSubstring(haystack, part));
+    }
+}
@@ -0,0 +1,47 @@
+#include <cstdint>
+#include <type_traits>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-core-equalby.hpp"
+#include "cljonic-string-parseall.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+using namespace cljonic::string;
+
+SCENARIO("String ParseAll", "[CljonicStringParseAll]")
+{
+    constexpr auto Same = [](const double d0, const double d1) { return d0 == d1; };
+
+    {
+        // each field is parsed to a number of the type, and the Array can hold one more number than there are chars
+        constexpr auto a0{ParseAll<int>(String{"3,-1,4"}, ',')};
+        static_assert(std::is_same_v<const Array<int, 7>, decltype(a0)>);
+        static_assert(Equal(Array{3, -1, 4}, a0));
+        constexpr auto a1{ParseAll<double>(String{"0.5 1e3"}, ' ')};
+        static_assert(EqualBy(Same, Array{0.5, 1000.0}, a1));
+        const auto s{String{"255|256|0"}};
+        CHECK(Equal(Array{std::uint8_t{255}, std::uint8_t{0}, std::uint8_t{0}}, ParseAll<std::uint8_t>(s, '|')));
+    }
+
+    {
+        // empty fields are kept, and a field that is not a number is zero, or the third parameter
+        static_assert(Equal(Array{7, 0, 0, 8}, ParseAll<int>(String{"7,,x,8"}, ',')));
+        static_assert(Equal(Array{7, -1, -1, 8}, ParseAll<int>(String{"7,,x,8"}, ',', -1)));
+        CHECK(Equal(Array{0}, ParseAll<int>(String<10>{}, ',')));
+        CHECK(Equal(Array{-1, -1}, ParseAll(String{","}, ',', -1)));
+    }
+
+    {
+        // a run time ParseAll agrees with a constant ParseAll, and parses views
+        constexpr auto a{ParseAll<double>(String{"0.1,2.2250738585072011e-308,1e400,-0.0"}, ',')};
+        const auto s{String{"0.1,2.2250738585072011e-308,1e400,-0.0"}};
+        CHECK(EqualBy(Same, a, ParseAll<double>(s, ',')));
+        CHECK(Equal(Array{0, 1}, ParseAll<int>(SliceView{s, 0, 3}, '.')));
+        const auto chars{Array{'1', ';', '2'}};
+        CHECK(Equal(Array{1, 2}, ParseAll<long>(chars, ';')));
+    }
+}
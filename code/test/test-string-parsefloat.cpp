@@ -0,0 +1,72 @@
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include "catch.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-string-parsefloat.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+SCENARIO("String ParseFloat", "[CljonicStringParseFloat]")
+{
+    {
+        // decimal numbers parse to the nearest double by default
+        static_assert(-2500.0 == ParseFloat("-2.5e3"));
+        static_assert(0.1 == ParseFloat("0.1"));
+        static_assert(0.5 == ParseFloat(".5"));
+        static_assert(5.0 == ParseFloat("+5."));
+        static_assert(123.0 == ParseFloat("123"));
+        static_assert(1e-300 == ParseFloat("1e-300"));
+        static_assert(std::is_same_v<double, decltype(ParseFloat("1"))>);
+        static_assert(std::is_same_v<float, decltype(ParseFloat<float>("1"))>);
+        static_assert(3.14159f == ParseFloat<float>("3.14159"));
+        CHECK(0.1 == ParseFloat("0.1"));
+        CHECK(1e-300 == ParseFloat("1e-300"));
+        CHECK(0.30000000000000004 == ParseFloat("0.30000000000000004"));
+        CHECK(3.14159f == ParseFloat<float>("3.14159"));
+        CHECK(1.7976931348623157e308 == ParseFloat("1.7976931348623157e308"));
+    }
+
+    {
+        // numbers beyond the range of the type are infinity or zero, and inf and nan are numbers
+        static_assert(std::numeric_limits<double>::infinity() == ParseFloat("1e400"));
+        static_assert(-std::numeric_limits<double>::infinity() == ParseFloat("-1e400"));
+        static_assert(std::numeric_limits<float>::infinity() == ParseFloat<float>("1e39"));
+        static_assert(0.0 == ParseFloat("1e-400"));
+        CHECK(std::numeric_limits<double>::infinity() == ParseFloat("1e400"));
+        CHECK(-std::numeric_limits<double>::infinity() == ParseFloat("-1e400"));
+        CHECK(std::signbit(ParseFloat("-1e-400")));
+        CHECK(std::numeric_limits<double>::infinity() == ParseFloat("INF"));
+        CHECK(-std::numeric_limits<double>::infinity() == ParseFloat("-Infinity"));
+        CHECK(std::isnan(ParseFloat("nan")));
+        CHECK(std::signbit(ParseFloat("-0")));
+    }
+
+    {
+        // anything else is not a number
+        static_assert(0.0 == ParseFloat("1.5x"));
+        static_assert(-1.0 == ParseFloat("1.5x", -1.0));
+        CHECK(-1.0 == ParseFloat("", -1.0));
+        CHECK(-1.0 == ParseFloat(".", -1.0));
+        CHECK(-1.0 == ParseFloat(" 1", -1.0));
+        CHECK(-1.0 == ParseFloat("1e", -1.0));
+        CHECK(-1.0 == ParseFloat("infinit", -1.0));
+        CHECK(-1.0 == ParseFloat("0x1p3", -1.0));
+    }
+
+    {
+        // a constant ParseFloat, which cannot call std::from_chars, and a run time ParseFloat agree
+        constexpr auto d0{ParseFloat("2.2250738585072011e-308")};
+        CHECK(d0 == ParseFloat("2.2250738585072011e-308"));
+        constexpr auto d1{ParseFloat("123456789012345678901234567890")};
+        CHECK(d1 == ParseFloat("123456789012345678901234567890"));
+        constexpr auto d2{ParseFloat("4.9406564584124654e-324")};
+        CHECK(d2 == ParseFloat("4.9406564584124654e-324"));
+        CHECK(d2 == std::numeric_limits<double>::denorm_min());
+        constexpr auto f0{ParseFloat<float>("1.00000005960464477550")};
+        CHECK(f0 == ParseFloat<float>("1.00000005960464477550"));
+        static_assert(0.25 == ParseFloat(SliceView{String{"x0.25"}, 1}));
+    }
+}
@@ -0,0 +1,57 @@
+#include <cstdint>
+#include <type_traits>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-spanview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-string-parseint.hpp"
+#include "cljonic-string-split.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+SCENARIO("String ParseInt", "[CljonicStringParseInt]")
+{
+    {
+        // an optional sign and decimal digits, and nothing else, parse to an int by default
+        static_assert(-42 == ParseInt("-42"));
+        static_assert(42 == ParseInt("+42"));
+        static_assert(std::is_same_v<int, decltype(ParseInt("1"))>);
+        static_assert(std::is_same_v<long, decltype(ParseInt("1", 0L))>);
+        CHECK(0 == ParseInt("0"));
+        CHECK(7 == ParseInt("007"));
+        CHECK(0 == ParseInt(" 7"));
+        CHECK(0 == ParseInt("7 "));
+        CHECK(0 == ParseInt("1.5"));
+        CHECK(0 == ParseInt(""));
+        CHECK(0 == ParseInt("-"));
+        CHECK(-1 == ParseInt("0x10", -1));
+    }
+
+    {
+        // every integer type parses to its limits, and a number beyond them is not a number
+        static_assert(255 == ParseInt<std::uint8_t>("255"));
+        static_assert(0 == ParseInt<std::uint8_t>("256"));
+        static_assert(99 == ParseInt<std::uint8_t>("256", 99));
+        static_assert(-128 == ParseInt<std::int8_t>("-128"));
+        static_assert(0 == ParseInt<std::uint32_t>("-1"));
+        CHECK(INT64_MIN == ParseInt<std::int64_t>("-9223372036854775808"));
+        CHECK(UINT64_MAX == ParseInt<std::uint64_t>("18446744073709551615"));
+        CHECK(0 == ParseInt<std::uint64_t>("18446744073709551616"));
+        CHECK(0 == ParseInt<std::int64_t>("99999999999999999999999"));
+    }
+
+    {
+        // the chars can be any collection of contiguous chars, such as the fields of Split
+        static_assert(123 == ParseInt(String{"123"}));
+        static_assert(12 == ParseInt(SliceView{String{"123"}, 0, 2}));
+        const auto s{String{"x=17,y=-3"}};
+        const auto fields{Split(s, ',')};
+        CHECK(17 == ParseInt(Split(fields[0], '=')[1]));
+        CHECK(-3 == ParseInt(Split(fields[1], '=')[1]));
+        const auto a{Array{'4', '2'}};
+        CHECK(42 == ParseInt(a));
+        CHECK(4 == ParseInt(SpanView<char>{a.Data(), 1}));
+    }
+}
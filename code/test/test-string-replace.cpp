@@ -0,0 +1,31 @@
+#include <type_traits>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-core-equal.hpp"
+#include "cljonic-string-replace.hpp"
+
+using namespace cljonic;
+using namespace cljonic::core;
+using namespace cljonic::string;
+
+SCENARIO("String Replace", "[CljonicStringReplace]")
+{
+    constexpr auto s{String<20>{"Hello, World"}};
+    constexpr auto s0{Replace(s, "World", "There")};
+    static_assert(std::is_same_v<const String<20>, decltype(s0)>);
+    static_assert(Equal(String{"Hello, There"}, s0));
+    static_assert(Equal(String{"Heo, Word"}, Replace(s, "l", "")));
+    static_assert(Equal(String{"Hell00, W00rld"}, Replace(s, String{"o"}, "00")));
+    static_assert(Equal(String{"-a-"}, Replace(String{"abc"}, "", "-")));
+    static_assert(Equal(String{"cbc"}, Replace(Array{'a', 'b', 'a'}, "a", "c")));
+
+    CHECK(Equal(String{"-a-b-c-"}, Replace(String<10>{"abc"}, "", "-")));
+    CHECK(Equal(s, Replace(s, "world", "There")));
+    CHECK(Equal(String{"bba"}, Replace(String{"aaaaa"}, "aa", "b")));
+    CHECK(Equal(String{"Hello"}, Replace(String{"Hello"}, "Hello, World", "")));
+    CHECK(Equal(String{""}, Replace(String{"abab"}, "ab", "")));
+    CHECK(Equal(String{"xWorld"}, Replace(SliceView{s, 5}, ", ", "x")));
+    CHECK(Equal(String{"XXXXX"}, Replace(String<5>{"ab"}, "a", "XXXXXXXX")));
+}
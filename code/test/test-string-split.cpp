@@ -0,0 +1,102 @@
+#include <string_view>
+#include <type_traits>
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-spanview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-string-split.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+namespace
+{
+
+template <typename T>
+std::string_view View(const T& t)
+{
+    return std::string_view{t.begin(), t.Count()};
+}
+
+} // namespace
+
+SCENARIO("String Split", "[CljonicStringSplit]")
+{
+    {
+        // the fields are SpanViews that refer to the chars of the String
+        const auto s{String{"id=7,,name=bob"}};
+        const auto fields{Split(s, ',')};
+        static_assert(std::is_same_v<const Array<SpanView<char>, 15>, decltype(fields)>);
+        CHECK(3 == fields.Count());
+        CHECK("id=7" == View(fields[0]));
+        CHECK(0 == fields[1].Count());
+        CHECK("name=bob" == View(fields[2]));
+        CHECK(s.Data() == fields[0].Data());
+        CHECK((s.Data() + 6) == fields[2].Data());
+        const auto name{Split(fields[2], '=')};
+        CHECK(2 == name.Count());
+        CHECK("bob" == View(name[1]));
+        CHECK((s.Data() + 11) == name[1].Data());
+    }
+
+    {
+        // empty fields, even leading and trailing ones, are kept
+        const auto s{String{",a,,b,"}};
+        const auto fields{Split(s, ',')};
+        CHECK(5 == fields.Count());
+        CHECK((("" == View(fields[0])) and ("a" == View(fields[1])) and ("" == View(fields[2]))));
+        CHECK((("b" == View(fields[3])) and ("" == View(fields[4]))));
+        const auto empty{String<10>{}};
+        CHECK(1 == Split(empty, ',').Count());
+        CHECK(0 == Split(empty, ',')[0].Count());
+        const auto commas{String{",,,"}};
+        CHECK(4 == Split(commas, ',').Count());
+    }
+
+    {
+        // a delimiter can be a C string, or a collection of contiguous chars, and an empty one splits out the chars
+        const auto s{String{"a::b::c"}};
+        const auto fields{Split(s, "::")};
+        CHECK(3 == fields.Count());
+        CHECK("c" == View(fields[2]));
+        CHECK(3 == Split(s, String{"::"}).Count());
+        CHECK(1 == Split(s, ":::").Count());
+        const auto chars{Split(s, "")};
+        CHECK(7 == chars.Count());
+        CHECK(":" == View(chars[1]));
+    }
+
+    {
+        // an empty String split by an empty delimiter is one empty field, like an empty String split by any delimiter
+        const auto empty{String<5>{""}};
+        CHECK(1 == Split(empty, "").Count());
+        CHECK(0 == Split(empty, "")[0].Count());
+        CHECK(1 == Split(empty, String<3>{}).Count());
+        CHECK(1 == Split(empty, "::").Count());
+        static constexpr auto c{String<5>{""}};
+        static_assert(1 == Split(c, "").Count());
+        static_assert(0 == Split(c, "")[0].Count());
+    }
+
+    {
+        // char Arrays and slices can be split, and a constant String can be split at compile time
+        const auto a{Array{'x', ' ', 'y'}};
+        CHECK(2 == Split(a, ' ').Count());
+        const auto s{String{"one two three"}};
+        const auto v{SliceView{s, 4}};
+        CHECK("three" == View(Split(v, ' ')[1]));
+        static constexpr auto c{String{"1,22,333"}};
+        static_assert(3 == Split(c, ',').Count());
+        static_assert(3 == Split(c, ',')[2].Count());
+    }
+
+    {
+        // every field of a String full of delimiters fits
+        char text[1001]{};
+        for (SizeType i{0}; i < 999; ++i)
+            text[i] = ',';
+        const auto s{String<999>{text}};
+        CHECK(1000 == Split(s, ',').Count());
+    }
+}
@@ -0,0 +1,23 @@
+#include "catch.hpp"
+#include "cljonic-array.hpp"
+#include "cljonic-sliceview.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-string-startswith.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+SCENARIO("String StartsWith", "[CljonicStringStartsWith]")
+{
+    constexpr auto s{String{"Hello, World"}};
+    static_assert(StartsWith(s, "Hello"));
+    static_assert(not StartsWith(s, String{"World"}));
+    static_assert(not StartsWith("Hi", "Hello"));
+    static_assert(StartsWith(s, ""));
+
+    CHECK(StartsWith(s, s));
+    CHECK(StartsWith(Array{'a', 'b', 'c'}, "ab"));
+    CHECK(StartsWith(SliceView{s, 7}, "Wor"));
+    CHECK(not StartsWith(String<10>{}, "a"));
+    CHECK(StartsWith("", ""));
+}
@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include "catch.hpp"
+#include "cljonic-string.hpp"
+#include "cljonic-string-parsefloat.hpp"
+#include "cljonic-string-str.hpp"
+
+using namespace cljonic;
+using namespace cljonic::string;
+
+namespace
+{
+
+template <SizeType N>
+constexpr std::string_view View(const String<N>& s)
+{
+    return s.template AsStringView<std::string_view>();
+}
+
+} // namespace
+
+SCENARIO("String Str", "[CljonicStringStr]")
+{
+    {
+        // integers are written in decimal, in a String big enough for any value of their type
+        static_assert(std::is_same_v<String<11>, decltype(Str(-42))>);
+        static_assert(std::is_same_v<String<4>, decltype(Str(std::uint8_t{255}))>);
+        static_assert(std::is_same_v<String<20>, decltype(Str(std::int64_t{1}))>);
+        static_assert("-42" == View(Str(-42)));
+        static_assert("255" == View(Str(std::uint8_t{255})));
+        static_assert("-128" == View(Str(std::int8_t{-128})));
+        CHECK("-2147483648" == View(Str(std::numeric_limits<int>::min())));
+        CHECK("18446744073709551615" == View(Str(std::numeric_limits<std::uint64_t>::max())));
+        CHECK("0" == View(Str(0u)));
+    }
+
+    {
+        // bools are true or false, and chars are themselves
+        static_assert("true" == View(Str(true)));
+        static_assert("false" == View(Str(false)));
+        static_assert("c" == View(Str('c')));
+        static_assert(std::is_same_v<String<1>, decltype(Str('c'))>);
+    }
+
+    {
+        // floats and doubles are written with the fewest digits that parse back to them
+        static_assert(std::is_same_v<String<24>, decltype(Str(1.0))>);
+        static_assert(std::is_same_v<String<16>, decltype(Str(1.0f))>);
+        static_assert("0.1" == View(Str(0.1)));
+        static_assert("0.30000000000000004" == View(Str(0.1 + 0.2)));
+        static_assert("0.3" == View(Str(0.1f + 0.2f)));
+        static_assert("1e+22" == View(Str(1e22)));
+        static_assert("100" == View(Str(100.0)));
+        CHECK("0.1" == View(Str(0.1)));
+        CHECK("0.30000000000000004" == View(Str(0.1 + 0.2)));
+        CHECK("1e+22" == View(Str(1e22)));
+        CHECK("-1.5e-07" == View(Str(-1.5e-7)));
+        CHECK("-2.2250738585072014e-308" == View(Str(-std::numeric_limits<double>::min())));
+        CHECK("inf" == View(Str(std::numeric_limits<double>::infinity())));
+        CHECK("nan" == View(Str(std::numeric_limits<double>::quiet_NaN())));
+    }
+
+    {
+        // a constant Str and a run time Str agree, and ParseFloat parses back what Str writes
+        constexpr auto s0{Str(1.2345678901234568e20)};
+        CHECK(View(s0) == View(Str(1.2345678901234568e20)));
+        constexpr auto s1{Str(-3.4028235e38f)};
+        CHECK(View(s1) == View(Str(-3.4028235e38f)));
+        constexpr auto s2{Str(6.02214076e23)};
+        CHECK(View(s2) == View(Str(6.02214076e23)));
+        static_assert(6.02214076e23 == ParseFloat(Str(6.02214076e23)));
+        for (auto d{1e-310}; d < 1e300; d *= 7.3)
+            CHECK(d == ParseFloat(Str(d)));
+    }
+}
@@ -1,4 +1,8 @@
+#include <cstring>
+#include <span>
 #include <string>
+#include <string_view>
+#include <utility>
 #include "catch.hpp"
 #include "cljonic-string.hpp"
 
@@ -118,4 +122,51 @@ SCENARIO("String", "[CljonicString]")
         CHECK('4' == s(3));
         CHECK('\0' == s(4)); // index out-of-bounds so return default element, which is '\0' in this case
     }
+
+    {
+        // the chars are contiguous and NUL terminated, so they can be accessed without being copied
+        const auto s{String<10>{"Hello"}};
+        const char* p{s.Data()};
+        CHECK(p == s.begin());
+        CHECK(0 == std::strcmp("Hello", p));
+        const std::span<const char> sp{s.AsSpan()};
+        CHECK(5 == sp.size());
+        CHECK(p == sp.data());
+        const std::string_view v{s.AsStringView<std::string_view>()};
+        CHECK("Hello" == v);
+        CHECK(p == v.data());
+        CHECK(String<10>{}.AsStringView<std::string_view>().empty());
+        CHECK(0 == String<10>{}.AsSpan().size());
+    }
+
+    {
+        // only the chars in use, and the null terminator, are copied, and the unused ones are never read
+        constexpr auto s0{String<1000>{"Hello"}};
+        constexpr auto s1{s0};
+        static_assert((5 == s1.Count()) and ('o' == s1[4]) and ('\0' == s1[5]));
+        auto s2{String<1000>{"World"}};
+        const auto s3{std::move(s2)};
+        CHECK(5 == s3.Count());
+        CHECK(0 == std::strcmp("World", s3.Data()));
+        CHECK(0 == std::strcmp("", String<1000>{}.Data()));
+    }
+
+    {
+        // At returns a const reference to a char, or to the default char when the index is out-of-bounds
+        constexpr auto s{String{"Hello"}};
+        static_assert(('e' == s.At(1)) and ('\0' == s.At(5)));
+        CHECK(&s.At(1) == (s.Data() + 1));
+    }
+
+    {
+        // MConj appends a char and keeps the chars null terminated, until the String is full
+        auto s{String<3>{}};
+        MConj(s, 'a');
+        MConj(s, 'b');
+        CHECK(0 == std::strcmp("ab", s.Data()));
+        MConj(s, 'c');
+        MConj(s, 'd');
+        CHECK(3 == s.Count());
+        CHECK(0 == std::strcmp("abc", s.Data()));
+    }
 }
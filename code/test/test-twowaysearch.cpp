@@ -0,0 +1,115 @@
+#include "catch.hpp"
+#include "cljonic-twowaysearch.hpp"
+
+using namespace cljonic;
+
+namespace
+{
+
+SizeType NaiveIndexOf(const Text& text, const Text& part)
+{
+    for (SizeType i{0}; (i + part.count) <= text.count; ++i)
+    {
+        SizeType j{0};
+        while ((j < part.count) and (text.chars[i + j] == part.chars[j]))
+            ++j;
+        if (j == part.count)
+            return i;
+    }
+    return CLJONIC_INVALID_INDEX;
+}
+
+SizeType NaiveLastIndexOf(const Text& text, const Text& part)
+{
+    auto result{CLJONIC_INVALID_INDEX};
+    for (SizeType i{0}; (i + part.count) <= text.count; ++i)
+    {
+        SizeType j{0};
+        while ((j < part.count) and (text.chars[i + j] == part.chars[j]))
+            ++j;
+        if (j == part.count)
+            result = i;
+    }
+    return result;
+}
+
+// Writes the count chars of number, in base 'a' to 'a' + base - 1, least significant first
+void Spell(char* chars, SizeType number, const SizeType count, const SizeType base)
+{
+    for (SizeType i{0}; i < count; ++i, number /= base)
+        chars[i] = static_cast<char>('a' + (number % base));
+}
+
+} // namespace
+
+SCENARIO("TwoWaySearch", "[CljonicTwoWaySearch]")
+{
+    {
+        // every needle of up to 7 chars, over 2 and 3 letter alphabets, is found where a naive search finds it
+        constexpr SizeType textCount{40};
+        for (SizeType base{2}; base <= 3; ++base)
+        {
+            char text[textCount]{};
+            for (SizeType i{0}; i < textCount; ++i)
+                text[i] = static_cast<char>('a' + (((i * i) + (i / 3)) % base));
+            char needle[7]{};
+            SizeType combinations{1};
+            for (SizeType count{1}; count <= 7; ++count)
+            {
+                combinations *= base;
+                for (SizeType number{0}; number < combinations; ++number)
+                {
+                    Spell(needle, number, count, base);
+                    const auto t{Text{text, textCount}};
+                    const auto p{Text{needle, count}};
+                    CHECK(NaiveIndexOf(t, p) == IndexOfText(t, p));
+                    CHECK(NaiveLastIndexOf(t, p) == LastIndexOfText(t, p));
+                }
+            }
+        }
+    }
+
+    {
+        // periodic needles, and texts that defeat a naive search, are found at every start
+        const char* text{"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab"};
+        const auto t{AsText(text)};
+        CHECK(35 == IndexOfText(t, AsText("aaaaaab")));
+        CHECK(35 == LastIndexOfText(t, AsText("aaaaaab")));
+        CHECK(CLJONIC_INVALID_INDEX == IndexOfText(t, AsText("aaaaaac")));
+        CHECK(0 == IndexOfText(t, AsText("aaaaaa")));
+        CHECK(35 == LastIndexOfText(t, AsText("aaaaaa")));
+        CHECK(10 == IndexOfText(t, AsText("aaaa"), 10));
+        CHECK(CLJONIC_INVALID_INDEX == IndexOfText(t, AsText("aaaa"), 40));
+        const auto abab{AsText("abababcabababcabababc")};
+        CHECK(0 == IndexOfText(abab, AsText("abababc")));
+        CHECK(7 == IndexOfText(abab, AsText("abababc"), 1));
+        CHECK(14 == LastIndexOfText(abab, AsText("abababc")));
+        CHECK(5 == IndexOfText(abab, AsText("bcababab")));
+        CHECK(12 == LastIndexOfText(abab, AsText("bcababab")));
+    }
+
+    {
+        // empty needles and haystacks
+        CHECK(0 == IndexOfText(AsText(""), AsText("")));
+        CHECK(3 == IndexOfText(AsText("abc"), AsText(""), 3));
+        CHECK(CLJONIC_INVALID_INDEX == IndexOfText(AsText("abc"), AsText(""), 4));
+        CHECK(3 == LastIndexOfText(AsText("abc"), AsText("")));
+        CHECK(CLJONIC_INVALID_INDEX == IndexOfText(AsText(""), AsText("a")));
+        CHECK(CLJONIC_INVALID_INDEX == LastIndexOfText(AsText("ab"), AsText("abc")));
+    }
+
+    {
+        // chars above 127 are ordered and found like any other chars
+        const char text[]{'x', '\xe9', '\xff', 'a', '\xe9', '\xff', '\0'};
+        const char part[]{'\xe9', '\xff', '\0'};
+        CHECK(1 == IndexOfText(AsText(text), AsText(part)));
+        CHECK(4 == LastIndexOfText(AsText(text), AsText(part)));
+    }
+
+    {
+        // the search is constexpr
+        static_assert(5 == IndexOfText(AsText("Hello, World"), AsText(", W")));
+        static_assert(8 == LastIndexOfText(AsText("Hello, World"), AsText("or")));
+        static_assert(CLJONIC_INVALID_INDEX == IndexOfText(AsText("Hello, World"), AsText("world")));
+    }
+}
@@ -7,11 +7,22 @@ using namespace cljonic::core;
 int main()
 {
     constexpr auto a{Array<int, 3>{1, 2, 3}};
+    constexpr auto hashmap{HashMap{std::pair{1, 11}, std::pair{2, 12}}};
+    constexpr auto hashset{HashSet{11, 12, 13}};
     constexpr auto rng{Range<1, 5>{}};
     constexpr auto rpt{Repeat{1}};
     constexpr auto set{Set{11, 12, 13}};
+    constexpr auto sortedset{SortedSet{13, 11, 12}};
     constexpr auto str{String{"Hello"}};
+    constexpr auto filterview{FilterView{[](const int i) { return true; }, Range<1, 5>{}}};
+    constexpr auto mapview{MapView{[](const int i) { return i; }, Range<1, 5>{}}};
+    constexpr auto removeview{RemoveView{[](const int i) { return true; }, Range<1, 5>{}}};
+    constexpr auto sliceview{SliceView{Range<1, 5>{}, 1, 3}};
+    constexpr auto spanview{SpanView<int>{}};
+    const auto data{a.Data()};
 
+    constexpr auto arrayof{ArrayOf<3, [](const SizeType i) { return i; }>()};
+    constexpr auto assoc{Assoc(hashmap, 3, 13)};
     constexpr auto compose{Compose(a, a)};
     constexpr auto concat0{Concat()};
     constexpr auto concat1{Concat(a, a)};
@@ -21,19 +32,26 @@ int main()
     constexpr auto dedupe{Dedupe(a)};
     constexpr auto dedupeby{DedupeBy([](const int i, const int j) { return i == j; }, a)};
     constexpr auto defaultelement{DefaultElement(a)};
+    constexpr auto dissoc{Dissoc(hashmap, 1)};
     constexpr auto drop{Drop(1, a)};
+    const auto dropview{DropView(1, a)};
     constexpr auto droplast{DropLast(1, a)};
+    const auto droplastview{DropLastView(1, a)};
     constexpr auto dropwhile{DropWhile([](const int i) { return true; }, a)};
     constexpr auto equal{Equal(a, a)};
     constexpr auto equalby{EqualBy([](const int i, const int j) { return i == j; }, 1, 1, 1, 1)};
     constexpr auto every{Every([](const int i) { return 1 == i; }, a)};
     constexpr auto filter{Filter([](const int i) { return 1 == i; }, a)};
+    constexpr auto filterrange{Filter(IsEven, rng)};
     constexpr auto first{First(a)};
+    constexpr auto freeze{Freeze<[] { return Range<1, 5>{}; }>()};
     constexpr auto identical{Identical(a)};
     const auto identity{Identity(a)};
     constexpr auto inc{Inc(1)};
     constexpr auto indexof{IndexOf(Array{1, 2, 3}, 1)};
     constexpr auto indexofby{IndexOfBy([](const int i, const int j) { return i == j; }, Array{1, 2, 3}, 1)};
+    constexpr auto indexofmax{IndexOfMax(Array{1, 3, 2})};
+    constexpr auto indexofmin{IndexOfMin(Array{2, 1, 3})};
     constexpr auto interleave0{Interleave()};
     constexpr auto interleave1{Interleave(a)};
     constexpr auto interpose{Interpose(1, Array{1, 2, 3})};
@@ -41,13 +59,17 @@ int main()
     constexpr auto isdistinct1{IsDistinct(1, 1, 1)};
     constexpr auto isdistinctby0{IsDistinctBy([](const int i, const int j) { return i == j; }, a)};
     constexpr auto isdistinctby1{IsDistinctBy([](const int i, const int j) { return i == j; }, 1, 1, 1)};
+    constexpr auto iseven{IsEven(2)};
     constexpr auto isempty{IsEmpty(a)};
     constexpr auto isfull{IsFull(a)};
+    constexpr auto isodd{IsOdd(1)};
     constexpr auto iterate{Iterate([](const int i) { return 1 + i; }, 1)};
+    constexpr auto iteratetake{Take(5, iterate)};
     constexpr auto last{Last(a)};
     constexpr auto lastindexof{LastIndexOf(a, 5)};
     constexpr auto lastindexofby{LastIndexOfBy([](const int i, const int j) { return j == i; }, a, 5)};
     constexpr auto map{Map([](const int i) { return 1 == i; }, a)};
+    constexpr auto mapcycle{Map([](const int i, const int j) { return i + j; }, a, cycle)};
     constexpr auto max1{Max(a)};
     constexpr auto max2{Max(4, 1, 5, 3)};
     constexpr auto maxby1{MaxBy([](const int i, const int j) { return i < j; }, a)};
@@ -63,6 +85,8 @@ int main()
     constexpr auto partial{Partial([](const int i, const int j) { return i + j; }, 10)};
     constexpr auto reduce2{Reduce([](const int sum, const int i) { return sum + i; }, a)};
     constexpr auto reduce3{Reduce([](const int sum, const int i) { return sum + i; }, 30, a)};
+    constexpr auto reduce4{Reduce(Plus, a)};
+    constexpr auto reduce5{Reduce(Maximum, 30, a)};
     constexpr auto remove{Remove([](const int i) { return 1 == i; }, a)};
     constexpr auto replace{Replace(a, Array{1, 2, 3, 20})};
     constexpr auto reverse{Reverse(a)};
@@ -73,13 +97,46 @@ int main()
     constexpr auto sort{Sort(a)};
     constexpr auto sortby{SortBy([](const int i, const int j) { return i < j; }, a)};
     constexpr auto splitat{SplitAt(2, a)};
+    const auto splitatview{SplitAtView(2, a)};
     constexpr auto splitwith{SplitWith([](const int i) { return true; }, a)};
+    const auto splitwithview{SplitWithView([](const int i) { return true; }, a)};
+    constexpr auto stablesort{StableSort(a)};
+    constexpr auto stablesortby{StableSortBy([](const int i, const int j) { return i < j; }, a)};
     constexpr auto subs_1{Subs(a, 0, 2)};
     constexpr auto subs_2{Subs(a, 0)};
+    const auto subsview{SubsView(a, 0, 2)};
     constexpr auto take{Take(2, a)};
+    constexpr auto takecycle{Take(5, cycle)};
+    const auto takeview_2{TakeView(2, a)};
+    constexpr auto takeview{Take(2, FilterView{[](const int i) { return true; }, mapview})};
     constexpr auto takelast{TakeLast(2, a)};
+    const auto takelastview{TakeLastView(2, a)};
     constexpr auto takenth{TakeNth(2, a)};
     constexpr auto takewhile{TakeWhile([](const int i) { return true; }, a)};
+    constexpr auto transduce{Transduce(Compose(MapT([](const int i) { return i; }),
+                                               FilterT([](const int i) { return true; }),
+                                               TakeWhileT([](const int i) { return true; }),
+                                               DedupeT<int>(),
+                                               TakeT(2)),
+                                       [](const int i, const int j) { return i + j; },
+                                       0,
+                                       a)};
+    constexpr auto into{Into(Array<int, 3>{}, TakeT(2), a)};
+
+    constexpr auto endswith{string::EndsWith(str, "llo")};
+    constexpr auto includes{string::Includes(str, "ell")};
+    constexpr auto indexofsubstring{string::IndexOfSubstring(str, "ll")};
+    constexpr auto join{string::Join(',', Array{"a", "b"})};
+    constexpr auto lastindexofsubstring{string::LastIndexOfSubstring(str, "l")};
+    constexpr auto parseall{string::ParseAll<int>(String{"1,2"}, ',')};
+    constexpr auto parsefloat{string::ParseFloat("1.5")};
+    const auto parsefloatruntime{string::ParseFloat(str)};
+    constexpr auto parseint{string::ParseInt("12")};
+    constexpr auto stringreplace{string::Replace(str, "l", "L")};
+    const auto split{string::Split(str, 'l')};
+    constexpr auto startswith{string::StartsWith(str, "He")};
+    constexpr auto stringstr{string::Str(1.5)};
+    const auto stringstrruntime{string::Str(parsefloatruntime)};
 
     return 0;
 }
@@ -0,0 +1,92 @@
+#!/usr/bin/env bash
+
+get_current_directory () {
+    pwd
+}
+
+CMAKELISTS_FILE_DIRECTORY=benchmark
+CPU_COUNT=$(scripts/make-cpu-count.sh)
+CURRENT_DIRECTORY=$(get_current_directory)
+LAST_EXIT_CODE=0
+
+create_build_directory () {
+    echo -n "Creating Build Directory ... "
+    rm -rf build 2>/dev/null >/dev/null
+    LAST_EXIT_CODE=$?
+    if [ "$LAST_EXIT_CODE" == "0" ]; then
+        mkdir build 2>/dev/null >/dev/null
+    fi
+    echo "Done"
+}
+
+create_build_system () {
+    echo -n "Creating Build System ... "
+    cp ../cmake/CMakeLists.txt .
+    cat ../cmake/$CMAKELISTS_FILE_DIRECTORY/CMakeLists.txt >> CMakeLists.txt
+    cmake CMakeLists.txt  2>/dev/null >/dev/null
+    echo "Done"
+}
+
+enter_build_directory () {
+    echo -n "Entering Build Directory ... "
+    cd build
+    LAST_EXIT_CODE=$?
+    echo "Done"
+}
+
+execute_cljonic_benchmark_program () {
+    echo "Executing Cljonic Benchmark Program"
+    ./cljonic-benchmark
+    LAST_EXIT_CODE=$?
+}
+
+exit_build_directory () {
+    echo -n "Exiting Build Directory ... "
+    cd $CURRENT_DIRECTORY
+    LAST_EXIT_CODE=$?
+    echo "Done"
+}
+
+handle_error () { # <message>
+    if [ "$LAST_EXIT_CODE" != "0" ]; then
+        echo "***** Error: Could Not $1"
+        exit_build_directory
+        exit 1
+    fi
+}
+
+handle_make_error () { # <message>
+    if [ "$LAST_EXIT_CODE" != "0" ]; then
+        echo "***** Error: Could Not $1"
+        cd $CURRENT_DIRECTORY
+        exit 1
+    fi
+}
+
+make_cljonic_benchmark_program () {
+    echo "Making Cljonic Benchmark Program"
+    echo
+    make -j $CPU_COUNT cljonic-benchmark >/dev/null
+    LAST_EXIT_CODE=$?
+    echo
+    echo "Done"
+}
+
+render_header () {
+    echo
+    echo '========================================'
+    echo '== make benchmark'
+    echo '========================================'
+}
+
+################################################################################
+## Main
+################################################################################
+render_header
+create_build_directory ; handle_error "Create Build Directory"
+enter_build_directory ; handle_error "Enter Build Directory"
+create_build_system ; handle_error "Create Build System"
+make_cljonic_benchmark_program ; handle_make_error "Make Cljonic Benchmark Program"
+execute_cljonic_benchmark_program ; handle_error "Execute Cljonic Benchmark Program"
+exit_build_directory ; handle_error "leave Build Directory"
+exit 0
\ No newline at end of file
@@ -14,13 +14,28 @@ cat cljonic-collection-iterator.hpp \
     cljonic-concepts.hpp \
     cljonic-shared.hpp \
     cljonic-pre-declarations.hpp \
+    cljonic-introsort.hpp \
+    cljonic-mergesort.hpp \
+    cljonic-twowaysearch.hpp \
     cljonic-array.hpp \
+    cljonic-filterview.hpp \
+    cljonic-hashmap.hpp \
+    cljonic-hashset.hpp \
     cljonic-iterator.hpp \
+    cljonic-mapview.hpp \
     cljonic-range.hpp \
     cljonic-repeat.hpp \
     cljonic-set.hpp \
+    cljonic-sliceview.hpp \
+    cljonic-sortedset.hpp \
+    cljonic-spanview.hpp \
     cljonic-string.hpp \
+    cljonic-charconv.hpp \
     cljonic-core.hpp \
+    cljonic-core-reducers.hpp \
+    cljonic-core-iseven.hpp \
+    cljonic-core-isodd.hpp \
+    cljonic-core-assoc.hpp \
     cljonic-core-compose.hpp \
     cljonic-core-concat.hpp \
     cljonic-core-conj.hpp \
@@ -28,7 +43,9 @@ cat cljonic-collection-iterator.hpp \
     cljonic-core-cycle.hpp \
     cljonic-core-dedupe.hpp \
     cljonic-core-dedupeby.hpp \
+    cljonic-core-dedupet.hpp \
     cljonic-core-defaultelement.hpp \
+    cljonic-core-dissoc.hpp \
     cljonic-core-drop.hpp \
     cljonic-core-droplast.hpp \
     cljonic-core-dropwhile.hpp \
@@ -36,14 +53,19 @@ cat cljonic-collection-iterator.hpp \
     cljonic-core-equalby.hpp \
     cljonic-core-every.hpp \
     cljonic-core-filter.hpp \
+    cljonic-core-filtert.hpp \
     cljonic-core-first.hpp \
+    cljonic-core-freeze.hpp \
     cljonic-core-identical.hpp \
     cljonic-core-identity.hpp \
     cljonic-core-inc.hpp \
     cljonic-core-indexof.hpp \
     cljonic-core-indexofby.hpp \
+    cljonic-core-indexofmax.hpp \
+    cljonic-core-indexofmin.hpp \
     cljonic-core-interleave.hpp \
     cljonic-core-interpose.hpp \
+    cljonic-core-into.hpp \
     cljonic-core-isdistinct.hpp \
     cljonic-core-isdistinctby.hpp \
     cljonic-core-isempty.hpp \
@@ -53,6 +75,7 @@ cat cljonic-collection-iterator.hpp \
     cljonic-core-lastindexof.hpp \
     cljonic-core-lastindexofby.hpp \
     cljonic-core-map.hpp \
+    cljonic-core-mapt.hpp \
     cljonic-core-max.hpp \
     cljonic-core-maxby.hpp \
     cljonic-core-min.hpp \
@@ -73,11 +96,28 @@ cat cljonic-collection-iterator.hpp \
     cljonic-core-sortby.hpp \
     cljonic-core-splitat.hpp \
     cljonic-core-splitwith.hpp \
+    cljonic-core-stablesort.hpp \
+    cljonic-core-stablesortby.hpp \
     cljonic-core-subs.hpp \
     cljonic-core-take.hpp \
     cljonic-core-takelast.hpp \
     cljonic-core-takenth.hpp \
-    cljonic-core-takewhile.hpp > /tmp/cljonic-glued.hpp
+    cljonic-core-taket.hpp \
+    cljonic-core-takewhile.hpp \
+    cljonic-core-takewhilet.hpp \
+    cljonic-core-transduce.hpp \
+    cljonic-string-endswith.hpp \
+    cljonic-string-includes.hpp \
+    cljonic-string-indexofsubstring.hpp \
+    cljonic-string-join.hpp \
+    cljonic-string-lastindexofsubstring.hpp \
+    cljonic-string-parseall.hpp \
+    cljonic-string-parsefloat.hpp \
+    cljonic-string-parseint.hpp \
+    cljonic-string-replace.hpp \
+    cljonic-string-split.hpp \
+    cljonic-string-startswith.hpp \
+    cljonic-string-str.hpp > /tmp/cljonic-glued.hpp
 
 # remove all the comments
 g++ -fpreprocessed -dD -E -o /tmp/cljonic.hpp /tmp/cljonic-glued.hpp